@@ -99,6 +99,8 @@ set(ob_close_deps_static_name "")
 if (OB_BUILD_OPENSOURCE)
   # 开源模式
   set(OB_BUILD_CLOSE_MODULES OFF)
+  # 日志存储压缩, 使用src/logservice/ob_log_compression.cpp
+  ob_define(OB_BUILD_LOG_STORAGE_COMPRESS ON)
 else()
   # 闭源模式
   set(OB_BUILD_CLOSE_MODULES ON)
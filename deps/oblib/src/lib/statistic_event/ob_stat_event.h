@@ -197,6 +197,8 @@ STAT_EVENT_ADD_DEF(SQL_LOCAL_TIME, "sql local execute time", ObStatClassIds::SQL
 STAT_EVENT_ADD_DEF(SQL_REMOTE_TIME, "sql remote execute time", ObStatClassIds::SQL, 40117, false, true, true)
 STAT_EVENT_ADD_DEF(SQL_DISTRIBUTED_TIME, "sql distributed execute time", ObStatClassIds::SQL, 40118, false, true, true)
 STAT_EVENT_ADD_DEF(SQL_FAIL_COUNT, "sql fail count", ObStatClassIds::SQL, 40119, false, true, true)
+STAT_EVENT_ADD_DEF(SQL_SPILL_COMPRESS_RAW_BYTES, "sql spill compress raw bytes", ObStatClassIds::SQL, 40120, false, true, true)
+STAT_EVENT_ADD_DEF(SQL_SPILL_COMPRESSED_BYTES, "sql spill compressed bytes", ObStatClassIds::SQL, 40121, false, true, true)
 
 // CACHE
 STAT_EVENT_ADD_DEF(ROW_CACHE_HIT, "row cache hit", ObStatClassIds::CACHE, 50000, true, true, true)
@@ -268,6 +270,11 @@ STAT_EVENT_ADD_DEF(OPT_SYSTEM_STAT_CACHE_MISS, "opt system stat cache miss", ObS
 
 STAT_EVENT_ADD_DEF(LOG_KV_CACHE_HIT, "log kv cache hit", ObStatClassIds::CACHE, 50065, false, true, true)
 STAT_EVENT_ADD_DEF(LOG_KV_CACHE_MISS, "log kv cache miss", ObStatClassIds::CACHE, 50066, false, true, true)
+STAT_EVENT_ADD_DEF(BLOCK_SECONDARY_CACHE_HIT, "block secondary cache hit", ObStatClassIds::CACHE, 50067, true, true, true)
+STAT_EVENT_ADD_DEF(BLOCK_SECONDARY_CACHE_MISS, "block secondary cache miss", ObStatClassIds::CACHE, 50068, true, true, true)
+STAT_EVENT_ADD_DEF(BLOCK_SECONDARY_CACHE_WRITE_COUNT, "block secondary cache write count", ObStatClassIds::CACHE, 50069, true, true, true)
+STAT_EVENT_ADD_DEF(BLOCK_SECONDARY_CACHE_WRITE_SIZE, "block secondary cache write size", ObStatClassIds::CACHE, 50070, true, true, true)
+STAT_EVENT_ADD_DEF(BLOCK_SECONDARY_CACHE_DROP_COUNT, "block secondary cache drop count", ObStatClassIds::CACHE, 50071, true, true, true)
 
 // STORAGE
 STAT_EVENT_ADD_DEF(MEMSTORE_LOGICAL_READS, "MEMSTORE_LOGICAL_READS", STORAGE, "MEMSTORE_LOGICAL_READS", true, true, false)
@@ -344,6 +351,8 @@ STAT_EVENT_ADD_DEF(PUSHDOWN_STORAGE_FILTER_ROW_CNT, "storage filtered row count"
 STAT_EVENT_ADD_DEF(MINOR_SSSTORE_READ_ROW_COUNT, "minor ssstore read row count", ObStatClassIds::STORAGE, 60091, true, true, true)
 STAT_EVENT_ADD_DEF(MAJOR_SSSTORE_READ_ROW_COUNT, "major ssstore read row count", ObStatClassIds::STORAGE, 60092, true, true, true)
 STAT_EVENT_ADD_DEF(STORAGE_WRITING_THROTTLE_TIME, "storage waiting throttle time", ObStatClassIds::STORAGE, 60093, true, true, true)
+STAT_EVENT_ADD_DEF(COLUMNAR_FILTER_ROW_CNT, "columnar filter decoded row count", ObStatClassIds::STORAGE, 60094, true, true, true)
+STAT_EVENT_ADD_DEF(COLUMNAR_PROJECT_ROW_CNT, "columnar project decoded row count", ObStatClassIds::STORAGE, 60095, true, true, true)
 
 // backup & restore
 STAT_EVENT_ADD_DEF(BACKUP_IO_READ_COUNT, "backup io read count", ObStatClassIds::STORAGE, 69000, true, true, true)
@@ -21,7 +21,7 @@ ObLockWaitNode::ObLockWaitNode() :
   hold_key_(0), need_wait_(false), request_stat_(), addr_(NULL), recv_ts_(0), lock_ts_(0), lock_seq_(0),
   abs_timeout_(0), tablet_id_(common::OB_INVALID_ID), try_lock_times_(0), sessid_(0),
   holder_sessid_(0), block_sessid_(0), tx_id_(0), holder_tx_id_(0), run_ts_(0),
-  is_standalone_task_(false), last_compact_cnt_(0), total_update_cnt_(0) {}
+  is_standalone_task_(false), last_compact_cnt_(0), total_update_cnt_(0), row_hash_(0) {}
 
 void ObLockWaitNode::set(void *addr,
                          int64_t hash,
@@ -50,6 +50,7 @@ void ObLockWaitNode::set(void *addr,
   last_compact_cnt_ = last_compact_cnt,
   total_update_cnt_ = total_trans_node_cnt;
   run_ts_ = 0;
+  row_hash_ = 0;
   snprintf(key_, sizeof(key_), "%s", key);
   reset_need_wait();
 }
@@ -121,6 +121,7 @@ struct ObLockWaitNode: public common::SpHashNode
            int64_t holder_tx_id,
            const share::ObLSID &ls_id);
   void change_hash(const int64_t hash, const int64_t lock_seq);
+  void set_row_hash(const uint64_t row_hash) { row_hash_ = row_hash; }
   void update_run_ts(const int64_t run_ts) { run_ts_ = run_ts; }
   int64_t get_run_ts() const { return run_ts_; }
   int compare(ObLockWaitNode* that);
@@ -150,6 +151,7 @@ struct ObLockWaitNode: public common::SpHashNode
                K_(request_stat),
                KP_(addr),
                K_(hash),
+               K_(row_hash),
                K_(lock_ts),
                K_(lock_seq),
                K_(abs_timeout),
@@ -191,6 +193,9 @@ struct ObLockWaitNode: public common::SpHashNode
   bool is_standalone_task_;
   int64_t last_compact_cnt_;
   int64_t total_update_cnt_;
+  // the hash of the conflict row, which is kept when the request waits on the
+  // txn of the row holder
+  uint64_t row_hash_;
 };
 
 
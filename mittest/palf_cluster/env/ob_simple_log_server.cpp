@@ -235,6 +235,8 @@ int ObSimpleLogServer::init_io_(const std::string &cluster_name)
   return ret;
 }
 
+int64_t ObSimpleLogServer::log_writer_parallelism_ = 0;
+
 int ObSimpleLogServer::init_log_service_(const std::string &cluster_name)
 {
   int ret = OB_SUCCESS;
@@ -248,7 +250,7 @@ int ObSimpleLogServer::init_log_service_(const std::string &cluster_name)
   opts.disk_options_.log_disk_utilization_limit_threshold_ = 95;
   opts.disk_options_.log_disk_throttling_percentage_ = 100;
   opts.disk_options_.log_disk_throttling_maximum_duration_ = 2 * 3600 * 1000 * 1000L;
-  opts.disk_options_.log_writer_parallelism_ = 2;
+  opts.disk_options_.log_writer_parallelism_ = (log_writer_parallelism_ > 0) ? log_writer_parallelism_ : 2;
 
   std::string clog_dir = clog_dir_ + "/tenant_1";
   allocator_ = OB_NEW(ObTenantMutilAllocator, "TestBase", node_id_);
@@ -258,13 +260,39 @@ int ObSimpleLogServer::init_log_service_(const std::string &cluster_name)
   if (OB_FAIL(log_service_.init(opts, clog_dir.c_str(), addr_,
       allocator_, transport_, &log_block_pool_))) {
     SERVER_LOG(ERROR, "init_log_service_ fail", K(ret));
+  } else if (FALSE_IT(palf_env_ = log_service_.get_palf_env())) {
+  } else if (log_writer_parallelism_ > 0 && OB_FAIL(init_log_io_workers_(log_writer_parallelism_))) {
+    SERVER_LOG(ERROR, "init_log_io_workers_ fail", K(ret), K(log_writer_parallelism_));
   } else {
-    palf_env_ = log_service_.get_palf_env();
     SERVER_LOG(INFO, "init_log_service_ success", K(ret));
   }
   return ret;
 }
 
+// log_writer_parallelism only takes effect for user tenants, while the bench runs as sys tenant,
+// therefore, recreate LogIOWorkers as a user tenant does: | sys log ioworker | others |.
+int ObSimpleLogServer::init_log_io_workers_(const int64_t log_writer_parallelism)
+{
+  int ret = OB_SUCCESS;
+  const int64_t mock_user_tenant_id = 1002;
+  PalfEnvImpl *palf_env_impl = &palf_env_->palf_env_impl_;
+  LogIOWorkerWrapper &log_iow_wrapper = palf_env_impl->log_io_worker_wrapper_;
+  LogIOWorkerConfig config;
+  if (OB_FAIL(palf_env_impl->init_log_io_worker_config_(log_writer_parallelism, mock_user_tenant_id, config))) {
+    SERVER_LOG(ERROR, "init_log_io_worker_config_ fail", K(ret), K(log_writer_parallelism));
+  } else if (FALSE_IT(log_iow_wrapper.destory_and_free_log_io_workers_())) {
+  } else if (OB_FAIL(log_iow_wrapper.create_and_init_log_io_workers_(config, node_id_,
+      palf_env_impl->cb_thread_pool_.get_tg_id(), palf_env_impl->log_alloc_mgr_, palf_env_impl))) {
+    SERVER_LOG(ERROR, "create_and_init_log_io_workers_ fail", K(ret), K(config));
+  } else {
+    palf_env_impl->log_io_worker_config_ = config;
+    log_iow_wrapper.log_writer_parallelism_ = config.io_worker_num_;
+    log_iow_wrapper.is_user_tenant_ = true;
+    SERVER_LOG(INFO, "init_log_io_workers_ success", K(ret), K(config), K(log_iow_wrapper));
+  }
+  return ret;
+}
+
 int ObSimpleLogServer::simple_start(const bool is_bootstrap = false)
 {
   int ret = OB_SUCCESS;
@@ -205,10 +205,15 @@ public:
   void set_rpc_loss(const ObAddr &src, const int loss_rate) { deliver_.set_rpc_loss(src, loss_rate); }
   void reset_rpc_loss(const ObAddr &src) { deliver_.reset_rpc_loss(src); }
   TO_STRING_KV(K_(node_id), K_(addr), KP(palf_env_));
+public:
+  // the number of LogIOWorkers for user log streams, 0 means keeping the default of the bench
+  // tenant (sys tenant, only one LogIOWorker).
+  static int64_t log_writer_parallelism_;
 protected:
   int init_io_(const std::string &cluster_name);
   int init_network_(const common::ObAddr &addr, const bool is_bootstrap);
   int init_log_service_(const std::string &cluster_name);
+  int init_log_io_workers_(const int64_t log_writer_parallelism);
   int init_memory_dump_timer_();
 
 private:
@@ -63,22 +63,24 @@ EOF
 
 # thread_num
 # log_size
+# palf_group_number, optional
+# log_writer_parallelism, optional
 function startserver
 {
 ssh $USERNAME@$TEST_MACHINE1 bash -s << EOF
     export LD_LIBRARY_PATH=$TARGET_PATH;
     cd $TARGET_PATH;
-    ./test_palf_bench_server $1 $2 > /dev/null 2>&1 &
+    ./test_palf_bench_server $1 $2 $3 $4 > /dev/null 2>&1 &
 EOF
 ssh $USERNAME@$TEST_MACHINE2 bash -s << EOF
     export LD_LIBRARY_PATH=$TARGET_PATH;
     cd $TARGET_PATH;
-    ./test_palf_bench_server $1 $2 > /dev/null 2>&1 &
+    ./test_palf_bench_server $1 $2 $3 $4 > /dev/null 2>&1 &
 EOF
 ssh $USERNAME@$TEST_MACHINE3 bash -s << EOF
     export LD_LIBRARY_PATH=$TARGET_PATH;
     cd $TARGET_PATH;
-    ./test_palf_bench_server $1 $2 > /dev/null 2>&1 &
+    ./test_palf_bench_server $1 $2 $3 $4 > /dev/null 2>&1 &
 EOF
   sleep 5
   echo "startserver success"
@@ -163,12 +165,13 @@ EOF
 # $4 replica_num
 # $5 freeze_us
 # $6 exp1,exp2
+# $7 log_writer_parallelism, optional
 function run_experiment_once
 {
   send_server_binary
-  echo "start experiment: "$6", thread_num: " $1 "log_size: " $2 " freeze_us: " $5
+  echo "start experiment: "$6", thread_num: " $1 "log_size: " $2 " freeze_us: " $5 " log_writer_parallelism: " $7
   kill_server_process
-  startserver $1 $2
+  startserver $1 $2 $3 $7
   ./test_palf_bench_client $1 $2 $3 $4
   sleep 20
   kill_server_process
@@ -244,6 +247,45 @@ EOF
   generate_result $1 $2 $4 $5 $6
 }
 
+# $1 thread_number
+# $2 nbytes
+# $3 replica_num
+# $4 freeze_us
+# $5 experiment name
+# sum up l_log_size of all LogIOWorkers per second, print the average write bandwidth of the leader
+function summarize_io_result
+{
+result_dir_name="palf_raw_result_"$5
+io_result_name=$result_dir_name"/palf_io_"$1"_"$2"_"$3"_"$4".result"
+
+ssh $USERNAME@$TEST_MACHINE1 bash -s << EOF
+    cd $TARGET_PATH;
+    sed -n 's/^\[\([^.]*\)\..*l_log_size=\([0-9]*\).*/\1 \2/p' $io_result_name | \
+    awk '{bytes[\$1 " " \$2]+=\$3} END {n=0; total=0; for (ts in bytes) {n++; total+=bytes[ts]}; \
+         if (n > 0) printf("$5: io_seconds=%d, avg_bw=%.2fMB/s\n", n, total/n/1024/1024)}';
+EOF
+}
+
+# scale LogIOWorkers of the tenant from 1 to 16, palf groups are sharded over LogIOWorkers
+# by palf_id, so use enough palf groups to keep every LogIOWorker busy.
+function experiment_log_writer_parallelism
+{
+  thread_num=1500
+  log_size=512
+  palf_group_number=32
+  log_writer_parallelism_array=(1 2 4 8 16)
+
+  run_round=1
+  for log_writer_parallelism in ${log_writer_parallelism_array[@]}
+  do
+    exp_name=exp_log_writer_parallelism_$log_writer_parallelism
+    echo "start run experiment_log_writer_parallelism, round: " $run_round ", log_writer_parallelism: " $log_writer_parallelism
+    run_experiment_once $thread_num $log_size $palf_group_number 3 1000 $exp_name $log_writer_parallelism
+    summarize_io_result $thread_num $log_size 3 1000 $exp_name
+    let run_round++
+  done;
+}
+
 function experiment1
 {
   log_size_array=(32 64 128 256 512 1024 2048 4096 8192)
@@ -358,6 +400,7 @@ function main
   # experiment4
   # experiment1_less_clients
   # experiment5
+  # experiment_log_writer_parallelism
   run_experiment_once 1500 512 1 3 1000 exp_test
 }
 
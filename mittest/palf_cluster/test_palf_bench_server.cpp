@@ -18,6 +18,7 @@
 #include "lib/utility/utility.h"
 #include <cstdio>
 #include <signal.h>
+#include <thread>
 #include "lib/utility/ob_defer.h"
 #include "share/ob_errno.h"
 #define private public
@@ -61,19 +62,15 @@ public:
     server_list_.push_back(server3);
   }
 
-  int local_submit_log(const int64_t thread_num, const int64_t log_size)
+  int wait_for_leader(const int64_t palf_id, palfcluster::ObLogClient *&log_client)
   {
     int ret = OB_SUCCESS;
     palfcluster::LogService *log_service = get_log_server()->get_log_service();
-    obrpc::PalfClusterRpcProxy *rpc_proxy = NULL;
-    const int64_t RPC_TIMEOUT_US = 500 * 1000 * 1000;
     palfcluster::LogClientMap *log_clients = nullptr;
-    palfcluster::ObLogClient *log_client;
-    int64_t palf_id = 1;
     const share::ObLSID ls_id(palf_id);
-    ObAddr self;
 
     if (OB_ISNULL(log_service)) {
+      ret = OB_ERR_UNEXPECTED;
       CLOG_LOG(ERROR, "get_log_service failed");
     } else if (nullptr == (log_clients = log_service->get_log_client_map())) {
       ret = OB_ERR_UNEXPECTED;
@@ -89,18 +86,45 @@ public:
         } else if (OB_FAIL(log_client->get_log_handler()->get_role(role, unused_id))) {
           CLOG_LOG(ERROR, "get_role fail", K(palf_id));
         } else if (role == ObRole::LEADER) {
-          break;
           CLOG_LOG(ERROR, "switch_to_leader success", K(palf_id));
+          break;
         } else {
           usleep(100* 1000);
         }
       }
+    }
+    return ret;
+  }
 
-      if (OB_FAIL(log_client->submit_append_log_task(thread_num, log_size))) {
-        CLOG_LOG(ERROR, "submit_log failed", K(ret));
+  // palf groups created by the client are numbered from 1 to palf_group_number, and they are
+  // sharded over LogIOWorkers by palf_id, so submitting to all of them keeps every worker busy.
+  int local_submit_log(const int64_t thread_num, const int64_t log_size, const int64_t palf_group_number)
+  {
+    int ret = OB_SUCCESS;
+    const int64_t thread_num_per_group = MAX(1, thread_num / palf_group_number);
+    std::vector<palfcluster::ObLogClient *> log_client_list;
+    std::vector<std::thread> submit_threads;
+
+    for (int64_t palf_id = 1; OB_SUCC(ret) && palf_id <= palf_group_number; palf_id++) {
+      palfcluster::ObLogClient *log_client = nullptr;
+      if (OB_FAIL(wait_for_leader(palf_id, log_client))) {
+        CLOG_LOG(ERROR, "wait_for_leader failed", K(ret), K(palf_id));
+      } else {
+        log_client_list.push_back(log_client);
       }
     }
-    PALF_LOG(INFO, "end test_palf_bench");
+    for (palfcluster::ObLogClient *log_client : log_client_list) {
+      submit_threads.emplace_back([log_client, thread_num_per_group, log_size]() {
+        int tmp_ret = OB_SUCCESS;
+        if (OB_SUCCESS != (tmp_ret = log_client->submit_append_log_task(thread_num_per_group, log_size))) {
+          CLOG_LOG_RET(ERROR, tmp_ret, "submit_log failed", K(tmp_ret));
+        }
+      });
+    }
+    for (std::thread &submit_thread : submit_threads) {
+      submit_thread.join();
+    }
+    PALF_LOG(INFO, "end test_palf_bench", K(thread_num), K(log_size), K(palf_group_number));
 
     LOG_STDOUT("submit_log success\n");
     return ret;
@@ -115,7 +139,9 @@ TEST_F(TestPalfClusterBenchServer, multiple_replica)
   int ret = OB_SUCCESS;
   OB_LOGGER.set_log_level("WDIAG");
   // server mode
-  if (OB_FAIL(local_submit_log(oceanbase::unittest::thread_num_arg, oceanbase::unittest::nbytes_arg))) {
+  if (OB_FAIL(local_submit_log(oceanbase::unittest::thread_num_arg,
+                               oceanbase::unittest::nbytes_arg,
+                               oceanbase::unittest::palf_group_number_arg))) {
     CLOG_LOG(ERROR, "local_submit_log failed");
   }
   while (true) {
@@ -140,5 +166,11 @@ int main(int argc, char **argv)
     oceanbase::unittest::thread_num_arg = strtol(argv[1], NULL, 10);
     oceanbase::unittest::nbytes_arg = strtol(argv[2], NULL, 10);
   }
+  if (argc > 3) {
+    oceanbase::unittest::palf_group_number_arg = strtol(argv[3], NULL, 10);
+  }
+  if (argc > 4) {
+    oceanbase::unittest::ObSimpleLogServer::log_writer_parallelism_ = strtol(argv[4], NULL, 10);
+  }
   RUN_SIMPLE_LOG_CLUSTER_TEST(TEST_NAME);
 }
\ No newline at end of file
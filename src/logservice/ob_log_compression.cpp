@@ -0,0 +1,339 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_log_compression.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "common/ob_clock_generator.h"
+#include "share/allocator/ob_tenant_mutil_allocator.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+#include "share/ob_cluster_version.h"
+#include "ob_log_base_header.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace logservice
+{
+LogCompressedPayloadHeader::LogCompressedPayloadHeader()
+{
+  reset();
+}
+
+LogCompressedPayloadHeader::LogCompressedPayloadHeader(const ObCompressorType compressor_type,
+                                                       const int64_t original_len)
+    : magic_(COMPRESSED_PAYLOAD_HEADER_MAGIC),
+      version_(COMPRESSED_PAYLOAD_HEADER_VERSION),
+      compressor_type_(static_cast<int32_t>(compressor_type)),
+      original_len_(original_len)
+{
+}
+
+LogCompressedPayloadHeader::~LogCompressedPayloadHeader()
+{
+  reset();
+}
+
+void LogCompressedPayloadHeader::reset()
+{
+  magic_ = 0;
+  version_ = 0;
+  compressor_type_ = static_cast<int32_t>(INVALID_COMPRESSOR);
+  original_len_ = 0;
+}
+
+bool LogCompressedPayloadHeader::is_valid() const
+{
+  return COMPRESSED_PAYLOAD_HEADER_MAGIC == magic_
+         && COMPRESSED_PAYLOAD_HEADER_VERSION == version_
+         && compressor_type_ > static_cast<int32_t>(NONE_COMPRESSOR)
+         && compressor_type_ < static_cast<int32_t>(MAX_COMPRESSOR)
+         && original_len_ > 0;
+}
+
+ObCompressorType LogCompressedPayloadHeader::get_compressor_type() const
+{
+  return static_cast<ObCompressorType>(compressor_type_);
+}
+
+int64_t LogCompressedPayloadHeader::get_original_len() const
+{
+  return original_len_;
+}
+
+DEFINE_SERIALIZE(LogCompressedPayloadHeader)
+{
+  int ret = OB_SUCCESS;
+  if ((OB_ISNULL(buf)) || (buf_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    CLOG_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  } else if (OB_FAIL(serialization::encode_i16(buf, buf_len, pos, magic_))) {
+    CLOG_LOG(WARN, "serialize magic_ failed", K(ret), KP(buf), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i16(buf, buf_len, pos, version_))) {
+    CLOG_LOG(WARN, "serialize version_ failed", K(ret), KP(buf), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i32(buf, buf_len, pos, compressor_type_))) {
+    CLOG_LOG(WARN, "serialize compressor_type_ failed", K(ret), KP(buf), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, original_len_))) {
+    CLOG_LOG(WARN, "serialize original_len_ failed", K(ret), KP(buf), K(buf_len), K(pos));
+  }
+  return ret;
+}
+
+DEFINE_DESERIALIZE(LogCompressedPayloadHeader)
+{
+  int ret = OB_SUCCESS;
+  if ((OB_ISNULL(buf)) || (data_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    CLOG_LOG(WARN, "invalid argument", K(ret), KP(buf), K(data_len));
+  } else if (OB_FAIL(serialization::decode_i16(buf, data_len, pos, &magic_))) {
+    CLOG_LOG(WARN, "deserialize magic_ failed", K(ret), KP(buf), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i16(buf, data_len, pos, &version_))) {
+    CLOG_LOG(WARN, "deserialize version_ failed", K(ret), KP(buf), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i32(buf, data_len, pos, &compressor_type_))) {
+    CLOG_LOG(WARN, "deserialize compressor_type_ failed", K(ret), KP(buf), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &original_len_))) {
+    CLOG_LOG(WARN, "deserialize original_len_ failed", K(ret), KP(buf), K(data_len), K(pos));
+  } else if (OB_UNLIKELY(!is_valid())) {
+    ret = OB_INVALID_DATA;
+    CLOG_LOG(WARN, "invalid LogCompressedPayloadHeader", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+DEFINE_GET_SERIALIZE_SIZE(LogCompressedPayloadHeader)
+{
+  int64_t size = 0;
+  size += serialization::encoded_length_i16(magic_);
+  size += serialization::encoded_length_i16(version_);
+  size += serialization::encoded_length_i32(compressor_type_);
+  size += serialization::encoded_length_i64(original_len_);
+  return size;
+}
+
+int decompress(const char *in_buf,
+               const int64_t in_len,
+               char *out_buf,
+               const int64_t out_buf_len,
+               int64_t &decompressed_len)
+{
+  int ret = OB_SUCCESS;
+  LogCompressedPayloadHeader header;
+  ObCompressor *compressor = NULL;
+  int64_t pos = 0;
+  decompressed_len = 0;
+  if (OB_ISNULL(in_buf) || OB_UNLIKELY(in_len <= 0) || OB_ISNULL(out_buf) || OB_UNLIKELY(out_buf_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    CLOG_LOG(WARN, "invalid argument", K(ret), KP(in_buf), K(in_len), KP(out_buf), K(out_buf_len));
+  } else if (OB_FAIL(header.deserialize(in_buf, in_len, pos))) {
+    CLOG_LOG(WARN, "failed to deserialize LogCompressedPayloadHeader", K(ret), K(in_len));
+  } else if (OB_UNLIKELY(out_buf_len < header.get_original_len())) {
+    ret = OB_BUF_NOT_ENOUGH;
+    CLOG_LOG(WARN, "decompression buf is not enough", K(ret), K(header), K(out_buf_len));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(header.get_compressor_type(),
+                                                                     compressor))) {
+    CLOG_LOG(WARN, "failed to get compressor", K(ret), K(header));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    CLOG_LOG(WARN, "compressor is NULL", K(ret), K(header));
+  } else if (OB_FAIL(compressor->decompress(in_buf + pos, in_len - pos, out_buf,
+                                            out_buf_len, decompressed_len))) {
+    CLOG_LOG(WARN, "failed to decompress", K(ret), K(header), K(in_len), K(out_buf_len));
+  }
+  return ret;
+}
+
+ObLogCompressorWrapper::ObLogCompressorWrapper()
+    : is_inited_(false),
+      id_(-1),
+      alloc_mgr_(NULL),
+      is_enabled_(false),
+      compressor_(NULL),
+      last_refresh_ts_(OB_INVALID_TIMESTAMP)
+{
+}
+
+ObLogCompressorWrapper::~ObLogCompressorWrapper()
+{
+  reset();
+}
+
+int ObLogCompressorWrapper::init(const int64_t id, ObILogAllocator *alloc_mgr)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    CLOG_LOG(WARN, "ObLogCompressorWrapper init twice", K(ret), K(id));
+  } else if (OB_ISNULL(alloc_mgr)) {
+    ret = OB_INVALID_ARGUMENT;
+    CLOG_LOG(WARN, "invalid argument", K(ret), K(id), KP(alloc_mgr));
+  } else {
+    id_ = id;
+    alloc_mgr_ = alloc_mgr;
+    is_enabled_ = false;
+    compressor_ = NULL;
+    last_refresh_ts_ = OB_INVALID_TIMESTAMP;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+bool ObLogCompressorWrapper::is_valid() const
+{
+  return is_inited_ && NULL != alloc_mgr_;
+}
+
+void ObLogCompressorWrapper::reset()
+{
+  is_inited_ = false;
+  id_ = -1;
+  alloc_mgr_ = NULL;
+  is_enabled_ = false;
+  compressor_ = NULL;
+  last_refresh_ts_ = OB_INVALID_TIMESTAMP;
+}
+
+int ObLogCompressorWrapper::compress_payload(const void *buffer,
+                                             const int64_t nbytes,
+                                             void *&compression_buf,
+                                             bool &log_compressed,
+                                             const void *&final_buf,
+                                             int64_t &final_nbytes)
+{
+  int ret = OB_SUCCESS;
+  char *buf = NULL;
+  int64_t compressed_nbytes = 0;
+  ObCompressor *compressor = NULL;
+  log_compressed = false;
+  final_buf = buffer;
+  final_nbytes = nbytes;
+  if (IS_NOT_INIT) {
+  } else if (FALSE_IT(refresh_config_())) {
+  } else if (!ATOMIC_LOAD(&is_enabled_) || OB_ISNULL(compressor = ATOMIC_LOAD(&compressor_))) {
+  } else if (OB_ISNULL(buffer) || OB_UNLIKELY(nbytes <= MIN_COMPRESS_PAYLOAD_LEN)) {
+  } else if (OB_FAIL(do_compress_(static_cast<const char *>(buffer), nbytes, compressor,
+                                  buf, compressed_nbytes))) {
+    if (REACH_TIME_INTERVAL(2 * 1000 * 1000L)) {
+      CLOG_LOG(WARN, "failed to compress log, append the original log", K(ret), K(nbytes), KPC(this));
+    }
+  } else if (OB_NOT_NULL(buf)) {
+    compression_buf = buf;
+    log_compressed = true;
+    final_buf = buf;
+    final_nbytes = compressed_nbytes;
+  }
+  // the original log is appended if it is not compressed
+  return OB_SUCCESS;
+}
+
+void ObLogCompressorWrapper::free_compression_buf(void *&compression_buf)
+{
+  if (OB_NOT_NULL(compression_buf) && OB_NOT_NULL(alloc_mgr_)) {
+    alloc_mgr_->free_append_compression_buf(compression_buf);
+  }
+  compression_buf = NULL;
+}
+
+// compression_buf stays NULL if the log is not worth compressing, such as the
+// log which needs the pre replay barrier(replay does not decompress it) and
+// the log which is not shorter after compression
+int ObLogCompressorWrapper::do_compress_(const char *buffer,
+                                         const int64_t nbytes,
+                                         ObCompressor *compressor,
+                                         char *&compression_buf,
+                                         int64_t &compressed_nbytes)
+{
+  int ret = OB_SUCCESS;
+  ObLogBaseHeader base_header;
+  int64_t base_header_len = 0;
+  int64_t payload_len = 0;
+  int64_t max_overflow_size = 0;
+  int64_t buf_len = 0;
+  int64_t pos = 0;
+  int64_t compressed_payload_len = 0;
+  char *buf = NULL;
+  compression_buf = NULL;
+  compressed_nbytes = 0;
+  if (OB_FAIL(base_header.deserialize(buffer, nbytes, base_header_len))) {
+    CLOG_LOG(WARN, "failed to deserialize ObLogBaseHeader", K(ret), K(nbytes));
+  } else if (base_header.is_compressed() || base_header.need_pre_replay_barrier()) {
+  } else if (FALSE_IT(payload_len = nbytes - base_header_len)) {
+  } else if (payload_len <= MIN_COMPRESS_PAYLOAD_LEN) {
+  } else {
+    LogCompressedPayloadHeader payload_header(compressor->get_compressor_type(), payload_len);
+    const int64_t payload_header_len = payload_header.get_serialize_size();
+    if (OB_FAIL(compressor->get_max_overflow_size(payload_len, max_overflow_size))) {
+      CLOG_LOG(WARN, "failed to get max overflow size", K(ret), K(payload_len));
+    } else if (FALSE_IT(buf_len = base_header_len + payload_header_len + payload_len + max_overflow_size)) {
+    } else if (OB_ISNULL(buf = static_cast<char *>(alloc_mgr_->alloc_append_compression_buf(buf_len)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else if (FALSE_IT(base_header.set_compressed())) {
+    } else if (OB_FAIL(base_header.serialize(buf, buf_len, pos))) {
+      CLOG_LOG(WARN, "failed to serialize ObLogBaseHeader", K(ret), K(base_header));
+    } else if (OB_FAIL(payload_header.serialize(buf, buf_len, pos))) {
+      CLOG_LOG(WARN, "failed to serialize LogCompressedPayloadHeader", K(ret), K(payload_header));
+    } else if (OB_FAIL(compressor->compress(buffer + base_header_len, payload_len, buf + pos,
+                                            buf_len - pos, compressed_payload_len))) {
+      CLOG_LOG(WARN, "failed to compress payload", K(ret), K(payload_len), K(buf_len), K(pos));
+    } else if (pos + compressed_payload_len < nbytes) {
+      compression_buf = buf;
+      compressed_nbytes = pos + compressed_payload_len;
+      buf = NULL;
+    }
+    if (OB_NOT_NULL(buf)) {
+      alloc_mgr_->free_append_compression_buf(buf);
+      buf = NULL;
+    }
+  }
+  return ret;
+}
+
+void ObLogCompressorWrapper::refresh_config_()
+{
+  int ret = OB_SUCCESS;
+  const int64_t last_refresh_ts = ATOMIC_LOAD(&last_refresh_ts_);
+  const int64_t cur_ts = ObClockGenerator::getClock();
+  if (OB_UNLIKELY(cur_ts - last_refresh_ts > REFRESH_INTERVAL)
+      && ATOMIC_BCAS(&last_refresh_ts_, last_refresh_ts, cur_ts)) {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    ObCompressor *compressor = NULL;
+    uint64_t tenant_data_version = 0;
+    if (!tenant_config.is_valid()) {
+      // keep the current config
+    } else if (!tenant_config->log_storage_compress_all) {
+      ATOMIC_STORE(&is_enabled_, false);
+    } else if (OB_FAIL(GET_MIN_DATA_VERSION(MTL_ID(), tenant_data_version))) {
+      ATOMIC_STORE(&is_enabled_, false);
+      CLOG_LOG(WARN, "get tenant data version failed", K(ret), K_(id));
+    } else if (tenant_data_version < DATA_VERSION_4_3_3_0) {
+      // the replicas of lower version can not decompress the log
+      ATOMIC_STORE(&is_enabled_, false);
+      if (REACH_TIME_INTERVAL(60 * 1000 * 1000L)) {
+        CLOG_LOG(INFO, "log storage compression is not enabled before data version 4.3.3.0",
+                 K_(id), K(tenant_data_version));
+      }
+    } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(
+            tenant_config->log_storage_compress_func.str(), compressor))) {
+      ATOMIC_STORE(&is_enabled_, false);
+      CLOG_LOG(WARN, "failed to get compressor", K(ret), K_(id),
+               "compress_func", tenant_config->log_storage_compress_func.str());
+    } else {
+      if (compressor != ATOMIC_LOAD(&compressor_) || !ATOMIC_LOAD(&is_enabled_)) {
+        CLOG_LOG(INFO, "log storage compression is enabled", K_(id),
+                 "compress_func", tenant_config->log_storage_compress_func.str());
+      }
+      ATOMIC_STORE(&compressor_, compressor);
+      ATOMIC_STORE(&is_enabled_, true);
+    }
+  }
+}
+
+} // namespace logservice
+} // namespace oceanbase
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_OB_LOG_COMPRESSION_
+#define OCEANBASE_LOGSERVICE_OB_LOG_COMPRESSION_
+
+#include "lib/ob_define.h"
+#include "lib/utility/ob_print_utils.h"
+#include "lib/compress/ob_compress_util.h"
+
+namespace oceanbase
+{
+namespace common
+{
+class ObCompressor;
+class ObILogAllocator;
+}
+namespace logservice
+{
+// The layout of the compressed log:
+//
+//   | ObLogBaseHeader(compressed) | LogCompressedPayloadHeader | compressed payload |
+//
+// Only the payload after ObLogBaseHeader is compressed, so the readers can
+// still get the log type and the replay barrier of the log without
+// decompressing it. The log is compressed before it is appended to palf, so
+// the LSN, the group entries and the log cache of palf are the same as the
+// uncompressed log, and the readers of the log(replay, cdc, restore and
+// ob_admin) decompress the payload with decompress() as needed.
+class LogCompressedPayloadHeader
+{
+public:
+  LogCompressedPayloadHeader();
+  LogCompressedPayloadHeader(const common::ObCompressorType compressor_type,
+                             const int64_t original_len);
+  ~LogCompressedPayloadHeader();
+public:
+  void reset();
+  bool is_valid() const;
+  common::ObCompressorType get_compressor_type() const;
+  int64_t get_original_len() const;
+  NEED_SERIALIZE_AND_DESERIALIZE;
+  TO_STRING_KV(K_(magic), K_(version), K_(compressor_type), K_(original_len));
+private:
+  static const int16_t COMPRESSED_PAYLOAD_HEADER_MAGIC = 0x4C43; // 'LC'
+  static const int16_t COMPRESSED_PAYLOAD_HEADER_VERSION = 1;
+  int16_t magic_;
+  int16_t version_;
+  int32_t compressor_type_;
+  int64_t original_len_;
+};
+
+// @param[in] in_buf, the LogCompressedPayloadHeader and the compressed payload
+// @param[in] in_len, the length of in_buf
+// @param[out] out_buf, the buffer of the original payload
+// @param[in] out_buf_len, the length of out_buf, which must not be less than the original length
+// @param[out] decompressed_len, the length of the original payload
+int decompress(const char *in_buf,
+               const int64_t in_len,
+               char *out_buf,
+               const int64_t out_buf_len,
+               int64_t &decompressed_len);
+
+// ObLogCompressorWrapper compresses the logs appended by ObLogHandler, it is
+// controlled by the tenant config log_storage_compress_all and
+// log_storage_compress_func, and is enabled only if the min data version of
+// the tenant is not less than 4.3.3.0, so that all replicas can decompress.
+class ObLogCompressorWrapper
+{
+public:
+  ObLogCompressorWrapper();
+  ~ObLogCompressorWrapper();
+public:
+  int init(const int64_t id, common::ObILogAllocator *alloc_mgr);
+  bool is_valid() const;
+  void reset();
+  // compress_payload always returns OB_SUCCESS, the original log is used if
+  // the log is not compressed for any reason.
+  //
+  // @param[in] buffer, the log to be appended, which starts with ObLogBaseHeader
+  // @param[in] nbytes, the length of buffer
+  // @param[out] compression_buf, the buffer allocated for the compressed log,
+  //   which must be freed with free_compression_buf
+  // @param[out] log_compressed, whether the log is compressed
+  // @param[out] final_buf, the log to be appended to palf
+  // @param[out] final_nbytes, the length of final_buf
+  int compress_payload(const void *buffer,
+                       const int64_t nbytes,
+                       void *&compression_buf,
+                       bool &log_compressed,
+                       const void *&final_buf,
+                       int64_t &final_nbytes);
+  void free_compression_buf(void *&compression_buf);
+  TO_STRING_KV(K_(is_inited), K_(id), K_(is_enabled), KP_(compressor), K_(last_refresh_ts));
+private:
+  int do_compress_(const char *buffer,
+                   const int64_t nbytes,
+                   common::ObCompressor *compressor,
+                   char *&compression_buf,
+                   int64_t &compressed_nbytes);
+  void refresh_config_();
+private:
+  // the payload which is shorter than MIN_COMPRESS_PAYLOAD_LEN gains little
+  // from compression
+  static const int64_t MIN_COMPRESS_PAYLOAD_LEN = 256;
+  static const int64_t REFRESH_INTERVAL = 5 * 1000 * 1000L;
+private:
+  bool is_inited_;
+  int64_t id_;
+  common::ObILogAllocator *alloc_mgr_;
+  bool is_enabled_;
+  common::ObCompressor *compressor_;
+  int64_t last_refresh_ts_;
+  DISALLOW_COPY_AND_ASSIGN(ObLogCompressorWrapper);
+};
+
+} // namespace logservice
+} // namespace oceanbase
+
+#endif // OCEANBASE_LOGSERVICE_OB_LOG_COMPRESSION_
@@ -15,6 +15,8 @@
 #include "log_cache.h"
 #include "palf_handle_impl.h"
 #include "palf_handle_impl_guard.h"
+#include "log_shared_task.h"             // LogReadAheadTask
+#include "share/rc/ob_tenant_base.h"   // mtl_malloc
 
 namespace oceanbase
 {
@@ -451,10 +453,130 @@ void FillBuf::update_state(const LSN &aligned_lsn, const int64_t flashback_versi
   flashback_version_ = flashback_version;
 }
 
+//============================================= LogReadAheadTracker ==========================
+void LogReadAheadTracker::Stream::reset()
+{
+  next_lsn_.reset();
+  read_ahead_end_lsn_.reset();
+  window_size_ = 0;
+  seq_read_cnt_ = 0;
+  last_access_ts_ = OB_INVALID_TIMESTAMP;
+}
+
+bool LogReadAheadTracker::Stream::is_active(const int64_t cur_ts) const
+{
+  return next_lsn_.is_valid() && cur_ts - last_access_ts_ < STREAM_EXPIRE_TIME_US;
+}
+
+bool LogReadAheadTracker::Stream::is_sequential(const LSN &lsn) const
+{
+  // the readers may read a little backward or forward for the alignment of DIO
+  return lsn + CACHE_LINE_SIZE >= next_lsn_ && lsn <= next_lsn_ + CACHE_LINE_SIZE;
+}
+
+LogReadAheadTracker::LogReadAheadTracker() : lock_()
+{
+  reset();
+}
+
+LogReadAheadTracker::~LogReadAheadTracker()
+{
+  reset();
+}
+
+void LogReadAheadTracker::reset()
+{
+  ObSpinLockGuard guard(lock_);
+  for (int64_t i = 0; i < MAX_STREAM_CNT; i++) {
+    streams_[i].reset();
+  }
+}
+
+void LogReadAheadTracker::record_read(const LSN &lsn,
+                                      const LSN &end_lsn,
+                                      const bool is_cache_miss,
+                                      const LSN &limit_lsn,
+                                      const int64_t cur_ts,
+                                      LSN &read_ahead_lsn,
+                                      int64_t &read_ahead_size)
+{
+  ObSpinLockGuard guard(lock_);
+  Stream *stream = NULL;
+  Stream *victim = NULL;
+  int64_t active_stream_cnt = 0;
+  bool is_evicted = false;
+  read_ahead_lsn.reset();
+  read_ahead_size = 0;
+  for (int64_t i = 0; i < MAX_STREAM_CNT; i++) {
+    Stream &curr = streams_[i];
+    if (curr.is_active(cur_ts)) {
+      active_stream_cnt++;
+      if (NULL == stream && curr.is_sequential(lsn)) {
+        stream = &curr;
+      }
+    }
+    if (NULL == victim || curr.last_access_ts_ < victim->last_access_ts_) {
+      victim = &curr;
+    }
+  }
+
+  if (NULL == stream) {
+    // a new reader, replace the least recently used stream
+    if (!victim->is_active(cur_ts)) {
+      active_stream_cnt++;
+    }
+    victim->reset();
+    stream = victim;
+  } else if (is_cache_miss && stream->read_ahead_end_lsn_.is_valid() && lsn < stream->read_ahead_end_lsn_) {
+    // the logs read ahead have been evicted before being read, the window is too large
+    is_evicted = true;
+    stream->window_size_ = MAX(MIN_READ_AHEAD_SIZE, stream->window_size_ / 2);
+    stream->read_ahead_end_lsn_.reset();
+  }
+  stream->seq_read_cnt_++;
+  stream->next_lsn_ = end_lsn;
+  stream->last_access_ts_ = cur_ts;
+
+  if (stream->seq_read_cnt_ >= MIN_SEQ_READ_CNT) {
+    const int64_t max_window_size =
+        MAX(MIN_READ_AHEAD_SIZE, MIN(MAX_READ_AHEAD_SIZE, MAX_TOTAL_READ_AHEAD_SIZE / active_stream_cnt));
+    // the cache line which end_lsn is in hasn't been filled by this read
+    LSN start_lsn = LogCacheUtils::lower_align_with_start(end_lsn, CACHE_LINE_SIZE);
+    if (stream->read_ahead_end_lsn_.is_valid() && stream->read_ahead_end_lsn_ > start_lsn) {
+      start_lsn = stream->read_ahead_end_lsn_;
+    }
+    const int64_t remained_size = (start_lsn > end_lsn) ? (start_lsn - end_lsn) : 0;
+    if (0 == stream->window_size_) {
+      stream->window_size_ = MIN_READ_AHEAD_SIZE;
+    } else if (!is_evicted && remained_size < stream->window_size_ / 2) {
+      // read ahead again when half of the window has been consumed, and the
+      // window grows as the reader keeps reading sequentially
+      stream->window_size_ = MIN(stream->window_size_ * 2, max_window_size);
+    }
+    stream->window_size_ = MIN(stream->window_size_, max_window_size);
+
+    if (remained_size < stream->window_size_ / 2) {
+      LSN target_end_lsn = MIN(end_lsn + stream->window_size_, limit_lsn);
+      if (target_end_lsn != limit_lsn) {
+        // only complete cache lines are filled
+        target_end_lsn = LogCacheUtils::lower_align_with_start(target_end_lsn, CACHE_LINE_SIZE);
+      }
+      if (target_end_lsn > start_lsn) {
+        read_ahead_lsn = start_lsn;
+        read_ahead_size = target_end_lsn - start_lsn;
+        stream->read_ahead_end_lsn_ = target_end_lsn;
+      }
+    }
+  }
+  PALF_LOG(TRACE, "record read", K(lsn), K(end_lsn), K(is_cache_miss), K(limit_lsn),
+           K(read_ahead_lsn), K(read_ahead_size), KPC(stream));
+}
+
 //============================================= LogColdCache ==========================
 LogColdCache::LogColdCache()
     : palf_id_(INVALID_PALF_ID), palf_env_impl_(NULL), log_reader_(NULL),
-      kv_cache_(NULL), logical_block_size_(0), log_cache_stat_(), is_inited_(false) {}
+      kv_cache_(NULL), logical_block_size_(0), log_cache_stat_(), read_ahead_tracker_(),
+      read_ahead_task_cnt_(0), is_inited_(false) {}
 
 int LogColdCache::init(int64_t palf_id,
                        IPalfEnvImpl *palf_env_impl,
@@ -489,6 +611,8 @@ void LogColdCache::destroy()
   log_reader_ = NULL;
   kv_cache_ = NULL;
   log_cache_stat_.reset();
+  read_ahead_tracker_.reset();
+  read_ahead_task_cnt_ = 0;
   is_inited_ = false;
 }
 
@@ -521,12 +645,14 @@ int LogColdCache::read(const int64_t flashback_version,
                        const int64_t in_read_size,
                        ReadBuf &read_buf,
                        int64_t &out_read_size,
-                       LogIteratorInfo *iterator_info)
+                       LogIteratorInfo *iterator_info,
+                       const LSN &max_readable_lsn)
 {
   #define PRINT_INFO K(palf_id_), K(MTL_ID())
 
   int ret = OB_SUCCESS;
   bool enable_fill_cache = false;
+  bool is_cache_miss = false;
   int64_t cache_lines_read_size = 0;
   int64_t cache_out_read_size = 0;
   LSN read_lsn = lsn;
@@ -545,6 +671,7 @@ int LogColdCache::read(const int64_t flashback_version,
   } else if (OB_ENTRY_NOT_EXIST != ret) {
     PALF_LOG(WARN, "fail to get cache lines", K(ret), K(lsn), K(flashback_version),
              K(in_read_size), K(cache_lines_read_size), PRINT_INFO);
+  } else if (FALSE_IT(is_cache_miss = true)) {
   } else if (OB_FAIL(allow_filling_cache_(iterator_info, enable_fill_cache))) {
     PALF_LOG(WARN, "allow_filling_cache failed", K(ret), K(enable_fill_cache), PRINT_INFO);
   } else if (OB_FAIL(deal_with_miss_(enable_fill_cache, cache_lines_read_size, read_buf.buf_len_, read_lsn,
@@ -574,6 +701,10 @@ int LogColdCache::read(const int64_t flashback_version,
     }
   }
 
+  if (OB_SUCC(ret) && 0 < out_read_size) {
+    try_read_ahead_(flashback_version, lsn, out_read_size, is_cache_miss, max_readable_lsn, iterator_info);
+  }
+
   #undef PRINT_INFO
 
   return ret;
@@ -608,6 +739,21 @@ int LogColdCache::allow_filling_cache_(LogIteratorInfo *iterator_info, bool &ena
   return ret;
 }
 
+int LogColdCache::allow_read_ahead_(LogIteratorInfo *iterator_info, bool &enable_read_ahead)
+{
+  int ret = OB_SUCCESS;
+  PalfOptions options;
+  enable_read_ahead = false;
+  if (OB_FAIL(palf_env_impl_->get_options(options))) {
+    PALF_LOG(WARN, "get options failed", K(ret));
+  } else {
+    enable_read_ahead = options.enable_log_cache_
+                        && options.enable_log_cache_read_ahead_
+                        && iterator_info->get_allow_filling_cache();
+  }
+  return ret;
+}
+
 int LogColdCache::deal_with_miss_(const bool enable_fill_cache,
                                   const int64_t has_read_size,
                                   const int64_t buf_len,
@@ -836,6 +982,104 @@ int LogColdCache::read_from_disk_(const LSN &read_lsn,
   return ret;
 }
 
+void LogColdCache::try_read_ahead_(const int64_t flashback_version,
+                                   const LSN &lsn,
+                                   const int64_t read_size,
+                                   const bool is_cache_miss,
+                                   const LSN &max_readable_lsn,
+                                   LogIteratorInfo *iterator_info)
+{
+  int ret = OB_SUCCESS;
+  bool enable_read_ahead = false;
+  LSN read_ahead_lsn;
+  int64_t read_ahead_size = 0;
+  if (!max_readable_lsn.is_valid()) {
+  } else if (OB_FAIL(allow_read_ahead_(iterator_info, enable_read_ahead)) || !enable_read_ahead) {
+  } else {
+    // max_readable_lsn is never beyond the block of lsn, and the logs can be
+    // read ahead up to the end of the block or the last complete cache line
+    const LSN next_block_start_lsn = LogCacheUtils::next_block_start_lsn(lsn);
+    const LSN limit_lsn = (max_readable_lsn >= next_block_start_lsn) ?
+        next_block_start_lsn : LogCacheUtils::lower_align_with_start(max_readable_lsn, CACHE_LINE_SIZE);
+    read_ahead_tracker_.record_read(lsn, lsn + read_size, is_cache_miss, limit_lsn,
+                                    ObTimeUtility::current_time(), read_ahead_lsn, read_ahead_size);
+    // the reader doesn't wait for the disk, the task is dropped when too many
+    // tasks are in flight, and the tracker treats the logs as evicted later
+    if (0 < read_ahead_size && OB_FAIL(submit_read_ahead_task_(flashback_version, read_ahead_lsn,
+                                                               read_ahead_size))) {
+      PALF_LOG(TRACE, "submit read ahead task failed", K(ret), K(read_ahead_lsn), K(read_ahead_size), K(palf_id_));
+    }
+  }
+}
+
+int LogColdCache::submit_read_ahead_task_(const int64_t flashback_version,
+                                          const LSN &read_ahead_lsn,
+                                          const int64_t read_ahead_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t palf_epoch = -1;
+  IPalfHandleImplGuard guard;
+  LogReadAheadTask *task = NULL;
+  void *buf = NULL;
+  if (ATOMIC_AAF(&read_ahead_task_cnt_, 1) > MAX_READ_AHEAD_TASK_CNT) {
+    ret = OB_EAGAIN;
+  } else if (OB_FAIL(palf_env_impl_->get_palf_handle_impl(palf_id_, guard))) {
+    PALF_LOG(WARN, "get_palf_handle_impl failed", K(ret), K(palf_id_));
+  } else if (OB_FAIL(guard.get_palf_handle_impl()->get_palf_epoch(palf_epoch))) {
+    PALF_LOG(WARN, "get_palf_epoch failed", K(ret), K(palf_id_));
+  } else if (OB_ISNULL(buf = mtl_malloc(sizeof(LogReadAheadTask), "LogReadAhead"))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    PALF_LOG(WARN, "alloc LogReadAheadTask failed", K(ret), K(palf_id_));
+  } else if (FALSE_IT(task = new (buf) LogReadAheadTask(palf_id_, palf_epoch))) {
+  } else if (OB_FAIL(task->init(flashback_version, read_ahead_lsn, read_ahead_size))) {
+    PALF_LOG(WARN, "LogReadAheadTask init failed", K(ret), K(read_ahead_lsn), K(read_ahead_size));
+  } else if (OB_FAIL(palf_env_impl_->submit_log_read_ahead_task(task))) {
+    PALF_LOG(WARN, "submit_log_read_ahead_task failed", K(ret), KPC(task));
+  } else {
+    PALF_LOG(TRACE, "submit read ahead task successfully", KPC(task));
+  }
+  if (OB_FAIL(ret)) {
+    if (OB_NOT_NULL(task)) {
+      task->free_this(palf_env_impl_);
+      task = NULL;
+    }
+    ATOMIC_DEC(&read_ahead_task_cnt_);
+  }
+  return ret;
+}
+
+int LogColdCache::read_ahead(const int64_t flashback_version,
+                             const LSN &read_ahead_lsn,
+                             const int64_t read_ahead_size)
+{
+  int ret = OB_SUCCESS;
+  ReadBufGuard read_buf_guard("LogReadAhead", read_ahead_size);
+  ReadBuf &read_buf = read_buf_guard.read_buf_;
+  // the stats of reading the disk don't belong to any iterator
+  LogIteratorInfo iterator_info;
+  int64_t out_read_size = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "LogColdCache is not inited", K(ret));
+  } else if (0 > flashback_version || !read_ahead_lsn.is_valid() || 0 >= read_ahead_size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(flashback_version), K(read_ahead_lsn), K(read_ahead_size));
+  } else if (!read_buf.is_valid()) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+  } else if (OB_FAIL(read_from_disk_(read_ahead_lsn, read_ahead_size, read_buf,
+                                     out_read_size, &iterator_info))) {
+    PALF_LOG(WARN, "read_from_disk_ failed", K(ret), K(read_ahead_lsn), K(read_ahead_size));
+  } else if (OB_FAIL(fill_cache_lines_(flashback_version, read_ahead_lsn, out_read_size, read_buf.buf_))) {
+    PALF_LOG(WARN, "fail to fill cache", K(ret), K(read_ahead_lsn), K(out_read_size), K(palf_id_));
+  } else {
+    PALF_LOG(TRACE, "read ahead successfully", K(read_ahead_lsn), K(read_ahead_size), K(palf_id_));
+  }
+  if (IS_INIT) {
+    ATOMIC_DEC(&read_ahead_task_cnt_);
+  }
+  return ret;
+}
+
 offset_t LogColdCache::get_phy_offset_(const LSN &lsn) const
 {
   return lsn_2_offset(lsn, logical_block_size_) + MAX_INFO_BLOCK_SIZE;
@@ -953,7 +1197,8 @@ int LogCache::read(const int64_t flashback_version,
                    const int64_t in_read_size,
                    ReadBuf &read_buf,
                    int64_t &out_read_size,
-                   LogIteratorInfo *iterator_info)
+                   LogIteratorInfo *iterator_info,
+                   const LSN &max_readable_lsn)
 {
   int ret = OB_SUCCESS;
   const bool is_cold_cache = false;
@@ -969,7 +1214,7 @@ int LogCache::read(const int64_t flashback_version,
     iterator_info->inc_cache_read_size(out_read_size, is_cold_cache);
   } else if (FALSE_IT(iterator_info->inc_miss_cnt(is_cold_cache))) {
   } else if (OB_FAIL(read_cold_cache_(flashback_version, lsn, in_read_size,
-                                      read_buf, out_read_size, iterator_info))) {
+                                      read_buf, out_read_size, iterator_info, max_readable_lsn))) {
     PALF_LOG(WARN, "fail to read from cold cache", K(ret), K(lsn), K(in_read_size), K(read_buf), K(out_read_size));
   } else {
     // read data from kv cache successfully
@@ -978,6 +1223,20 @@ int LogCache::read(const int64_t flashback_version,
   return ret;
 }
 
+int LogCache::read_ahead(const int64_t flashback_version,
+                         const LSN &read_ahead_lsn,
+                         const int64_t read_ahead_size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "LogCache is not inited", K(ret));
+  } else if (OB_FAIL(cold_cache_.read_ahead(flashback_version, read_ahead_lsn, read_ahead_size))) {
+    PALF_LOG(TRACE, "cold cache read ahead failed", K(ret), K(read_ahead_lsn), K(read_ahead_size));
+  }
+  return ret;
+}
+
 int LogCache::fill_cache_when_slide(const LSN &lsn,
                                     const int64_t fill_size,
                                     const int64_t flashback_version)
@@ -1066,7 +1325,8 @@ int LogCache::read_cold_cache_(const int64_t flashback_version,
                               const int64_t in_read_size,
                               ReadBuf &read_buf,
                               int64_t &out_read_size,
-                              LogIteratorInfo *iterator_info)
+                              LogIteratorInfo *iterator_info,
+                              const LSN &max_readable_lsn)
 {
   int ret = OB_SUCCESS;
   if (!lsn.is_valid() || 0 >= in_read_size || !read_buf.is_valid()) {
@@ -1074,7 +1334,7 @@ int LogCache::read_cold_cache_(const int64_t flashback_version,
     PALF_LOG(WARN, "invalid argument", K(ret), K(lsn), K(in_read_size), K(read_buf));
   } else if (OB_FAIL(cold_cache_.read(flashback_version, lsn, in_read_size,
                                       read_buf, out_read_size,
-                                      iterator_info))) {
+                                      iterator_info, max_readable_lsn))) {
     PALF_LOG(WARN, "read cold cache failed", K(ret), K(lsn), K(in_read_size), K(read_buf), K(out_read_size));
   } else {
     PALF_LOG(TRACE, "read cold cache successfully", K(lsn), K(in_read_size), K(read_buf), K(out_read_size));
@@ -19,6 +19,7 @@
 #include "lsn.h"
 #include "log_storage.h"
 #include "log_storage_interface.h"                       // LogIteratorInfo
+#include "lib/lock/ob_spin_lock.h"                       // ObSpinLock
 
 #define OB_LOG_KV_CACHE oceanbase::palf::LogKVCache::get_instance()
 namespace oceanbase
@@ -181,8 +182,70 @@ public:
   common::ObKVCacheInstHandle inst_handle_;
 };
 
+// LogReadAheadTracker detects the sequential readers of a palf, such as the
+// replay, the fetch log of followers, cdc and restore, and decides how many
+// logs should be read ahead into the cold cache for each of them.
+//
+// Every sequential reader is tracked by a stream. The read-ahead window of a
+// stream starts from MIN_READ_AHEAD_SIZE and doubles each time the reader
+// consumes half of the logs read ahead, up to its share of
+// MAX_TOTAL_READ_AHEAD_SIZE, so that concurrent readers don't evict the logs
+// read ahead for each other. If the reader misses the logs which have been
+// read ahead, which means they were evicted before being read, the window is
+// halved.
+class LogReadAheadTracker
+{
+public:
+  static const int64_t MAX_STREAM_CNT = 8;
+  static const int64_t MIN_SEQ_READ_CNT = 2;
+  static const int64_t MIN_READ_AHEAD_SIZE = 4 * CACHE_LINE_SIZE;
+  static const int64_t MAX_READ_AHEAD_SIZE = 32 * CACHE_LINE_SIZE;
+  static const int64_t MAX_TOTAL_READ_AHEAD_SIZE = 128 * CACHE_LINE_SIZE;
+  static const int64_t STREAM_EXPIRE_TIME_US = 10 * 1000 * 1000L;
+public:
+  LogReadAheadTracker();
+  ~LogReadAheadTracker();
+  void reset();
+  // @brief: record a read of logs and get the logs to be read ahead
+  // @param[in] const LSN &lsn: start lsn of the read
+  // @param[in] const LSN &end_lsn: end lsn of the read
+  // @param[in] const bool is_cache_miss: whether the read misses the cold cache
+  // @param[in] const LSN &limit_lsn: logs after limit_lsn can't be read ahead
+  // @param[in] const int64_t cur_ts: current timestamp
+  // @param[out] LSN &read_ahead_lsn: start lsn of the logs to be read ahead
+  // @param[out] int64_t &read_ahead_size: size of the logs to be read ahead, 0 means no need to read ahead
+  void record_read(const LSN &lsn,
+                   const LSN &end_lsn,
+                   const bool is_cache_miss,
+                   const LSN &limit_lsn,
+                   const int64_t cur_ts,
+                   LSN &read_ahead_lsn,
+                   int64_t &read_ahead_size);
+private:
+  struct Stream
+  {
+    Stream() { reset(); }
+    void reset();
+    bool is_active(const int64_t cur_ts) const;
+    bool is_sequential(const LSN &lsn) const;
+    TO_STRING_KV(K_(next_lsn), K_(read_ahead_end_lsn), K_(window_size), K_(seq_read_cnt), K_(last_access_ts));
+    LSN next_lsn_;
+    LSN read_ahead_end_lsn_;
+    int64_t window_size_;
+    int64_t seq_read_cnt_;
+    int64_t last_access_ts_;
+  };
+private:
+  common::ObSpinLock lock_;
+  Stream streams_[MAX_STREAM_CNT];
+};
+
 class LogColdCache
 {
+public:
+  // at most one read-ahead task of each stream is in flight, which keeps the
+  // queue of the read-ahead thread from being full
+  static const int64_t MAX_READ_AHEAD_TASK_CNT = LogReadAheadTracker::MAX_STREAM_CNT;
 public:
   LogColdCache();
   ~LogColdCache();
@@ -197,6 +260,7 @@ public:
   // @param[out] ReadBuf &read_buf: buf for read logs
   // @param[out] int64_t &out_read_size: actual read size
   // @param[out] LogIteratorInfo *iterator_info: iterator info
+  // @param[in] const LSN &max_readable_lsn: logs after max_readable_lsn can't be read ahead
   // @return
   // - OB_SUCCESS: read logs successfully
   // - OB_INVALID_ARGUEMENTS: invalid arguments
@@ -207,12 +271,21 @@ public:
            const int64_t in_read_size,
            ReadBuf &read_buf,
            int64_t &out_read_size,
-           LogIteratorInfo *iterator_info);
+           LogIteratorInfo *iterator_info,
+           const LSN &max_readable_lsn);
   int fill_cache_line(FillBuf &fill_buf);
   int alloc_kv_pair(const int64_t flashback_version, const LSN &aligned_lsn, FillBuf &fill_buf);
-  TO_STRING_KV(K(is_inited_), K(palf_id_), K(log_cache_stat_));
+  // @brief: read logs from the disk and fill them into cold cache, which is
+  // called by the read-ahead thread for the task submitted by try_read_ahead_
+  int read_ahead(const int64_t flashback_version,
+                 const LSN &read_ahead_lsn,
+                 const int64_t read_ahead_size);
+  TO_STRING_KV(K(is_inited_), K(palf_id_), K(log_cache_stat_), K(read_ahead_task_cnt_));
 private:
   int allow_filling_cache_(LogIteratorInfo *iterator_info, bool &enable_fill_cache);
+  // read-ahead is controlled by _enable_log_cache_read_ahead, since it takes
+  // the disk bandwidth and the cache space of the other readers
+  int allow_read_ahead_(LogIteratorInfo *iterator_info, bool &enable_read_ahead);
   /*
   this func is used to adujst read position(lsn) and read size(in_read_size) before reading from the disk:
   1. if read from cache successfully, lsn must be aligned to CACHE_LINE_SIZE in the block.
@@ -253,6 +326,17 @@ private:
                       ReadBuf &read_buf,
                       int64_t &out_read_size,
                       LogIteratorInfo *iterator_info);
+  // submit a task to read the logs after a sequential read into the cold cache
+  // asynchronously, failures are ignored
+  void try_read_ahead_(const int64_t flashback_version,
+                       const LSN &lsn,
+                       const int64_t read_size,
+                       const bool is_cache_miss,
+                       const LSN &max_readable_lsn,
+                       LogIteratorInfo *iterator_info);
+  int submit_read_ahead_task_(const int64_t flashback_version,
+                              const LSN &read_ahead_lsn,
+                              const int64_t read_ahead_size);
   offset_t get_phy_offset_(const LSN &lsn) const;
 private:
   class LogCacheStat
@@ -286,6 +370,9 @@ private:
   LogKVCache *kv_cache_;
   int64_t logical_block_size_;
   LogCacheStat log_cache_stat_;
+  LogReadAheadTracker read_ahead_tracker_;
+  // the read-ahead tasks which are being submitted or handled
+  int64_t read_ahead_task_cnt_;
   bool is_inited_;
 };
 
@@ -305,10 +392,14 @@ public:
            const int64_t in_read_size,
            ReadBuf &read_buf,
            int64_t &out_read_size,
-           LogIteratorInfo *iterator_info);
+           LogIteratorInfo *iterator_info,
+           const LSN &max_readable_lsn);
   int fill_cache_when_slide(const LSN &lsn,
                             const int64_t size,
                             const int64_t flashback_version);
+  int read_ahead(const int64_t flashback_version,
+                 const LSN &read_ahead_lsn,
+                 const int64_t read_ahead_size);
   TO_STRING_KV(K(is_inited_), K(palf_id_), K(cold_cache_));
 private:
   int read_hot_cache_(const LSN &read_begin_lsn,
@@ -320,7 +411,8 @@ private:
                        const int64_t in_read_size,
                        ReadBuf &read_buf,
                        int64_t &out_read_size,
-                       LogIteratorInfo *iterator_info);
+                       LogIteratorInfo *iterator_info,
+                       const LSN &max_readable_lsn);
   int try_update_fill_buf_(const int64_t flashback_version,
                            LSN &fill_lsn,
                            int64_t &fill_size);
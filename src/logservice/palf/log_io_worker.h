@@ -130,7 +130,8 @@ private:
   //       will consume it, at nowdays, the io_task_queue is single consumer and mutil
   //       producers model.
 
-  // NB: at nowdays, the default 'log_io_worker_num_' is 1.
+  // NB: 'log_io_worker_num_' is the number of LogIOWorkers of this tenant (see LogIOWorkerWrapper),
+  //     each LogIOWorker consumes its queue with MAX_THREAD_NUM threads.
   int64_t log_io_worker_num_;
   int cb_thread_pool_tg_id_;
   IPalfEnvImpl *palf_env_impl_;
@@ -34,12 +34,13 @@ public:
   int start();
   void stop();
   void wait();
-  // NB: nowdays, this interface can only be called when create_palf_handle_impl!!! otherwise, round_robin_idx_
-  // will not be correct.
+  // NB: the LogIOWorker of a log stream only depends on its palf_id, therefore, a log stream always
+  // writes through the same LogIOWorker after restart or rebuild, and the log streams of a tenant
+  // are spread evenly over the LogIOWorkers except the one reserved for sys log stream.
   LogIOWorker *get_log_io_worker(const int64_t palf_id);
   int notify_need_writing_throttling(const bool &need_throtting);
   int64_t get_last_working_time() const;
-  TO_STRING_KV(K_(is_inited), K_(is_user_tenant), K_(log_writer_parallelism), KP(log_io_workers_), K_(round_robin_idx));
+  TO_STRING_KV(K_(is_inited), K_(is_user_tenant), K_(log_writer_parallelism), KP(log_io_workers_));
 
 private:
   int create_and_init_log_io_workers_(const LogIOWorkerConfig &config,
@@ -51,7 +52,7 @@ private:
   void stop_();
   void wait_();
   void destory_and_free_log_io_workers_();
-  int64_t palf_id_to_index_(const int64_t palf_id);
+  int64_t palf_id_to_index_(const int64_t palf_id) const;
   constexpr static int64_t SYS_LOG_IO_WORKER_INDEX = 0;
 
 private:
@@ -60,8 +61,8 @@ private:
   int64_t log_writer_parallelism_;
   // The layout of LogIOWorker: | sys log ioworker | others |
   LogIOWorker *log_io_workers_;
+  // shared by all LogIOWorkers, see LogWritingThrottle::next_throttling_ts_.
   LogWritingThrottle throttle_;
-  int64_t round_robin_idx_;
   bool is_inited_;
 };
 
@@ -32,18 +32,17 @@ LogSharedQueueTh::~LogSharedQueueTh()
   destroy();
 }
 
-int LogSharedQueueTh::init(IPalfEnvImpl *palf_env_impl)
+int LogSharedQueueTh::init(IPalfEnvImpl *palf_env_impl, const int tg_def_id)
 {
   int ret = OB_SUCCESS;
-  const int tg_id = lib::TGDefIDs::LogSharedQueueTh;
   if (IS_INIT) {
     ret = OB_INIT_TWICE;
     PALF_LOG(ERROR, "LogSharedQueueTh has inited", K(ret));
   } else if (NULL == palf_env_impl) {
     ret = OB_INVALID_ARGUMENT;
     PALF_LOG(ERROR, "Invalid argument", K(ret), KP(palf_env_impl));
-  } else if (OB_FAIL(TG_CREATE_TENANT(tg_id, tg_id_, MAX_LOG_HANDLE_TASK_NUM))) {
-    PALF_LOG(WARN, "LogSharedQueueTh TG_CREATE failed", K(ret));
+  } else if (OB_FAIL(TG_CREATE_TENANT(tg_def_id, tg_id_, MAX_LOG_HANDLE_TASK_NUM))) {
+    PALF_LOG(WARN, "LogSharedQueueTh TG_CREATE failed", K(ret), K(tg_def_id));
   } else {
     palf_env_impl_ = palf_env_impl;
     is_inited_ = true;
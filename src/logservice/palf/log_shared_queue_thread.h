@@ -30,7 +30,8 @@ public:
   LogSharedQueueTh();
   ~LogSharedQueueTh();
 public:
-  int init(IPalfEnvImpl *palf_env_impl);
+  // @param[in] tg_def_id: LogSharedQueueTh or LogReadAheadTh in TGDefIDs
+  int init(IPalfEnvImpl *palf_env_impl, const int tg_def_id);
   int start();
   int stop();
   int wait();
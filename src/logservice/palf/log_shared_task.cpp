@@ -13,6 +13,7 @@
 #include "log_shared_task.h"
 #include "palf_env_impl.h"                    // PalfEnvImpl
 #include "share/ob_errno.h"                   // errno...
+#include "share/rc/ob_tenant_base.h"          // mtl_free
 
 namespace oceanbase
 {
@@ -131,5 +132,71 @@ void LogFillCacheTask::free_this(IPalfEnvImpl *palf_env_impl)
   palf_env_impl->get_log_allocator()->free_log_fill_cache_task(this);
 }
 
+// ================================================= LogReadAheadTask =================================
+LogReadAheadTask::LogReadAheadTask(const int64_t palf_id, const int64_t palf_epoch)
+  : LogSharedTask(palf_id, palf_epoch), is_inited_(false), flashback_version_(-1),
+    read_ahead_lsn_(LOG_INVALID_LSN_VAL), read_ahead_size_(0)
+{}
+
+LogReadAheadTask::~LogReadAheadTask()
+{
+  is_inited_ = false;
+  flashback_version_ = -1;
+  read_ahead_lsn_.reset();
+  read_ahead_size_ = 0;
+}
+
+int LogReadAheadTask::init(const int64_t flashback_version,
+                           const LSN &read_ahead_lsn,
+                           const int64_t read_ahead_size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    PALF_LOG(ERROR, "LogReadAheadTask has been inited", K(ret), KPC(this));
+  } else if (0 > flashback_version || !read_ahead_lsn.is_valid() || 0 >= read_ahead_size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), K(flashback_version), K(read_ahead_lsn), K(read_ahead_size));
+  } else {
+    flashback_version_ = flashback_version;
+    read_ahead_lsn_ = read_ahead_lsn;
+    read_ahead_size_ = read_ahead_size;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int LogReadAheadTask::do_task(IPalfEnvImpl *palf_env_impl)
+{
+  int ret = OB_SUCCESS;
+  int64_t palf_epoch = -1;
+  IPalfHandleImplGuard guard;
+  common::ObTimeGuard time_guard("read ahead log cache", 100 * 1000);
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    PALF_LOG(WARN, "LogReadAheadTask is not inited", K(ret), KPC(this));
+  } else if (OB_FAIL(palf_env_impl->get_palf_handle_impl(palf_id_, guard))) {
+    PALF_LOG(WARN, "IPalfEnvImpl get_palf_handle_impl failed", K(ret), KPC(this));
+  } else if (OB_FAIL(guard.get_palf_handle_impl()->get_palf_epoch(palf_epoch))) {
+    PALF_LOG(WARN, "PalfHandleImpl get_palf_epoch failed", K(ret), KPC(this));
+  } else if (palf_epoch != palf_epoch_) {
+    ret = OB_STATE_NOT_MATCH;
+    PALF_LOG(WARN, "palf_epoch has changed, drop task", K(ret), K(palf_epoch), KPC(this));
+  } else if (OB_FAIL(guard.get_palf_handle_impl()->read_ahead_log_cache(flashback_version_,
+      read_ahead_lsn_, read_ahead_size_))) {
+    PALF_LOG(TRACE, "read ahead log cache failed", K(ret), KPC(this));
+  } else {
+    PALF_LOG(TRACE, "read ahead log cache successfully", K(time_guard), KPC(this));
+  }
+  return ret;
+}
+
+void LogReadAheadTask::free_this(IPalfEnvImpl *palf_env_impl)
+{
+  UNUSED(palf_env_impl);
+  this->~LogReadAheadTask();
+  mtl_free(this);
+}
+
 } // end namespace palf
 } // end namespace oceanbase
@@ -25,6 +25,7 @@ enum class LogSharedTaskType
 {
   LogHandleSubmitType = 1,
   LogFillCacheType = 2,
+  LogReadAheadType = 3,
 };
 
 inline const char *shared_type_2_str(const LogSharedTaskType type)
@@ -34,6 +35,7 @@ inline const char *shared_type_2_str(const LogSharedTaskType type)
   {
     EXTRACT_SHARED_TYPE(LogHandleSubmitType);
     EXTRACT_SHARED_TYPE(LogFillCacheType);
+    EXTRACT_SHARED_TYPE(LogReadAheadType);
     default:
       return "Invalid Type";
   }
@@ -90,6 +92,27 @@ private:
   DISALLOW_COPY_AND_ASSIGN(LogFillCacheTask);
 };
 
+// read the logs ahead into the cold cache, which is submitted by LogColdCache
+// and handled by the read-ahead thread of PalfEnvImpl
+class LogReadAheadTask : public LogSharedTask
+{
+public:
+  LogReadAheadTask(const int64_t palf_id, const int64_t palf_epoch);
+  ~LogReadAheadTask() override;
+  int init(const int64_t flashback_version, const LSN &read_ahead_lsn, const int64_t read_ahead_size);
+  int do_task(IPalfEnvImpl *palf_env_impl) override;
+  void free_this(IPalfEnvImpl *palf_env_impl) override;
+  virtual LogSharedTaskType get_shared_task_type() const override { return LogSharedTaskType::LogReadAheadType; }
+  INHERIT_TO_STRING_KV("LogSharedTask", LogSharedTask, "task type", shared_type_2_str(get_shared_task_type()),
+      K_(flashback_version), K_(read_ahead_lsn), K_(read_ahead_size));
+private:
+  bool is_inited_;
+  int64_t flashback_version_;
+  LSN read_ahead_lsn_;
+  int64_t read_ahead_size_;
+  DISALLOW_COPY_AND_ASSIGN(LogReadAheadTask);
+};
+
 } // end namespace palf
 } // end namespace oceanbase
 
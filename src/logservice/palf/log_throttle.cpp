@@ -35,6 +35,7 @@ void LogThrottlingStat::reset()
 void LogWritingThrottle::reset()
 {
   last_update_ts_ = OB_INVALID_TIMESTAMP;
+  next_throttling_ts_ = OB_INVALID_TIMESTAMP;
   need_writing_throttling_notified_ = false;
   appended_log_size_cur_round_ = 0;
   decay_factor_ = 0;
@@ -82,7 +83,11 @@ int LogWritingThrottle::throttling(const int64_t throttling_size,
                                                              cur_unrecyclable_size, decay_factor_, time_interval))) {
         LOG_WARN("failed to get_throttling_interval", KPC(this));
       }
-      int64_t remain_interval_us = time_interval;
+      // queue behind the tasks which are sleeping in other LogIOWorkers.
+      const int64_t cur_ts = ObClockGenerator::getClock();
+      next_throttling_ts_ = MAX(cur_ts, next_throttling_ts_) + time_interval;
+      const int64_t total_interval_us = next_throttling_ts_ - cur_ts;
+      int64_t remain_interval_us = total_interval_us;
       bool has_freed_up_space = false;
       // release lock_ in progress of usleep, therefore, accessing shared members in LogWritingThrottle need be guarded by lock
       // in following code block.
@@ -94,16 +99,16 @@ int LogWritingThrottle::throttling(const int64_t throttling_size,
         if (remain_interval_us <= 0) {
           //do nothing
         } else if (OB_FAIL(update_throtting_options_guarded_by_lock_(palf_env_impl, has_freed_up_space))) {
-          LOG_WARN("failed to update_throttling_info_", KPC(this), K(time_interval), K(remain_interval_us));
+          LOG_WARN("failed to update_throttling_info_", KPC(this), K(total_interval_us), K(remain_interval_us));
         } else if (!need_throttling_not_guarded_by_lock_(need_purging_throttling_func)
                    || has_freed_up_space) {
-          LOG_TRACE("no need throttling or log disk has been freed up", KPC(this), K(time_interval), K(remain_interval_us), K(has_freed_up_space));
+          LOG_TRACE("no need throttling or log disk has been freed up", KPC(this), K(total_interval_us), K(remain_interval_us), K(has_freed_up_space));
           break;
         }
       }
       // hold lock_ after ulseep, therefore, accessing shared members in LogWritingThrottle no need be guarded by lock.
       lock_.lock();
-      stat_.after_throttling(time_interval - remain_interval_us, throttling_size);
+      stat_.after_throttling(total_interval_us - remain_interval_us, throttling_size);
     } else if (need_throttling_with_options_not_guarded_by_lock_()) {
       stat_.after_throttling(0, throttling_size);
     }
@@ -173,8 +178,9 @@ int LogWritingThrottle::update_throtting_options_guarded_by_lock_(IPalfEnvImpl *
           has_freed_up_space = new_throttling_options.unrecyclable_disk_space_ < throttling_options_.unrecyclable_disk_space_;
           bool has_unrecyclable_space_changed = new_throttling_options.unrecyclable_disk_space_ != throttling_options_.unrecyclable_disk_space_;
           if (has_unrecyclable_space_changed || need_start_throttling) {
-            // reset appended_log_size_cur_round_ when unrecyclable_disk_space_ changed
+            // reset appended_log_size_cur_round_ and reserved slots when unrecyclable_disk_space_ changed
             appended_log_size_cur_round_ = 0;
+            next_throttling_ts_ = OB_INVALID_TIMESTAMP;
           }
           throttling_options_ = new_throttling_options;
           if (need_start_throttling) {
@@ -207,6 +213,7 @@ void LogWritingThrottle::clean_up_not_guarded_by_lock_()
 {
   //do not reset submitted_seq_  && handled_seq_ && last_update_ts_ && stat_
   appended_log_size_cur_round_ = 0;
+  next_throttling_ts_ = OB_INVALID_TIMESTAMP;
   decay_factor_ = 0;
   throttling_options_.reset();
 }
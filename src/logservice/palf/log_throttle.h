@@ -102,6 +102,7 @@ public:
                  IPalfEnvImpl *palf_env_impl);
   int after_append_log(const int64_t log_size);
   TO_STRING_KV(K_(last_update_ts),
+               K_(next_throttling_ts),
                K_(need_writing_throttling_notified),
                K_(appended_log_size_cur_round),
                K_(decay_factor),
@@ -123,7 +124,9 @@ private:
   const int64_t THROTTLING_CHUNK_SIZE = MAX_LOG_BUFFER_SIZE;
   //ts of lastest updating writing throttling info
   int64_t last_update_ts_;
-  //ts when next log can be appended
+  //ts when next log can be appended, shared by all LogIOWorkers of a tenant, each throttled
+  //task reserves its own slot after it, so N workers can not throttle N times faster than one.
+  int64_t next_throttling_ts_;
   //log_size can be appended during current round, will be reset when unrecyclable_size changed
   // notified by gc, local meta may not be ready
   mutable bool need_writing_throttling_notified_;
@@ -23,6 +23,7 @@
 #include "share/config/ob_server_config.h"
 #include "share/ob_errno.h"
 #include "share/ob_occam_thread_pool.h"
+#include "share/ob_thread_define.h"               // TGDefIDs
 #include "log_define.h"
 #include "palf_handle_impl_guard.h"             // IPalfHandleImplGuard
 #include "palf_handle.h"
@@ -183,6 +184,7 @@ PalfEnvImpl::PalfEnvImpl() : palf_meta_lock_(common::ObLatchIds::PALF_ENV_LOCK),
                              cb_thread_pool_(),
                              log_io_worker_wrapper_(),
                              log_shared_queue_th_(),
+                             log_read_ahead_th_(),
                              block_gc_timer_task_(),
                              log_updater_(),
                              monitor_(NULL),
@@ -194,6 +196,7 @@ PalfEnvImpl::PalfEnvImpl() : palf_meta_lock_(common::ObLatchIds::PALF_ENV_LOCK),
                              last_palf_epoch_(0),
                              rebuild_replica_log_lag_threshold_(0),
                              enable_log_cache_(false),
+                             enable_log_cache_read_ahead_(false),
                              diskspace_enough_(true),
                              tenant_id_(0),
                              is_inited_(false),
@@ -245,8 +248,10 @@ int PalfEnvImpl::init(
                                                  cb_thread_pool_.get_tg_id(),
                                                  log_alloc_mgr, this))) {
     PALF_LOG(ERROR, "LogIOWorker init failed", K(ret));
-  } else if (OB_FAIL(log_shared_queue_th_.init(this))) {
+  } else if (OB_FAIL(log_shared_queue_th_.init(this, lib::TGDefIDs::LogSharedQueueTh))) {
     PALF_LOG(ERROR, "LogSharedQueueTh init failed", K(ret));
+  } else if (OB_FAIL(log_read_ahead_th_.init(this, lib::TGDefIDs::LogReadAheadTh))) {
+    PALF_LOG(ERROR, "LogReadAheadTh init failed", K(ret));
   } else if (OB_FAIL(block_gc_timer_task_.init(this))) {
     PALF_LOG(ERROR, "ObCheckLogBlockCollectTask init failed", K(ret));
   } else if ((pret = snprintf(log_dir_, MAX_PATH_SIZE, "%s", base_dir)) && false) {
@@ -279,6 +284,7 @@ int PalfEnvImpl::init(
     is_inited_ = true;
     is_running_ = true;
     enable_log_cache_ = options.enable_log_cache_;
+    enable_log_cache_read_ahead_ = options.enable_log_cache_read_ahead_;
     PALF_LOG(INFO, "PalfEnvImpl init success", K(ret), K(self_), KPC(this));
   }
   if (OB_FAIL(ret) && OB_INIT_TWICE != ret) {
@@ -300,6 +306,8 @@ int PalfEnvImpl::start()
     PALF_LOG(ERROR, "LogIOWorker start failed", K(ret));
   } else if (OB_FAIL(log_shared_queue_th_.start())) {
     PALF_LOG(ERROR, "LogIOWorker start failed", K(ret));
+  } else if (OB_FAIL(log_read_ahead_th_.start())) {
+    PALF_LOG(ERROR, "LogReadAheadTh start failed", K(ret));
   } else if (OB_FAIL(block_gc_timer_task_.start())) {
     PALF_LOG(ERROR, "FileCollectTimerTask start failed", K(ret));
 	} else if (OB_FAIL(fetch_log_engine_.start())) {
@@ -322,6 +330,7 @@ void PalfEnvImpl::stop()
     is_running_ = false;
     log_io_worker_wrapper_.stop();
     log_shared_queue_th_.stop();
+    log_read_ahead_th_.stop();
     cb_thread_pool_.stop();
     block_gc_timer_task_.stop();
     fetch_log_engine_.stop();
@@ -336,6 +345,7 @@ void PalfEnvImpl::wait()
   PALF_LOG(INFO, "PalfEnvImpl begin wait", KPC(this));
   log_io_worker_wrapper_.wait();
   log_shared_queue_th_.wait();
+  log_read_ahead_th_.wait();
   cb_thread_pool_.wait();
   block_gc_timer_task_.wait();
   fetch_log_engine_.wait();
@@ -352,6 +362,7 @@ void PalfEnvImpl::destroy()
   palf_handle_impl_map_.destroy();
   log_io_worker_wrapper_.destroy();
   log_shared_queue_th_.destroy();
+  log_read_ahead_th_.destroy();
   cb_thread_pool_.destroy();
   log_loop_thread_.destroy();
   block_gc_timer_task_.destroy();
@@ -369,6 +380,7 @@ void PalfEnvImpl::destroy()
   disk_options_wrapper_.reset();
   rebuild_replica_log_lag_threshold_ = 0;
   enable_log_cache_ = false;
+  enable_log_cache_read_ahead_ = false;
 }
 
 // NB: not thread safe
@@ -928,6 +940,7 @@ int PalfEnvImpl::update_options(const PalfOptions &options)
     PALF_LOG(WARN, "update_disk_options failed", K(ret), K(options));
   } else {
     enable_log_cache_ = options.enable_log_cache_;
+    enable_log_cache_read_ahead_ = options.enable_log_cache_read_ahead_;
     PALF_LOG(INFO, "update_options successs", K(options), KPC(this));
   }
   return ret;
@@ -943,6 +956,21 @@ int PalfEnvImpl::get_options(PalfOptions &options)
     options.compress_options_ = log_rpc_.get_compress_opts();
     options.rebuild_replica_log_lag_threshold_ = rebuild_replica_log_lag_threshold_;
     options.enable_log_cache_ = enable_log_cache_;
+    options.enable_log_cache_read_ahead_ = enable_log_cache_read_ahead_;
+  }
+  return ret;
+}
+
+int PalfEnvImpl::submit_log_read_ahead_task(LogSharedTask *task)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_ISNULL(task)) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(task));
+  } else if (OB_FAIL(log_read_ahead_th_.push_task(task))) {
+    PALF_LOG(WARN, "push read ahead task failed", K(ret), KPC(task));
   }
   return ret;
 }
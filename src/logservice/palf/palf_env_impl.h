@@ -205,6 +205,8 @@ public:
   virtual int get_throttling_options(PalfThrottleOptions &option) = 0;
   virtual void period_calc_disk_usage() = 0;
   virtual int get_options(PalfOptions &options) = 0;
+  // the task is freed by the read-ahead thread, or by the caller when it fails
+  virtual int submit_log_read_ahead_task(LogSharedTask *task) = 0;
   VIRTUAL_TO_STRING_KV("IPalfEnvImpl", "Dummy");
 
 };
@@ -266,6 +268,7 @@ public:
   int get_stable_disk_usage(int64_t &used_size_byte, int64_t &total_usable_size_byte);
   int update_options(const PalfOptions &options);
   int get_options(PalfOptions &options);
+  int submit_log_read_ahead_task(LogSharedTask *task) override final;
   int64_t get_rebuild_replica_log_lag_threshold() const
   {return rebuild_replica_log_lag_threshold_;}
   int for_each(const common::ObFunction<int(const PalfHandle&)> &func);
@@ -371,6 +374,9 @@ private:
   common::ObOccamTimer election_timer_;
   LogIOWorkerWrapper log_io_worker_wrapper_;
   LogSharedQueueTh log_shared_queue_th_;
+  // reads the disk for LogColdCache read-ahead, apart from log_shared_queue_th_
+  // which handles the submission of logs
+  LogSharedQueueTh log_read_ahead_th_;
   BlockGCTimerTask block_gc_timer_task_;
   LogUpdater log_updater_;
   PalfMonitorCb *monitor_;
@@ -390,6 +396,7 @@ private:
   int64_t last_palf_epoch_;
   int64_t rebuild_replica_log_lag_threshold_;//for rebuild test
   bool enable_log_cache_;
+  bool enable_log_cache_read_ahead_;
 
   LogIOWorkerConfig log_io_worker_config_;
   bool diskspace_enough_;
@@ -4201,6 +4201,21 @@ int PalfHandleImpl::try_handle_next_submit_log()
   return ret;
 }
 
+int PalfHandleImpl::read_ahead_log_cache(const int64_t flashback_version,
+                                         const LSN &read_ahead_lsn,
+                                         const int64_t read_ahead_size)
+{
+  int ret = OB_SUCCESS;
+  // the lock is not held, since reading the disk may take a long time and the
+  // cache is filled without changing any state of palf
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(log_cache_.read_ahead(flashback_version, read_ahead_lsn, read_ahead_size))) {
+    PALF_LOG(TRACE, "read ahead log cache failed", K(ret), K_(palf_id), K(read_ahead_lsn), K(read_ahead_size));
+  }
+  return ret;
+}
+
 int PalfHandleImpl::inner_after_flush_log(const FlushLogCbCtx &flush_log_cb_ctx)
 {
   int ret = OB_SUCCESS;
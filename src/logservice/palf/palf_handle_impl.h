@@ -824,6 +824,10 @@ public:
                                     char *buf,
                                     int64_t &out_read_size) const = 0;
   virtual int try_handle_next_submit_log() = 0;
+  // read logs from the disk into the cold cache, called by the read-ahead thread
+  virtual int read_ahead_log_cache(const int64_t flashback_version,
+                                   const LSN &read_ahead_lsn,
+                                   const int64_t read_ahead_size) = 0;
 
   virtual int raw_read(const palf::LSN &lsn,
                        char *read_buf,
@@ -969,6 +973,9 @@ public:
                             char *buf,
                             int64_t &out_read_size) const;
   int try_handle_next_submit_log();
+  int read_ahead_log_cache(const int64_t flashback_version,
+                           const LSN &read_ahead_lsn,
+                           const int64_t read_ahead_size) override final;
 
   int raw_read(const palf::LSN &lsn,
                char *buffer,
@@ -26,6 +26,7 @@ void PalfOptions::reset()
   compress_options_.reset();
   rebuild_replica_log_lag_threshold_ = 0;
   enable_log_cache_ = false;
+  enable_log_cache_read_ahead_ = false;
 }
 
 bool PalfOptions::is_valid() const
@@ -55,7 +56,7 @@ bool PalfDiskOptions::is_valid() const
     && log_disk_throttling_percentage_ <= 100
     && log_disk_throttling_maximum_duration_ >= MIN_DURATION
     && log_disk_throttling_maximum_duration_ <= MAX_DURATION
-    && log_writer_parallelism_ >= 1 && log_writer_parallelism_ <= 8;
+    && log_writer_parallelism_ >= 1 && log_writer_parallelism_ <= 16;
 }
 
 bool PalfDiskOptions::operator==(const PalfDiskOptions &palf_disk_options) const
@@ -174,7 +174,8 @@ struct PalfOptions
   PalfOptions() : disk_options_(),
                   compress_options_(),
                   rebuild_replica_log_lag_threshold_(0),
-                  enable_log_cache_(false)
+                  enable_log_cache_(false),
+                  enable_log_cache_read_ahead_(false)
   {}
   ~PalfOptions() { reset(); }
   void reset();
@@ -182,12 +183,14 @@ struct PalfOptions
   TO_STRING_KV(K(disk_options_),
                K(compress_options_),
                K(rebuild_replica_log_lag_threshold_),
-               K(enable_log_cache_));
+               K(enable_log_cache_),
+               K(enable_log_cache_read_ahead_));
 public:
   PalfDiskOptions disk_options_;
   PalfTransportCompressOptions compress_options_;
   int64_t rebuild_replica_log_lag_threshold_;
   bool enable_log_cache_;
+  bool enable_log_cache_read_ahead_;
 };
 
 struct PalfThrottleOptions
@@ -166,6 +166,8 @@ ObLogReplayService::ObLogReplayService()
   : is_inited_(false),
     is_running_(false),
     tg_id_(-1),
+    prefetch_tg_id_(-1),
+    prefetch_handler_(),
     replay_stat_(),
     ls_adapter_(NULL),
     palf_env_(NULL),
@@ -203,11 +205,14 @@ int ObLogReplayService::init(PalfEnv *palf_env,
     CLOG_LOG(WARN, "fail to create thread group", K(ret));
   } else if (OB_FAIL(MTL_REGISTER_THREAD_DYNAMIC(thread_quota, tg_id_))) {
     CLOG_LOG(WARN, "MTL_REGISTER_THREAD_DYNAMIC failed", K(ret), K(tg_id_));
+  } else if (OB_FAIL(TG_CREATE_TENANT(lib::TGDefIDs::ReplayPrefetch, prefetch_tg_id_))) {
+    CLOG_LOG(WARN, "fail to create prefetch thread group", K(ret));
   } else if (OB_FAIL(replay_status_map_.init("REPLAY_STATUS", MAP_TENANT_ID))) {
     CLOG_LOG(WARN, "replay_status_map_ init error", K(ret));
   } else if (OB_FAIL(replay_stat_.init(this))) {
     CLOG_LOG(WARN, "replay_stat_ init error", K(ret));
   } else {
+    prefetch_handler_.set_replay_service(this);
     replayable_point_ = SCN::min_scn();
     pending_replay_log_size_ = 0;
     is_inited_ = true;
@@ -236,6 +241,8 @@ int ObLogReplayService::start()
     CLOG_LOG(ERROR, "start ObLogReplayService failed", K(ret));
   } else if (OB_FAIL(TG_SET_ADAPTIVE_STRATEGY(tg_id_, adaptive_strategy))) {
     CLOG_LOG(WARN, "set adaptive strategy failed", K(ret));
+  } else if (OB_FAIL(TG_SET_HANDLER_AND_START(prefetch_tg_id_, prefetch_handler_))) {
+    CLOG_LOG(ERROR, "start replay prefetch threads failed", K(ret));
   } else {
     is_running_ = true;
     int tmp_ret = OB_SUCCESS;
@@ -243,7 +250,7 @@ int ObLogReplayService::start()
       //不影响回放线程工作
       CLOG_LOG(WARN, "replay_stat start failed", K(tmp_ret));
     }
-    CLOG_LOG(INFO, "start ObLogReplayService success", K(ret), K(tg_id_));
+    CLOG_LOG(INFO, "start ObLogReplayService success", K(ret), K(tg_id_), K(prefetch_tg_id_));
   }
   return ret;
 }
@@ -270,7 +277,16 @@ void ObLogReplayService::wait()
   if (OB_FAIL(ret)) {
     CLOG_LOG(WARN, "ObLogReplayService failed to get queue number");
   }
+  // the prefetch tasks are dropped after the replay service is stopped
+  while (OB_SUCC(TG_GET_QUEUE_NUM(prefetch_tg_id_, num)) && num > 0) {
+    PAUSE();
+  }
+  if (OB_FAIL(ret)) {
+    CLOG_LOG(WARN, "ObLogReplayService failed to get prefetch queue number");
+  }
   CLOG_LOG(INFO, "replay service SimpleQueue empty");
+  TG_STOP(prefetch_tg_id_);
+  TG_WAIT(prefetch_tg_id_);
   TG_STOP(tg_id_);
   TG_WAIT(tg_id_);
   CLOG_LOG(INFO, "replay service SimpleQueue destroy finish");
@@ -283,11 +299,16 @@ void ObLogReplayService::destroy()
   (void)remove_all_ls_();
   is_inited_ = false;
   CLOG_LOG(INFO, "replay service destroy");
+  if (-1 != prefetch_tg_id_) {
+    TG_DESTROY(prefetch_tg_id_);
+    prefetch_tg_id_ = -1;
+  }
   if (-1 != tg_id_) {
     MTL_UNREGISTER_THREAD_DYNAMIC(tg_id_);
     TG_DESTROY(tg_id_);
     tg_id_ = -1;
   }
+  prefetch_handler_.set_replay_service(NULL);
   replayable_point_.reset();
   replay_stat_.destroy();
   pending_replay_log_size_ = 0;
@@ -339,6 +360,9 @@ void ObLogReplayService::handle(void *task)
     } else if (ObReplayServiceTaskType::SUBMIT_LOG_TASK == task_type) {
       ObReplayServiceSubmitTask *submit_task = static_cast<ObReplayServiceSubmitTask *>(task_to_handle);
       ret = handle_submit_task_(submit_task, is_timeslice_run_out);
+    } else if (ObReplayServiceTaskType::PREFETCH_LOG_TASK == task_type) {
+      ObReplayServicePrefetchTask *prefetch_task = static_cast<ObReplayServicePrefetchTask *>(task_to_handle);
+      ret = handle_prefetch_task_(prefetch_task, is_timeslice_run_out);
     } else {
       ret = OB_ERR_UNEXPECTED;
       CLOG_LOG(ERROR, "invalid task_type", K(ret), K(task_type), KPC(replay_status));
@@ -370,6 +394,16 @@ void ObLogReplayService::handle(void *task)
   }
 }
 
+void ObLogReplayService::PrefetchHandler::handle(void *task)
+{
+  if (OB_ISNULL(rp_sv_)) {
+    CLOG_LOG_RET(ERROR, OB_NOT_INIT, "replay service is NULL", KP(task));
+  } else {
+    // the prefetch task is pushed back into the prefetch threads by submit_task
+    rp_sv_->handle(task);
+  }
+}
+
 int ObLogReplayService::add_ls(const share::ObLSID &id)
 {
   int ret = OB_SUCCESS;
@@ -666,8 +700,10 @@ int ObLogReplayService::submit_task(ObReplayServiceTask *task)
     ret = OB_INVALID_ARGUMENT;
     CLOG_LOG(ERROR, "task is NULL", K(ret));
   } else {
+    const int tg_id = ObReplayServiceTaskType::PREFETCH_LOG_TASK == task->get_type() ?
+                      prefetch_tg_id_ : tg_id_;
     task->set_enqueue_ts(ObTimeUtility::fast_current_time());
-    while (OB_FAIL(TG_PUSH_TASK(tg_id_, task)) && OB_EAGAIN == ret) {
+    while (OB_FAIL(TG_PUSH_TASK(tg_id, task)) && OB_EAGAIN == ret) {
       //预期不应该失败
       ob_usleep(1000);
       CLOG_LOG(ERROR, "failed to push", K(ret));
@@ -1249,6 +1285,8 @@ int ObLogReplayService::handle_submit_task_(ObReplayServiceSubmitTask *submit_ta
         } else if (OB_SUCC(fetch_and_submit_single_log_(*replay_status, submit_task, to_submit_lsn,
                                                         to_submit_scn, log_size))) {
           count++;
+          // keep the logs in front of the iterator prefetched into the log cache
+          replay_status->trigger_prefetch_log(to_submit_lsn + log_size);
           if (!last_batch_to_submit_lsn.is_valid()) {
             last_batch_to_submit_lsn = to_submit_lsn;
           } else if ((0 == (count & (BATCH_PUSH_REPLAY_TASK_COUNT_THRESOLD - 1)))
@@ -1296,6 +1334,38 @@ int ObLogReplayService::handle_submit_task_(ObReplayServiceSubmitTask *submit_ta
   return ret;
 }
 
+int ObLogReplayService::handle_prefetch_task_(ObReplayServicePrefetchTask *prefetch_task,
+                                              bool &is_timeslice_run_out)
+{
+  int ret = OB_SUCCESS;
+  ObReplayStatus *replay_status = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    CLOG_LOG(WARN, "replay service not init", K(ret));
+  } else if (OB_ISNULL(prefetch_task)) {
+    ret = OB_ERR_UNEXPECTED;
+    on_replay_error_();
+    CLOG_LOG(ERROR, "prefetch_log_task is NULL", KPC(prefetch_task), KR(ret));
+  } else if (OB_ISNULL(replay_status = prefetch_task->get_replay_status())) {
+    ret = OB_ERR_UNEXPECTED;
+    on_replay_error_();
+    CLOG_LOG(ERROR, "replay status is NULL", KPC(prefetch_task), KPC(replay_status), KR(ret));
+  } else if (replay_status->try_rdlock()) {
+    if (!replay_status->is_enabled_without_lock() || !replay_status->need_submit_log()) {
+      // leader or disabled replay status does not prefetch
+    } else if (OB_FAIL(prefetch_task->prefetch(is_timeslice_run_out))) {
+      CLOG_LOG(WARN, "failed to prefetch log", KPC(prefetch_task), KPC(replay_status), K(ret));
+    }
+    replay_status->unlock();
+  } else {
+    //return OB_EAGAIN to avoid taking up worker threads
+    ret = OB_EAGAIN;
+    if (REACH_TIME_INTERVAL(1 * 1000 * 1000)) {
+      CLOG_LOG(INFO, "try lock failed", "replay_status", *replay_status, K(ret));
+    }
+  }
+  return ret;
+}
 
 int ObLogReplayService::handle_replay_task_(ObReplayServiceReplayTask *task_queue,
                                             bool &is_timeslice_run_out)
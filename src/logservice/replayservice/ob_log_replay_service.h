@@ -134,6 +134,20 @@ public:
   private:
     int ret_code_;
   };
+  // The prefetch tasks are handled by the ReplayPrefetch threads instead of
+  // the replay threads, so the log reading of prefetch never holds up the
+  // submit and replay tasks. The thread count of ReplayPrefetch caps the
+  // concurrent prefetches of the tenant.
+  class PrefetchHandler : public lib::TGTaskHandler
+  {
+  public:
+    PrefetchHandler() : rp_sv_(NULL) {}
+    ~PrefetchHandler() { rp_sv_ = NULL; }
+    void set_replay_service(ObLogReplayService *rp_sv) { rp_sv_ = rp_sv; }
+    void handle(void *task);
+  private:
+    ObLogReplayService *rp_sv_;
+  };
 public:
   void handle(void *task);
   int add_ls(const share::ObLSID &id);
@@ -198,6 +212,8 @@ private:
                           bool &is_timeslice_run_out);
   int handle_replay_task_(ObReplayServiceReplayTask *task_queue,
                           bool &is_timeslice_run_out);
+  int handle_prefetch_task_(ObReplayServicePrefetchTask *prefetch_task,
+                            bool &is_timeslice_run_out);
   int check_can_submit_log_replay_task_(ObLogReplayTask *replay_task,
                                         ObReplayStatus *replay_status);
   int do_replay_task_(ObLogReplayTask *replay_task,
@@ -250,6 +266,8 @@ private:
   bool is_inited_;
   bool is_running_;
   int tg_id_;
+  int prefetch_tg_id_;
+  PrefetchHandler prefetch_handler_;
   ReplayProcessStat replay_stat_;
   ObLSAdapter *ls_adapter_;
   palf::PalfEnv *palf_env_;
@@ -16,6 +16,8 @@
 #include "logservice/palf/palf_env.h"
 #include "lib/stat/ob_session_stat.h"
 #include "share/ob_errno.h"
+#include "common/ob_clock_generator.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
 {
@@ -335,6 +337,153 @@ int ObReplayServiceSubmitTask::update_next_to_submit_lsn_(const LSN &lsn)
   return ret;
 }
 
+//---------------ObReplayServicePrefetchTask---------------//
+int ObReplayServicePrefetchTask::init(PalfHandle *palf_handle,
+                                      ObReplayStatus *replay_status)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(replay_status) || OB_ISNULL(palf_handle)) {
+    ret = OB_INVALID_ARGUMENT;
+    CLOG_LOG(WARN, "invalid argument", K(type_), K(ret), KP(replay_status), KP(palf_handle));
+  } else {
+    ObLockGuard<ObSpinLock> guard(lock_);
+    palf_handle_ = palf_handle;
+    replay_status_ = replay_status;
+    type_ = ObReplayServiceTaskType::PREFETCH_LOG_TASK;
+    next_to_submit_lsn_.reset();
+    prefetch_end_lsn_.reset();
+    CLOG_LOG(INFO, "ObReplayServicePrefetchTask init success", K(type_), K(replay_status_));
+  }
+  return ret;
+}
+
+void ObReplayServicePrefetchTask::reset()
+{
+  //attention: type_ and replay_status_ can not be reset
+  ObLockGuard<ObSpinLock> guard(lock_);
+  next_to_submit_lsn_.reset();
+  prefetch_end_lsn_.reset();
+  free_read_buf_();
+  ObReplayServiceTask::reset();
+}
+
+void ObReplayServicePrefetchTask::destroy()
+{
+  reset();
+  palf_handle_ = NULL;
+  ObReplayServiceTask::destroy();
+}
+
+bool ObReplayServicePrefetchTask::need_prefetch(const LSN &next_to_submit_lsn)
+{
+  bool bool_ret = false;
+  refresh_config_();
+  const int64_t prefetch_size = ATOMIC_LOAD(&prefetch_size_);
+  ATOMIC_STORE(&next_to_submit_lsn_.val_, next_to_submit_lsn.val_);
+  if (prefetch_size > 0 && next_to_submit_lsn.is_valid()) {
+    const LSN prefetch_end_lsn(ATOMIC_LOAD(&prefetch_end_lsn_.val_));
+    bool_ret = !prefetch_end_lsn.is_valid()
+               || prefetch_end_lsn < next_to_submit_lsn + prefetch_size / 2;
+  }
+  return bool_ret;
+}
+
+int ObReplayServicePrefetchTask::prefetch(bool &is_timeslice_run_out)
+{
+  int ret = OB_SUCCESS;
+  const int64_t start_ts = ObClockGenerator::getClock();
+  const int64_t prefetch_size = ATOMIC_LOAD(&prefetch_size_);
+  const LSN next_to_submit_lsn(ATOMIC_LOAD(&next_to_submit_lsn_.val_));
+  LSN prefetch_lsn(ATOMIC_LOAD(&prefetch_end_lsn_.val_));
+  LSN end_lsn;
+  if (OB_ISNULL(palf_handle_)) {
+    ret = OB_NOT_INIT;
+    CLOG_LOG(WARN, "prefetch task not init", K(ret), KPC(this));
+  } else if (prefetch_size <= 0 || !next_to_submit_lsn.is_valid()) {
+    // prefetch is disabled
+  } else if (OB_ISNULL(read_buf_)
+             && OB_ISNULL(read_buf_ = static_cast<char *>(ob_malloc_align(LOG_DIO_ALIGN_SIZE,
+                 PREFETCH_READ_BUF_SIZE, ObMemAttr(MTL_ID(), "ReplayPrefetch"))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    CLOG_LOG(WARN, "failed to alloc prefetch read buf", K(ret), KPC(this));
+  } else if (OB_FAIL(palf_handle_->get_end_lsn(end_lsn))) {
+    CLOG_LOG(WARN, "get_end_lsn failed", K(ret), KPC(this));
+  } else {
+    LSN prefetch_end_lsn;
+    get_prefetch_range_(next_to_submit_lsn, end_lsn, prefetch_size, prefetch_lsn, prefetch_end_lsn);
+    while (OB_SUCC(ret) && prefetch_lsn < prefetch_end_lsn && !is_timeslice_run_out) {
+      const LSN read_lsn(lower_align(prefetch_lsn.val_, LOG_DIO_ALIGN_SIZE));
+      int64_t read_size = 0;
+      // raw_read reads through the log cache and fills the cache lines it misses
+      if (OB_FAIL(palf_handle_->raw_read(read_lsn, read_buf_, PREFETCH_READ_BUF_SIZE, read_size))) {
+        CLOG_LOG(WARN, "prefetch raw_read failed", K(ret), K(read_lsn), K(prefetch_end_lsn), KPC(this));
+      } else if (read_lsn + read_size <= prefetch_lsn) {
+        break;
+      } else {
+        prefetch_lsn = read_lsn + read_size;
+        ATOMIC_STORE(&prefetch_end_lsn_.val_, prefetch_lsn.val_);
+      }
+      if (ObClockGenerator::getClock() - start_ts > MAX_PREFETCH_TIME_PER_ROUND) {
+        is_timeslice_run_out = true;
+      }
+    }
+  }
+  // prefetch is only an optimization of reading, the submit task reads the logs
+  // by itself if they are not prefetched
+  if (OB_FAIL(ret)) {
+    if (REACH_TIME_INTERVAL(1000 * 1000)) {
+      CLOG_LOG(WARN, "prefetch log failed", K(ret), KPC(this));
+    }
+    ret = OB_SUCCESS;
+    is_timeslice_run_out = false;
+  }
+  return ret;
+}
+
+void ObReplayServicePrefetchTask::get_prefetch_range_(const LSN &next_to_submit_lsn,
+                                                      const LSN &end_lsn,
+                                                      const int64_t prefetch_size,
+                                                      LSN &prefetch_lsn,
+                                                      LSN &prefetch_end_lsn) const
+{
+  // 1. the logs behind the next log to submit are never read again.
+  // 2. the window which is far ahead of the next log to submit is left by the
+  //    iterator which was reset backward.
+  // 3. the logs after the end lsn have been truncated or flashed back, and the
+  //    cache lines of them are not valid anymore.
+  if (!prefetch_lsn.is_valid()
+      || prefetch_lsn < next_to_submit_lsn
+      || prefetch_lsn > next_to_submit_lsn + prefetch_size
+      || prefetch_lsn > end_lsn) {
+    prefetch_lsn = next_to_submit_lsn;
+  }
+  prefetch_end_lsn = MIN(end_lsn, next_to_submit_lsn + prefetch_size);
+}
+
+void ObReplayServicePrefetchTask::refresh_config_()
+{
+  const int64_t last_refresh_ts = ATOMIC_LOAD(&last_refresh_ts_);
+  const int64_t cur_ts = ObClockGenerator::getClock();
+  if (OB_UNLIKELY(cur_ts - last_refresh_ts > REFRESH_INTERVAL)
+      && ATOMIC_BCAS(&last_refresh_ts_, last_refresh_ts, cur_ts)) {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (OB_LIKELY(tenant_config.is_valid())) {
+      // the prefetched logs are only kept in the log cache
+      const int64_t prefetch_size = tenant_config->_enable_log_cache ?
+                                    tenant_config->_replay_log_prefetch_size : 0;
+      ATOMIC_STORE(&prefetch_size_, prefetch_size);
+    }
+  }
+}
+
+void ObReplayServicePrefetchTask::free_read_buf_()
+{
+  if (NULL != read_buf_) {
+    ob_free_align(read_buf_);
+    read_buf_ = NULL;
+  }
+}
+
 //---------------ObReplayServiceReplayTask---------------//
 int ObReplayServiceReplayTask::init(ObReplayStatus *replay_status,
                                     const int64_t idx)
@@ -592,6 +741,7 @@ ObReplayStatus::ObReplayStatus():
     rolelock_(common::ObLatchIds::REPLAY_STATUS_LOCK),
     rp_sv_(NULL),
     submit_log_task_(),
+    prefetch_log_task_(),
     palf_env_(NULL),
     palf_handle_(),
     fs_cb_(),
@@ -660,6 +810,7 @@ void ObReplayStatus::destroy()
       palf_env_->close(palf_handle_);
     }
     submit_log_task_.destroy();
+    prefetch_log_task_.destroy();
     for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
       task_queues_[i].destroy();
     }
@@ -710,6 +861,8 @@ int ObReplayStatus::enable_(const LSN &base_lsn, const SCN &base_scn)
     CLOG_LOG(WARN, "remain pending task when enable replay status", K(ret), KPC(this));
   } else if (OB_FAIL(submit_log_task_.init(base_lsn, base_scn, &palf_handle_, this))) {
     CLOG_LOG(WARN, "failed to init submit_log_task", K(ret), K(&palf_handle_));
+  } else if (OB_FAIL(prefetch_log_task_.init(&palf_handle_, this))) {
+    CLOG_LOG(WARN, "failed to init prefetch_log_task", K(ret), K(&palf_handle_));
   } else {
     for (int64_t i = 0; OB_SUCC(ret) && i < REPLAY_TASK_QUEUE_SIZE; ++i) {
       if (OB_FAIL(task_queues_[i].init(this, i))) {
@@ -765,6 +918,9 @@ int ObReplayStatus::disable_()
   int ret = OB_SUCCESS;
   is_enabled_ = false;
   submit_log_task_.reset();
+  // the prefetch window is dropped, the replay is disabled before the logs are
+  // flashed back or the replica is rebuilt
+  prefetch_log_task_.reset();
   for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
     task_queues_[i].reset();
   }
@@ -952,6 +1108,20 @@ int ObReplayStatus::update_end_offset(const LSN &lsn)
   return ret;
 }
 
+void ObReplayStatus::trigger_prefetch_log(const LSN &next_to_submit_lsn)
+{
+  int ret = OB_SUCCESS;
+  // the caller holds the read lock of rwlock_
+  if (!is_enabled_) {
+    // do nothing
+  } else if (!prefetch_log_task_.need_prefetch(next_to_submit_lsn)) {
+    // enough logs are prefetched
+  } else if (OB_FAIL(submit_task_to_replay_service_(prefetch_log_task_))) {
+    CLOG_LOG(WARN, "failed to submit prefetch_log_task to replay service", K(prefetch_log_task_),
+             KPC(this), K(ret));
+  }
+}
+
 int ObReplayStatus::get_ls_id(share::ObLSID &id)
 {
   int ret = OB_SUCCESS;
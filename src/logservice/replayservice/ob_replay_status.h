@@ -48,12 +48,16 @@ class ObLogReplayService;
 // 4.ObReplayServiceReplayTask: replay类型任务, 继承ObReplayServiceTask,
 //                              在replay status中对应task_queues_[i],
 //                              用于存放ObLogReplayTask
+// 5.ObReplayServicePrefetchTask: prefetch类型任务, 继承ObReplayServiceTask,
+//                              在replay status中对应prefetch_log_task_,
+//                              提前读取submit task即将迭代的日志并填充log cache
 class ObReplayStatus;
 enum class ObReplayServiceTaskType
 {
   INVALID_LOG_TASK = 0,
   SUBMIT_LOG_TASK = 1,
   REPLAY_LOG_TASK = 2,
+  PREFETCH_LOG_TASK = 3,
 };
 
 //虚拟表统计
@@ -338,6 +342,71 @@ private:
   palf::PalfBufferIterator iterator_;
 };
 
+// ObReplayServicePrefetchTask reads the logs in front of the submit task
+// through palf, so the log cache is filled before the iterator of the submit
+// task reaches them, and the submit task reads the logs from the cache instead
+// of waiting for the disk io. The logs within _replay_log_prefetch_size after
+// the next log to submit are prefetched, and the task is pushed into the replay
+// service again when less than half of them are left. The task is handled by
+// the ReplayPrefetch threads of the replay service, not by the replay threads.
+class ObReplayServicePrefetchTask : public ObReplayServiceTask
+{
+public:
+  ObReplayServicePrefetchTask(): ObReplayServiceTask(),
+    palf_handle_(NULL),
+    next_to_submit_lsn_(),
+    prefetch_end_lsn_(),
+    prefetch_size_(DEFAULT_PREFETCH_SIZE),
+    last_refresh_ts_(OB_INVALID_TIMESTAMP),
+    read_buf_(NULL)
+  {
+    type_ = ObReplayServiceTaskType::PREFETCH_LOG_TASK;
+  }
+  ~ObReplayServicePrefetchTask()
+  {
+    destroy();
+  }
+  int init(palf::PalfHandle *palf_handle,
+           ObReplayStatus *replay_status);
+  void reset() override;
+  void destroy() override;
+
+public:
+  // record the next log to submit, return true if the prefetched logs are not enough
+  bool need_prefetch(const palf::LSN &next_to_submit_lsn);
+  // read the logs in front of the next log to submit until the prefetch window is full
+  int prefetch(bool &is_timeslice_run_out);
+
+  INHERIT_TO_STRING_KV("ObReplayServicePrefetchTask", ObReplayServiceTask,
+                       K(next_to_submit_lsn_),
+                       K(prefetch_end_lsn_),
+                       K(prefetch_size_));
+private:
+  // compute the logs [prefetch_lsn, prefetch_end_lsn) to be read in this round,
+  // prefetch_lsn is the end of the last prefetched logs as input
+  void get_prefetch_range_(const palf::LSN &next_to_submit_lsn,
+                           const palf::LSN &end_lsn,
+                           const int64_t prefetch_size,
+                           palf::LSN &prefetch_lsn,
+                           palf::LSN &prefetch_end_lsn) const;
+  void refresh_config_();
+  void free_read_buf_();
+private:
+  static const int64_t DEFAULT_PREFETCH_SIZE = 8 * (1LL << 20); //8MB
+  static const int64_t PREFETCH_READ_BUF_SIZE = 2 * (1LL << 20); //2MB
+  static const int64_t MAX_PREFETCH_TIME_PER_ROUND = 10 * 1000; //10ms
+  static const int64_t REFRESH_INTERVAL = 5 * 1000 * 1000; //5s
+private:
+  palf::PalfHandle *palf_handle_;
+  // updated by the submit task
+  palf::LSN next_to_submit_lsn_;
+  // the logs before prefetch_end_lsn_ have been read into the log cache
+  palf::LSN prefetch_end_lsn_;
+  int64_t prefetch_size_;
+  int64_t last_refresh_ts_;
+  char *read_buf_;
+};
+
 class ObReplayServiceReplayTask : public ObReplayServiceTask
 {
 public:
@@ -538,6 +607,8 @@ public:
   void set_post_barrier_submitted(const palf::LSN &lsn);
   int set_post_barrier_finished(const palf::LSN &lsn);
   int trigger_fetch_log();
+  // 提交日志时检查预读进度, 预读的日志不足时提交prefetch任务
+  void trigger_prefetch_log(const palf::LSN &next_to_submit_lsn);
   int stat(LSReplayStat &stat) const;
   int diagnose(ReplayDiagnoseInfo &diagnose_info);
   inline void inc_ref()
@@ -630,6 +701,7 @@ private:
   // be sure to clear these queues when the partition is offline to prevent old replay task is replayed in situation of migrating out and then migrating in
   ObReplayServiceReplayTask task_queues_[common::REPLAY_TASK_QUEUE_SIZE];
   ObReplayServiceSubmitTask submit_log_task_;
+  ObReplayServicePrefetchTask prefetch_log_task_;
 
   palf::PalfEnv *palf_env_;
   palf::PalfHandle palf_handle_;
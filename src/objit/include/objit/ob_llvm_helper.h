@@ -401,6 +401,10 @@ public:
   int create_add(ObLLVMValue &value1, int64_t &value2, ObLLVMValue &result);
   int create_sub(ObLLVMValue &value1, ObLLVMValue &value2, ObLLVMValue &result);
   int create_sub(ObLLVMValue &value1, int64_t &value2, ObLLVMValue &result);
+  int create_bit_and(ObLLVMValue &value1, ObLLVMValue &value2, ObLLVMValue &result);
+  int create_bit_or(ObLLVMValue &value1, ObLLVMValue &value2, ObLLVMValue &result);
+  int create_bit_xor(ObLLVMValue &value1, ObLLVMValue &value2, ObLLVMValue &result);
+  int create_select(ObLLVMValue &cond, ObLLVMValue &value1, ObLLVMValue &value2, ObLLVMValue &result);
   int create_ret(ObLLVMValue &value);
   int create_gep(const common::ObString &name, ObLLVMValue &value, common::ObIArray<int64_t> &idxs, ObLLVMValue &result);
   int create_gep(const common::ObString &name, ObLLVMValue &value, common::ObIArray<ObLLVMValue> &idxs, ObLLVMValue &result);
@@ -408,6 +412,7 @@ public:
   int create_gep(const common::ObString &name, ObLLVMValue &value, ObLLVMValue &idx, ObLLVMValue &result);
   int create_extract_value(const common::ObString &name, ObLLVMValue &value, uint64_t idx, ObLLVMValue &result);
   int create_const_gep1_64(const common::ObString &name, ObLLVMValue &value, uint64_t idx, ObLLVMValue &result);
+  int create_gep1(const common::ObString &name, ObLLVMValue &value, ObLLVMValue &idx, ObLLVMValue &result);
   int create_ptr_to_int(const common::ObString &name, const ObLLVMValue &value, const ObLLVMType &type, ObLLVMValue &result);
   int create_int_to_ptr(const common::ObString &name, const ObLLVMValue &value, const ObLLVMType &type, ObLLVMValue &result);
   int create_bit_cast(const common::ObString &name, const ObLLVMValue &value, const ObLLVMType &type, ObLLVMValue &result);
@@ -415,6 +420,7 @@ public:
   int create_addr_space_cast(const common::ObString &name, const ObLLVMValue &value, const ObLLVMType &type, ObLLVMValue &result);
   int create_sext(const common::ObString &name, const ObLLVMValue &value, const ObLLVMType &type, ObLLVMValue &result);
   int create_sext_or_bitcast(const common::ObString &name, const ObLLVMValue &value, const ObLLVMType &type, ObLLVMValue &result);
+  int create_zext(const common::ObString &name, const ObLLVMValue &value, const ObLLVMType &type, ObLLVMValue &result);
   int create_landingpad(const common::ObString &name, ObLLVMType &type, ObLLVMLandingPad &result);
   int create_switch(ObLLVMValue &value, ObLLVMBasicBlock &default_block, ObLLVMSwitch &result);
   int create_resume(ObLLVMValue &value);
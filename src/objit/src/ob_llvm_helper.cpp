@@ -1330,6 +1330,53 @@ int ObLLVMHelper::create_##name(ObLLVMValue &value1, int64_t &value2, ObLLVMValu
 DEFINE_CREATE_ARITH_INT(add)
 DEFINE_CREATE_ARITH_INT(sub)
 
+#define DEFINE_CREATE_BINARY_OP(func_name, op_name) \
+int ObLLVMHelper::create_##func_name(ObLLVMValue &value1, ObLLVMValue &value2, ObLLVMValue &result) \
+{ \
+  int ret = OB_SUCCESS; \
+  if (OB_ISNULL(jc_)) { \
+    ret = OB_NOT_INIT; \
+    LOG_WARN("jc is NULL", K(ret)); \
+  } else if (OB_ISNULL(value1.get_v()) || OB_ISNULL(value2.get_v())) { \
+    ret = OB_INVALID_ARGUMENT; \
+    LOG_WARN("value is NULL", K(value1), K(value2), K(ret)); \
+  } else { \
+    llvm::Value *value = jc_->get_builder().Create##op_name(value1.get_v(), value2.get_v()); \
+    if (OB_ISNULL(value)) { \
+      ret = OB_ERR_UNEXPECTED; \
+      LOG_WARN("failed to create binary op", K(ret)); \
+    } else { \
+      result.set_v(value); \
+    } \
+  } \
+  return ret; \
+}
+
+DEFINE_CREATE_BINARY_OP(bit_and, And)
+DEFINE_CREATE_BINARY_OP(bit_or, Or)
+DEFINE_CREATE_BINARY_OP(bit_xor, Xor)
+
+int ObLLVMHelper::create_select(ObLLVMValue &cond, ObLLVMValue &value1, ObLLVMValue &value2, ObLLVMValue &result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(jc_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("jc is NULL", K(ret));
+  } else if (OB_ISNULL(cond.get_v()) || OB_ISNULL(value1.get_v()) || OB_ISNULL(value2.get_v())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("value is NULL", K(cond), K(value1), K(value2), K(ret));
+  } else {
+    llvm::Value *value = jc_->get_builder().CreateSelect(cond.get_v(), value1.get_v(), value2.get_v());
+    if (OB_ISNULL(value)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("failed to create select", K(ret));
+    } else {
+      result.set_v(value);
+    }
+  }
+  return ret;
+}
+
 int ObLLVMHelper::create_ret(ObLLVMValue &value)
 {
   int ret = OB_SUCCESS;
@@ -1464,6 +1511,27 @@ int ObLLVMHelper::create_const_gep1_64(const ObString &name, ObLLVMValue &value,
   return ret;
 }
 
+int ObLLVMHelper::create_gep1(const ObString &name, ObLLVMValue &value, ObLLVMValue &idx, ObLLVMValue &result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(jc_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("jc is NULL", K(ret));
+  } else if (OB_ISNULL(value.get_v()) || OB_ISNULL(idx.get_v())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("value is NULL", K(name), K(value), K(idx), K(ret));
+  } else {
+    llvm::Value *elem = jc_->get_builder().CreateGEP(value.get_v(), idx.get_v(), make_string_ref(name));
+    if (OB_ISNULL(elem)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("failed to create gep1", K(ret));
+    } else {
+      result.set_v(elem);
+    }
+  }
+  return ret;
+}
+
 int ObLLVMHelper::create_extract_value(const ObString &name, ObLLVMValue &value, uint64_t idx, ObLLVMValue &result)
 {
   int ret = OB_SUCCESS;
@@ -1514,6 +1582,7 @@ DEFINE_CREATE_CAST(pointer_cast, PointerCast)
 DEFINE_CREATE_CAST(addr_space_cast, AddrSpaceCast)
 DEFINE_CREATE_CAST(sext_or_bitcast, SExtOrBitCast)
 DEFINE_CREATE_CAST(sext, SExt);
+DEFINE_CREATE_CAST(zext, ZExt);
 
 int ObLLVMHelper::create_landingpad(const ObString &name, ObLLVMType &type, ObLLVMLandingPad &result)
 {
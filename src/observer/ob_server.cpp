@@ -2913,6 +2913,12 @@ int ObServer::init_storage()
                                     storage_env_.bf_cache_miss_count_threshold_,
                                     storage_env_.storage_meta_cache_priority_))) {
       LOG_WARN("Fail to init OB_STORE_CACHE, ", KR(ret), K(storage_env_.data_dir_));
+    } else if (OB_FAIL(OB_STORE_CACHE.init_secondary_block_cache(
+        0 == STRLEN(config_._micro_block_secondary_cache_path.str())
+            ? storage_env_.sstable_dir_ : config_._micro_block_secondary_cache_path.str(),
+        config_._micro_block_secondary_cache_size,
+        config_._micro_block_secondary_cache_tenant_limit_percentage))) {
+      LOG_WARN("Fail to init micro block secondary cache", KR(ret), K(storage_env_.sstable_dir_));
     } else if (OB_FAIL(ObTmpFileManager::get_instance().init())) {
       LOG_WARN("fail to init temp file manager", KR(ret));
     } else if (OB_FAIL(OB_SERVER_BLOCK_MGR.init(THE_IO_DEVICE,
@@ -3145,6 +3151,9 @@ int ObServer::reload_config()
                                                    GCONF.bf_cache_priority,
                                                    GCONF.storage_meta_cache_priority))) {
     LOG_WARN("set cache priority fail, ", KR(ret));
+  } else if (OB_FAIL(OB_STORE_CACHE.set_secondary_block_cache_tenant_limit(
+      GCONF._micro_block_secondary_cache_tenant_limit_percentage))) {
+    LOG_WARN("set secondary block cache tenant limit fail", KR(ret));
   } else if (OB_FAIL(reload_bandwidth_throttle_limit(ethernet_speed_))) {
     LOG_WARN("failed to reload_bandwidth_throttle_limit", KR(ret));
   }
@@ -293,6 +293,14 @@ int ObInfoSchemaKvCacheTable::process_row(const ObKVCacheInst *inst)
         cells_[cell_idx].set_int(inst->status_.hold_size_);
         break;
       }
+      case TOTAL_ADMIT_CNT: {
+        cells_[cell_idx].set_int(inst->status_.total_admit_cnt_.value());
+        break;
+      }
+      case TOTAL_REJECT_CNT: {
+        cells_[cell_idx].set_int(inst->status_.total_reject_cnt_.value());
+        break;
+      }
       default: {
         ret = OB_ERR_UNEXPECTED;
         SERVER_LOG(WARN, "Invalid column id", K(ret), K(cell_idx), K(output_column_ids_), K(col_id));
@@ -62,7 +62,9 @@ private:
     TOTAL_PUT_CNT,
     TOTAL_HIT_CNT,
     TOTAL_MISS_CNT,
-    HOLD_SIZE
+    HOLD_SIZE,
+    TOTAL_ADMIT_CNT,
+    TOTAL_REJECT_CNT
   };
   common::ObAddr *addr_;
   common::ObString ipstr_;
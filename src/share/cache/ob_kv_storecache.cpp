@@ -301,9 +301,10 @@ int ObKVGlobalCache::put(
   const ObIKVCacheValue &value,
   const ObIKVCacheValue *&pvalue,
   ObKVMemBlockHandle *&mb_handle,
-  bool overwrite)
+  bool overwrite,
+  const bool need_fetch)
 {
-  return put(store_, cache_id, key, value, pvalue, mb_handle, overwrite);
+  return put(store_, cache_id, key, value, pvalue, mb_handle, overwrite, true /*check_admission*/, need_fetch);
 }
 
 int ObKVGlobalCache::put(
@@ -323,7 +324,9 @@ int ObKVGlobalCache::put(
     LOG_WARN("invalid argument", K(ret), KP(working_set));
   } else {
     const int64_t cache_id = working_set->get_cache_id();
-    if (OB_FAIL(put(*working_set, cache_id, key, value, pvalue, mb_handle, overwrite))) {
+    // the working set is bounded by itself, it does not go through the admission policy
+    if (OB_FAIL(put(*working_set, cache_id, key, value, pvalue, mb_handle, overwrite,
+                    false /*check_admission*/, true /*need_fetch*/))) {
       LOG_WARN("put failed", K(ret), K(cache_id));
     }
   }
@@ -338,7 +341,9 @@ int ObKVGlobalCache::put(
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite)
+    bool overwrite,
+    const bool check_admission,
+    const bool need_fetch)
 {
   int ret = OB_SUCCESS;
   ObKVCacheInstKey inst_key(cache_id, key.get_tenant_id());
@@ -347,6 +352,7 @@ int ObKVGlobalCache::put(
   pvalue = NULL;
   mb_handle = NULL;
   MBWrapper *mb_wrapper = NULL;
+  bool admitted = true;
   if (OB_UNLIKELY(!inited_)) {
     ret = OB_NOT_INIT;
     COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
@@ -360,12 +366,18 @@ int ObKVGlobalCache::put(
     COMMON_LOG(WARN, "The inst is NULL, ", K(ret));
   } else if (!overwrite && (OB_SUCC(map_.get(cache_id, key, pvalue, mb_handle)))) {
     ret = OB_ENTRY_EXIST;
+  } else if (FALSE_IT(admitted = !check_admission || inst_handle.get_inst()->admit(
+      key.hash(), ObKVStoreMemBlock::get_align_size(key, value)))) {
+  } else if (!admitted && !need_fetch) {
+    // rejected by the admission policy, the kvpair is not kept in cache at all
   } else if (OB_FAIL(store.store(*inst_handle.get_inst(), key, value, kvpair, mb_wrapper))) {
     COMMON_LOG(WARN, "Fail to store kvpair to store, ", K(ret));
   } else {
     mb_handle = mb_wrapper->get_mb_handle();
     pvalue = kvpair->value_;
-    if (OB_FAIL(map_.put(*inst_handle.get_inst(), key, kvpair, mb_handle, overwrite))) {
+    if (!admitted) {
+      // the caller still needs the value, keep it in store only and let it be washed with the memblock
+    } else if (OB_FAIL(map_.put(*inst_handle.get_inst(), key, kvpair, mb_handle, overwrite))) {
       if (OB_ENTRY_EXIST != ret) {
         COMMON_LOG(WARN, "Fail to put kvpair to map, ", K(ret));
       }
@@ -737,6 +749,37 @@ int ObKVGlobalCache::set_mem_limit_pct(const int64_t cache_id, const int64_t mem
   return ret;
 }
 
+int ObKVGlobalCache::set_admission_policy(const int64_t cache_id, const ObKVCacheAdmissionPolicy policy)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(cache_id < 0) || OB_UNLIKELY(cache_id >= MAX_CACHE_NUM)
+      || OB_UNLIKELY(policy >= MAX_ADMISSION_POLICY)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(cache_id), K(policy), K(ret));
+  } else {
+    ATOMIC_STORE(&configs_[cache_id].admission_policy_, policy);
+  }
+  return ret;
+}
+
+int ObKVGlobalCache::set_wash_callback(const int64_t cache_id, ObIKVCacheWashCallback *wash_callback)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(cache_id < 0) || OB_UNLIKELY(cache_id >= MAX_CACHE_NUM)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(cache_id), K(ret));
+  } else {
+    ATOMIC_STORE(&configs_[cache_id].wash_callback_, wash_callback);
+  }
+  return ret;
+}
+
 void ObKVGlobalCache::wash()
 {
   if (OB_LIKELY(inited_ && !stopped_)) {
@@ -811,6 +854,26 @@ void ObKVGlobalCache::reload_priority()
   }
 }
 
+void ObKVGlobalCache::reload_admission()
+{
+  int ret = OB_SUCCESS;
+  for (int16_t i = 0; i < MAX_CACHE_NUM; ++i) {
+    if (configs_[i].is_valid_) {
+      bool enable_admission = false;
+      if (0 == STRNCMP(configs_[i].cache_name_, "user_block_cache", MAX_CACHE_NAME_LENGTH)) {
+        enable_admission = GCONF._enable_user_block_cache_admission;
+      } else if (0 == STRNCMP(configs_[i].cache_name_, "user_row_cache", MAX_CACHE_NAME_LENGTH)) {
+        enable_admission = GCONF._enable_user_row_cache_admission;
+      } else if (0 == STRNCMP(configs_[i].cache_name_, "fuse_row_cache", MAX_CACHE_NAME_LENGTH)) {
+        enable_admission = GCONF._enable_fuse_row_cache_admission;
+      }
+      if (OB_FAIL(set_admission_policy(i, enable_admission ? TINY_LFU : ADMIT_ALL))) {
+        COMMON_LOG(WARN, "Fail to set admission policy, ", K(i), K(enable_admission));
+      }
+    }
+  }
+}
+
 int ObKVGlobalCache::reload_wash_interval()
 {
   int ret = OB_SUCCESS;
@@ -49,7 +49,14 @@ public:
   virtual int erase(const Key &key) = 0;
   virtual int alloc(const uint64_t tenant_id, const int64_t key_size, const int64_t value_size,
       ObKVCachePair *&kvpair, ObKVCacheHandle &handle, ObKVCacheInstHandle &inst_handle) = 0;
+  // put_kvpair does not check the admission policy, the caller checks it by admit before the
+  // kvpair is allocated, so that a rejected kvpair takes no memory of the cache.
   virtual int put_kvpair(ObKVCacheInstHandle &inst_handle, ObKVCachePair *kvpair, ObKVCacheHandle &handle, bool overwrite = true);
+  virtual bool admit(const uint64_t tenant_id, const Key &key, const int64_t kv_size)
+  {
+    UNUSEDx(tenant_id, key, kv_size);
+    return true;
+  }
 };
 
 template <class Key, class Value>
@@ -62,7 +69,12 @@ public:
   void destroy();
   int set_priority(const int64_t priority);
   int set_mem_limit_pct(const int64_t mem_limit_pct);
+  int set_admission_policy(const ObKVCacheAdmissionPolicy policy);
+  int set_wash_callback(ObIKVCacheWashCallback *wash_callback);
   virtual int put(const Key &key, const Value &value, bool overwrite = true);
+  // A kvpair rejected by the admission policy is still stored, because the caller reads the
+  // value through pvalue and handle right after. It is not indexed in the map, so it can not
+  // be hit later and is washed together with its memblock.
   virtual int put_and_fetch(
     const Key &key,
     const Value &value,
@@ -79,6 +91,7 @@ public:
       ObKVCachePair *&kvpair,
       ObKVCacheHandle &handle,
       ObKVCacheInstHandle &inst_handle) override;
+  virtual bool admit(const uint64_t tenant_id, const Key &key, const int64_t kv_size) override;
   int64_t size(const uint64_t tenant_id = OB_SYS_TENANT_ID) const;
   int64_t count(const uint64_t tenant_id = OB_SYS_TENANT_ID) const;
   int64_t get_hit_cnt(const uint64_t tenant_id = OB_SYS_TENANT_ID) const;
@@ -139,6 +152,7 @@ public:
   void wait();
   void destroy();
   void reload_priority();
+  void reload_admission();
   int reload_wash_interval();
   int64_t get_suitable_bucket_num();
   int get_cache_inst_info(const uint64_t tenant_id, ObIArray<ObKVCacheInstHandle> &inst_handles);
@@ -175,13 +189,19 @@ private:
   int delete_working_set(ObWorkingSet *working_set);
   int set_priority(const int64_t cache_id, const int64_t priority);
   int set_mem_limit_pct(const int64_t cache_id, const int64_t mem_limit_pct);
+  int set_admission_policy(const int64_t cache_id, const ObKVCacheAdmissionPolicy policy);
+  // the callback must outlive the cache, set it to NULL before destroying it
+  int set_wash_callback(const int64_t cache_id, ObIKVCacheWashCallback *wash_callback);
+  // @param need_fetch: whether the caller is going to read the value through pvalue and mb_handle,
+  //                    if not, a kvpair rejected by the admission policy is not stored at all.
   int put(
     const int64_t cache_id,
     const ObIKVCacheKey &key,
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite = true);
+    bool overwrite = true,
+    const bool need_fetch = true);
   int put(
     ObWorkingSet *working_set,
     const ObIKVCacheKey &key,
@@ -197,7 +217,9 @@ private:
     const ObIKVCacheValue &value,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle,
-    bool overwrite = true);
+    bool overwrite,
+    const bool check_admission,
+    const bool need_fetch);
   int alloc(
       const int64_t cache_id,
       const uint64_t tenant_id,
@@ -477,6 +499,32 @@ int ObKVCache<Key, Value>::set_mem_limit_pct(const int64_t mem_limit_pct)
   return ret;
 }
 
+template <class Key, class Value>
+int ObKVCache<Key, Value>::set_admission_policy(const ObKVCacheAdmissionPolicy policy)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
+  } else if (OB_FAIL(ObKVGlobalCache::get_instance().set_admission_policy(cache_id_, policy))) {
+    COMMON_LOG(WARN, "Fail to set admission policy, ", K(policy), K(ret));
+  }
+  return ret;
+}
+
+template <class Key, class Value>
+int ObKVCache<Key, Value>::set_wash_callback(ObIKVCacheWashCallback *wash_callback)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
+  } else if (OB_FAIL(ObKVGlobalCache::get_instance().set_wash_callback(cache_id_, wash_callback))) {
+    COMMON_LOG(WARN, "Fail to set wash callback, ", KP(wash_callback), K(ret));
+  }
+  return ret;
+}
+
 template <class Key, class Value>
 int64_t ObKVCache<Key, Value>::size(const uint64_t tenant_id) const
 {
@@ -576,7 +624,7 @@ int ObKVCache<Key, Value>::put(const Key &key, const Value &value, bool overwrit
     ret = OB_NOT_INIT;
     COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
   } else if (OB_FAIL(ObKVGlobalCache::get_instance().put(cache_id_, key, value, pvalue,
-      handle.mb_handle_, overwrite))) {
+      handle.mb_handle_, overwrite, false /*need_fetch*/))) {
     if (OB_ENTRY_EXIST != ret) {
       COMMON_LOG(WARN, "Fail to put kv to ObKVGlobalCache, ", K_(cache_id), K(ret));
     }
@@ -681,6 +729,23 @@ int ObKVCache<Key, Value>::alloc(const uint64_t tenant_id, const int64_t key_siz
 }
 
 
+template <class Key, class Value>
+bool ObKVCache<Key, Value>::admit(const uint64_t tenant_id, const Key &key, const int64_t kv_size)
+{
+  bool admitted = true;
+  if (OB_LIKELY(inited_)) {
+    int ret = OB_SUCCESS;
+    ObKVCacheInstKey inst_key(cache_id_, tenant_id);
+    ObKVCacheInstHandle inst_handle;
+    if (OB_FAIL(ObKVGlobalCache::get_instance().insts_.get_cache_inst(inst_key, inst_handle))) {
+      COMMON_LOG(WARN, "Fail to get cache inst, ", K(ret), K_(cache_id), K(tenant_id));
+    } else if (OB_NOT_NULL(inst_handle.get_inst())) {
+      admitted = inst_handle.get_inst()->admit(key.hash(), kv_size);
+    }
+  }
+  return admitted;
+}
+
 template <class Key, class Value>
 int64_t ObKVCache<Key, Value>::store_size(const uint64_t tenant_id) const
 {
@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+#include "share/cache/ob_kvcache_admission.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/atomic/ob_atomic.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+/*
+ * -------------------------------------------------------------ObKVCacheFrequencySketch---------------------------------------------------------------
+ */
+ObKVCacheFrequencySketch::ObKVCacheFrequencySketch()
+  : is_inited_(false),
+    table_(NULL),
+    word_cnt_(0),
+    sample_size_(0),
+    add_cnt_(0)
+{
+}
+
+ObKVCacheFrequencySketch::~ObKVCacheFrequencySketch()
+{
+  destroy();
+}
+
+int ObKVCacheFrequencySketch::init(const int64_t word_cnt, const lib::ObMemAttr &attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("The ObKVCacheFrequencySketch has been inited", K(ret));
+  } else if (OB_UNLIKELY(word_cnt <= 0 || 0 != (word_cnt & (word_cnt - 1)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument, word_cnt must be power of 2", K(ret), K(word_cnt));
+  } else if (OB_ISNULL(table_ = static_cast<uint64_t *>(ob_malloc(word_cnt * sizeof(uint64_t), attr)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Fail to allocate memory for frequency sketch", K(ret), K(word_cnt));
+  } else {
+    MEMSET(table_, 0, word_cnt * sizeof(uint64_t));
+    word_cnt_ = word_cnt;
+    sample_size_ = SAMPLE_FACTOR * word_cnt * COUNTERS_PER_WORD;
+    add_cnt_ = 0;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObKVCacheFrequencySketch::destroy()
+{
+  if (OB_NOT_NULL(table_)) {
+    ob_free(table_);
+    table_ = NULL;
+  }
+  word_cnt_ = 0;
+  sample_size_ = 0;
+  add_cnt_ = 0;
+  is_inited_ = false;
+}
+
+uint64_t ObKVCacheFrequencySketch::index_hash_(const uint64_t hash, const int64_t i)
+{
+  static const uint64_t SEEDS[DEPTH] = {
+    0xc3a5c85c97cb3127UL, 0xb492b66fbe98f273UL, 0x9ae16a3b2f90404fUL, 0xcbf29ce484222325UL };
+  // finalizer of murmurhash3, keys such as integers do not have well distributed hash values
+  uint64_t h = hash ^ SEEDS[i];
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdUL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53UL;
+  h ^= h >> 33;
+  return h;
+}
+
+bool ObKVCacheFrequencySketch::increment(const uint64_t hash)
+{
+  bool halved = false;
+  if (IS_INIT) {
+    for (int64_t i = 0; i < DEPTH; ++i) {
+      const uint64_t h = index_hash_(hash, i);
+      uint64_t *word = table_ + ((h >> COUNTER_BITS) & (word_cnt_ - 1));
+      const int64_t shift = (h & (COUNTERS_PER_WORD - 1)) * COUNTER_BITS;
+      uint64_t old_val = ATOMIC_LOAD(word);
+      while (((old_val >> shift) & MAX_COUNTER) < MAX_COUNTER) {
+        const uint64_t cur_val = ATOMIC_VCAS(word, old_val, old_val + (1UL << shift));
+        if (cur_val == old_val) {
+          break;
+        }
+        old_val = cur_val;
+      }
+    }
+    if (0 == ATOMIC_AAF(&add_cnt_, 1) % sample_size_) {
+      halve_();
+      halved = true;
+    }
+  }
+  return halved;
+}
+
+int64_t ObKVCacheFrequencySketch::estimate(const uint64_t hash) const
+{
+  int64_t freq = 0;
+  if (IS_INIT) {
+    freq = MAX_COUNTER;
+    for (int64_t i = 0; i < DEPTH; ++i) {
+      const uint64_t h = index_hash_(hash, i);
+      const uint64_t word = ATOMIC_LOAD(table_ + ((h >> COUNTER_BITS) & (word_cnt_ - 1)));
+      const int64_t shift = (h & (COUNTERS_PER_WORD - 1)) * COUNTER_BITS;
+      freq = MIN(freq, static_cast<int64_t>((word >> shift) & MAX_COUNTER));
+    }
+  }
+  return freq;
+}
+
+void ObKVCacheFrequencySketch::halve_()
+{
+  for (int64_t i = 0; i < word_cnt_; ++i) {
+    ATOMIC_STORE(table_ + i, (ATOMIC_LOAD(table_ + i) >> 1) & HALVE_MASK);
+  }
+}
+
+/*
+ * -------------------------------------------------------------ObKVCacheTinyLFUAdmission---------------------------------------------------------------
+ */
+ObKVCacheTinyLFUAdmission::ObKVCacheTinyLFUAdmission()
+  : is_inited_(false),
+    sketch_(),
+    window_used_size_(0),
+    period_put_size_(0)
+{
+}
+
+ObKVCacheTinyLFUAdmission::~ObKVCacheTinyLFUAdmission()
+{
+  destroy();
+}
+
+int ObKVCacheTinyLFUAdmission::init(const lib::ObMemAttr &attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("The ObKVCacheTinyLFUAdmission has been inited", K(ret));
+  } else if (OB_FAIL(sketch_.init(SKETCH_WORD_CNT, attr))) {
+    LOG_WARN("Fail to init frequency sketch", K(ret));
+  } else {
+    window_used_size_ = 0;
+    period_put_size_ = 0;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObKVCacheTinyLFUAdmission::destroy()
+{
+  sketch_.destroy();
+  window_used_size_ = 0;
+  period_put_size_ = 0;
+  is_inited_ = false;
+}
+
+bool ObKVCacheTinyLFUAdmission::admit(const uint64_t hash, const int64_t kv_size, const int64_t store_size)
+{
+  bool admitted = true;
+  if (IS_INIT) {
+    const int64_t window_size = MAX(MIN_WINDOW_SIZE, store_size / 100 * WINDOW_PERCENTAGE);
+    const int64_t period_size = window_size * 100 / WINDOW_PERCENTAGE;
+    (void) sketch_.increment(hash);
+    if (ATOMIC_AAF(&period_put_size_, kv_size) >= period_size) {
+      // the puts add up to the whole store, the window segment is refilled
+      ATOMIC_STORE(&period_put_size_, 0);
+      ATOMIC_STORE(&window_used_size_, 0);
+    }
+    if (sketch_.estimate(hash) < ADMIT_FREQUENCY) {
+      if (ATOMIC_LOAD(&window_used_size_) + kv_size > window_size) {
+        admitted = false;
+      } else {
+        (void) ATOMIC_AAF(&window_used_size_, kv_size);
+      }
+    }
+  }
+  return admitted;
+}
+
+/*
+ * -------------------------------------------------------------ObKVCacheAdmissionFactory---------------------------------------------------------------
+ */
+int ObKVCacheAdmissionFactory::create(
+    const ObKVCacheAdmissionPolicy policy,
+    const uint64_t tenant_id,
+    ObIKVCacheAdmission *&admission)
+{
+  int ret = OB_SUCCESS;
+  admission = NULL;
+  lib::ObMemAttr attr(tenant_id, "CACHE_ADMIT");
+  switch (policy) {
+    case ADMIT_ALL: {
+      break;
+    }
+    case TINY_LFU: {
+      ObKVCacheTinyLFUAdmission *tiny_lfu = NULL;
+      if (OB_ISNULL(tiny_lfu = OB_NEW(ObKVCacheTinyLFUAdmission, attr))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("Fail to allocate memory for tiny lfu admission", K(ret), K(tenant_id));
+      } else if (OB_FAIL(tiny_lfu->init(attr))) {
+        LOG_WARN("Fail to init tiny lfu admission", K(ret), K(tenant_id));
+        OB_DELETE(ObKVCacheTinyLFUAdmission, attr, tiny_lfu);
+      } else {
+        admission = tiny_lfu;
+      }
+      break;
+    }
+    default: {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("Invalid admission policy", K(ret), K(policy));
+    }
+  }
+  return ret;
+}
+
+void ObKVCacheAdmissionFactory::destroy(ObIKVCacheAdmission *admission)
+{
+  int ret = OB_SUCCESS;
+  if (OB_NOT_NULL(admission)) {
+    switch (admission->get_policy()) {
+      case TINY_LFU: {
+        ObKVCacheTinyLFUAdmission *tiny_lfu = static_cast<ObKVCacheTinyLFUAdmission *>(admission);
+        OB_DELETE(ObKVCacheTinyLFUAdmission, "CACHE_ADMIT", tiny_lfu);
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_ERROR("Unexpected admission policy, leak it", K(ret), "policy", admission->get_policy());
+      }
+    }
+  }
+}
+
+}//end namespace common
+}//end namespace oceanbase
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_CACHE_OB_KVCACHE_ADMISSION_H_
+#define OCEANBASE_CACHE_OB_KVCACHE_ADMISSION_H_
+
+#include "lib/ob_define.h"
+#include "lib/alloc/alloc_struct.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+enum ObKVCacheAdmissionPolicy
+{
+  ADMIT_ALL = 0,
+  TINY_LFU = 1,
+  MAX_ADMISSION_POLICY
+};
+
+// Count-min sketch with 4-bit counters, which estimates how many times a key has been put recently.
+// All counters are halved every sample_size_ increments so that the history fades out.
+// Increments and estimations are lock free, concurrent halving may lose a few increments, it is fine
+// for a frequency estimation.
+class ObKVCacheFrequencySketch
+{
+public:
+  ObKVCacheFrequencySketch();
+  ~ObKVCacheFrequencySketch();
+  int init(const int64_t word_cnt, const lib::ObMemAttr &attr);
+  void destroy();
+  // return true if the counters has been halved by this increment
+  bool increment(const uint64_t hash);
+  int64_t estimate(const uint64_t hash) const;
+  TO_STRING_KV(K_(is_inited), KP_(table), K_(word_cnt), K_(sample_size), K_(add_cnt));
+private:
+  static inline uint64_t index_hash_(const uint64_t hash, const int64_t i);
+  void halve_();
+private:
+  static const int64_t DEPTH = 4;
+  static const int64_t COUNTER_BITS = 4;
+  static const int64_t COUNTERS_PER_WORD = 64 / COUNTER_BITS;
+  static const uint64_t MAX_COUNTER = (1UL << COUNTER_BITS) - 1;
+  static const uint64_t HALVE_MASK = 0x7777777777777777UL;
+  static const int64_t SAMPLE_FACTOR = 10;
+  bool is_inited_;
+  uint64_t *table_;
+  int64_t word_cnt_;
+  int64_t sample_size_;
+  int64_t add_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObKVCacheFrequencySketch);
+};
+
+class ObIKVCacheAdmission
+{
+public:
+  virtual ~ObIKVCacheAdmission() {}
+  // @param hash: hash of the key which is going to be put into the cache.
+  // @param kv_size: size of the kvpair.
+  // @param store_size: memory size that the cache instance takes in store.
+  virtual bool admit(const uint64_t hash, const int64_t kv_size, const int64_t store_size) = 0;
+  virtual ObKVCacheAdmissionPolicy get_policy() const = 0;
+  DECLARE_PURE_VIRTUAL_TO_STRING;
+};
+
+// TinyLFU admission with a small window segment.
+//
+// A key is admitted if it has been put at least ADMIT_FREQUENCY times recently, which means it has been
+// missed again after it was rejected, keys read only once by a large scan are hence kept out of the cache.
+// Keys seen for the first time are still admitted as long as the window segment, WINDOW_PERCENTAGE of the
+// memory taken by the cache instance, is not used up in current period, so that a cold cache can warm up
+// and bursts of new keys are not rejected at all. A period ends once the sizes of the puts add up to the
+// memory taken by the cache instance, i.e. at most WINDOW_PERCENTAGE of the put bytes are new keys.
+//
+// Unlike the TinyLFU of an entry based cache, the frequency of the candidate is not compared with that of
+// an eviction victim, because kvcache washes whole memblocks and there is no victim key at admission time.
+class ObKVCacheTinyLFUAdmission : public ObIKVCacheAdmission
+{
+public:
+  ObKVCacheTinyLFUAdmission();
+  virtual ~ObKVCacheTinyLFUAdmission();
+  int init(const lib::ObMemAttr &attr);
+  void destroy();
+  virtual bool admit(const uint64_t hash, const int64_t kv_size, const int64_t store_size) override;
+  virtual ObKVCacheAdmissionPolicy get_policy() const override { return TINY_LFU; }
+  VIRTUAL_TO_STRING_KV(K_(is_inited), K_(sketch), K_(window_used_size), K_(period_put_size));
+private:
+  static const int64_t SKETCH_WORD_CNT = 4096; // 64K counters, 32KB
+  static const int64_t ADMIT_FREQUENCY = 2;
+  static const int64_t WINDOW_PERCENTAGE = 1;
+  static const int64_t MIN_WINDOW_SIZE = 2L << 20; // 2MB
+  bool is_inited_;
+  ObKVCacheFrequencySketch sketch_;
+  int64_t window_used_size_;
+  int64_t period_put_size_;
+  DISALLOW_COPY_AND_ASSIGN(ObKVCacheTinyLFUAdmission);
+};
+
+class ObKVCacheAdmissionFactory
+{
+public:
+  static int create(const ObKVCacheAdmissionPolicy policy, const uint64_t tenant_id,
+                    ObIKVCacheAdmission *&admission);
+  static void destroy(ObIKVCacheAdmission *admission);
+};
+
+}//end namespace common
+}//end namespace oceanbase
+
+#endif //OCEANBASE_CACHE_OB_KVCACHE_ADMISSION_H_
@@ -123,6 +123,34 @@ void ObKVCacheInst::try_mark_delete()
   }
 }
 
+bool ObKVCacheInst::admit(const uint64_t hash, const int64_t kv_size)
+{
+  int ret = OB_SUCCESS;
+  bool admitted = true;
+  const ObKVCacheAdmissionPolicy policy = status_.get_admission_policy();
+  if (ADMIT_ALL != policy) {
+    ObIKVCacheAdmission *admission = ATOMIC_LOAD(&admission_);
+    if (OB_ISNULL(admission)) {
+      ObIKVCacheAdmission *new_admission = nullptr;
+      if (OB_FAIL(ObKVCacheAdmissionFactory::create(policy, tenant_id_, new_admission))) {
+        COMMON_LOG(WARN, "Fail to create cache admission", K(ret), K(policy), K_(tenant_id), K_(cache_id));
+      } else if (!ATOMIC_BCAS(&admission_, nullptr, new_admission)) {
+        ObKVCacheAdmissionFactory::destroy(new_admission);
+      }
+      admission = ATOMIC_LOAD(&admission_);
+    }
+    if (OB_NOT_NULL(admission)) {
+      if (admission->admit(hash, kv_size, ATOMIC_LOAD(&status_.store_size_))) {
+        status_.total_admit_cnt_.inc();
+      } else {
+        status_.total_reject_cnt_.inc();
+        admitted = false;
+      }
+    }
+  }
+  return admitted;
+}
+
 /**
  * ---------------------------------------------------------ObKVCacheInstHandle-----------------------------------------------------
  */
@@ -84,6 +84,7 @@ struct ObKVCacheInst
   bool is_delete_;
   int64_t ref_cnt_;
   ObTenantMBListHandle mb_list_handle_; // list of tenant mbs
+  ObIKVCacheAdmission *admission_; // created on the first put after an admission policy is set
   ObKVCacheInst()
     : cache_id_(0),
       tenant_id_(0),
@@ -91,7 +92,8 @@ struct ObKVCacheInst
       status_(),
       is_delete_(false),
       ref_cnt_(0),
-      mb_list_handle_() { MEMSET(handles_, 0, sizeof(handles_)); }
+      mb_list_handle_(),
+      admission_(nullptr) { MEMSET(handles_, 0, sizeof(handles_)); }
   bool can_destroy() const ;
   void reset() {
     cache_id_ = 0;
@@ -102,10 +104,14 @@ struct ObKVCacheInst
     ref_cnt_ = 0;
     mb_list_handle_.reset();
     MEMSET(handles_, 0, sizeof(handles_));
+    ObKVCacheAdmissionFactory::destroy(admission_);
+    admission_ = nullptr;
   }
   bool is_valid() const { return ref_cnt_ > 0; }
   bool is_mark_delete() const { return ATOMIC_LOAD(&is_delete_); }
   void try_mark_delete();
+  // return false if the kvpair should not be kept in cache by the admission policy
+  bool admit(const uint64_t hash, const int64_t kv_size);
 
   // hold size related
   inline bool need_hold_cache() { return ATOMIC_LOAD(&status_.hold_size_) > 0; }
@@ -132,7 +132,7 @@ void ObKVCacheMap::destroy()
 int ObKVCacheMap::put(
   ObKVCacheInst &inst,
   const ObIKVCacheKey &key,
-  const ObKVCachePair *kvpair,
+  ObKVCachePair *kvpair,
   ObKVMemBlockHandle *mb_handle,
   bool overwrite)
 {
@@ -220,6 +220,7 @@ int ObKVCacheMap::put(
           // add new node to list
           new_node->next_ = bucket_ptr;
           (void) ATOMIC_SET(&bucket_ptr, new_node);
+          ATOMIC_STORE(&kvpair->status_, ObKVCachePair::MAPPED);
 
           // erase old node when overwrite
           if (NULL != iter) {
@@ -816,6 +817,7 @@ int ObKVCacheMap::internal_data_move(const ObKVCacheHazardGuard &guard,
     new_node->key_ = new_kvpair->key_;
     new_node->value_ = new_kvpair->value_;
     new_node->get_cnt_ = old_iter->get_cnt_;
+    new_kvpair->status_ = ObKVCachePair::MAPPED;
     new_node->next_ = old_iter->next_;
 
     // update inst and mb_handle
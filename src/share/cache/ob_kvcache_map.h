@@ -47,7 +47,7 @@ public:
   int put(
     ObKVCacheInst &inst,
     const ObIKVCacheKey &key,
-    const ObKVCachePair *kvpair,
+    ObKVCachePair *kvpair,
     ObKVMemBlockHandle *mb_handle,
     bool overwrite = true);
   int get(
@@ -1187,6 +1187,10 @@ bool ObKVCacheStore::try_wash_mb(ObKVMemBlockHandle *mb_handle, const uint64_t t
       int ret = OB_SUCCESS;
       if (mb_handle->inst_->tenant_id_ == tenant_id
           && mb_handle->handle_ref_.try_inc_seq_num()) {
+        ObIKVCacheWashCallback *wash_callback = mb_handle->inst_->status_.get_wash_callback();
+        if (NULL != wash_callback && NULL != mb_handle->mem_block_) {
+          mb_handle->mem_block_->on_wash(*wash_callback);
+        }
         if (OB_FAIL(do_wash_mb(mb_handle, buf, mb_size))) {
           COMMON_LOG(ERROR, "do_wash_mb failed", K(ret));
         } else {
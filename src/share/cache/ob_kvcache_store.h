@@ -274,6 +274,8 @@ int ObIKVCacheStore<MBWrapper>::store(
       COMMON_LOG(WARN, "failed to deep copy key", K(ret));
     } else if (OB_FAIL(value.deep_copy(reinterpret_cast<char *>(kvpair->value_), value_size, kvpair->value_))) {
       COMMON_LOG(WARN, "failed to deep copy value", K(ret));
+    } else {
+      kvpair->status_ = ObKVCachePair::STORED;
     }
     if (OB_FAIL(ret)) {
       if (nullptr != mb_wrapper) {
@@ -21,7 +21,9 @@ namespace common
  */
 ObKVCacheConfig::ObKVCacheConfig()
   : is_valid_(false),
-    priority_(0)
+    priority_(0),
+    admission_policy_(ADMIT_ALL),
+    wash_callback_(NULL)
 {
   MEMSET(cache_name_, 0, MAX_CACHE_NAME_LENGTH);
 }
@@ -31,6 +33,8 @@ void ObKVCacheConfig::reset()
   is_valid_ = false;
   priority_ = 0;
   mem_limit_pct_ = 100;
+  admission_policy_ = ADMIT_ALL;
+  wash_callback_ = NULL;
   MEMSET(cache_name_, 0, MAX_CACHE_NAME_LENGTH);
 }
 
@@ -63,6 +67,8 @@ void ObKVCacheStatus::reset()
   lfu_mb_cnt_ = 0;
   total_put_cnt_.reset();
   total_hit_cnt_.reset();
+  total_admit_cnt_.reset();
+  total_reject_cnt_.reset();
   total_miss_cnt_ = 0;
   last_hit_cnt_ = 0;
   base_mb_score_ = 0;
@@ -105,6 +111,23 @@ void ObKVStoreMemBlock::reuse()
   atomic_pos_.pairs = 0;
 }
 
+void ObKVStoreMemBlock::on_wash(ObIKVCacheWashCallback &callback) const
+{
+  if (NULL != buffer_) {
+    int64_t pos = 0;
+    const ObKVCachePair *kvpair = NULL;
+
+    for (uint32_t i = 0; i < atomic_pos_.pairs; ++i) {
+      kvpair = reinterpret_cast<const ObKVCachePair*>(buffer_ + pos);
+      if (ObKVCachePair::MAPPED == ATOMIC_LOAD(&kvpair->status_)
+          && NULL != kvpair->key_ && NULL != kvpair->value_) {
+        callback.on_wash(*kvpair->key_, *kvpair->value_);
+      }
+      pos += kvpair->size_;
+    }
+  }
+}
+
 int64_t ObKVStoreMemBlock::upper_align(int64_t input, int64_t align)
 {
   return (input + align - 1) & ~(align - 1);
@@ -185,6 +208,7 @@ int ObKVStoreMemBlock::store(
             store_pair.value_))) {
       COMMON_LOG(WARN, "Fail to deep copy value, ", K(ret));
     } else {
+      store_pair.status_ = ObKVCachePair::STORED;
       MEMCPY(&(buffer_[old_atomic_pos.buffer]), &store_pair, sizeof(ObKVCachePair));
       kvpair = reinterpret_cast<ObKVCachePair*>(&(buffer_[old_atomic_pos.buffer]));
     }
@@ -253,6 +277,7 @@ int ObKVStoreMemBlock::alloc(
   if (OB_SUCC(ret)) {
     kvpair = reinterpret_cast<ObKVCachePair *>(&(buffer_[old_atomic_pos.buffer]));
     kvpair->size_ = static_cast<int32_t>(align_kv_size);
+    kvpair->status_ = ObKVCachePair::ALLOCATED;
     kvpair->key_ = reinterpret_cast<ObIKVCacheKey *>(&(buffer_[old_atomic_pos.buffer + sizeof(ObKVCachePair)]));
     kvpair->value_ = reinterpret_cast<ObIKVCacheValue *>(&(buffer_[old_atomic_pos.buffer
         + sizeof(ObKVCachePair) + key_size]));
@@ -22,6 +22,7 @@
 #include "lib/resource/ob_resource_mgr.h"
 #include "lib/allocator/ob_lf_fifo_allocator.h"
 #include "lib/metrics/ob_counter.h"
+#include "share/cache/ob_kvcache_admission.h"
 
 namespace oceanbase
 {
@@ -57,18 +58,36 @@ public:
   virtual int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const = 0;
 };
 
+// Invoked on every kvpair of a mem block right before the mem block is washed, e.g. to spill the
+// kvpair to a lower storage tier. The kvpair is destroyed once it returns, so it must not block.
+// Only kvpairs which have been put into the cache map are passed, kvpairs which are not constructed
+// yet, failed to be put or were rejected by the admission policy are skipped.
+class ObIKVCacheWashCallback
+{
+public:
+  virtual ~ObIKVCacheWashCallback() {}
+  virtual void on_wash(const ObIKVCacheKey &key, const ObIKVCacheValue &value) = 0;
+};
+
 struct ObKVCachePair
 {
+  enum Status
+  {
+    ALLOCATED = 0,  // the key and value may not be constructed yet
+    STORED = 1,     // the key and value are constructed
+    MAPPED = 2,     // the kvpair has been put into the cache map
+  };
   uint32_t magic_;
   int32_t size_;
   ObIKVCacheKey *key_;
   ObIKVCacheValue *value_;
+  int32_t status_;
   static const uint32_t KVPAIR_MAGIC_NUM = 0x4B564B56;  //"KVKV"
   ObKVCachePair()
-      : magic_(KVPAIR_MAGIC_NUM), size_(0), key_(NULL), value_(NULL)
+      : magic_(KVPAIR_MAGIC_NUM), size_(0), key_(NULL), value_(NULL), status_(ALLOCATED)
   {
   }
-  TO_STRING_KV(K_(magic), K_(size), KP_(key), KP_(value));
+  TO_STRING_KV(K_(magic), K_(size), KP_(key), KP_(value), K_(status));
 };
 
 enum ObKVCachePolicy
@@ -84,6 +103,7 @@ public:
   ObKVStoreMemBlock(char *buffer, const int64_t size);
   virtual ~ObKVStoreMemBlock();
   void reuse();
+  void on_wash(ObIKVCacheWashCallback &callback) const;
   static int64_t upper_align(int64_t input, int64_t align);
   static int64_t get_align_size(const ObIKVCacheKey &key, const ObIKVCacheValue &value);
   static int64_t get_align_size(const int64_t key_size, const int64_t value_size);
@@ -178,6 +198,8 @@ public:
   bool is_valid_;
   int64_t priority_;
   int64_t mem_limit_pct_;
+  ObKVCacheAdmissionPolicy admission_policy_;
+  ObIKVCacheWashCallback *wash_callback_;
   char cache_name_[MAX_CACHE_NAME_LENGTH];
 };
 
@@ -193,6 +215,14 @@ public:
   {
     return ATOMIC_LOAD(&config_->mem_limit_pct_);
   }
+  inline ObKVCacheAdmissionPolicy get_admission_policy() const
+  {
+    return NULL == config_ ? ADMIT_ALL : ATOMIC_LOAD(&config_->admission_policy_);
+  }
+  inline ObIKVCacheWashCallback *get_wash_callback() const
+  {
+    return NULL == config_ ? NULL : ATOMIC_LOAD(&config_->wash_callback_);
+  }
   void reset();
   TO_STRING_KV(KP_(config), K_(kv_cnt), K_(store_size), K_(map_size), K_(lru_mb_cnt),
       K_(lfu_mb_cnt), K_(base_mb_score), K_(hold_size));
@@ -200,6 +230,9 @@ public:
   const ObKVCacheConfig *config_;
   ObPCNonAtomicCounter total_put_cnt_;
   ObPCNonAtomicCounter total_hit_cnt_;
+  // only counted when an admission policy is set to the cache
+  ObPCNonAtomicCounter total_admit_cnt_;
+  ObPCNonAtomicCounter total_reject_cnt_;
   int64_t kv_cnt_;
   int64_t store_size_;
   int64_t lru_mb_cnt_;
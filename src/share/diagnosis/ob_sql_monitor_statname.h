@@ -61,6 +61,15 @@ SQL_MONITOR_STATNAME_DEF(SSTABLE_INSERT_CG_ROW_COUNT, sql_monitor_statname::INT,
 SQL_MONITOR_STATNAME_DEF(IO_READ_BYTES, sql_monitor_statname::CAPACITY, "total io bytes read from disk", "total io bytes read from storage")
 SQL_MONITOR_STATNAME_DEF(TOTAL_READ_BYTES, sql_monitor_statname::CAPACITY, "total bytes processed by storage", "total bytes processed by storage, including memtable")
 SQL_MONITOR_STATNAME_DEF(TOTAL_READ_ROW_COUNT, sql_monitor_statname::INT, "total rows processed by storage", "total rows processed by storage, including memtable")
+SQL_MONITOR_STATNAME_DEF(COLUMNAR_FILTER_ROW_COUNT, sql_monitor_statname::INT, "columnar filter decoded rows", "rows decoded by pushdown filters of column store scan")
+SQL_MONITOR_STATNAME_DEF(COLUMNAR_PROJECT_ROW_COUNT, sql_monitor_statname::INT, "columnar project decoded rows", "rows decoded for projection of column store scan")
+// Auto Memory Management (spill compression)
+SQL_MONITOR_STATNAME_DEF(SPILL_COMPRESS_SAVED_SIZE, sql_monitor_statname::CAPACITY, "spill compress saved size", "disk space saved by compressing dumped data")
+SQL_MONITOR_STATNAME_DEF(SPILL_COMPRESS_RATIO, sql_monitor_statname::INT, "spill compress ratio", "percentage of compressed size to raw size of dumped data")
+// window function
+SQL_MONITOR_STATNAME_DEF(WINFUNC_FULL_FRAME_COUNT, sql_monitor_statname::INT, "full frame aggregation count", "count of frames aggregated over all rows of the frame by window function op")
+SQL_MONITOR_STATNAME_DEF(WINFUNC_INCR_FRAME_COUNT, sql_monitor_statname::INT, "incremental frame aggregation count", "count of frames aggregated by adding and removing rows of the previous frame by window function op")
+SQL_MONITOR_STATNAME_DEF(WINFUNC_SEG_TREE_FRAME_COUNT, sql_monitor_statname::INT, "segment tree frame aggregation count", "count of frames aggregated with the segment tree of the partition by window function op")
 
 //end
 SQL_MONITOR_STATNAME_DEF(MONITOR_STATNAME_END, sql_monitor_statname::INVALID, "monitor end", "monitor stat name end")
@@ -8003,6 +8003,8 @@ def_table_schema(
   ('total_hit_cnt', 'int', 'false'),
   ('total_miss_cnt', 'int', 'false'),
   ('hold_size', 'int', 'false'),
+  ('total_admit_cnt', 'int', 'false'),
+  ('total_reject_cnt', 'int', 'false'),
   ],
   vtable_route_policy = 'distributed',
   partition_columns = ['svr_ip', 'svr_port'],
@@ -154,7 +154,7 @@ int ObIODeviceWrapper::init(
     const int64_t data_disk_size)
 {
   int ret = OB_SUCCESS;
-  const int64_t MAX_IOD_OPT_CNT = 5;
+  const int64_t MAX_IOD_OPT_CNT = 7;
   ObIODOpt iod_opt_array[MAX_IOD_OPT_CNT];
   ObIODOpts iod_opts;
   iod_opts.opts_ = iod_opt_array;
@@ -177,6 +177,8 @@ int ObIODeviceWrapper::init(
     iod_opt_array[2].set("block_size", block_size);
     iod_opt_array[3].set("datafile_disk_percentage", data_disk_percentage);
     iod_opt_array[4].set("datafile_size", data_disk_size);
+    iod_opt_array[5].set("enable_io_uring", static_cast<bool>(GCONF._enable_io_uring));
+    iod_opt_array[6].set("enable_io_uring_sqpoll", static_cast<bool>(GCONF._enable_io_uring_sqpoll));
     iod_opts.opt_cnt_ = MAX_IOD_OPT_CNT;
   }
 
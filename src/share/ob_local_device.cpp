@@ -97,7 +97,9 @@ ObLocalDevice::ObLocalDevice()
     block_bitmap_(nullptr),
     allocator_(),
     iocb_pool_(),
-    is_fs_support_punch_hole_(true)
+    is_fs_support_punch_hole_(true),
+    enable_io_uring_(false),
+    enable_io_uring_sqpoll_(false)
 {
 
   MEMSET(store_dir_, 0, sizeof(store_dir_));
@@ -132,6 +134,8 @@ int ObLocalDevice::init(const common::ObIODOpts &opts)
     int64_t datafile_disk_percentage = 0;
     bool is_exist = false;
     int64_t media_id = 0;
+    bool enable_io_uring = false;
+    bool enable_io_uring_sqpoll = false;
 
     for (int64_t i = 0; OB_SUCC(ret) && i < opts.opt_cnt_; ++i) {
       if (0 == STRCMP(opts.opts_[i].key_, "data_dir")) {
@@ -146,6 +150,10 @@ int ObLocalDevice::init(const common::ObIODOpts &opts)
         datafile_size = opts.opts_[i].value_.value_int64;
       } else if (0 == STRCMP(opts.opts_[i].key_, "media_id")) {
         media_id = opts.opts_[i].value_.value_int64;
+      } else if (0 == STRCMP(opts.opts_[i].key_, "enable_io_uring")) {
+        enable_io_uring = opts.opts_[i].value_.value_bool;
+      } else if (0 == STRCMP(opts.opts_[i].key_, "enable_io_uring_sqpoll")) {
+        enable_io_uring_sqpoll = opts.opts_[i].value_.value_bool;
       } else {
         ret = OB_NOT_SUPPORTED;
         SHARE_LOG(WARN, "Not supported option, ", K(ret), K(i), K(opts.opts_[i].key_));
@@ -167,6 +175,13 @@ int ObLocalDevice::init(const common::ObIODOpts &opts)
         STRNCPY(store_dir_, store_dir, STRLEN(store_dir));
         STRNCPY(sstable_dir_, sstable_dir, STRLEN(sstable_dir));
         media_id_ = media_id;
+        if (enable_io_uring && !ObLocalIOUring::is_supported()) {
+          SHARE_LOG(WARN, "io_uring is not supported, use libaio instead");
+        } else {
+          enable_io_uring_ = enable_io_uring;
+          enable_io_uring_sqpoll_ = enable_io_uring && enable_io_uring_sqpoll;
+        }
+        SHARE_LOG(INFO, "local device io engine", K_(enable_io_uring), K_(enable_io_uring_sqpoll));
       }
     }
   }
@@ -281,6 +296,8 @@ void ObLocalDevice::destroy()
   is_inited_ = false;
   is_marked_ = false;
   is_fs_support_punch_hole_ = true;
+  enable_io_uring_ = false;
+  enable_io_uring_sqpoll_ = false;
 
   MEMSET(store_dir_, 0, sizeof(store_dir_));
   MEMSET(sstable_dir_, 0, sizeof(sstable_dir_));
@@ -1066,7 +1083,13 @@ int ObLocalDevice::io_setup(
     int sys_ret = 0;
     ObLocalIOContext *local_context = nullptr;
     local_context = new (buf) ObLocalIOContext();
-    if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
+    if (enable_io_uring_) {
+      if (OB_FAIL(io_uring_setup_(max_events, *local_context))) {
+        SHARE_LOG(WARN, "Fail to setup io uring, ", K(ret), K(max_events));
+      } else {
+        io_context = local_context;
+      }
+    } else if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
       ret = OB_IO_ERROR;
       SHARE_LOG(WARN, "Fail to setup io context, ", K(ret), K(sys_ret), KERRMSG);
     } else {
@@ -1080,6 +1103,27 @@ int ObLocalDevice::io_setup(
   return ret;
 }
 
+int ObLocalDevice::io_uring_setup_(uint32_t max_events, ObLocalIOContext &local_context)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  ObLocalIOUring *io_uring = nullptr;
+  if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObLocalIOUring)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SHARE_LOG(WARN, "Fail to allocate memory, ", K(ret));
+  } else if (FALSE_IT(io_uring = new (buf) ObLocalIOUring())) {
+  } else if (OB_FAIL(io_uring->init(max_events, enable_io_uring_sqpoll_))) {
+    SHARE_LOG(WARN, "Fail to init io uring, ", K(ret), K(max_events), K_(enable_io_uring_sqpoll));
+  } else {
+    local_context.io_uring_ = io_uring;
+  }
+  if (OB_FAIL(ret) && nullptr != io_uring) {
+    io_uring->~ObLocalIOUring();
+    allocator_.free(io_uring);
+  }
+  return ret;
+}
+
 int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
 {
   int ret = OB_SUCCESS;
@@ -1094,6 +1138,11 @@ int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    local_io_context->io_uring_->~ObLocalIOUring();
+    allocator_.free(local_io_context->io_uring_);
+    local_io_context->io_uring_ = nullptr;
+    allocator_.free(io_context);
   } else {
     int sys_ret = 0;
     if ((sys_ret = ::io_destroy(local_io_context->io_context_)) != 0) {
@@ -1197,6 +1246,18 @@ int ObLocalDevice::io_submit(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    ObLocalIOUring *io_uring = local_io_context->io_uring_;
+    int tmp_ret = OB_SUCCESS;
+    // the block file is opened after the io channels are set up, register it on first use
+    if (block_fd_ > 0 && block_fd_ == static_cast<int>(local_iocb->iocb_.aio_fildes)
+        && OB_SUCCESS != (tmp_ret = io_uring->register_file(block_fd_))) {
+      SHARE_LOG(WARN, "Fail to register block file, ", K(tmp_ret), K_(block_fd));
+    }
+    if (OB_FAIL(io_uring->submit(local_iocb->iocb_))) {
+      SHARE_LOG(WARN, "Fail to submit io uring, ", K(ret), KPC(io_uring));
+    }
+    time_guard.click("LocalDevice_uring_submit");
   } else {
     iocbp = &(local_iocb->iocb_);
     int submit_ret = ::io_submit(local_io_context->io_context_, 1, &iocbp);
@@ -1230,6 +1291,9 @@ int ObLocalDevice::io_cancel(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    // same as a kernel without aio cancel support, the request returns through io_getevents
+    ret = OB_NOT_SUPPORTED;
   } else {
     int sys_ret = 0;
     if ((sys_ret = ::io_cancel(local_io_context->io_context_, &(local_iocb->iocb_), &local_event)) < 0) {
@@ -1262,6 +1326,18 @@ int ObLocalDevice::io_getevents(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    int64_t complete_cnt = 0;
+    {
+      oceanbase::lib::Thread::WaitGuard guard(oceanbase::lib::Thread::WAIT_FOR_IO_EVENT);
+      ret = local_io_context->io_uring_->reap(min_nr, local_io_events->max_event_cnt_,
+          local_io_events->io_events_, timeout, complete_cnt);
+    }
+    if (OB_FAIL(ret)) {
+      SHARE_LOG(WARN, "Fail to reap io uring, ", K(ret), K(min_nr));
+    } else {
+      local_io_events->complete_io_cnt_ = complete_cnt;
+    }
   } else {
     int sys_ret = 0;
     {
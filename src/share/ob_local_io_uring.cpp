@@ -0,0 +1,478 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "share/ob_local_io_uring.h"
+#include "share/ob_errno.h"
+#include "lib/time/ob_time_utility.h"
+#include "lib/utility/utility.h"
+
+using namespace oceanbase::common;
+
+namespace oceanbase {
+namespace share {
+
+#ifdef OB_HAS_IO_URING
+// the syscall numbers are the same on x86_64 and aarch64
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+
+static int sys_io_uring_setup(const uint32_t entries, struct io_uring_params *p)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+}
+
+static int sys_io_uring_enter(const int fd, const uint32_t to_submit, const uint32_t min_complete,
+    const uint32_t flags, const void *arg, const size_t arg_size)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, arg, arg_size));
+}
+
+static int sys_io_uring_register(const int fd, const uint32_t opcode, const void *arg, const uint32_t nr_args)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+#endif
+
+ObLocalIOUring::ObLocalIOUring()
+  : is_inited_(false),
+    enable_sqpoll_(false),
+    support_ext_arg_(false),
+    ring_fd_(-1),
+    registered_fd_(-1),
+    register_failed_(false),
+    sq_entries_(0),
+    cq_entries_(0),
+    sq_ring_ptr_(nullptr),
+    sq_ring_size_(0),
+    cq_ring_ptr_(nullptr),
+    cq_ring_size_(0),
+    sqes_ptr_(nullptr),
+    sqes_size_(0),
+    sq_head_(nullptr),
+    sq_tail_(nullptr),
+    sq_mask_(nullptr),
+    sq_flags_(nullptr),
+    sq_array_(nullptr),
+    cq_head_(nullptr),
+    cq_tail_(nullptr),
+    cq_mask_(nullptr),
+    cqes_(nullptr),
+    submit_cnt_(0),
+    enter_cnt_(0),
+    flushing_(false),
+    sq_lock_()
+{
+}
+
+ObLocalIOUring::~ObLocalIOUring()
+{
+  destroy();
+}
+
+bool ObLocalIOUring::is_supported()
+{
+  static int support_state = 0; // 0: unknown, 1: supported, -1: not supported
+#ifdef OB_HAS_IO_URING
+  if (0 == ATOMIC_LOAD(&support_state)) {
+    struct io_uring_params params;
+    MEMSET(&params, 0, sizeof(params));
+    const int fd = sys_io_uring_setup(1, &params);
+    if (fd < 0) {
+      SHARE_LOG(INFO, "io_uring is not supported by kernel", K(errno), KERRMSG);
+      ATOMIC_STORE(&support_state, -1);
+    } else {
+      ::close(fd);
+      ATOMIC_STORE(&support_state, 1);
+    }
+  }
+#else
+  support_state = -1;
+#endif
+  return 1 == ATOMIC_LOAD(&support_state);
+}
+
+int ObLocalIOUring::init(const uint32_t max_events, const bool enable_sqpoll)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_HAS_IO_URING
+  struct io_uring_params params;
+  MEMSET(&params, 0, sizeof(params));
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    SHARE_LOG(WARN, "io uring has been inited", K(ret));
+  } else if (OB_UNLIKELY(0 == max_events)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "invalid argument", K(ret), K(max_events));
+  } else {
+    if (enable_sqpoll) {
+      params.flags |= IORING_SETUP_SQPOLL;
+      params.sq_thread_idle = SQPOLL_IDLE_MS;
+    }
+    ring_fd_ = sys_io_uring_setup(max_events, &params);
+    if (ring_fd_ < 0 && enable_sqpoll) {
+      // SQPOLL needs CAP_SYS_ADMIN before linux 5.11, fall back to the interrupt driven mode
+      SHARE_LOG(WARN, "fail to setup io_uring with sqpoll, retry without it", K(errno), KERRMSG);
+      MEMSET(&params, 0, sizeof(params));
+      ring_fd_ = sys_io_uring_setup(max_events, &params);
+    }
+    if (ring_fd_ < 0) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "fail to setup io_uring", K(ret), K(max_events), K(errno), KERRMSG);
+    } else {
+      enable_sqpoll_ = 0 != (params.flags & IORING_SETUP_SQPOLL);
+#ifdef IORING_FEAT_EXT_ARG
+      support_ext_arg_ = 0 != (params.features & IORING_FEAT_EXT_ARG);
+#endif
+      sq_entries_ = params.sq_entries;
+      cq_entries_ = params.cq_entries;
+      sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+      cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+      sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+      const bool single_mmap = 0 != (params.features & IORING_FEAT_SINGLE_MMAP);
+      if (single_mmap) {
+        sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+      }
+      if (MAP_FAILED == (sq_ring_ptr_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+          MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING))) {
+        sq_ring_ptr_ = nullptr;
+        ret = OB_IO_ERROR;
+        SHARE_LOG(WARN, "fail to mmap sq ring", K(ret), K(errno), KERRMSG);
+      } else if (single_mmap) {
+        cq_ring_ptr_ = sq_ring_ptr_;
+      } else if (MAP_FAILED == (cq_ring_ptr_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+          MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING))) {
+        cq_ring_ptr_ = nullptr;
+        ret = OB_IO_ERROR;
+        SHARE_LOG(WARN, "fail to mmap cq ring", K(ret), K(errno), KERRMSG);
+      }
+      if (OB_SUCC(ret)) {
+        if (MAP_FAILED == (sqes_ptr_ = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES))) {
+          sqes_ptr_ = nullptr;
+          ret = OB_IO_ERROR;
+          SHARE_LOG(WARN, "fail to mmap sqes", K(ret), K(errno), KERRMSG);
+        } else {
+          char *sq_ptr = static_cast<char *>(sq_ring_ptr_);
+          char *cq_ptr = static_cast<char *>(cq_ring_ptr_);
+          sq_head_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.head);
+          sq_tail_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.tail);
+          sq_mask_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.ring_mask);
+          sq_flags_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.flags);
+          sq_array_ = reinterpret_cast<uint32_t *>(sq_ptr + params.sq_off.array);
+          cq_head_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.head);
+          cq_tail_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.tail);
+          cq_mask_ = reinterpret_cast<uint32_t *>(cq_ptr + params.cq_off.ring_mask);
+          cqes_ = cq_ptr + params.cq_off.cqes;
+          is_inited_ = true;
+          SHARE_LOG(INFO, "succeed to setup io_uring", K(*this));
+        }
+      }
+    }
+  }
+  if (OB_FAIL(ret) && !is_inited_) {
+    destroy();
+  }
+#else
+  UNUSEDx(max_events, enable_sqpoll);
+  ret = OB_NOT_SUPPORTED;
+  SHARE_LOG(WARN, "io_uring is not supported by this build", K(ret));
+#endif
+  return ret;
+}
+
+void ObLocalIOUring::destroy()
+{
+  if (nullptr != sqes_ptr_) {
+    ::munmap(sqes_ptr_, sqes_size_);
+    sqes_ptr_ = nullptr;
+  }
+  if (nullptr != cq_ring_ptr_ && cq_ring_ptr_ != sq_ring_ptr_) {
+    ::munmap(cq_ring_ptr_, cq_ring_size_);
+  }
+  cq_ring_ptr_ = nullptr;
+  if (nullptr != sq_ring_ptr_) {
+    ::munmap(sq_ring_ptr_, sq_ring_size_);
+    sq_ring_ptr_ = nullptr;
+  }
+  if (ring_fd_ >= 0) {
+    ::close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  sq_head_ = sq_tail_ = sq_mask_ = sq_flags_ = sq_array_ = nullptr;
+  cq_head_ = cq_tail_ = cq_mask_ = nullptr;
+  cqes_ = nullptr;
+  sq_ring_size_ = cq_ring_size_ = sqes_size_ = 0;
+  sq_entries_ = cq_entries_ = 0;
+  registered_fd_ = -1;
+  register_failed_ = false;
+  submit_cnt_ = 0;
+  enter_cnt_ = 0;
+  flushing_ = false;
+  enable_sqpoll_ = false;
+  support_ext_arg_ = false;
+  is_inited_ = false;
+}
+
+int ObLocalIOUring::register_file(const int fd)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_HAS_IO_URING
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "io uring has not been inited", K(ret));
+  } else if (OB_UNLIKELY(fd < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "invalid argument", K(ret), K(fd));
+  } else if (fd == ATOMIC_LOAD(&registered_fd_)) {
+    // already registered
+  } else if (ATOMIC_LOAD(&register_failed_)) {
+    // failed before, the file is submitted as a normal fd and the failure is not reported again
+  } else {
+    ObSpinLockGuard guard(sq_lock_);
+    if (registered_fd_ >= 0) {
+      ret = OB_ENTRY_EXIST;
+      ATOMIC_STORE(&register_failed_, true);
+      SHARE_LOG(WARN, "another file has been registered", K(ret), K(fd), K_(registered_fd));
+    } else if (register_failed_) {
+      // raced with another failed registration
+    } else if (0 != sys_io_uring_register(ring_fd_, IORING_REGISTER_FILES, &fd, 1)) {
+      ret = OB_IO_ERROR;
+      ATOMIC_STORE(&register_failed_, true);
+      SHARE_LOG(WARN, "fail to register file to io_uring", K(ret), K(fd), K(errno), KERRMSG);
+    } else {
+      ATOMIC_STORE(&registered_fd_, fd);
+      SHARE_LOG(INFO, "succeed to register file to io_uring", K(fd), K_(ring_fd));
+    }
+  }
+#else
+  UNUSED(fd);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+int ObLocalIOUring::submit(const struct iocb &cb)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_HAS_IO_URING
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "io uring has not been inited", K(ret));
+  } else if (OB_UNLIKELY(IO_CMD_PREAD != cb.aio_lio_opcode && IO_CMD_PWRITE != cb.aio_lio_opcode)) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "not supported io opcode", K(ret), K(cb.aio_lio_opcode));
+  } else {
+    ObSpinLockGuard guard(sq_lock_);
+    const uint32_t tail = *sq_tail_;
+    const uint32_t head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (tail - head >= sq_entries_) {
+      ret = OB_EAGAIN;
+    } else {
+      const uint32_t index = tail & *sq_mask_;
+      struct io_uring_sqe *sqe = static_cast<struct io_uring_sqe *>(sqes_ptr_) + index;
+      MEMSET(sqe, 0, sizeof(*sqe));
+      sqe->opcode = IO_CMD_PREAD == cb.aio_lio_opcode ? IORING_OP_READ : IORING_OP_WRITE;
+      if (registered_fd_ >= 0 && cb.aio_fildes == static_cast<uint32_t>(registered_fd_)) {
+        sqe->fd = 0; // index in the registered file table
+        sqe->flags |= IOSQE_FIXED_FILE;
+      } else {
+        sqe->fd = static_cast<int32_t>(cb.aio_fildes);
+      }
+      sqe->addr = reinterpret_cast<uint64_t>(cb.u.c.buf);
+      sqe->len = static_cast<uint32_t>(cb.u.c.nbytes);
+      sqe->off = static_cast<uint64_t>(cb.u.c.offset);
+      sqe->user_data = reinterpret_cast<uint64_t>(cb.data);
+      sq_array_[index] = index;
+      __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+      ++submit_cnt_;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (enable_sqpoll_) {
+    // the kernel thread picks up new sqes by itself, only wake it up when it went idle
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (0 != (__atomic_load_n(sq_flags_, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP)) {
+      int tmp_ret = OB_SUCCESS;
+      // the sqe has been published, the next submit wakes up the kernel thread again if this fails
+      if (OB_SUCCESS != (tmp_ret = enter_(0, 0, IORING_ENTER_SQ_WAKEUP, nullptr))) {
+        SHARE_LOG(WARN, "fail to wakeup sq thread", K(tmp_ret));
+      }
+    }
+  } else {
+    flush_();
+  }
+#else
+  UNUSED(cb);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+int ObLocalIOUring::reap(
+    const int64_t min_nr,
+    const int64_t max_nr,
+    struct io_event *events,
+    const struct timespec *timeout,
+    int64_t &complete_cnt)
+{
+  int ret = OB_SUCCESS;
+  complete_cnt = 0;
+#ifdef OB_HAS_IO_URING
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "io uring has not been inited", K(ret));
+  } else if (OB_ISNULL(events) || OB_UNLIKELY(min_nr < 0 || max_nr <= 0 || min_nr > max_nr)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "invalid argument", K(ret), KP(events), K(min_nr), K(max_nr));
+  } else {
+    if (!enable_sqpoll_) {
+      // the sqes left by a failed flush are submitted here, so they do not wait for the next submit
+      flush_();
+    }
+    // completions are visible in the shared ring, no syscall is needed if they are already there
+    complete_cnt = copy_cqes_(max_nr, events);
+    if (complete_cnt < min_nr) {
+      if (support_ext_arg_) {
+        if (OB_FAIL(enter_(0, static_cast<uint32_t>(min_nr - complete_cnt), IORING_ENTER_GETEVENTS, timeout))) {
+          if (OB_TIMEOUT == ret) {
+            ret = OB_SUCCESS;
+          }
+        }
+      } else {
+        // old kernels can not wait with timeout, poll the ring until timeout instead
+        const int64_t timeout_us = nullptr == timeout ? INT64_MAX
+            : timeout->tv_sec * 1000L * 1000L + timeout->tv_nsec / 1000L;
+        const int64_t begin_us = ObTimeUtility::fast_current_time();
+        while (__atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE) == *cq_head_
+            && ObTimeUtility::fast_current_time() - begin_us < timeout_us) {
+          ob_usleep(POLL_INTERVAL_US);
+        }
+      }
+      if (OB_SUCC(ret)) {
+        complete_cnt += copy_cqes_(max_nr - complete_cnt, events + complete_cnt);
+      }
+    }
+  }
+#else
+  UNUSEDx(min_nr, max_nr, events, timeout);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+// The published sqes are submitted by one enter. The thread which wins the flushing flag
+// submits every sqe published so far, including the ones published by the other threads
+// while it was in the kernel, and the other threads return without a syscall. The flag is
+// checked again after it is released, so no sqe is left behind by a thread which lost it.
+// The sqes are kept in the ring on failure, they are submitted by the next flush or reap.
+void ObLocalIOUring::flush_()
+{
+#ifdef OB_HAS_IO_URING
+  bool has_pending = true;
+  while (has_pending && ATOMIC_BCAS(&flushing_, false, true)) {
+    int tmp_ret = OB_SUCCESS;
+    const uint32_t tail = __atomic_load_n(sq_tail_, __ATOMIC_ACQUIRE);
+    const uint32_t head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (tail != head && OB_SUCCESS != (tmp_ret = enter_(tail - head, 0, 0, nullptr))) {
+      if (OB_EAGAIN != tmp_ret) {
+        SHARE_LOG_RET(WARN, tmp_ret, "fail to flush sqes", K(tail), K(head));
+      }
+      has_pending = false;
+    }
+    ATOMIC_STORE(&flushing_, false);
+    has_pending = has_pending
+        && __atomic_load_n(sq_tail_, __ATOMIC_ACQUIRE) != __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+  }
+#endif
+}
+
+int ObLocalIOUring::enter_(const uint32_t to_submit, const uint32_t min_complete, const uint32_t flags,
+    const struct timespec *timeout)
+{
+  int ret = OB_SUCCESS;
+#ifdef OB_HAS_IO_URING
+  int sys_ret = 0;
+  uint32_t enter_flags = flags;
+  const void *arg = nullptr;
+  size_t arg_size = 0;
+#ifdef IORING_FEAT_EXT_ARG
+  struct __kernel_timespec ts;
+  struct io_uring_getevents_arg ext_arg;
+  MEMSET(&ext_arg, 0, sizeof(ext_arg));
+  if (nullptr != timeout && support_ext_arg_) {
+    ts.tv_sec = timeout->tv_sec;
+    ts.tv_nsec = timeout->tv_nsec;
+    ext_arg.ts = reinterpret_cast<uint64_t>(&ts);
+    enter_flags |= IORING_ENTER_EXT_ARG;
+    arg = &ext_arg;
+    arg_size = sizeof(ext_arg);
+  }
+#else
+  UNUSED(timeout);
+#endif
+  ATOMIC_INC(&enter_cnt_);
+  while ((sys_ret = sys_io_uring_enter(ring_fd_, to_submit, min_complete, enter_flags, arg, arg_size)) < 0
+      && EINTR == errno); // ignore EINTR
+  if (sys_ret < 0) {
+    if (ETIME == errno) {
+      ret = OB_TIMEOUT;
+    } else if (EAGAIN == errno || EBUSY == errno) {
+      ret = OB_EAGAIN;
+    } else {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "fail to enter io_uring", K(ret), K(to_submit), K(min_complete), K(flags), K(errno), KERRMSG);
+    }
+  }
+#else
+  UNUSEDx(to_submit, min_complete, flags, timeout);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+int64_t ObLocalIOUring::copy_cqes_(const int64_t max_nr, struct io_event *events)
+{
+  int64_t cnt = 0;
+#ifdef OB_HAS_IO_URING
+  uint32_t head = *cq_head_;
+  const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  const struct io_uring_cqe *cqes = static_cast<const struct io_uring_cqe *>(cqes_);
+  while (head != tail && cnt < max_nr) {
+    const struct io_uring_cqe &cqe = cqes[head & *cq_mask_];
+    struct io_event &event = events[cnt];
+    event.data = reinterpret_cast<void *>(cqe.user_data);
+    event.obj = nullptr;
+    // same encoding as libaio, negative errno on failure
+    event.res = static_cast<int64_t>(cqe.res);
+    event.res2 = 0;
+    ++head;
+    ++cnt;
+  }
+  __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+#else
+  UNUSEDx(max_nr, events);
+#endif
+  return cnt;
+}
+
+} /* namespace share */
+} /* namespace oceanbase */
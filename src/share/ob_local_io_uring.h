@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef SRC_SHARE_OB_LOCAL_IO_URING_H_
+#define SRC_SHARE_OB_LOCAL_IO_URING_H_
+
+#include <libaio.h>
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/utility/ob_print_utils.h"
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+// IORING_OP_READ/IORING_OP_WRITE are required, they come with the same headers as FAST_POLL
+#if defined(IORING_FEAT_FAST_POLL)
+#define OB_HAS_IO_URING 1
+#endif
+#endif
+#endif
+
+namespace oceanbase {
+namespace share {
+
+/*
+ * A minimal io_uring ring used by ObLocalDevice in place of libaio's io_context_t.
+ *
+ * Requests are still prepared as libaio iocbs by ObLocalDevice::io_prepare_pread/pwrite,
+ * they are translated into sqes on submit and the cqes are translated back into io_events
+ * on reap, so ObAsyncIOChannel does not need to know which engine is underneath.
+ *
+ * Concurrency: submit() may be called by any number of threads, reap() must only be
+ * called by the single get_events thread that owns the io context. Without SQPOLL, the
+ * sqes published by concurrent submits are flushed to the kernel by one io_uring_enter.
+ */
+class ObLocalIOUring final
+{
+public:
+  ObLocalIOUring();
+  ~ObLocalIOUring();
+  static bool is_supported();
+  int init(const uint32_t max_events, const bool enable_sqpoll);
+  void destroy();
+  // register @fd as fixed file 0, reads and writes on it skip the per-request fget/fput.
+  // Only the first failure is returned, the later calls succeed and the file stays unregistered.
+  int register_file(const int fd);
+  int submit(const struct iocb &cb);
+  int reap(
+      const int64_t min_nr,
+      const int64_t max_nr,
+      struct io_event *events,
+      const struct timespec *timeout,
+      int64_t &complete_cnt);
+  bool is_sqpoll() const { return enable_sqpoll_; }
+  TO_STRING_KV(K_(is_inited), K_(ring_fd), K_(sq_entries), K_(cq_entries), K_(registered_fd),
+      K_(register_failed), K_(enable_sqpoll), K_(submit_cnt), K_(enter_cnt));
+
+private:
+  void flush_();
+  int enter_(const uint32_t to_submit, const uint32_t min_complete, const uint32_t flags,
+      const struct timespec *timeout);
+  int64_t copy_cqes_(const int64_t max_nr, struct io_event *events);
+
+private:
+  static const uint32_t SQPOLL_IDLE_MS = 2000;
+  static const int64_t POLL_INTERVAL_US = 50;
+  bool is_inited_;
+  bool enable_sqpoll_;
+  bool support_ext_arg_;
+  int ring_fd_;
+  int registered_fd_;
+  bool register_failed_;
+  uint32_t sq_entries_;
+  uint32_t cq_entries_;
+  void *sq_ring_ptr_;
+  int64_t sq_ring_size_;
+  void *cq_ring_ptr_;
+  int64_t cq_ring_size_;
+  void *sqes_ptr_;
+  int64_t sqes_size_;
+  uint32_t *sq_head_;
+  uint32_t *sq_tail_;
+  uint32_t *sq_mask_;
+  uint32_t *sq_flags_;
+  uint32_t *sq_array_;
+  uint32_t *cq_head_;
+  uint32_t *cq_tail_;
+  uint32_t *cq_mask_;
+  void *cqes_;
+  int64_t submit_cnt_;
+  int64_t enter_cnt_;
+  // set by the thread which is submitting the published sqes to the kernel
+  bool flushing_;
+  common::ObSpinLock sq_lock_;
+  DISALLOW_COPY_AND_ASSIGN(ObLocalIOUring);
+};
+
+} /* namespace share */
+} /* namespace oceanbase */
+
+#endif /* SRC_SHARE_OB_LOCAL_IO_URING_H_ */
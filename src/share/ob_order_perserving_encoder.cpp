@@ -533,6 +533,10 @@ int ObOrderPerservingEncoder::encode_from_string_varlen(
     if (res_len < 0) {
       ret = OB_NOT_SUPPORTED;
       LOG_TRACE("not support collation", K(cs));
+    } else if (!is_valid_uni) {
+      // the sortkey of invalid unicode is not order perserving
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("not support invalid unicode", K(cs));
     } else {
       to_len += res_len;
     }
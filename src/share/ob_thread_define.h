@@ -103,7 +103,12 @@ TG_DEF(LogSharedQueueTh, LogSharedQueueThread, QUEUE_THREAD,
        ThreadCountPair(palf::LogSharedQueueTh::THREAD_NUM,
        palf::LogSharedQueueTh::MINI_MODE_THREAD_NUM),
        palf::LogSharedQueueTh::MAX_LOG_HANDLE_TASK_NUM)
+TG_DEF(LogReadAheadTh, LogReadAhead, QUEUE_THREAD,
+       ThreadCountPair(palf::LogSharedQueueTh::THREAD_NUM,
+       palf::LogSharedQueueTh::MINI_MODE_THREAD_NUM),
+       palf::LogSharedQueueTh::MAX_LOG_HANDLE_TASK_NUM)
 TG_DEF(ReplayService, ReplaySrv, QUEUE_THREAD, 1, (common::REPLAY_TASK_QUEUE_SIZE + 1) * OB_MAX_LS_NUM_PER_TENANT_PER_SERVER_CAN_BE_SET)
+TG_DEF(ReplayPrefetch, RpPrefetch, QUEUE_THREAD, 2, OB_MAX_LS_NUM_PER_TENANT_PER_SERVER_CAN_BE_SET)
 TG_DEF(LogRouteService, LogRouteSrv, QUEUE_THREAD, 1, (common::MAX_SERVER_COUNT) * OB_MAX_LS_NUM_PER_TENANT_PER_SERVER_CAN_BE_SET)
 TG_DEF(LogRouterTimer, LogRouterTimer, TIMER)
 TG_DEF(LogFetcherLSWorker, LSWorker, MAP_QUEUE_THREAD, ThreadCountPair(4, 1))
@@ -377,6 +377,14 @@ DEF_INT(_rowsets_target_maxsize, OB_TENANT_PARAMETER, "524288", "[262144, 838860
 DEF_INT(_rowsets_max_rows, OB_TENANT_PARAMETER, "256", "[0, 65535]",
         "the row number processed by vectorized sql engine within one batch. Range: [0, 65535]",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_sql_expr_jit, OB_TENANT_PARAMETER, "False",
+         "specifies whether the integer arithmetic, comparison and case expressions of the hot plans "
+         "are compiled into native code in background",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_regexp_automaton, OB_TENANT_PARAMETER, "False",
+         "specifies whether the regexp functions with a constant pattern are matched by a linear "
+         "time automaton and a literal prefilter before falling back to ICU",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_STR_WITH_CHECKER(_ctx_memory_limit, OB_TENANT_PARAMETER, "",
         common::ObCtxMemoryLimitChecker,
         "specifies tenant ctx memory limit.",
@@ -500,6 +508,10 @@ DEF_INT(_enable_hash_join_processor, OB_TENANT_PARAMETER, "7", "[1, 7]",
          "which path to process for hash join, default 7 to auto choose "
          "1: nest loop, 2: recursive, 4: in-memory",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_hash_join_radix_cluster, OB_TENANT_PARAMETER, "True",
+         "cluster the buckets of hash join by partition when the hash table is much larger than "
+         "L2 cache. Value:  True:turned on  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_pushdown_storage_level, OB_TENANT_PARAMETER, "4", "[0, 4]",
         "the level of storage pushdown. Range: [0, 4] "
         "0: disabled, 1:blockscan, 2: blockscan & filter, 3: blockscan & filter & aggregate, 4: blockscan & filter & aggregate & group by",
@@ -705,8 +717,9 @@ DEF_TIME(archive_lag_target, OB_TENANT_PARAMETER, "120s",
         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_INT(_log_writer_parallelism, OB_TENANT_PARAMETER, "3",
-       "[1,8]",
-       "the number of parallel log writer threads that can be used to write redo log entries to disk. ",
+       "[1,16]",
+       "the number of parallel log writer threads that can be used to write redo log entries to disk, "
+       "log streams are sharded by palf id over these writers. Range: [1, 16]",
        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 
 DEF_TIME(_ls_gc_wait_readonly_tx_time, OB_TENANT_PARAMETER, "24h",
@@ -725,6 +738,15 @@ DEF_BOOL(_enable_log_cache, OB_TENANT_PARAMETER, "True",
          "specifies whether allow to fill log kv cache. "
          "Value:  True:turned on  False: turned off",
          ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_log_cache_read_ahead, OB_TENANT_PARAMETER, "False",
+         "specifies whether the sequential readers of logs read the following logs into the log kv cache "
+         "in advance. It works only when _enable_log_cache is true. "
+         "Value:  True:turned on  False: turned off",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_replay_log_prefetch_size, OB_TENANT_PARAMETER, "8M", "[0M, 64M]",
+        "the size of logs which are read into the log kv cache in advance of replay on the follower. "
+        "0 means no prefetch. It works only when _enable_log_cache is true. Range: [0M, 64M]",
+        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 // ========================= LogService Config End   =====================
 DEF_INT(resource_hard_limit, OB_CLUSTER_PARAMETER, "100", "[100, 10000]",
@@ -936,6 +958,29 @@ DEF_INT(bf_cache_miss_count_threshold, OB_CLUSTER_PARAMETER, "100", "[0,)", "bf
 DEF_INT(fuse_row_cache_priority, OB_CLUSTER_PARAMETER, "1", "[1,)", "fuse row cache priority. Range:[1, )", ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(storage_meta_cache_priority, OB_CLUSTER_PARAMETER, "10", "[1,)", "storage meta cache priority. Range:[1, )",
         ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_user_block_cache_admission, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether user block cache admits new micro blocks by their recent access frequency, "
+         "so that blocks read only once by large scans do not evict the frequently accessed ones. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_user_row_cache_admission, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether user row cache admits new rows by their recent access frequency. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_fuse_row_cache_admission, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether fuse row cache admits new rows by their recent access frequency. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_micro_block_secondary_cache_size, OB_CLUSTER_PARAMETER, "0M", "[0M,)",
+        "size of the file on local disk which keeps the data micro blocks washed out of user block cache, "
+        "0 means the secondary cache is disabled. Range: [0M, )",
+        ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_STR(_micro_block_secondary_cache_path, OB_CLUSTER_PARAMETER, "",
+        "the directory for the micro block secondary cache file, empty means the sstable directory",
+        ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_INT(_micro_block_secondary_cache_tenant_limit_percentage, OB_CLUSTER_PARAMETER, "50", "[1,100]",
+        "the max percentage of the micro block secondary cache a single tenant can take. Range: [1, 100]",
+        ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 //background limit config
 DEF_TIME(_data_storage_io_timeout, OB_CLUSTER_PARAMETER, "10s", "[1s,600s]",
@@ -963,6 +1008,16 @@ DEF_INT_WITH_CHECKER(disk_io_thread_count, OB_CLUSTER_PARAMETER, "8",
 DEF_INT(_io_callback_thread_count, OB_TENANT_PARAMETER, "0", "[0,64]",
         "The number of io callback threads. The default value is 0. Range: [0,64] in integer. If not specified, The number of threads is dynamically configured according to the memory size",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_io_uring, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the local data device submits async io through io_uring instead of libaio. "
+         "Fall back to libaio if the kernel does not support io_uring. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_BOOL(_enable_io_uring_sqpoll, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether io_uring uses a kernel polling thread so that submitting io needs no syscall, "
+         "only takes effect when _enable_io_uring is turned on. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 
 DEF_BOOL(_enable_parallel_minor_merge, OB_TENANT_PARAMETER, "True",
          "specifies whether enable parallel minor merge. "
@@ -1997,6 +2052,21 @@ DEF_BOOL(_enable_memleak_light_backtrace, OB_CLUSTER_PARAMETER, "True",
 DEF_BOOL(_enable_dbms_lob_partial_update, OB_TENANT_PARAMETER, "False",
          "Enable the capability of dbms_lob to perform partial updates on LOB",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_memtable_delta_update, OB_TENANT_PARAMETER, "False",
+         "Enable writing the update which only adds to bigint columns as the commutative delta node in memtable, "
+         "so that concurrent updates on the hot row do not wait for each other. "
+         "Value: True: enabled; False: disabled",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_memtable_frozen_image, OB_TENANT_PARAMETER, "False",
+         "Build the sorted image of the keys for the frozen memtable in background before it is flushed, "
+         "so that the mini merge and the scans on the memtable do not iterate the btree once the image is ready. "
+         "Value: True: enabled; False: disabled",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_lock_wait_fifo_handoff, OB_TENANT_PARAMETER, "False",
+         "Wake up the waiters of a row one by one in the order of arrival, and hand off the row to the "
+         "woken waiter, so the hot row does not wake up all the waiters to retry together. "
+         "Value: True: enabled; False: disabled",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_enable_dbms_job_package, OB_CLUSTER_PARAMETER, "True",
          "Control whether can use DBMS_JOB package.",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -218,6 +218,7 @@ public:
     TASK_TYPE_DDL_SPLIT_WRITE = 62,
     TASK_TYPE_DDL_SPLIT_MERGE = 63,
     TASK_TYPE_TABLE_FINISH_BACKFILL = 64,
+    TASK_TYPE_MEMTABLE_FROZEN_IMAGE = 65,
     TASK_TYPE_MAX,
   };
 
@@ -19,6 +19,7 @@
 #include "sql/engine/expr/ob_expr_column_conv.h"
 #include "sql/engine/dml/ob_dml_ctx_define.h"
 #include "share/config/ob_server_config.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "sql/parser/ob_parser.h"
 #include "sql/resolver/dml/ob_merge_stmt.h"
 #include "sql/engine/dml/ob_conflict_checker.h"
@@ -508,10 +509,201 @@ int ObDmlCgService::generate_update_ctdef(ObLogDelUpd &op,
       LOG_WARN("generate distinct_key exprs failed", K(ret), K(distinct_exprs));
     }
   }
+  if (OB_SUCC(ret) && OB_FAIL(generate_delta_update_info(op, index_dml_info, upd_ctdef))) {
+    LOG_WARN("generate delta update info failed", K(ret), K(index_dml_info));
+  }
   LOG_TRACE("finish generate update ctdef", K(ret), K(upd_ctdef));
   return ret;
 }
 
+// The update like `c = c + 1` on the bigint counter columns of the hot row may be
+// written as the commutative delta node in memtable, see ObMemtableRowDelta.
+// Only the plain update of the primary table without index, trigger, foreign
+// key and partition key change is considered, and the check constraints must
+// be `c >= 0` on the counter columns, which are kept by the escrow check in
+// memtable. The old value of the counter column read by the statement is not
+// the value the delta is folded into, so no filter, join condition or
+// RETURNING clause may reference a counter column
+int ObDmlCgService::generate_delta_update_info(ObLogDelUpd &op,
+                                               const IndexDMLInfo &index_dml_info,
+                                               ObUpdCtDef &upd_ctdef)
+{
+  int ret = OB_SUCCESS;
+  const ObAssignments &assigns = index_dml_info.assignments_;
+  const ObIArray<ObRawExpr*> &ck_cst_exprs = index_dml_info.ck_cst_exprs_;
+  bool is_delta = false;
+  bool is_non_neg = false;
+  if (OB_ISNULL(cg_.opt_ctx_) || OB_ISNULL(cg_.opt_ctx_->get_session_info())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("session info is null", K(ret));
+  } else {
+    const uint64_t tenant_id = cg_.opt_ctx_->get_session_info()->get_effective_tenant_id();
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id));
+    is_delta = tenant_config.is_valid()
+               && tenant_config->_enable_memtable_delta_update
+               && log_op_def::LOG_UPDATE == op.get_type()
+               && index_dml_info.is_primary_index_
+               && !index_dml_info.is_update_part_key_
+               && 1 == op.get_index_dml_infos().count()
+               && index_dml_info.related_index_ids_.empty()
+               && upd_ctdef.fk_args_.empty()
+               && upd_ctdef.trig_ctdef_.tg_args_.empty()
+               && !assigns.empty();
+  }
+  for (int64_t i = 0; is_delta && i < assigns.count(); ++i) {
+    is_delta = is_delta_update_assign(assigns.at(i));
+  }
+  if (OB_SUCC(ret) && is_delta) {
+    bool is_referenced = false;
+    if (OB_FAIL(check_delta_column_referenced(op, assigns, is_referenced))) {
+      LOG_WARN("check delta column referenced failed", K(ret));
+    } else {
+      is_delta = !is_referenced;
+    }
+  }
+  if (is_delta && !ck_cst_exprs.empty()) {
+    // every counter column needs its non-negative check
+    ObSEArray<bool, 8> covered;
+    for (int64_t i = 0; OB_SUCC(ret) && i < assigns.count(); ++i) {
+      if (OB_FAIL(covered.push_back(false))) {
+        LOG_WARN("push back failed", K(ret));
+      }
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && is_delta && i < ck_cst_exprs.count(); ++i) {
+      int64_t assign_idx = OB_INVALID_INDEX;
+      if (is_non_neg_check(ck_cst_exprs.at(i), assigns, assign_idx)) {
+        covered.at(assign_idx) = true;
+      } else {
+        is_delta = false;
+      }
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && is_delta && i < covered.count(); ++i) {
+      is_delta = covered.at(i);
+    }
+    is_non_neg = is_delta;
+  }
+  if (OB_SUCC(ret) && is_delta) {
+    upd_ctdef.dupd_ctdef_.is_delta_update_ = true;
+    upd_ctdef.dupd_ctdef_.is_delta_non_neg_ = is_non_neg;
+    LOG_TRACE("generate delta update", K(is_non_neg), K(assigns));
+  }
+  return ret;
+}
+
+// whether the counter columns of the assignments are referenced by the where
+// conditions, join conditions, semi join conditions or the returning exprs.
+// The conditions with subquery are taken as referenced, since the correlated
+// column in the subquery is not extracted
+int ObDmlCgService::check_delta_column_referenced(ObLogDelUpd &op,
+                                                  const ObAssignments &assigns,
+                                                  bool &is_referenced)
+{
+  int ret = OB_SUCCESS;
+  const ObDMLStmt *stmt = op.get_stmt();
+  ObSEArray<ObRawExpr*, 16> exprs;
+  ObSEArray<ObRawExpr*, 16> column_exprs;
+  is_referenced = false;
+  if (OB_ISNULL(stmt)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("stmt is null", K(ret));
+  } else if (OB_FAIL(append(exprs, stmt->get_condition_exprs()))) {
+    LOG_WARN("append condition exprs failed", K(ret));
+  } else if (stmt->is_returning()
+             && OB_FAIL(append(exprs, static_cast<const ObDelUpdStmt *>(stmt)->get_returning_exprs()))) {
+    LOG_WARN("append returning exprs failed", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < stmt->get_joined_tables().count(); ++i) {
+    const JoinedTable *joined_table = stmt->get_joined_tables().at(i);
+    if (OB_ISNULL(joined_table)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("joined table is null", K(ret));
+    } else if (OB_FAIL(append(exprs, joined_table->get_join_conditions()))) {
+      LOG_WARN("append join conditions failed", K(ret));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < stmt->get_semi_infos().count(); ++i) {
+    const SemiInfo *semi_info = stmt->get_semi_infos().at(i);
+    if (OB_ISNULL(semi_info)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("semi info is null", K(ret));
+    } else if (OB_FAIL(append(exprs, semi_info->semi_conditions_))) {
+      LOG_WARN("append semi conditions failed", K(ret));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && !is_referenced && i < exprs.count(); ++i) {
+    if (OB_ISNULL(exprs.at(i))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("expr is null", K(ret), K(i));
+    } else if (exprs.at(i)->has_flag(CNT_SUB_QUERY)) {
+      is_referenced = true;
+    }
+  }
+  if (OB_FAIL(ret) || is_referenced) {
+  } else if (OB_FAIL(ObRawExprUtils::extract_column_exprs(exprs, column_exprs))) {
+    LOG_WARN("extract column exprs failed", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && !is_referenced && i < column_exprs.count(); ++i) {
+    const ObColumnRefRawExpr *col = static_cast<const ObColumnRefRawExpr *>(column_exprs.at(i));
+    for (int64_t j = 0; !is_referenced && j < assigns.count(); ++j) {
+      const ObColumnRefRawExpr *assign_col = assigns.at(j).column_expr_;
+      is_referenced = NULL != assign_col
+                      && col->get_table_id() == assign_col->get_table_id()
+                      && col->get_column_id() == assign_col->get_column_id();
+    }
+  }
+  return ret;
+}
+
+// c = c + expr or c = c - expr, where c is a non-rowkey bigint column and expr
+// does not depend on any column
+bool ObDmlCgService::is_delta_update_assign(const ObAssignment &assign)
+{
+  bool bret = false;
+  const ObColumnRefRawExpr *col = assign.column_expr_;
+  const ObRawExpr *expr = assign.expr_;
+  if (NULL != expr && T_FUN_COLUMN_CONV == expr->get_expr_type()
+      && ObExprColumnConv::PARAMS_COUNT_WITHOUT_COLUMN_INFO <= expr->get_param_count()) {
+    expr = expr->get_param_expr(4);
+  }
+  if (OB_ISNULL(col) || OB_ISNULL(expr) || assign.is_implicit_) {
+  } else if (col->is_rowkey_column() || ObIntType != col->get_result_type().get_type()) {
+  } else if ((T_OP_ADD == expr->get_expr_type() || T_OP_MINUS == expr->get_expr_type())
+             && 2 == expr->get_param_count()
+             && ObIntType == expr->get_result_type().get_type()
+             && expr->get_param_expr(0) == col
+             && NULL != expr->get_param_expr(1)
+             && !expr->get_param_expr(1)->has_flag(CNT_COLUMN)) {
+    bret = true;
+  }
+  return bret;
+}
+
+// c >= 0 on the counter column c of the assignments
+bool ObDmlCgService::is_non_neg_check(const ObRawExpr *expr,
+                                      const ObAssignments &assigns,
+                                      int64_t &assign_idx)
+{
+  bool bret = false;
+  assign_idx = OB_INVALID_INDEX;
+  if (NULL != expr
+      && T_OP_GE == expr->get_expr_type()
+      && 2 == expr->get_param_count()
+      && NULL != expr->get_param_expr(0)
+      && NULL != expr->get_param_expr(1)
+      && expr->get_param_expr(1)->is_const_raw_expr()) {
+    const ObObj &value = static_cast<const ObConstRawExpr *>(expr->get_param_expr(1))->get_value();
+    for (int64_t i = 0; !bret && i < assigns.count(); ++i) {
+      if (assigns.at(i).column_expr_ == expr->get_param_expr(0)
+          && value.is_integer_type()
+          && 0 == value.get_int()) {
+        assign_idx = i;
+        bret = true;
+      }
+    }
+  }
+  return bret;
+}
+
 int ObDmlCgService::get_table_rowkey_exprs(const IndexDMLInfo &index_dml_info,
                                            ObIArray<ObRawExpr*> &rowkey_exprs)
 {
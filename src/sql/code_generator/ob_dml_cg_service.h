@@ -307,6 +307,14 @@ private:
   int convert_upd_assign_infos(bool is_heap_table,
                                const IndexDMLInfo &index_dml_info,
                                ColContentFixedArray &assign_infos);
+  int generate_delta_update_info(ObLogDelUpd &op,
+                                 const IndexDMLInfo &index_dml_info,
+                                 ObUpdCtDef &upd_ctdef);
+  bool is_delta_update_assign(const ObAssignment &assign);
+  int check_delta_column_referenced(ObLogDelUpd &op,
+                                    const ObAssignments &assigns,
+                                    bool &is_referenced);
+  bool is_non_neg_check(const ObRawExpr *expr, const ObAssignments &assigns, int64_t &assign_idx);
   int convert_check_constraint(ObLogDelUpd &log_op,
                                uint64_t ref_table_id,
                                ObDMLBaseCtDef &dml_base_ctdef,
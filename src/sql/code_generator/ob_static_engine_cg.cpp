@@ -104,6 +104,8 @@
 #include "sql/engine/aggregate/ob_merge_groupby_op.h"
 #include "sql/engine/aggregate/ob_hash_groupby_op.h"
 #include "sql/engine/join/ob_merge_join_op.h"
+#include "sql/engine/join/ob_merge_join_vec_op.h"
+#include "sql/engine/join/ob_nested_loop_join_vec_op.h"
 #include "sql/engine/basic/ob_topk_op.h"
 #include "sql/executor/ob_task_spliter.h"
 #include "sql/engine/dml/ob_table_delete_op.h"
@@ -5909,6 +5911,162 @@ int ObStaticEngineCG::generate_spec(ObLogJoin &op,
   UNUSED(in_root_job);
   return generate_join_spec(op, spec);
 }
+
+int ObStaticEngineCG::generate_spec(ObLogJoin &op,
+                                    ObMergeJoinVecSpec &spec,
+                                    const bool in_root_job)
+{
+  int ret = OB_SUCCESS;
+  UNUSED(in_root_job);
+  if (op.is_partition_wise()) {
+    phy_plan_->set_is_wise_join(op.is_partition_wise()); // set is_wise_join
+  }
+  // 1. add other join conditions
+  const ObIArray<ObRawExpr*> &other_join_conds = op.get_other_join_conditions();
+  OZ(spec.other_join_conds_.init(other_join_conds.count()));
+  ARRAY_FOREACH(other_join_conds, i) {
+    ObRawExpr *raw_expr = other_join_conds.at(i);
+    ObExpr *expr = NULL;
+    if (OB_ISNULL(raw_expr)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("null pointer", K(ret));
+    } else if (OB_FAIL(generate_rt_expr(*raw_expr, expr))) {
+      LOG_WARN("fail to generate rt expr", K(ret), K(*raw_expr));
+    } else if (OB_FAIL(spec.other_join_conds_.push_back(expr))) {
+      LOG_WARN("failed to add sql expr", K(ret), K(*expr));
+    }
+  } // end for
+  spec.join_type_ = op.get_join_type();
+
+  // 2. add equal join conditions and populate all exprs for left/right child fetcher
+  const ObIArray<ObRawExpr*> &equal_join_conds = op.get_equal_join_conditions();
+  OZ(spec.equal_cond_infos_.init(equal_join_conds.count()));
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(spec.get_left()) || OB_ISNULL(spec.get_right())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("child is null", K(ret), KP(spec.get_left()), KP(spec.get_right()));
+  } else if (OB_FAIL(spec.left_child_fetcher_all_exprs_.init(
+               spec.get_left()->output_.count() + equal_join_conds.count()))) {
+    LOG_WARN("failed to init left fetcher all exprs", K(ret));
+  } else if (OB_FAIL(spec.right_child_fetcher_all_exprs_.init(
+               spec.get_right()->output_.count() + equal_join_conds.count()))) {
+    LOG_WARN("failed to init right fetcher all exprs", K(ret));
+  } else if (OB_FAIL(append_array_no_dup(spec.left_child_fetcher_all_exprs_,
+                                         spec.get_left()->output_))) {
+    LOG_WARN("fail to append array no dup for left child", K(ret), K(op));
+  } else if (OB_FAIL(append_array_no_dup(spec.right_child_fetcher_all_exprs_,
+                                         spec.get_right()->output_))) {
+    LOG_WARN("fail to append array no dup for right child", K(ret), K(op));
+  }
+  ARRAY_FOREACH(equal_join_conds, i) {
+    ObMergeJoinVecSpec::EqualConditionInfo equal_cond_info;
+    ObRawExpr *raw_expr = equal_join_conds.at(i);
+    NullSafeRowCmpFunc null_first_cmp = NULL;
+    NullSafeRowCmpFunc null_last_cmp = NULL;
+    CK(OB_NOT_NULL(raw_expr));
+    CK(T_OP_EQ == raw_expr->get_expr_type() || T_OP_NSEQ == raw_expr->get_expr_type());
+    OZ(generate_rt_expr(*raw_expr, equal_cond_info.expr_));
+    CK(OB_NOT_NULL(equal_cond_info.expr_));
+    CK(2 == equal_cond_info.expr_->arg_cnt_);
+    CK(OB_NOT_NULL(equal_cond_info.expr_->args_));
+    CK(OB_NOT_NULL(equal_cond_info.expr_->args_[0]));
+    CK(OB_NOT_NULL(equal_cond_info.expr_->args_[1]));
+    OZ(calc_equal_cond_opposite(op, *raw_expr, equal_cond_info.is_opposite_));
+    if (OB_SUCC(ret)) {
+      ObExpr *left_key = equal_cond_info.get_left_expr();
+      ObExpr *right_key = equal_cond_info.get_right_expr();
+      // the null position must be the same as the sort order of the children
+      VectorCmpExprFuncsHelper::get_cmp_set(left_key->datum_meta_, right_key->datum_meta_,
+                                            null_first_cmp, null_last_cmp);
+      equal_cond_info.ns_cmp_func_ = is_oracle_mode() ? null_last_cmp : null_first_cmp;
+      if (OB_ISNULL(equal_cond_info.ns_cmp_func_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("null compare function", K(ret), K(left_key->datum_meta_),
+                 K(right_key->datum_meta_));
+      } else if (OB_FAIL(spec.equal_cond_infos_.push_back(equal_cond_info))) {
+        LOG_WARN("failed to push back equal condition info", K(ret));
+      } else if (OB_FAIL(add_var_to_array_no_dup(spec.left_child_fetcher_all_exprs_,
+                                                 left_key))) {
+        LOG_WARN("fail to add_var_to_array_no_dup", K(ret));
+      } else if (OB_FAIL(add_var_to_array_no_dup(spec.right_child_fetcher_all_exprs_,
+                                                 right_key))) {
+        LOG_WARN("fail to add_var_to_array_no_dup", K(ret));
+      }
+    }
+  } // end for
+
+  // 3. add merge directions
+  if (OB_SUCC(ret) && OB_FAIL(spec.set_merge_directions(op.get_merge_directions()))) {
+    LOG_WARN("fail to set merge directions", K(ret));
+  }
+  return ret;
+}
+
+int ObStaticEngineCG::generate_spec(ObLogJoin &op,
+                                    ObNestedLoopJoinVecSpec &spec,
+                                    const bool in_root_job)
+{
+  int ret = OB_SUCCESS;
+  UNUSED(in_root_job);
+  if (op.is_partition_wise()) {
+    phy_plan_->set_is_wise_join(op.is_partition_wise()); // set is_wise_join
+  }
+  // 1. add other join conditions
+  const ObIArray<ObRawExpr*> &other_join_conds = op.get_other_join_conditions();
+  OZ(spec.other_join_conds_.init(other_join_conds.count()));
+  ARRAY_FOREACH(other_join_conds, i) {
+    ObRawExpr *raw_expr = other_join_conds.at(i);
+    ObExpr *expr = NULL;
+    if (OB_ISNULL(raw_expr)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("null pointer", K(ret));
+    } else if (OB_FAIL(generate_rt_expr(*raw_expr, expr))) {
+      LOG_WARN("fail to generate rt expr", K(ret), K(*raw_expr));
+    } else if (OB_FAIL(spec.other_join_conds_.push_back(expr))) {
+      LOG_WARN("failed to add sql expr", K(ret), K(*expr));
+    }
+  } // end for
+  spec.join_type_ = op.get_join_type();
+
+  // 2. add rescan params, the partition id expr for gi pruning and group rescan info
+  if (OB_FAIL(ret)) {
+  } else if (0 != op.get_equal_join_conditions().count()) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("equal join conditions' count should equal 0", K(ret));
+  } else if (FALSE_IT(spec.enable_gi_partition_pruning_ = op.is_enable_gi_partition_pruning())) {
+  } else if (spec.enable_gi_partition_pruning_
+             && OB_FAIL(generate_rt_expr(*op.get_partition_id_expr(),
+                                         spec.gi_partition_id_expr_))) {
+    LOG_WARN("fail do gi partition pruning", K(ret));
+  } else if (OB_FAIL(generate_param_spec(op.get_nl_params(), spec.rescan_params_))) {
+    LOG_WARN("fail to generate param spec", K(ret));
+  } else if (FALSE_IT(spec.group_rescan_ = op.can_use_batch_nlj())) {
+  } else if (OB_FAIL(spec.left_rescan_params_.init(op.get_above_pushdown_left_params().count()))) {
+    LOG_WARN("fail to init fixed array", K(ret));
+  } else if (OB_FAIL(spec.right_rescan_params_.init(op.get_above_pushdown_right_params().count()))) {
+    LOG_WARN("fail to init fixed array", K(ret));
+  } else if (OB_FAIL(set_batch_exec_param(op.get_nl_params(), spec.rescan_params_))) {
+    LOG_WARN("fail to set batch exec param", K(ret));
+  }
+  ARRAY_FOREACH(op.get_above_pushdown_left_params(), i) {
+    ObExecParamRawExpr* param_expr = op.get_above_pushdown_left_params().at(i);
+    if (OB_FAIL(batch_exec_param_caches_.push_back(BatchExecParamCache(param_expr,
+                                                                       &spec,
+                                                                       true)))) {
+      LOG_WARN("fail to push back param expr", K(ret));
+    }
+  }
+  ARRAY_FOREACH(op.get_above_pushdown_right_params(), i) {
+    ObExecParamRawExpr* param_expr = op.get_above_pushdown_right_params().at(i);
+    if (OB_FAIL(batch_exec_param_caches_.push_back(BatchExecParamCache(param_expr,
+                                                                       &spec,
+                                                                       false)))) {
+      LOG_WARN("fail to push back param expr", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObStaticEngineCG::generate_join_spec(ObLogJoin &op, ObJoinSpec &spec)
 {
   int ret = OB_SUCCESS;
@@ -8820,15 +8978,30 @@ int ObStaticEngineCG::get_phy_op_type(ObLogicalOperator &log_op,
       auto &op = static_cast<ObLogJoin&>(log_op);
       switch(op.get_join_algo()) {
         case NESTED_LOOP_JOIN: {
-          type = CONNECT_BY_JOIN != op.get_join_type()
-             ? PHY_NESTED_LOOP_JOIN
-             : (op.get_nl_params().count() > 0
-                  ? PHY_NESTED_LOOP_CONNECT_BY_WITH_INDEX
-                  : PHY_NESTED_LOOP_CONNECT_BY);
+          int tmp_ret = OB_SUCCESS;
+          tmp_ret = OB_E(EventTable::EN_DISABLE_VEC_NESTED_LOOP_JOIN) OB_SUCCESS;
+          if (CONNECT_BY_JOIN == op.get_join_type()) {
+            type = op.get_nl_params().count() > 0
+                   ? PHY_NESTED_LOOP_CONNECT_BY_WITH_INDEX
+                   : PHY_NESTED_LOOP_CONNECT_BY;
+          } else if (OB_SUCCESS == tmp_ret && use_rich_format && !op.enable_px_batch_rescan()
+                     && GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_3_3_0) {
+            // px batch rescan is only supported by PHY_NESTED_LOOP_JOIN
+            type = PHY_VEC_NESTED_LOOP_JOIN;
+          } else {
+            type = PHY_NESTED_LOOP_JOIN;
+          }
           break;
         }
         case MERGE_JOIN: {
-          type = PHY_MERGE_JOIN;
+          int tmp_ret = OB_SUCCESS;
+          tmp_ret = OB_E(EventTable::EN_DISABLE_VEC_MERGE_JOIN) OB_SUCCESS;
+          if (OB_SUCCESS == tmp_ret && use_rich_format
+              && GET_MIN_CLUSTER_VERSION() >= CLUSTER_VERSION_4_3_3_0) {
+            type = PHY_VEC_MERGE_JOIN;
+          } else {
+            type = PHY_MERGE_JOIN;
+          }
           break;
         }
         case HASH_JOIN: {
@@ -9535,6 +9708,17 @@ int ObStaticEngineCG::set_batch_exec_param(const ObIArray<ObExecParamRawExpr *>
         } else if (OB_FAIL(batch_exec_param_caches_.remove(j))) {
           LOG_WARN("fail to remove batch nl param caches", K(ret));
         }
+      } else if (cache.spec_->get_type() == PHY_VEC_NESTED_LOOP_JOIN) {
+        ObNestedLoopJoinVecSpec *nlj = static_cast<ObNestedLoopJoinVecSpec*>(cache.spec_);
+        if (cache.is_left_param_ &&
+                    OB_FAIL(nlj->left_rescan_params_.push_back(setter))) {
+          LOG_WARN("fail to push back left rescan params", K(ret));
+        } else if (!cache.is_left_param_ &&
+                    OB_FAIL(nlj->right_rescan_params_.push_back(setter))) {
+          LOG_WARN("fail to push back right rescan params", K(ret));
+        } else if (OB_FAIL(batch_exec_param_caches_.remove(j))) {
+          LOG_WARN("fail to remove batch nl param caches", K(ret));
+        }
       }
     }
   }
@@ -67,6 +67,8 @@ class ObHashJoinVecSpec;
 class ObNestedLoopJoinSpec;
 class ObBasicNestedLoopJoinSpec;
 class ObMergeJoinSpec;
+class ObMergeJoinVecSpec;
+class ObNestedLoopJoinVecSpec;
 class ObJoinSpec;
 class ObMonitoringDumpSpec;
 class ObLogSequence;
@@ -356,8 +358,10 @@ private:
 
   // generate nested loop join
   int generate_spec(ObLogJoin &op, ObNestedLoopJoinSpec &spec, const bool in_root_job);
+  int generate_spec(ObLogJoin &op, ObNestedLoopJoinVecSpec &spec, const bool in_root_job);
   // generate merge join
   int generate_spec(ObLogJoin &op, ObMergeJoinSpec &spec, const bool in_root_job);
+  int generate_spec(ObLogJoin &op, ObMergeJoinVecSpec &spec, const bool in_root_job);
 
   int generate_join_spec(ObLogJoin &op, ObJoinSpec &spec);
 
@@ -58,6 +58,8 @@ public:
                        K_(is_batch_stmt),
                        K_(is_insert_up),
                        K_(is_table_api),
+                       K_(is_delta_update),
+                       K_(is_delta_non_neg),
                        K_(tz_info),
                        K_(table_param),
                        K_(encrypt_meta));
@@ -83,7 +85,9 @@ public:
       uint64_t is_insert_up_                    : 1;
       uint64_t is_table_api_                    : 1;
       uint64_t is_access_mlog_as_master_table_  : 1;
-      uint64_t reserved_                        : 58;
+      uint64_t is_delta_update_                 : 1; // see ObMemtableRowDelta
+      uint64_t is_delta_non_neg_                : 1;
+      uint64_t reserved_                        : 56;
     };
   };
 protected:
@@ -239,11 +239,15 @@ int ObExtendHashTableVec<GroupRowBucket>::inner_process_batch(const common::ObIA
   int ret = OB_SUCCESS;
   int64_t curr_idx = start_idx;
   bool need_fallback = false;
+  const bool prefetch_ahead = !probe_by_col && buckets_->count() > HASH_BUCKET_PREFETCH_MAGIC_NUM;
   while (OB_SUCC(ret) && !need_fallback && curr_idx < child_brs.size_) {
     bool batch_duplicate = false;
     new_row_selector_cnt_ = 0;
     old_row_selector_cnt_ = 0;
     for (; OB_SUCC(ret) && curr_idx < child_brs.size_; ++curr_idx) {
+      if (prefetch_ahead && curr_idx + PROBE_PREFETCH_DISTANCE < child_brs.size_) {
+        prefetch_item_ahead(hash_values[curr_idx + PROBE_PREFETCH_DISTANCE]);
+      }
       if (child_brs.skip_->at(curr_idx)
           || is_dumped[curr_idx]
           || (nullptr != bloom_filter
@@ -760,11 +764,15 @@ int ObExtendHashTableVec<GroupRowBucket>::inner_process_batch(const RowMeta &row
   int ret = OB_SUCCESS;
   int64_t curr_idx = start_idx;
   bool need_fallback = false;
+  const bool prefetch_ahead = !probe_by_col && buckets_->count() > HASH_BUCKET_PREFETCH_MAGIC_NUM;
   while (OB_SUCC(ret) && !need_fallback && curr_idx < batch_size) {
     bool batch_duplicate = false;
     new_row_selector_cnt_ = 0;
     old_row_selector_cnt_ = 0;
     for (; OB_SUCC(ret) && curr_idx < batch_size; ++curr_idx) {
+      if (prefetch_ahead && curr_idx + PROBE_PREFETCH_DISTANCE < batch_size) {
+        prefetch_item_ahead(hash_values[curr_idx + PROBE_PREFETCH_DISTANCE]);
+      }
       if (OB_NOT_NULL(child_skip) && child_skip->at(curr_idx)) {
         my_skip.set(curr_idx);
         continue;
@@ -319,6 +319,11 @@ int ObHashGroupByVecOp::reinit_group_store()
 
 int ObHashGroupByVecOp::inner_close()
 {
+  ObSqlMemMgrProcessor::set_compress_stat(
+      sql_mem_processor_.get_compress_raw_size() + distinct_sql_mem_processor_.get_compress_raw_size(),
+      sql_mem_processor_.get_compressed_size() + distinct_sql_mem_processor_.get_compressed_size(),
+      op_monitor_info_.otherstat_4_id_, op_monitor_info_.otherstat_4_value_,
+      op_monitor_info_.otherstat_5_id_, op_monitor_info_.otherstat_5_value_);
   sql_mem_processor_.unregister_profile();
   distinct_sql_mem_processor_.unregister_profile();
   group_expr_fixed_lengths_.destroy();
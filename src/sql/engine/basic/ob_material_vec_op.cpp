@@ -156,6 +156,12 @@ int ObMaterialVecOp::rewind()
 int ObMaterialVecOp::inner_close()
 {
   int ret = OB_SUCCESS;
+  ObSqlMemMgrProcessor::set_compress_stat(sql_mem_processor_.get_compress_raw_size(),
+                                          sql_mem_processor_.get_compressed_size(),
+                                          op_monitor_info_.otherstat_1_id_,
+                                          op_monitor_info_.otherstat_1_value_,
+                                          op_monitor_info_.otherstat_2_id_,
+                                          op_monitor_info_.otherstat_2_value_);
   sql_mem_processor_.unregister_profile();
   reset();
   if (nullptr != mem_context_) {
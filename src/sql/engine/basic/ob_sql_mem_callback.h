@@ -28,6 +28,13 @@ public:
   virtual void alloc(int64_t size) = 0;
   virtual void free(int64_t size) = 0;
   virtual void dumped(int64_t size) = 0;
+  // @param raw_size: size of the dumped data before compression.
+  // @param compressed_size: size written to disk, which has been counted by dumped().
+  virtual void compressed(int64_t raw_size, int64_t compressed_size)
+  {
+    UNUSED(raw_size);
+    UNUSED(compressed_size);
+  }
 };
 
 } // end namespace sql
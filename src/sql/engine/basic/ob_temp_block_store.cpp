@@ -416,7 +416,9 @@ int ObTempBlockStore::decompr_block(BlockReader &reader, const Block *&blk)
     int64_t comp_size = reader.read_io_handle_.get_data_size() - sizeof(Block);
     int64_t decomp_size = blk->raw_size_ - sizeof(Block);
     int64_t actual_uncomp_size = 0;
-    if (OB_FAIL(ensure_reader_buffer(reader, reader.decompr_buf_, blk->raw_size_))) {
+    if (comp_size == decomp_size) {
+      // written without compression, see write_compressed_block()
+    } else if (OB_FAIL(ensure_reader_buffer(reader, reader.decompr_buf_, blk->raw_size_))) {
       LOG_WARN("fail to alloc decomp_buf", K(ret));
     } else if (FALSE_IT(MEMCPY(reader.decompr_buf_.data(), blk, sizeof(Block)))) {
     } else {
@@ -1274,11 +1276,22 @@ int ObTempBlockStore::write_compressed_block(Block *blk, BlockIndex *bi)
     } else if (FALSE_IT(MEMCPY(comp_buf, blk, sizeof(Block)))) { // copy the head
     } else if (OB_FAIL(compressor_.compress(blk->payload_, data_size, need_size, comp_buf + sizeof(Block), comp_size))) {
       LOG_WARN("fail to compress block", K(ret));
+    } else if (comp_size >= data_size) {
+      // incompressible, write the raw block to save the decompression when it is read back,
+      // it is recognized by the read size which equals to the raw size.
+      if (OB_FAIL(write_file(*bi, static_cast<void *>(blk), blk->raw_size_))) {
+        LOG_WARN("fail to write raw block to file", K(ret));
+      } else {
+        bi->length_ = blk->raw_size_;
+      }
     } else if (OB_FAIL(write_file(*bi, static_cast<void *>(comp_buf), comp_size + sizeof(Block)))) {
       LOG_WARN("fail to write compressed block to file", K(ret));
     } else {
       bi->length_ = comp_size + sizeof(Block);
     }
+    if (OB_SUCC(ret) && NULL != mem_stat_) {
+      mem_stat_->compressed(blk->raw_size_, bi->length_);
+    }
     if (OB_NOT_NULL(comp_buf)) {
       allocator_->free(comp_buf);
     }
@@ -1216,6 +1216,12 @@ int ObDMLService::init_dml_param(const ObDASDMLBaseCtDef &base_ctdef,
   if (base_ctdef.is_table_api_) {
     dml_param.write_flag_.set_is_table_api();
   }
+  if (base_ctdef.is_delta_update_) {
+    dml_param.write_flag_.set_delta_update();
+    if (base_ctdef.is_delta_non_neg_) {
+      dml_param.write_flag_.set_delta_non_neg();
+    }
+  }
   if (dml_param.table_param_->get_data_table().is_storage_index_table()
       && !dml_param.table_param_->get_data_table().can_read_index()) {
     dml_param.write_flag_.set_is_write_only_index();
@@ -24,6 +24,7 @@
 #include "sql/engine/expr/ob_expr_extra_info_factory.h"
 #include "sql/engine/expr/ob_datum_cast.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_jit.h"
 
 
 namespace oceanbase
@@ -140,6 +141,9 @@ OB_DEF_SERIALIZE(ObExpr)
     } else if (T_INVALID != type) {
       OB_UNIS_ENCODE(*extra_info_);
     }
+    // the root of a compiled expression tree is serialized with the function of the interpreter
+    sql::ser_eval_vector_function ser_eval_vector_func =
+        reinterpret_cast<sql::ser_eval_vector_function>(ObExprJit::get_origin_eval_vector_func(*this));
     OB_UNIS_ENCODE(dyn_buf_header_offset_)
     LST_DO_CODE(OB_UNIS_ENCODE,
                 vector_header_off_,
@@ -148,7 +152,7 @@ OB_DEF_SERIALIZE(ObExpr)
                 cont_buf_off_,
                 null_bitmap_off_,
                 vec_value_tc_,
-                ser_eval_vector_func_);
+                ser_eval_vector_func);
     OB_UNIS_ENCODE(local_session_var_id_);
   }
 
@@ -257,6 +261,8 @@ OB_DEF_SERIALIZE_SIZE(ObExpr)
   if (T_INVALID != type) {
     OB_UNIS_ADD_LEN(*extra_info_);
   }
+  sql::ser_eval_vector_function ser_eval_vector_func =
+      reinterpret_cast<sql::ser_eval_vector_function>(ObExprJit::get_origin_eval_vector_func(*this));
   OB_UNIS_ADD_LEN(dyn_buf_header_offset_);
   LST_DO_CODE(OB_UNIS_ADD_LEN,
               vector_header_off_,
@@ -265,7 +271,7 @@ OB_DEF_SERIALIZE_SIZE(ObExpr)
               cont_buf_off_,
               null_bitmap_off_,
               vec_value_tc_,
-              ser_eval_vector_func_);
+              ser_eval_vector_func);
 
   OB_UNIS_ADD_LEN(local_session_var_id_);
   return len;
@@ -53,6 +53,7 @@ int ObExprBenchmark::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr
   rt_expr.eval_func_ = ObExprBenchmark::eval_benchmark;
   if (!rt_expr.args_[0]->is_batch_result()) {
     rt_expr.eval_batch_func_ = eval_benchmark_batch;
+    rt_expr.eval_vector_func_ = eval_benchmark_vector;
   }
   return ret;
 }
@@ -134,6 +135,59 @@ int ObExprBenchmark::eval_benchmark_batch(const ObExpr &expr,
   return ret;
 }
 
+// The whole batch of the measured expression is evaluated per loop, so that the
+// vectorized (and compiled) functions are measured. The throughput is logged.
+int ObExprBenchmark::eval_benchmark_vector(const ObExpr &expr,
+                                           ObEvalCtx &ctx,
+                                           const ObBitVector &skip,
+                                           const EvalBound &bound)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *loop_count = NULL;
+  ObIVector *res_vec = expr.get_vector(ctx);
+  ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+  bool is_null = false;
+  if (OB_FAIL(expr.args_[0]->eval(ctx, loop_count))) {
+    LOG_WARN("failed to eval loop count", K(ret));
+  } else if (loop_count->is_null() || loop_count->get_int() < 0) {
+    is_null = true;
+    if (!loop_count->is_null() && loop_count->get_int() < 0) {
+      // compat with mysql, only throw a warning
+      LOG_WARN("Incorrect count value for function benchmark", K(loop_count->get_int()));
+    }
+  } else {
+    ObArray<ObExpr *> exprs_to_clear;
+    const int64_t loops = loop_count->get_int();
+    const int64_t row_cnt = bound.range_size() - skip.accumulate_bit_cnt(bound);
+    const int64_t start_time = ObTimeUtility::current_time();
+    if (OB_FAIL(collect_exprs(exprs_to_clear, expr, ctx))) {
+      LOG_WARN("failed to collect expr", K(ret));
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < loops && OB_SUCC(THIS_WORKER.check_status()); ++i) {
+        OZ (clear_all_flags(exprs_to_clear, ctx));
+        OZ (expr.args_[1]->eval_vector(ctx, skip, bound));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      const int64_t elapsed_us = MAX(ObTimeUtility::current_time() - start_time, 1);
+      LOG_INFO("benchmark of batch evaluation", K(loops), K(row_cnt), K(elapsed_us),
+               "rows_per_second", loops * row_cnt * 1000000 / elapsed_us);
+    }
+  }
+  for (int64_t j = bound.start(); OB_SUCC(ret) && j < bound.end(); ++j) {
+    if (skip.at(j) || eval_flags.at(j)) {
+      continue;
+    } else if (is_null) {
+      res_vec->set_null(j);
+    } else {
+      const int32_t res = 0;
+      res_vec->set_payload(j, &res, sizeof(res));
+    }
+    eval_flags.set(j);
+  }
+  return ret;
+}
+
 int ObExprBenchmark::collect_exprs(common::ObIArray<ObExpr *> &exprs,
                                    const ObExpr &root_expr,
                                    ObEvalCtx &ctx)
@@ -40,6 +40,11 @@ public:
                                   ObEvalCtx &ctx,
                                   const ObBitVector &skip,
                                   const int64_t batch_size);
+
+  static int eval_benchmark_vector(const ObExpr &expr,
+                                   ObEvalCtx &ctx,
+                                   const ObBitVector &skip,
+                                   const EvalBound &bound);
 private:
   static int collect_exprs(common::ObIArray<ObExpr *> &exprs,
                            const ObExpr &root_expr,
@@ -1499,6 +1499,7 @@ static ObExpr::EvalVectorFunc g_expr_eval_vector_functions[] = {
   ObExprCeilFloor::calc_ceil_floor_vector,                      /* 114 */
   ObExprRepeat::eval_repeat_vector,                             /* 115 */
   NULL, // ObExprRegexpReplace::eval_hs_regexp_replace_vector,  /* 116 */
+  ObExprBenchmark::eval_benchmark_vector,                       /* 117 */
 };
 
 REG_SER_FUNC_ARRAY(OB_SFA_SQL_EXPR_EVAL,
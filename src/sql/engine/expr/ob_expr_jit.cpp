@@ -0,0 +1,726 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/expr/ob_expr_jit.h"
+#include "share/vector/ob_fixed_length_base.h"
+#include "sql/engine/ob_physical_plan.h"
+#include "sql/engine/expr/ob_expr_add.h"
+#include "sql/engine/expr/ob_expr_minus.h"
+#include "sql/engine/expr/ob_expr_case.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace jit;
+namespace sql
+{
+
+ObExprJitCtx::ObExprJitCtx(const uint64_t tenant_id)
+  : allocator_(ObMemAttr(tenant_id, "SqlExprJit")),
+    helper_(allocator_),
+    roots_(),
+    entries_()
+{
+}
+
+ObExprJitCtx::~ObExprJitCtx()
+{
+  destroy();
+}
+
+int ObExprJitCtx::init()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(helper_.init())) {
+    LOG_WARN("failed to init llvm helper", K(ret));
+  }
+  return ret;
+}
+
+void ObExprJitCtx::destroy()
+{
+  for (int64_t i = 0; i < roots_.count(); ++i) {
+    ObExprJitRegistry::get_instance().unregister_entry(*roots_.at(i));
+  }
+  roots_.reset();
+  entries_.reset();
+}
+
+ObExprJitRegistry &ObExprJitRegistry::get_instance()
+{
+  static ObExprJitRegistry instance;
+  return instance;
+}
+
+int ObExprJitRegistry::init()
+{
+  int ret = OB_SUCCESS;
+  lib::ObMutexGuard guard(lock_);
+  if (inited_) {
+    // do nothing
+  } else if (OB_FAIL(map_.create(BUCKET_NUM, ObMemAttr(OB_SERVER_TENANT_ID, "SqlExprJit")))) {
+    LOG_WARN("failed to create expr jit map", K(ret));
+  } else {
+    ATOMIC_STORE(&inited_, true);
+  }
+  return ret;
+}
+
+int ObExprJitRegistry::register_entry(const ObExpr &expr, const ObExprJitEntry &entry)
+{
+  int ret = OB_SUCCESS;
+  if (!ATOMIC_LOAD(&inited_) && OB_FAIL(init())) {
+    LOG_WARN("failed to init expr jit registry", K(ret));
+  } else if (OB_FAIL(map_.set_refactored(reinterpret_cast<uint64_t>(&expr), &entry))) {
+    LOG_WARN("failed to register fused expr", K(ret), KP(&expr));
+  }
+  return ret;
+}
+
+void ObExprJitRegistry::unregister_entry(const ObExpr &expr)
+{
+  int ret = OB_SUCCESS;
+  if (!ATOMIC_LOAD(&inited_)) {
+    // do nothing
+  } else if (OB_FAIL(map_.erase_refactored(reinterpret_cast<uint64_t>(&expr)))
+             && OB_HASH_NOT_EXIST != ret) {
+    LOG_WARN("failed to unregister fused expr", K(ret), KP(&expr));
+  }
+}
+
+const ObExprJitEntry *ObExprJitRegistry::get_entry(const ObExpr &expr)
+{
+  const ObExprJitEntry *entry = NULL;
+  if (ATOMIC_LOAD(&inited_)
+      && OB_SUCCESS != map_.get_refactored(reinterpret_cast<uint64_t>(&expr), entry)) {
+    entry = NULL;
+  }
+  return entry;
+}
+
+bool ObExprJit::is_hot_plan(const ObPhysicalPlan &plan)
+{
+  return !plan.is_expr_jit_checked()
+         && plan.get_use_rich_format()
+         // the compiled function can not be shipped to the other servers
+         && plan.is_local_plan()
+         && !plan.is_use_px()
+         && ATOMIC_LOAD(&plan.stat_.hit_count_) >= HOT_PLAN_HIT_COUNT;
+}
+
+bool ObExprJit::is_int_expr(const ObExpr &expr)
+{
+  return ob_is_int_tc(expr.datum_meta_.type_) && VEC_TC_INTEGER == expr.vec_value_tc_;
+}
+
+bool ObExprJit::is_fusable_leaf(const ObExpr &expr)
+{
+  // columns and constants, which are projected without evaluation and can not fail
+  return 0 == expr.arg_cnt_ && NULL == expr.eval_func_ && is_int_expr(expr);
+}
+
+bool ObExprJit::is_fusable_node(const ObExpr &expr)
+{
+  bool bret = false;
+  if (!is_int_expr(expr)
+      || NULL == expr.eval_vector_func_
+      || expr_default_eval_vector_func == expr.eval_vector_func_) {
+    // do nothing
+  } else {
+    switch (expr.type_) {
+      case T_OP_ADD: {
+        bret = 2 == expr.arg_cnt_ && ObExprAdd::add_int_int_vector == expr.eval_vector_func_;
+        break;
+      }
+      case T_OP_MINUS: {
+        bret = 2 == expr.arg_cnt_ && ObExprMinus::minus_int_int_vector == expr.eval_vector_func_;
+        break;
+      }
+      case T_OP_EQ:
+      case T_OP_NE:
+      case T_OP_LT:
+      case T_OP_LE:
+      case T_OP_GT:
+      case T_OP_GE: {
+        bret = 2 == expr.arg_cnt_ && is_int_expr(*expr.args_[0]) && is_int_expr(*expr.args_[1]);
+        break;
+      }
+      case T_OP_CASE: {
+        // searched CASE with ELSE, the WHEN conditions are integers
+        bret = expr.arg_cnt_ >= 3 && 1 == expr.arg_cnt_ % 2
+               && ObExprCase::eval_case_vector == expr.eval_vector_func_;
+        for (int64_t i = 0; bret && i < expr.arg_cnt_; ++i) {
+          bret = is_int_expr(*expr.args_[i]);
+        }
+        break;
+      }
+      default: {
+        break;
+      }
+    }
+  }
+  return bret;
+}
+
+int ObExprJit::collect_tree(ObExpr &expr,
+                            ObIArray<ObExpr *> &nodes,
+                            ObIArray<ObExpr *> &leaves,
+                            bool &fusable)
+{
+  int ret = OB_SUCCESS;
+  if (!fusable) {
+    // do nothing
+  } else if (is_fusable_node(expr)) {
+    if (has_exist_in_array(nodes, &expr)) {
+      // shared sub expression
+    } else if (OB_FAIL(nodes.push_back(&expr))) {
+      LOG_WARN("failed to push back node", K(ret));
+    } else if (nodes.count() > MAX_NODE_CNT) {
+      fusable = false;
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && fusable && i < expr.arg_cnt_; ++i) {
+      if (OB_FAIL(collect_tree(*expr.args_[i], nodes, leaves, fusable))) {
+        LOG_WARN("failed to collect tree", K(ret));
+      }
+    }
+  } else if (is_fusable_leaf(expr)) {
+    if (has_exist_in_array(leaves, &expr)) {
+      // do nothing
+    } else if (OB_FAIL(leaves.push_back(&expr))) {
+      LOG_WARN("failed to push back leaf", K(ret));
+    } else if (leaves.count() > MAX_LEAF_CNT) {
+      fusable = false;
+    }
+  } else {
+    fusable = false;
+  }
+  return ret;
+}
+
+int ObExprJit::find_roots(ObPhysicalPlan &plan, ObIArray<ObExpr *> &roots)
+{
+  int ret = OB_SUCCESS;
+  ObIArray<ObExpr> &exprs = plan.get_expr_frame_info().rt_exprs_;
+  ObSEArray<ObExpr *, 16> fusable_exprs;
+  ObSEArray<int64_t, 16> node_cnts;
+  ObSEArray<ObExpr *, 16> inner_nodes;
+  for (int64_t i = 0; OB_SUCC(ret) && i < exprs.count(); ++i) {
+    ObExpr &expr = exprs.at(i);
+    ObSEArray<ObExpr *, 16> nodes;
+    ObSEArray<ObExpr *, MAX_LEAF_CNT> leaves;
+    bool fusable = is_fusable_node(expr);
+    if (!fusable) {
+      // do nothing
+    } else if (OB_FAIL(collect_tree(expr, nodes, leaves, fusable))) {
+      LOG_WARN("failed to collect tree", K(ret));
+    } else if (!fusable) {
+      // do nothing
+    } else if (OB_FAIL(fusable_exprs.push_back(&expr))) {
+      LOG_WARN("failed to push back expr", K(ret));
+    } else if (OB_FAIL(node_cnts.push_back(nodes.count()))) {
+      LOG_WARN("failed to push back node count", K(ret));
+    }
+  }
+  // the tree of a fusable expression is a part of the tree of its fusable parent
+  for (int64_t i = 0; OB_SUCC(ret) && i < fusable_exprs.count(); ++i) {
+    const ObExpr *expr = fusable_exprs.at(i);
+    for (int64_t j = 0; OB_SUCC(ret) && j < expr->arg_cnt_; ++j) {
+      if (has_exist_in_array(fusable_exprs, expr->args_[j])
+          && OB_FAIL(inner_nodes.push_back(expr->args_[j]))) {
+        LOG_WARN("failed to push back inner node", K(ret));
+      }
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < fusable_exprs.count(); ++i) {
+    ObExpr *expr = fusable_exprs.at(i);
+    if (!expr->is_batch_result()
+        || node_cnts.at(i) < MIN_NODE_CNT
+        || has_exist_in_array(inner_nodes, expr)) {
+      // do nothing
+    } else if (OB_FAIL(roots.push_back(expr))) {
+      LOG_WARN("failed to push back root", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObExprJit::generate_overflow(ObLLVMHelper &helper,
+                                 const bool is_add,
+                                 ObLLVMValue &left,
+                                 ObLLVMValue &right,
+                                 ObLLVMValue &res,
+                                 ObLLVMValue &overflow)
+{
+  int ret = OB_SUCCESS;
+  // the sign bit is set on overflow:
+  //   l + r: (l ^ res) & (r ^ res)
+  //   l - r: (l ^ r) & (l ^ res)
+  ObLLVMValue xor1;
+  ObLLVMValue xor2;
+  ObLLVMValue term;
+  if (OB_FAIL(helper.create_bit_xor(left, res, xor1))) {
+    LOG_WARN("failed to create xor", K(ret));
+  } else if (OB_FAIL(is_add ? helper.create_bit_xor(right, res, xor2)
+                            : helper.create_bit_xor(left, right, xor2))) {
+    LOG_WARN("failed to create xor", K(ret));
+  } else if (OB_FAIL(helper.create_bit_and(xor1, xor2, term))) {
+    LOG_WARN("failed to create and", K(ret));
+  } else if (OB_FAIL(helper.create_bit_or(overflow, term, overflow))) {
+    LOG_WARN("failed to create or", K(ret));
+  }
+  return ret;
+}
+
+int ObExprJit::generate_value(ObLLVMHelper &helper,
+                              const ObExpr &expr,
+                              ValueArray &values,
+                              ObLLVMValue &overflow,
+                              ObLLVMValue &result)
+{
+  int ret = OB_SUCCESS;
+  bool found = false;
+  for (int64_t i = 0; !found && i < values.count(); ++i) {
+    if (values.at(i).expr_ == &expr) {
+      result = values.at(i).value_;
+      found = true;
+    }
+  }
+  if (found) {
+    // leaves and shared sub expressions
+  } else if (T_OP_CASE == expr.type_) {
+    // the branches are folded from ELSE: res = (when_i != 0) ? then_i : res
+    ObLLVMValue zero;
+    if (OB_FAIL(helper.get_int64(0, zero))) {
+      LOG_WARN("failed to get int64", K(ret));
+    } else if (OB_FAIL(generate_value(helper, *expr.args_[expr.arg_cnt_ - 1], values, overflow,
+                                      result))) {
+      LOG_WARN("failed to generate else", K(ret));
+    }
+    for (int64_t i = expr.arg_cnt_ - 3; OB_SUCC(ret) && i >= 0; i -= 2) {
+      ObLLVMValue when;
+      ObLLVMValue then;
+      ObLLVMValue is_match;
+      if (OB_FAIL(generate_value(helper, *expr.args_[i], values, overflow, when))) {
+        LOG_WARN("failed to generate when", K(ret), K(i));
+      } else if (OB_FAIL(generate_value(helper, *expr.args_[i + 1], values, overflow, then))) {
+        LOG_WARN("failed to generate then", K(ret), K(i));
+      } else if (OB_FAIL(helper.create_icmp(when, zero, ObLLVMHelper::ICMP_NE, is_match))) {
+        LOG_WARN("failed to create icmp", K(ret));
+      } else if (OB_FAIL(helper.create_select(is_match, then, result, result))) {
+        LOG_WARN("failed to create select", K(ret));
+      }
+    }
+  } else {
+    ObLLVMValue left;
+    ObLLVMValue right;
+    if (OB_FAIL(generate_value(helper, *expr.args_[0], values, overflow, left))) {
+      LOG_WARN("failed to generate left", K(ret));
+    } else if (OB_FAIL(generate_value(helper, *expr.args_[1], values, overflow, right))) {
+      LOG_WARN("failed to generate right", K(ret));
+    } else if (T_OP_ADD == expr.type_ || T_OP_MINUS == expr.type_) {
+      const bool is_add = T_OP_ADD == expr.type_;
+      if (OB_FAIL(is_add ? helper.create_add(left, right, result)
+                         : helper.create_sub(left, right, result))) {
+        LOG_WARN("failed to create arith", K(ret), K(is_add));
+      } else if (OB_FAIL(generate_overflow(helper, is_add, left, right, result, overflow))) {
+        LOG_WARN("failed to generate overflow", K(ret));
+      }
+    } else {
+      ObLLVMHelper::CMPTYPE cmp_type = ObLLVMHelper::ICMP_EQ;
+      ObLLVMType int64_type;
+      ObLLVMValue is_true;
+      switch (expr.type_) {
+        case T_OP_EQ: cmp_type = ObLLVMHelper::ICMP_EQ; break;
+        case T_OP_NE: cmp_type = ObLLVMHelper::ICMP_NE; break;
+        case T_OP_LT: cmp_type = ObLLVMHelper::ICMP_SLT; break;
+        case T_OP_LE: cmp_type = ObLLVMHelper::ICMP_SLE; break;
+        case T_OP_GT: cmp_type = ObLLVMHelper::ICMP_SGT; break;
+        case T_OP_GE: cmp_type = ObLLVMHelper::ICMP_SGE; break;
+        default: {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unexpected expr type", K(ret), K(expr.type_));
+          break;
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(helper.get_llvm_type(ObIntType, int64_type))) {
+        LOG_WARN("failed to get llvm type", K(ret));
+      } else if (OB_FAIL(helper.create_icmp(left, right, cmp_type, is_true))) {
+        LOG_WARN("failed to create icmp", K(ret));
+      } else if (OB_FAIL(helper.create_zext(ObString("cmp"), is_true, int64_type, result))) {
+        LOG_WARN("failed to create zext", K(ret));
+      }
+    }
+  }
+  if (OB_SUCC(ret) && !found && OB_FAIL(values.push_back(ValuePair(&expr, result)))) {
+    LOG_WARN("failed to push back value", K(ret));
+  }
+  return ret;
+}
+
+int ObExprJit::generate_function(ObLLVMHelper &helper,
+                                 const ObString &name,
+                                 ObExpr &root,
+                                 const ObIArray<ObExpr *> &leaves)
+{
+  int ret = OB_SUCCESS;
+  ObLLVMType int64_type;
+  ObLLVMType int64_ptr_type;
+  ObLLVMType int64_ptr_ptr_type;
+  ObSEArray<ObLLVMType, 5> arg_types;
+  ObLLVMFunctionType func_type;
+  ObLLVMFunction func;
+  ObLLVMBasicBlock entry_block;
+  ObLLVMBasicBlock cond_block;
+  ObLLVMBasicBlock body_block;
+  ObLLVMBasicBlock exit_block;
+  ObLLVMValue begin;
+  ObLLVMValue end;
+  ObLLVMValue inputs;
+  ObLLVMValue masks;
+  ObLLVMValue res;
+  ObLLVMValue zero;
+  ObLLVMValue one;
+  ObLLVMValue idx_ptr;
+  ObLLVMValue overflow_ptr;
+  ObSEArray<ObLLVMValue, MAX_LEAF_CNT> leaf_datas;
+  ObSEArray<ObLLVMValue, MAX_LEAF_CNT> leaf_masks;
+  // int64_t (int64_t begin, int64_t end, int64_t **inputs, int64_t *masks, int64_t *res)
+  if (OB_FAIL(helper.get_llvm_type(ObIntType, int64_type))) {
+    LOG_WARN("failed to get llvm type", K(ret));
+  } else if (OB_FAIL(int64_type.get_pointer_to(int64_ptr_type))) {
+    LOG_WARN("failed to get pointer type", K(ret));
+  } else if (OB_FAIL(int64_ptr_type.get_pointer_to(int64_ptr_ptr_type))) {
+    LOG_WARN("failed to get pointer type", K(ret));
+  } else if (OB_FAIL(arg_types.push_back(int64_type))) {
+    LOG_WARN("push_back error", K(ret));
+  } else if (OB_FAIL(arg_types.push_back(int64_type))) {
+    LOG_WARN("push_back error", K(ret));
+  } else if (OB_FAIL(arg_types.push_back(int64_ptr_ptr_type))) {
+    LOG_WARN("push_back error", K(ret));
+  } else if (OB_FAIL(arg_types.push_back(int64_ptr_type))) {
+    LOG_WARN("push_back error", K(ret));
+  } else if (OB_FAIL(arg_types.push_back(int64_ptr_type))) {
+    LOG_WARN("push_back error", K(ret));
+  } else if (OB_FAIL(ObLLVMFunctionType::get(int64_type, arg_types, func_type))) {
+    LOG_WARN("failed to get function type", K(ret));
+  } else if (OB_FAIL(helper.create_function(name, func_type, func))) {
+    LOG_WARN("failed to create function", K(ret), K(name));
+  } else if (OB_FAIL(helper.create_block(ObString("entry"), func, entry_block))) {
+    LOG_WARN("failed to create block", K(ret));
+  } else if (OB_FAIL(helper.create_block(ObString("cond"), func, cond_block))) {
+    LOG_WARN("failed to create block", K(ret));
+  } else if (OB_FAIL(helper.create_block(ObString("body"), func, body_block))) {
+    LOG_WARN("failed to create block", K(ret));
+  } else if (OB_FAIL(helper.create_block(ObString("exit"), func, exit_block))) {
+    LOG_WARN("failed to create block", K(ret));
+  } else if (OB_FAIL(func.get_argument(0, begin))) {
+    LOG_WARN("failed to get argument", K(ret));
+  } else if (OB_FAIL(func.get_argument(1, end))) {
+    LOG_WARN("failed to get argument", K(ret));
+  } else if (OB_FAIL(func.get_argument(2, inputs))) {
+    LOG_WARN("failed to get argument", K(ret));
+  } else if (OB_FAIL(func.get_argument(3, masks))) {
+    LOG_WARN("failed to get argument", K(ret));
+  } else if (OB_FAIL(func.get_argument(4, res))) {
+    LOG_WARN("failed to get argument", K(ret));
+  }
+
+  // entry: init the counters and load the data of the leaves
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(helper.set_insert_point(entry_block))) {
+    LOG_WARN("failed to set insert point", K(ret));
+  } else if (OB_FAIL(helper.get_int64(0, zero))) {
+    LOG_WARN("failed to get int64", K(ret));
+  } else if (OB_FAIL(helper.get_int64(1, one))) {
+    LOG_WARN("failed to get int64", K(ret));
+  } else if (OB_FAIL(helper.create_alloca(ObString("idx"), int64_type, idx_ptr))) {
+    LOG_WARN("failed to create alloca", K(ret));
+  } else if (OB_FAIL(helper.create_store(begin, idx_ptr))) {
+    LOG_WARN("failed to create store", K(ret));
+  } else if (OB_FAIL(helper.create_alloca(ObString("overflow"), int64_type, overflow_ptr))) {
+    LOG_WARN("failed to create alloca", K(ret));
+  } else if (OB_FAIL(helper.create_store(zero, overflow_ptr))) {
+    LOG_WARN("failed to create store", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < leaves.count(); ++i) {
+    ObLLVMValue ptr;
+    ObLLVMValue data;
+    ObLLVMValue mask;
+    if (OB_FAIL(helper.create_const_gep1_64(ObString("input_ptr"), inputs, i, ptr))) {
+      LOG_WARN("failed to create gep", K(ret), K(i));
+    } else if (OB_FAIL(helper.create_load(ObString("input"), ptr, data))) {
+      LOG_WARN("failed to create load", K(ret), K(i));
+    } else if (OB_FAIL(helper.create_const_gep1_64(ObString("mask_ptr"), masks, i, ptr))) {
+      LOG_WARN("failed to create gep", K(ret), K(i));
+    } else if (OB_FAIL(helper.create_load(ObString("mask"), ptr, mask))) {
+      LOG_WARN("failed to create load", K(ret), K(i));
+    } else if (OB_FAIL(leaf_datas.push_back(data))) {
+      LOG_WARN("push_back error", K(ret));
+    } else if (OB_FAIL(leaf_masks.push_back(mask))) {
+      LOG_WARN("push_back error", K(ret));
+    }
+  }
+  if (OB_SUCC(ret) && OB_FAIL(helper.create_br(cond_block))) {
+    LOG_WARN("failed to create br", K(ret));
+  }
+
+  // cond: idx < end
+  if (OB_SUCC(ret)) {
+    ObLLVMValue idx;
+    ObLLVMValue is_less;
+    if (OB_FAIL(helper.set_insert_point(cond_block))) {
+      LOG_WARN("failed to set insert point", K(ret));
+    } else if (OB_FAIL(helper.create_load(ObString("idx"), idx_ptr, idx))) {
+      LOG_WARN("failed to create load", K(ret));
+    } else if (OB_FAIL(helper.create_icmp(idx, end, ObLLVMHelper::ICMP_SLT, is_less))) {
+      LOG_WARN("failed to create icmp", K(ret));
+    } else if (OB_FAIL(helper.create_cond_br(is_less, body_block, exit_block))) {
+      LOG_WARN("failed to create cond br", K(ret));
+    }
+  }
+
+  // body: compute the tree of the row
+  if (OB_SUCC(ret)) {
+    ValueArray values;
+    ObLLVMValue idx;
+    ObLLVMValue overflow;
+    ObLLVMValue value;
+    ObLLVMValue res_ptr;
+    ObLLVMValue next_idx;
+    if (OB_FAIL(helper.set_insert_point(body_block))) {
+      LOG_WARN("failed to set insert point", K(ret));
+    } else if (OB_FAIL(helper.create_load(ObString("idx"), idx_ptr, idx))) {
+      LOG_WARN("failed to create load", K(ret));
+    } else if (OB_FAIL(helper.create_load(ObString("overflow"), overflow_ptr, overflow))) {
+      LOG_WARN("failed to create load", K(ret));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < leaves.count(); ++i) {
+      ObLLVMValue pos;
+      ObLLVMValue ptr;
+      ObLLVMValue leaf_value;
+      if (OB_FAIL(helper.create_bit_and(idx, leaf_masks.at(i), pos))) {
+        LOG_WARN("failed to create and", K(ret), K(i));
+      } else if (OB_FAIL(helper.create_gep1(ObString("leaf_ptr"), leaf_datas.at(i), pos, ptr))) {
+        LOG_WARN("failed to create gep", K(ret), K(i));
+      } else if (OB_FAIL(helper.create_load(ObString("leaf"), ptr, leaf_value))) {
+        LOG_WARN("failed to create load", K(ret), K(i));
+      } else if (OB_FAIL(values.push_back(ValuePair(leaves.at(i), leaf_value)))) {
+        LOG_WARN("push_back error", K(ret));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(generate_value(helper, root, values, overflow, value))) {
+      LOG_WARN("failed to generate value", K(ret));
+    } else if (OB_FAIL(helper.create_gep1(ObString("res_ptr"), res, idx, res_ptr))) {
+      LOG_WARN("failed to create gep", K(ret));
+    } else if (OB_FAIL(helper.create_store(value, res_ptr))) {
+      LOG_WARN("failed to create store", K(ret));
+    } else if (OB_FAIL(helper.create_store(overflow, overflow_ptr))) {
+      LOG_WARN("failed to create store", K(ret));
+    } else if (OB_FAIL(helper.create_add(idx, one, next_idx))) {
+      LOG_WARN("failed to create add", K(ret));
+    } else if (OB_FAIL(helper.create_store(next_idx, idx_ptr))) {
+      LOG_WARN("failed to create store", K(ret));
+    } else if (OB_FAIL(helper.create_br(cond_block))) {
+      LOG_WARN("failed to create br", K(ret));
+    }
+  }
+
+  // exit: return whether any row overflows
+  if (OB_SUCC(ret)) {
+    ObLLVMValue overflow;
+    ObLLVMValue has_overflow;
+    ObLLVMValue ret_value;
+    if (OB_FAIL(helper.set_insert_point(exit_block))) {
+      LOG_WARN("failed to set insert point", K(ret));
+    } else if (OB_FAIL(helper.create_load(ObString("overflow"), overflow_ptr, overflow))) {
+      LOG_WARN("failed to create load", K(ret));
+    } else if (OB_FAIL(helper.create_icmp(overflow, zero, ObLLVMHelper::ICMP_SLT, has_overflow))) {
+      LOG_WARN("failed to create icmp", K(ret));
+    } else if (OB_FAIL(helper.create_zext(ObString("ret"), has_overflow, int64_type, ret_value))) {
+      LOG_WARN("failed to create zext", K(ret));
+    } else if (OB_FAIL(helper.create_ret(ret_value))) {
+      LOG_WARN("failed to create ret", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObExprJit::compile_plan(ObPhysicalPlan &plan)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObExpr *, 8> roots;
+  ObExprJitCtx *jit_ctx = NULL;
+  void *buf = NULL;
+  char name_buf[32];
+  plan.set_expr_jit_checked(true);
+  if (OB_NOT_NULL(plan.get_expr_jit_ctx())) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("plan is already compiled", K(ret));
+  } else if (OB_FAIL(find_roots(plan, roots))) {
+    LOG_WARN("failed to find roots", K(ret));
+  } else if (roots.empty()) {
+    // nothing to compile
+  } else if (OB_ISNULL(buf = ob_malloc(sizeof(ObExprJitCtx),
+                                       ObMemAttr(plan.get_tenant_id(), "SqlExprJit")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc memory", K(ret));
+  } else if (FALSE_IT(jit_ctx = new (buf) ObExprJitCtx(plan.get_tenant_id()))) {
+  } else if (OB_FAIL(jit_ctx->init())) {
+    LOG_WARN("failed to init jit ctx", K(ret));
+  } else {
+    ObLLVMHelper &helper = jit_ctx->helper_;
+    for (int64_t i = 0; OB_SUCC(ret) && i < roots.count(); ++i) {
+      ObExpr *root = roots.at(i);
+      ObSEArray<ObExpr *, 16> nodes;
+      ObSEArray<ObExpr *, MAX_LEAF_CNT> leaves;
+      bool fusable = true;
+      ObExprJitEntry *entry = NULL;
+      int64_t pos = 0;
+      if (OB_FAIL(collect_tree(*root, nodes, leaves, fusable))) {
+        LOG_WARN("failed to collect tree", K(ret));
+      } else if (OB_UNLIKELY(!fusable)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("root is not fusable", K(ret), K(i));
+      } else if (OB_FAIL(databuff_printf(name_buf, sizeof(name_buf), pos, "expr_jit_%ld", i))) {
+        LOG_WARN("failed to print function name", K(ret));
+      } else if (OB_FAIL(generate_function(helper, ObString(pos, name_buf), *root, leaves))) {
+        LOG_WARN("failed to generate function", K(ret), K(i));
+      } else if (OB_ISNULL(entry = OB_NEWx(ObExprJitEntry, (&jit_ctx->allocator_)))
+                 || OB_ISNULL(entry->leaves_ = static_cast<ObExpr **>(
+                      jit_ctx->allocator_.alloc(sizeof(ObExpr *) * leaves.count())))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc memory", K(ret));
+      } else {
+        entry->origin_func_ = root->eval_vector_func_;
+        entry->leaf_cnt_ = leaves.count();
+        for (int64_t j = 0; j < leaves.count(); ++j) {
+          entry->leaves_[j] = leaves.at(j);
+        }
+        if (OB_FAIL(jit_ctx->roots_.push_back(root))) {
+          LOG_WARN("push_back error", K(ret));
+        } else if (OB_FAIL(jit_ctx->entries_.push_back(entry))) {
+          LOG_WARN("push_back error", K(ret));
+        }
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(helper.verify_module())) {
+      LOG_WARN("failed to verify module", K(ret));
+    } else if (OB_FAIL(helper.compile_module(static_cast<jit::ObPLOptLevel>(2)))) {
+      LOG_WARN("failed to compile module", K(ret));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < jit_ctx->entries_.count(); ++i) {
+      ObExprJitEntry *entry = jit_ctx->entries_.at(i);
+      int64_t pos = 0;
+      if (OB_FAIL(databuff_printf(name_buf, sizeof(name_buf), pos, "expr_jit_%ld", i))) {
+        LOG_WARN("failed to print function name", K(ret));
+      } else if (OB_ISNULL(entry->func_ = reinterpret_cast<ObExprJitFunc>(
+                             helper.get_function_address(ObString(pos, name_buf))))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("failed to get function address", K(ret), K(i));
+      } else if (OB_FAIL(ObExprJitRegistry::get_instance().register_entry(
+                   *jit_ctx->roots_.at(i), *entry))) {
+        LOG_WARN("failed to register entry", K(ret), K(i));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      // the entries are visible before the roots are switched to the compiled functions
+      plan.set_expr_jit_ctx(jit_ctx);
+      for (int64_t i = 0; i < jit_ctx->roots_.count(); ++i) {
+        ATOMIC_STORE(&jit_ctx->roots_.at(i)->eval_vector_func_, &ObExprJit::eval_fused_vector);
+      }
+      LOG_INFO("compiled the expressions of hot plan", K(plan.get_plan_id()),
+               "fused_expr_cnt", jit_ctx->roots_.count());
+    }
+  }
+  if (OB_FAIL(ret)) {
+    destroy_ctx(jit_ctx);
+  }
+  return ret;
+}
+
+void ObExprJit::destroy_ctx(ObExprJitCtx *&jit_ctx)
+{
+  if (NULL != jit_ctx) {
+    jit_ctx->~ObExprJitCtx();
+    ob_free(jit_ctx);
+    jit_ctx = NULL;
+  }
+}
+
+ObExpr::EvalVectorFunc ObExprJit::get_origin_eval_vector_func(const ObExpr &expr)
+{
+  ObExpr::EvalVectorFunc func = expr.eval_vector_func_;
+  if (&ObExprJit::eval_fused_vector == func) {
+    const ObExprJitEntry *entry = ObExprJitRegistry::get_instance().get_entry(expr);
+    if (NULL != entry) {
+      func = entry->origin_func_;
+    }
+  }
+  return func;
+}
+
+int ObExprJit::eval_fused_vector(VECTOR_EVAL_FUNC_ARG_DECL)
+{
+  int ret = OB_SUCCESS;
+  const ObExprJitEntry *entry = ObExprJitRegistry::get_instance().get_entry(expr);
+  bool is_computed = false;
+  if (OB_ISNULL(entry)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("fused expr is not registered", K(ret), KP(&expr));
+  } else if (bound.get_all_rows_active() && VEC_FIXED == expr.get_format(ctx)) {
+    const int64_t *inputs[MAX_LEAF_CNT];
+    int64_t masks[MAX_LEAF_CNT];
+    bool is_valid = true;
+    for (int64_t i = 0; OB_SUCC(ret) && is_valid && i < entry->leaf_cnt_; ++i) {
+      const ObExpr *leaf = entry->leaves_[i];
+      if (OB_FAIL(leaf->eval_vector(ctx, skip, bound))) {
+        LOG_WARN("failed to eval leaf", K(ret), K(i));
+      } else {
+        const VectorFormat format = leaf->get_format(ctx);
+        ObIVector *vec = leaf->get_vector(ctx);
+        if (VEC_FIXED == format) {
+          const ObFixedLengthBase *fixed_vec = static_cast<const ObFixedLengthBase *>(vec);
+          is_valid = !fixed_vec->has_null() && sizeof(int64_t) == fixed_vec->get_length();
+          inputs[i] = reinterpret_cast<const int64_t *>(fixed_vec->get_data());
+          masks[i] = -1;
+        } else if (VEC_UNIFORM_CONST == format) {
+          is_valid = !vec->is_null(0);
+          inputs[i] = reinterpret_cast<const int64_t *>(vec->get_payload(0));
+          masks[i] = 0;
+        } else {
+          is_valid = false;
+        }
+      }
+    }
+    if (OB_SUCC(ret) && is_valid) {
+      ObFixedLengthBase *res_vec = static_cast<ObFixedLengthBase *>(expr.get_vector(ctx));
+      int64_t *res_arr = reinterpret_cast<int64_t *>(res_vec->get_data());
+      if (0 == entry->func_(bound.start(), bound.end(), inputs, masks, res_arr)) {
+        res_vec->get_nulls()->unset_all(bound.start(), bound.end());
+        expr.get_evaluated_flags(ctx).set_all(bound.start(), bound.end());
+        is_computed = true;
+      }
+    }
+  }
+  if (OB_SUCC(ret) && !is_computed && OB_FAIL(entry->origin_func_(expr, ctx, skip, bound))) {
+    LOG_WARN("failed to eval fused expr by interpreter", K(ret));
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_JIT_
+#define OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_JIT_
+
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_se_array.h"
+#include "lib/hash/ob_hashmap.h"
+#include "lib/lock/ob_mutex.h"
+#include "objit/ob_llvm_helper.h"
+#include "sql/engine/expr/ob_expr.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+class ObPhysicalPlan;
+
+// The compiled loop of a fused expression tree. It computes the rows in [begin, end) of the
+// tree from the int64 data of the leaves, and writes the results to %res. The position of
+// row i in the data of leaf k is (i & masks[k]), the mask is 0 for a constant leaf and ~0
+// for a vector. Returns non-zero if any addition or subtraction overflows.
+typedef int64_t (*ObExprJitFunc)(const int64_t begin,
+                                 const int64_t end,
+                                 const int64_t **inputs,
+                                 const int64_t *masks,
+                                 int64_t *res);
+
+struct ObExprJitEntry
+{
+  ObExprJitEntry() : origin_func_(NULL), func_(NULL), leaves_(NULL), leaf_cnt_(0) {}
+  TO_STRING_KV(KP_(origin_func), KP_(func), K_(leaf_cnt));
+
+  // the interpreter, which is used when the batch can not be computed by the compiled loop
+  ObExpr::EvalVectorFunc origin_func_;
+  ObExprJitFunc func_;
+  ObExpr **leaves_;
+  int64_t leaf_cnt_;
+};
+
+// The compiled expression trees of a plan, which are released with the plan.
+class ObExprJitCtx
+{
+public:
+  explicit ObExprJitCtx(const uint64_t tenant_id);
+  ~ObExprJitCtx();
+  int init();
+  void destroy();
+
+public:
+  common::ObArenaAllocator allocator_;
+  jit::ObLLVMHelper helper_;
+  common::ObSEArray<ObExpr *, 8> roots_;
+  common::ObSEArray<ObExprJitEntry *, 8> entries_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObExprJitCtx);
+};
+
+// Maps the fused root expressions of all plans to their entries. The entry is looked up
+// once per batch by the eval vector function of the root.
+class ObExprJitRegistry
+{
+public:
+  static ObExprJitRegistry &get_instance();
+  int register_entry(const ObExpr &expr, const ObExprJitEntry &entry);
+  void unregister_entry(const ObExpr &expr);
+  const ObExprJitEntry *get_entry(const ObExpr &expr);
+private:
+  ObExprJitRegistry() : inited_(false), lock_(), map_() {}
+  int init();
+private:
+  static const int64_t BUCKET_NUM = 1024;
+  bool inited_;
+  lib::ObMutex lock_;
+  common::hash::ObHashMap<uint64_t, const ObExprJitEntry *> map_;
+  DISALLOW_COPY_AND_ASSIGN(ObExprJitRegistry);
+};
+
+// ObExprJit compiles the expression trees of the hot plans into native loops with LLVM.
+//
+// A tree is fused if its inner nodes are signed integer additions, subtractions,
+// comparisons or searched CASE expressions with ELSE, and its leaves are columns or
+// constants. The eval vector function of the root is replaced by eval_fused_vector, which
+// evaluates the leaves and computes the whole tree in one loop without materializing the
+// inner nodes. The batches with nulls, skipped rows, non fixed-length leaves or overflows
+// are computed by the interpreter.
+class ObExprJit
+{
+public:
+  static const uint64_t HOT_PLAN_HIT_COUNT = 1000;
+
+  static bool is_hot_plan(const ObPhysicalPlan &plan);
+  static int compile_plan(ObPhysicalPlan &plan);
+  static void destroy_ctx(ObExprJitCtx *&jit_ctx);
+  static int eval_fused_vector(VECTOR_EVAL_FUNC_ARG_DECL);
+  // the fused roots are serialized with the eval vector function of the interpreter
+  static ObExpr::EvalVectorFunc get_origin_eval_vector_func(const ObExpr &expr);
+
+private:
+  struct ValuePair
+  {
+    ValuePair() : expr_(NULL), value_() {}
+    ValuePair(const ObExpr *expr, const jit::ObLLVMValue &value) : expr_(expr), value_(value) {}
+    TO_STRING_KV(KP_(expr));
+    const ObExpr *expr_;
+    jit::ObLLVMValue value_;
+  };
+  typedef common::ObSEArray<ValuePair, 16> ValueArray;
+
+  static const int64_t MAX_LEAF_CNT = 16;
+  static const int64_t MAX_NODE_CNT = 64;
+  static const int64_t MIN_NODE_CNT = 2;
+
+  static bool is_int_expr(const ObExpr &expr);
+  static bool is_fusable_leaf(const ObExpr &expr);
+  static bool is_fusable_node(const ObExpr &expr);
+  static int collect_tree(ObExpr &expr,
+                          common::ObIArray<ObExpr *> &nodes,
+                          common::ObIArray<ObExpr *> &leaves,
+                          bool &fusable);
+  static int find_roots(ObPhysicalPlan &plan, common::ObIArray<ObExpr *> &roots);
+  static int generate_function(jit::ObLLVMHelper &helper,
+                               const common::ObString &name,
+                               ObExpr &root,
+                               const common::ObIArray<ObExpr *> &leaves);
+  static int generate_value(jit::ObLLVMHelper &helper,
+                            const ObExpr &expr,
+                            ValueArray &values,
+                            jit::ObLLVMValue &overflow,
+                            jit::ObLLVMValue &result);
+  static int generate_overflow(jit::ObLLVMHelper &helper,
+                               const bool is_add,
+                               jit::ObLLVMValue &left,
+                               jit::ObLLVMValue &right,
+                               jit::ObLLVMValue &res,
+                               jit::ObLLVMValue &overflow);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+#endif // OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_JIT_
@@ -0,0 +1,1324 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include "sql/engine/expr/ob_expr_regexp_automaton.h"
+#include <algorithm>
+#include <icu/i18n/unicode/uregex.h>
+#include "lib/oblog/ob_log.h"
+#include "lib/utility/ob_sort.h"
+#if OB_USE_MULTITARGET_CODE
+#include <immintrin.h>
+#endif
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+OB_DECLARE_DEFAULT_CODE(
+const char *find_literal(const char *text,
+                         const int64_t text_len,
+                         const char *literal,
+                         const int64_t literal_len)
+{
+  return static_cast<const char *>(MEMMEM(text, text_len, literal, literal_len));
+}
+)
+
+OB_DECLARE_AVX2_SPECIFIC_CODE(
+// Compares the first and the last byte of the literal at 32 positions at once, and verifies
+// the candidates with memcmp.
+const char *find_literal(const char *text,
+                         const int64_t text_len,
+                         const char *literal,
+                         const int64_t literal_len)
+{
+  const char *res = NULL;
+  if (literal_len < 2 || text_len < literal_len + 32) {
+    res = static_cast<const char *>(MEMMEM(text, text_len, literal, literal_len));
+  } else {
+    const __m256i first = _mm256_set1_epi8(literal[0]);
+    const __m256i last = _mm256_set1_epi8(literal[literal_len - 1]);
+    const int64_t end = text_len - literal_len + 1;
+    int64_t i = 0;
+    for (; NULL == res && i + 32 <= end; i += 32) {
+      const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text + i));
+      const __m256i block_last = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i *>(text + i + literal_len - 1));
+      uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+          _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first),
+                           _mm256_cmpeq_epi8(last, block_last))));
+      while (0 != mask && NULL == res) {
+        const int64_t pos = i + __builtin_ctz(mask);
+        if (0 == MEMCMP(text + pos + 1, literal + 1, literal_len - 2)) {
+          res = text + pos;
+        }
+        mask &= mask - 1;
+      }
+    }
+    if (NULL == res && i < end) {
+      res = static_cast<const char *>(MEMMEM(text + i, text_len - i, literal, literal_len));
+    }
+  }
+  return res;
+}
+)
+
+static const char *search_literal(const char *text,
+                                  const int64_t text_len,
+                                  const char *literal,
+                                  const int64_t literal_len)
+{
+  const char *res = NULL;
+#if OB_USE_MULTITARGET_CODE
+  if (common::is_arch_supported(ObTargetArch::AVX2)) {
+    res = specific::avx2::find_literal(text, text_len, literal, literal_len);
+  } else {
+#endif
+    res = specific::normal::find_literal(text, text_len, literal, literal_len);
+#if OB_USE_MULTITARGET_CODE
+  }
+#endif
+  return res;
+}
+
+// Decodes the code point at %pos and moves %pos to the next one, returns false for the
+// ill-formed sequences, which are left to ICU.
+static OB_INLINE bool decode_code_point(const unsigned char *str,
+                                        const int64_t len,
+                                        const bool is_utf16,
+                                        int64_t &pos,
+                                        uint32_t &cp)
+{
+  bool is_valid = true;
+  if (is_utf16) {
+    if (pos + 2 > len) {
+      is_valid = false;
+    } else {
+      cp = (static_cast<uint32_t>(str[pos]) << 8) | str[pos + 1];
+      if (cp < 0xD800 || cp > 0xDFFF) {
+        pos += 2;
+      } else if (cp > 0xDBFF || pos + 4 > len) {
+        is_valid = false;
+      } else {
+        const uint32_t low = (static_cast<uint32_t>(str[pos + 2]) << 8) | str[pos + 3];
+        if (low < 0xDC00 || low > 0xDFFF) {
+          is_valid = false;
+        } else {
+          cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+          pos += 4;
+        }
+      }
+    }
+  } else {
+    const uint32_t c = str[pos];
+    if (c < 0x80) {
+      cp = c;
+      pos += 1;
+    } else if (c < 0xC2 || c > 0xF4) {
+      is_valid = false;
+    } else if (c < 0xE0) {
+      if (pos + 2 > len || 0x80 != (str[pos + 1] & 0xC0)) {
+        is_valid = false;
+      } else {
+        cp = ((c & 0x1F) << 6) | (str[pos + 1] & 0x3F);
+        pos += 2;
+      }
+    } else if (c < 0xF0) {
+      if (pos + 3 > len || 0x80 != (str[pos + 1] & 0xC0) || 0x80 != (str[pos + 2] & 0xC0)) {
+        is_valid = false;
+      } else {
+        cp = ((c & 0x0F) << 12) | ((str[pos + 1] & 0x3F) << 6) | (str[pos + 2] & 0x3F);
+        is_valid = cp >= 0x800 && (cp < 0xD800 || cp > 0xDFFF);
+        pos += 3;
+      }
+    } else {
+      if (pos + 4 > len || 0x80 != (str[pos + 1] & 0xC0) || 0x80 != (str[pos + 2] & 0xC0)
+          || 0x80 != (str[pos + 3] & 0xC0)) {
+        is_valid = false;
+      } else {
+        cp = ((c & 0x07) << 18) | ((str[pos + 1] & 0x3F) << 12)
+            | ((str[pos + 2] & 0x3F) << 6) | (str[pos + 3] & 0x3F);
+        is_valid = cp >= 0x10000 && cp <= 0x10FFFF;
+        pos += 4;
+      }
+    }
+  }
+  return is_valid;
+}
+
+static OB_INLINE bool is_ascii_alnum(const uint32_t cp)
+{
+  return (cp >= '0' && cp <= '9') || (cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z');
+}
+
+// same as the line terminators of ICU
+static OB_INLINE bool is_line_terminator(const uint32_t cp)
+{
+  return (cp >= 0x0A && cp <= 0x0D) || 0x85 == cp || 0x2028 == cp || 0x2029 == cp;
+}
+
+ObExprRegexAutomaton::ObExprRegexAutomaton()
+  : inited_(false),
+    allocator_("SqlRegexDfa"),
+    pattern_(NULL),
+    pattern_len_(0),
+    pos_(0),
+    depth_(0),
+    fold_case_(false),
+    dot_all_(false),
+    unix_lines_(false),
+    anchored_start_(false),
+    anchored_end_(false),
+    ascii_only_(false),
+    root_(-1),
+    literal_utf8_(),
+    literal_utf16_(),
+    class_cnt_(0),
+    set_word_cnt_(0),
+    set_bits_(NULL),
+    nfa_state_cnt_(0),
+    nfa_start_(-1),
+    trans_(NULL),
+    dfa_offsets_(NULL),
+    dfa_cnts_(NULL),
+    dfa_accepts_(NULL),
+    dfa_pool_(NULL),
+    dfa_pool_size_(0),
+    dfa_pool_cap_(0),
+    dfa_buckets_(NULL),
+    dfa_state_cnt_(0),
+    dfa_start_(UNKNOWN_STATE),
+    marks_(NULL),
+    mark_gen_(0)
+{
+  MEMSET(ascii_classes_, 0, sizeof(ascii_classes_));
+}
+
+ObExprRegexAutomaton::~ObExprRegexAutomaton()
+{
+  destroy();
+}
+
+void ObExprRegexAutomaton::destroy()
+{
+  inited_ = false;
+  pattern_ = NULL;
+  pattern_len_ = 0;
+  pos_ = 0;
+  depth_ = 0;
+  fold_case_ = false;
+  dot_all_ = false;
+  unix_lines_ = false;
+  anchored_start_ = false;
+  anchored_end_ = false;
+  ascii_only_ = false;
+  root_ = -1;
+  nodes_.reset();
+  ranges_.reset();
+  sets_.reset();
+  literal_utf8_.reset();
+  literal_utf16_.reset();
+  boundaries_.reset();
+  class_cnt_ = 0;
+  set_word_cnt_ = 0;
+  set_bits_ = NULL;
+  nfa_states_.reset();
+  nfa_state_cnt_ = 0;
+  nfa_start_ = -1;
+  trans_ = NULL;
+  dfa_offsets_ = NULL;
+  dfa_cnts_ = NULL;
+  dfa_accepts_ = NULL;
+  dfa_pool_ = NULL;
+  dfa_pool_size_ = 0;
+  dfa_pool_cap_ = 0;
+  dfa_buckets_ = NULL;
+  dfa_state_cnt_ = 0;
+  dfa_start_ = UNKNOWN_STATE;
+  marks_ = NULL;
+  mark_gen_ = 0;
+  closure_stack_.reset();
+  next_states_.reset();
+  allocator_.reset();
+}
+
+int ObExprRegexAutomaton::init(const ObString &pattern, const uint32_t flags, bool &is_supported)
+{
+  int ret = OB_SUCCESS;
+  const uint32_t supported_flags = UREGEX_CASE_INSENSITIVE | UREGEX_MULTILINE
+                                   | UREGEX_DOTALL | UREGEX_UNIX_LINES;
+  uint32_t *cps = NULL;
+  is_supported = false;
+  if (OB_UNLIKELY(inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (0 != (flags & ~supported_flags)
+             || 0 != pattern.length() % 2
+             || pattern.length() / 2 > MAX_PATTERN_LEN) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_ISNULL(cps = static_cast<uint32_t *>(
+                 allocator_.alloc(sizeof(uint32_t) * (pattern.length() / 2 + 1))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(pattern.length()));
+  } else {
+    const unsigned char *str = reinterpret_cast<const unsigned char *>(pattern.ptr());
+    int64_t pos = 0;
+    pattern_len_ = 0;
+    while (OB_SUCC(ret) && pos < pattern.length()) {
+      if (!decode_code_point(str, pattern.length(), true, pos, cps[pattern_len_])) {
+        ret = OB_NOT_SUPPORTED;
+      } else {
+        ++pattern_len_;
+      }
+    }
+    pattern_ = cps;
+    fold_case_ = 0 != (flags & UREGEX_CASE_INSENSITIVE);
+    dot_all_ = 0 != (flags & UREGEX_DOTALL);
+    unix_lines_ = 0 != (flags & UREGEX_UNIX_LINES);
+    // a case-insensitive pattern may match a non-ascii text by the full case folding of ICU,
+    // e.g. 'ss' matches 'ß'.
+    ascii_only_ = fold_case_;
+    if (OB_SUCC(ret) && pattern_len_ > 0 && '^' == pattern_[0]) {
+      anchored_start_ = true;
+      pos_ = 1;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(parse_alt(root_))) {
+  } else if (pos_ != pattern_len_) {
+    ret = OB_NOT_SUPPORTED;
+  } else if ((anchored_start_ || anchored_end_)
+             && (0 != (flags & UREGEX_MULTILINE) || NODE_ALT == nodes_.at(root_).type_)) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_FAIL(extract_literal())) {
+  } else if (OB_FAIL(build_classes())) {
+  } else {
+    int32_t match_state = -1;
+    if (OB_FAIL(add_nfa_state(NFA_MATCH, -1, -1, -1, match_state))) {
+    } else if (OB_FAIL(compile_node(root_, match_state, nfa_start_))) {
+    } else {
+      nfa_state_cnt_ = static_cast<int32_t>(nfa_states_.count());
+      dfa_pool_cap_ = MIN(MAX_DFA_POOL_SIZE, nfa_state_cnt_ * MAX_DFA_STATE_CNT);
+      if (OB_ISNULL(trans_ = static_cast<int32_t *>(
+                    allocator_.alloc(sizeof(int32_t) * class_cnt_ * MAX_DFA_STATE_CNT)))
+          || OB_ISNULL(dfa_offsets_ = static_cast<int32_t *>(
+                       allocator_.alloc(sizeof(int32_t) * MAX_DFA_STATE_CNT)))
+          || OB_ISNULL(dfa_cnts_ = static_cast<int32_t *>(
+                       allocator_.alloc(sizeof(int32_t) * MAX_DFA_STATE_CNT)))
+          || OB_ISNULL(dfa_accepts_ = static_cast<bool *>(
+                       allocator_.alloc(sizeof(bool) * MAX_DFA_STATE_CNT)))
+          || OB_ISNULL(dfa_pool_ = static_cast<int32_t *>(
+                       allocator_.alloc(sizeof(int32_t) * dfa_pool_cap_)))
+          || OB_ISNULL(dfa_buckets_ = static_cast<int32_t *>(
+                       allocator_.alloc(sizeof(int32_t) * DFA_BUCKET_CNT)))
+          || OB_ISNULL(marks_ = static_cast<int32_t *>(
+                       allocator_.alloc(sizeof(int32_t) * nfa_state_cnt_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("allocate memory failed", K(ret), K(class_cnt_), K(nfa_state_cnt_));
+      } else {
+        MEMSET(marks_, 0, sizeof(int32_t) * nfa_state_cnt_);
+        if (OB_FAIL(reset_dfa())) {
+          LOG_WARN("reset dfa failed", K(ret));
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    inited_ = true;
+    is_supported = true;
+    LOG_TRACE("regexp automaton inited", K(*this));
+  } else if (OB_NOT_SUPPORTED == ret) {
+    LOG_TRACE("pattern is not supported by the regexp automaton", K(pattern), K(flags), K(pos_));
+    ret = OB_SUCCESS;
+    destroy();
+  } else if (OB_INIT_TWICE != ret) {
+    LOG_WARN("init regexp automaton failed", K(ret), K(pattern), K(flags));
+    destroy();
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::add_node(const NodeType type, const int32_t set_id, int32_t &node)
+{
+  int ret = OB_SUCCESS;
+  Node tmp;
+  tmp.type_ = type;
+  tmp.set_id_ = set_id;
+  node = static_cast<int32_t>(nodes_.count());
+  if (OB_FAIL(nodes_.push_back(tmp))) {
+    LOG_WARN("push back failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::append_child(const int32_t parent, const int32_t child)
+{
+  int ret = OB_SUCCESS;
+  if (-1 == nodes_.at(parent).child_) {
+    nodes_.at(parent).child_ = child;
+  } else {
+    int32_t last = nodes_.at(parent).child_;
+    while (-1 != nodes_.at(last).sibling_) {
+      last = nodes_.at(last).sibling_;
+    }
+    nodes_.at(last).sibling_ = child;
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::parse_alt(int32_t &node)
+{
+  int ret = OB_SUCCESS;
+  int32_t child = -1;
+  if (OB_FAIL(parse_concat(child))) {
+  } else if (pos_ >= pattern_len_ || '|' != pattern_[pos_]) {
+    node = child;
+  } else if (OB_FAIL(add_node(NODE_ALT, -1, node))) {
+  } else if (OB_FAIL(append_child(node, child))) {
+  } else {
+    while (OB_SUCC(ret) && pos_ < pattern_len_ && '|' == pattern_[pos_]) {
+      ++pos_;
+      if (OB_FAIL(parse_concat(child))) {
+      } else if (OB_FAIL(append_child(node, child))) {
+      }
+    }
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::parse_concat(int32_t &node)
+{
+  int ret = OB_SUCCESS;
+  int32_t child = -1;
+  if (OB_FAIL(add_node(NODE_CONCAT, -1, node))) {
+  }
+  while (OB_SUCC(ret) && pos_ < pattern_len_
+         && '|' != pattern_[pos_] && ')' != pattern_[pos_]) {
+    if ('$' == pattern_[pos_]) {
+      // '$' is only supported at the end of the pattern
+      if (0 == depth_ && pos_ + 1 == pattern_len_) {
+        anchored_end_ = true;
+        ++pos_;
+      } else {
+        ret = OB_NOT_SUPPORTED;
+      }
+    } else if (OB_FAIL(parse_repeat(child))) {
+    } else if (OB_FAIL(append_child(node, child))) {
+    }
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::parse_number(int32_t &value)
+{
+  int ret = OB_SUCCESS;
+  value = 0;
+  if (pos_ >= pattern_len_ || pattern_[pos_] < '0' || pattern_[pos_] > '9') {
+    ret = OB_NOT_SUPPORTED;
+  }
+  while (OB_SUCC(ret) && pos_ < pattern_len_ && pattern_[pos_] >= '0' && pattern_[pos_] <= '9') {
+    value = value * 10 + static_cast<int32_t>(pattern_[pos_] - '0');
+    ++pos_;
+    if (value > MAX_REPEAT_CNT) {
+      ret = OB_NOT_SUPPORTED;
+    }
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::parse_repeat(int32_t &node)
+{
+  int ret = OB_SUCCESS;
+  int32_t atom = -1;
+  int32_t min = 1;
+  int32_t max = 1;
+  bool has_quantifier = true;
+  if (OB_FAIL(parse_atom(atom))) {
+  } else if (pos_ >= pattern_len_) {
+    has_quantifier = false;
+  } else if ('*' == pattern_[pos_]) {
+    min = 0;
+    max = -1;
+    ++pos_;
+  } else if ('+' == pattern_[pos_]) {
+    min = 1;
+    max = -1;
+    ++pos_;
+  } else if ('?' == pattern_[pos_]) {
+    min = 0;
+    max = 1;
+    ++pos_;
+  } else if ('{' == pattern_[pos_]) {
+    ++pos_;
+    if (OB_FAIL(parse_number(min))) {
+    } else if (pos_ < pattern_len_ && '}' == pattern_[pos_]) {
+      max = min;
+    } else if (pos_ >= pattern_len_ || ',' != pattern_[pos_]) {
+      ret = OB_NOT_SUPPORTED;
+    } else if (++pos_ < pattern_len_ && '}' == pattern_[pos_]) {
+      max = -1;
+    } else if (OB_FAIL(parse_number(max))) {
+    } else if (max < min) {
+      ret = OB_NOT_SUPPORTED;
+    }
+    if (OB_FAIL(ret)) {
+    } else if (pos_ >= pattern_len_ || '}' != pattern_[pos_]) {
+      ret = OB_NOT_SUPPORTED;
+    } else {
+      ++pos_;
+    }
+  } else {
+    has_quantifier = false;
+  }
+  if (OB_FAIL(ret) || !has_quantifier) {
+    node = atom;
+  } else {
+    // the lazy quantifiers find the same matches, the possessive ones do not
+    if (pos_ < pattern_len_ && '?' == pattern_[pos_]) {
+      ++pos_;
+    }
+    if (pos_ < pattern_len_ && ('*' == pattern_[pos_] || '+' == pattern_[pos_]
+                                || '?' == pattern_[pos_] || '{' == pattern_[pos_])) {
+      ret = OB_NOT_SUPPORTED;
+    } else if (OB_FAIL(add_node(NODE_REPEAT, -1, node))) {
+    } else {
+      nodes_.at(node).min_ = min;
+      nodes_.at(node).max_ = max;
+      nodes_.at(node).child_ = atom;
+    }
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::parse_atom(int32_t &node)
+{
+  int ret = OB_SUCCESS;
+  const uint32_t cp = pattern_[pos_];
+  int32_t set_id = -1;
+  if ('(' == cp) {
+    ++pos_;
+    if (pos_ < pattern_len_ && '?' == pattern_[pos_]) {
+      // only the non-capturing group, not the lookaround or the inline flags
+      if (pos_ + 1 < pattern_len_ && ':' == pattern_[pos_ + 1]) {
+        pos_ += 2;
+      } else {
+        ret = OB_NOT_SUPPORTED;
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (++depth_ > MAX_GROUP_DEPTH) {
+      ret = OB_NOT_SUPPORTED;
+    } else if (OB_FAIL(parse_alt(node))) {
+    } else if (pos_ >= pattern_len_ || ')' != pattern_[pos_]) {
+      ret = OB_NOT_SUPPORTED;
+    } else {
+      ++pos_;
+      --depth_;
+    }
+  } else if ('[' == cp) {
+    if (OB_FAIL(parse_class(set_id))) {
+    } else if (OB_FAIL(add_node(NODE_SET, set_id, node))) {
+    }
+  } else if ('.' == cp) {
+    RangeArray ranges;
+    ++pos_;
+    if (dot_all_) {
+    } else if (unix_lines_) {
+      ret = ranges.push_back(Range('\n', '\n'));
+    } else if (OB_FAIL(ranges.push_back(Range(0x0A, 0x0D)))) {
+    } else if (OB_FAIL(ranges.push_back(Range(0x85, 0x85)))) {
+    } else if (OB_FAIL(ranges.push_back(Range(0x2028, 0x2029)))) {
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(add_set(ranges, true, false, set_id))) {
+    } else if (OB_FAIL(add_node(NODE_SET, set_id, node))) {
+    }
+  } else if ('\\' == cp) {
+    RangeArray ranges;
+    bool is_single = false;
+    uint32_t escaped = 0;
+    if (OB_FAIL(parse_escape(false, ranges, is_single, escaped))) {
+    } else if (is_single && OB_FAIL(add_literal_set(escaped, set_id))) {
+    } else if (!is_single && OB_FAIL(add_set(ranges, false, false, set_id))) {
+    } else if (OB_FAIL(add_node(NODE_SET, set_id, node))) {
+    }
+  } else if ('*' == cp || '+' == cp || '?' == cp || '{' == cp || '}' == cp
+             || ']' == cp || '^' == cp || '$' == cp) {
+    ret = OB_NOT_SUPPORTED;
+  } else {
+    ++pos_;
+    if (OB_FAIL(add_literal_set(cp, set_id))) {
+    } else if (OB_FAIL(add_node(NODE_SET, set_id, node))) {
+    }
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::parse_escape(const bool in_class,
+                                       RangeArray &ranges,
+                                       bool &is_single,
+                                       uint32_t &cp)
+{
+  int ret = OB_SUCCESS;
+  is_single = false;
+  ranges.reuse();
+  if (pos_ + 1 >= pattern_len_) {
+    ret = OB_NOT_SUPPORTED;
+  } else {
+    const uint32_t c = pattern_[pos_ + 1];
+    pos_ += 2;
+    switch (c) {
+      case 't': cp = '\t'; is_single = true; break;
+      case 'n': cp = '\n'; is_single = true; break;
+      case 'r': cp = '\r'; is_single = true; break;
+      case 'f': cp = '\f'; is_single = true; break;
+      case 'e': cp = 0x1B; is_single = true; break;
+      case 'a': cp = 0x07; is_single = true; break;
+      case 'd':
+      case 'D': {
+        ret = ranges.push_back(Range('0', '9'));
+        break;
+      }
+      case 'w':
+      case 'W': {
+        if (OB_FAIL(ranges.push_back(Range('0', '9')))) {
+        } else if (OB_FAIL(ranges.push_back(Range('A', 'Z')))) {
+        } else if (OB_FAIL(ranges.push_back(Range('_', '_')))) {
+        } else if (OB_FAIL(ranges.push_back(Range('a', 'z')))) {
+        }
+        break;
+      }
+      case 's':
+      case 'S': {
+        if (OB_FAIL(ranges.push_back(Range('\t', '\r')))) {
+        } else if (OB_FAIL(ranges.push_back(Range(' ', ' ')))) {
+        }
+        break;
+      }
+      default: {
+        // the other escaped letters and digits have special meanings in ICU
+        if (c < 0x80 && !is_ascii_alnum(c)) {
+          cp = c;
+          is_single = true;
+        } else {
+          ret = OB_NOT_SUPPORTED;
+        }
+        break;
+      }
+    }
+    if (OB_FAIL(ret) || is_single) {
+    } else {
+      // \d \w \s are the unicode properties in ICU, only the ascii texts are matched by them.
+      ascii_only_ = true;
+      if ('D' == c || 'W' == c || 'S' == c) {
+        if (in_class) {
+          ret = OB_NOT_SUPPORTED;
+        } else {
+          RangeArray negated;
+          uint32_t lo = 0;
+          for (int64_t i = 0; OB_SUCC(ret) && i < ranges.count(); ++i) {
+            if (ranges.at(i).lo_ > lo) {
+              ret = negated.push_back(Range(lo, ranges.at(i).lo_ - 1));
+            }
+            lo = ranges.at(i).hi_ + 1;
+          }
+          if (OB_FAIL(ret)) {
+          } else if (OB_FAIL(negated.push_back(Range(lo, MAX_CODE_POINT)))) {
+          } else if (OB_FAIL(ranges.assign(negated))) {
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::parse_class(int32_t &set_id)
+{
+  int ret = OB_SUCCESS;
+  RangeArray ranges;
+  RangeArray escaped;
+  bool negated = false;
+  bool is_end = false;
+  bool is_first = true;
+  ++pos_;
+  if (pos_ < pattern_len_ && '^' == pattern_[pos_]) {
+    negated = true;
+    ++pos_;
+  }
+  // the leading ']' and the posix classes are left to ICU
+  if (pos_ < pattern_len_ && (']' == pattern_[pos_] || ':' == pattern_[pos_])) {
+    ret = OB_NOT_SUPPORTED;
+  }
+  while (OB_SUCC(ret) && !is_end) {
+    uint32_t lo = 0;
+    bool is_single = true;
+    bool can_be_range = true;
+    if (pos_ >= pattern_len_) {
+      ret = OB_NOT_SUPPORTED;
+    } else if (']' == pattern_[pos_]) {
+      is_end = true;
+      ++pos_;
+    } else if ('[' == pattern_[pos_] || '&' == pattern_[pos_] || '$' == pattern_[pos_]
+               || '{' == pattern_[pos_] || '}' == pattern_[pos_]) {
+      // nested sets, set operations and the other UnicodeSet syntax
+      ret = OB_NOT_SUPPORTED;
+    } else if ('-' == pattern_[pos_]) {
+      if (is_first || (pos_ + 1 < pattern_len_ && ']' == pattern_[pos_ + 1])) {
+        lo = '-';
+        can_be_range = false;
+        ++pos_;
+      } else {
+        ret = OB_NOT_SUPPORTED;
+      }
+    } else if ('\\' == pattern_[pos_]) {
+      if (OB_FAIL(parse_escape(true, escaped, is_single, lo))) {
+      } else if (!is_single) {
+        for (int64_t i = 0; OB_SUCC(ret) && i < escaped.count(); ++i) {
+          ret = ranges.push_back(escaped.at(i));
+        }
+      }
+    } else {
+      lo = pattern_[pos_];
+      ++pos_;
+    }
+    if (OB_FAIL(ret) || is_end || !is_single) {
+    } else if (pos_ + 1 < pattern_len_ && '-' == pattern_[pos_] && ']' != pattern_[pos_ + 1]) {
+      if (!can_be_range) {
+        ret = OB_NOT_SUPPORTED;
+      }
+      uint32_t hi = 0;
+      ++pos_;
+      if (OB_FAIL(ret)) {
+      } else if ('\\' == pattern_[pos_]) {
+        if (OB_FAIL(parse_escape(true, escaped, is_single, hi))) {
+        } else if (!is_single) {
+          ret = OB_NOT_SUPPORTED;
+        }
+      } else if ('[' == pattern_[pos_] || '&' == pattern_[pos_] || '$' == pattern_[pos_]
+                 || '{' == pattern_[pos_] || '}' == pattern_[pos_] || '-' == pattern_[pos_]) {
+        ret = OB_NOT_SUPPORTED;
+      } else {
+        hi = pattern_[pos_];
+        ++pos_;
+      }
+      if (OB_FAIL(ret)) {
+      } else if (hi < lo) {
+        ret = OB_NOT_SUPPORTED;
+      } else {
+        ret = ranges.push_back(Range(lo, hi));
+      }
+    } else {
+      ret = ranges.push_back(Range(lo, lo));
+    }
+    is_first = false;
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(add_set(ranges, negated, fold_case_, set_id))) {
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::add_literal_set(const uint32_t cp, int32_t &set_id)
+{
+  int ret = OB_SUCCESS;
+  RangeArray ranges;
+  if (OB_FAIL(ranges.push_back(Range(cp, cp)))) {
+    LOG_WARN("push back failed", K(ret));
+  } else if (OB_FAIL(add_set(ranges, false, fold_case_, set_id))) {
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::add_set(RangeArray &ranges,
+                                  const bool negated,
+                                  const bool fold_case,
+                                  int32_t &set_id)
+{
+  int ret = OB_SUCCESS;
+  CharSet set;
+  if (fold_case) {
+    const int64_t cnt = ranges.count();
+    if (negated) {
+      ret = OB_NOT_SUPPORTED;
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < cnt; ++i) {
+      const Range range = ranges.at(i);
+      if (range.hi_ >= 0x80) {
+        ret = OB_NOT_SUPPORTED;
+      }
+      for (uint32_t c = MAX(range.lo_, static_cast<uint32_t>('A'));
+           OB_SUCC(ret) && c <= MIN(range.hi_, static_cast<uint32_t>('Z')); ++c) {
+        ret = ranges.push_back(Range(c + 'a' - 'A', c + 'a' - 'A'));
+      }
+      for (uint32_t c = MAX(range.lo_, static_cast<uint32_t>('a'));
+           OB_SUCC(ret) && c <= MIN(range.hi_, static_cast<uint32_t>('z')); ++c) {
+        ret = ranges.push_back(Range(c - 'a' + 'A', c - 'a' + 'A'));
+      }
+    }
+  }
+  if (OB_SUCC(ret) && ranges.count() > 0) {
+    lib::ob_sort(ranges.get_data(), ranges.get_data() + ranges.count());
+  }
+  set.offset_ = static_cast<int32_t>(ranges_.count());
+  if (OB_FAIL(ret)) {
+  } else if (!negated) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < ranges.count(); ++i) {
+      const Range &range = ranges.at(i);
+      if (ranges_.count() > set.offset_ && ranges_.at(ranges_.count() - 1).hi_ + 1 >= range.lo_) {
+        ranges_.at(ranges_.count() - 1).hi_ = MAX(ranges_.at(ranges_.count() - 1).hi_, range.hi_);
+      } else if (OB_FAIL(ranges_.push_back(range))) {
+        LOG_WARN("push back failed", K(ret));
+      }
+    }
+  } else {
+    // the complement of the merged ranges
+    uint32_t lo = 0;
+    bool is_full = false;
+    for (int64_t i = 0; OB_SUCC(ret) && !is_full && i < ranges.count(); ++i) {
+      const Range &range = ranges.at(i);
+      if (range.lo_ > lo && OB_FAIL(ranges_.push_back(Range(lo, range.lo_ - 1)))) {
+        LOG_WARN("push back failed", K(ret));
+      } else if (range.hi_ >= MAX_CODE_POINT) {
+        is_full = true;
+      } else {
+        lo = MAX(lo, range.hi_ + 1);
+      }
+    }
+    if (OB_SUCC(ret) && !is_full && OB_FAIL(ranges_.push_back(Range(lo, MAX_CODE_POINT)))) {
+      LOG_WARN("push back failed", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    set.cnt_ = static_cast<int32_t>(ranges_.count() - set.offset_);
+    set_id = static_cast<int32_t>(sets_.count());
+    if (OB_FAIL(sets_.push_back(set))) {
+      LOG_WARN("push back failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+bool ObExprRegexAutomaton::is_literal_node(const int32_t node, uint32_t &cp) const
+{
+  bool bret = false;
+  const Node &n = nodes_.at(node);
+  if (NODE_SET == n.type_) {
+    const CharSet &set = sets_.at(n.set_id_);
+    if (1 == set.cnt_ && ranges_.at(set.offset_).lo_ == ranges_.at(set.offset_).hi_) {
+      cp = ranges_.at(set.offset_).lo_;
+      bret = true;
+    }
+  }
+  return bret;
+}
+
+// Finds the longest run of the code points that every match must contain, from the top level
+// concatenation of the pattern. A literal repeated by 'x{m,n}' or 'x+' ends a run and starts
+// the next one, e.g. 'ab+c' contains both 'ab' and 'bc'.
+int ObExprRegexAutomaton::extract_literal()
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<uint32_t, 64> best;
+  ObSEArray<uint32_t, 64> cur;
+  const Node &root = nodes_.at(root_);
+  int32_t child = NODE_CONCAT == root.type_ ? root.child_ : root_;
+  while (OB_SUCC(ret) && -1 != child) {
+    const Node &n = nodes_.at(child);
+    uint32_t cp = 0;
+    bool is_cut = true;
+    if (is_literal_node(child, cp)) {
+      ret = cur.push_back(cp);
+      is_cut = false;
+    } else if (NODE_REPEAT == n.type_ && n.min_ > 0 && is_literal_node(n.child_, cp)) {
+      for (int32_t i = 0; OB_SUCC(ret) && i < n.min_; ++i) {
+        ret = cur.push_back(cp);
+      }
+      is_cut = n.max_ != n.min_;
+    }
+    if (OB_SUCC(ret) && (is_cut || -1 == n.sibling_ || NODE_CONCAT != root.type_)) {
+      if (cur.count() > best.count() && OB_FAIL(best.assign(cur))) {
+        LOG_WARN("assign failed", K(ret));
+      } else {
+        cur.reuse();
+        if (NODE_REPEAT == n.type_ && n.min_ > 0 && is_literal_node(n.child_, cp)) {
+          ret = cur.push_back(cp);
+        }
+      }
+    }
+    child = NODE_CONCAT == root.type_ ? n.sibling_ : -1;
+  }
+  if (OB_FAIL(ret)) {
+  } else if (best.count() > 0 && OB_FAIL(encode_literal(best))) {
+    LOG_WARN("encode literal failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::encode_literal(const ObIArray<uint32_t> &cps)
+{
+  int ret = OB_SUCCESS;
+  char *utf8 = NULL;
+  char *utf16 = NULL;
+  int64_t utf8_len = 0;
+  int64_t utf16_len = 0;
+  bool has_question_mark = false;
+  for (int64_t i = 0; i < cps.count(); ++i) {
+    // the ill-formed characters may be converted to '?' before matched by ICU
+    has_question_mark = has_question_mark || '?' == cps.at(i);
+  }
+  if (has_question_mark) {
+  } else if (OB_ISNULL(utf8 = static_cast<char *>(allocator_.alloc(cps.count() * 4)))
+             || OB_ISNULL(utf16 = static_cast<char *>(allocator_.alloc(cps.count() * 4)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(cps.count()));
+  } else {
+    for (int64_t i = 0; i < cps.count(); ++i) {
+      const uint32_t cp = cps.at(i);
+      if (cp < 0x80) {
+        utf8[utf8_len++] = static_cast<char>(cp);
+      } else if (cp < 0x800) {
+        utf8[utf8_len++] = static_cast<char>(0xC0 | (cp >> 6));
+        utf8[utf8_len++] = static_cast<char>(0x80 | (cp & 0x3F));
+      } else if (cp < 0x10000) {
+        utf8[utf8_len++] = static_cast<char>(0xE0 | (cp >> 12));
+        utf8[utf8_len++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        utf8[utf8_len++] = static_cast<char>(0x80 | (cp & 0x3F));
+      } else {
+        utf8[utf8_len++] = static_cast<char>(0xF0 | (cp >> 18));
+        utf8[utf8_len++] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        utf8[utf8_len++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        utf8[utf8_len++] = static_cast<char>(0x80 | (cp & 0x3F));
+      }
+      if (cp < 0x10000) {
+        utf16[utf16_len++] = static_cast<char>(cp >> 8);
+        utf16[utf16_len++] = static_cast<char>(cp & 0xFF);
+      } else {
+        const uint32_t high = 0xD800 + ((cp - 0x10000) >> 10);
+        const uint32_t low = 0xDC00 + ((cp - 0x10000) & 0x3FF);
+        utf16[utf16_len++] = static_cast<char>(high >> 8);
+        utf16[utf16_len++] = static_cast<char>(high & 0xFF);
+        utf16[utf16_len++] = static_cast<char>(low >> 8);
+        utf16[utf16_len++] = static_cast<char>(low & 0xFF);
+      }
+    }
+    literal_utf8_.assign_ptr(utf8, static_cast<int32_t>(utf8_len));
+    literal_utf16_.assign_ptr(utf16, static_cast<int32_t>(utf16_len));
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::build_classes()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(boundaries_.push_back(0))) {
+    LOG_WARN("push back failed", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < ranges_.count(); ++i) {
+    if (OB_FAIL(boundaries_.push_back(ranges_.at(i).lo_))) {
+      LOG_WARN("push back failed", K(ret));
+    } else if (ranges_.at(i).hi_ < MAX_CODE_POINT
+               && OB_FAIL(boundaries_.push_back(ranges_.at(i).hi_ + 1))) {
+      LOG_WARN("push back failed", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    uint32_t *begin = boundaries_.get_data();
+    lib::ob_sort(begin, begin + boundaries_.count());
+    const int64_t cnt = std::unique(begin, begin + boundaries_.count()) - begin;
+    while (boundaries_.count() > cnt) {
+      boundaries_.pop_back();
+    }
+    class_cnt_ = static_cast<int32_t>(cnt);
+    set_word_cnt_ = (class_cnt_ + 63) / 64;
+    if (class_cnt_ > MAX_CLASS_CNT) {
+      ret = OB_NOT_SUPPORTED;
+    } else if (OB_ISNULL(set_bits_ = static_cast<uint64_t *>(
+                         allocator_.alloc(sizeof(uint64_t) * set_word_cnt_ * sets_.count())))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret), K(class_cnt_), K(sets_.count()));
+    } else {
+      MEMSET(set_bits_, 0, sizeof(uint64_t) * set_word_cnt_ * sets_.count());
+      for (int32_t c = 0; c < 128; ++c) {
+        ascii_classes_[c] = get_class(c);
+      }
+      // every class is either in or out of a range, so checks the first code point only
+      for (int64_t s = 0; s < sets_.count(); ++s) {
+        const CharSet &set = sets_.at(s);
+        for (int32_t cls = 0; cls < class_cnt_; ++cls) {
+          const uint32_t cp = boundaries_.at(cls);
+          for (int64_t i = set.offset_; i < set.offset_ + set.cnt_; ++i) {
+            if (cp >= ranges_.at(i).lo_ && cp <= ranges_.at(i).hi_) {
+              set_bits_[s * set_word_cnt_ + (cls >> 6)] |= 1ULL << (cls & 63);
+            }
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+OB_INLINE int32_t ObExprRegexAutomaton::get_class(const uint32_t cp) const
+{
+  const uint32_t *begin = boundaries_.get_data();
+  return static_cast<int32_t>(std::upper_bound(begin, begin + class_cnt_, cp) - begin - 1);
+}
+
+int ObExprRegexAutomaton::add_nfa_state(const NfaStateType type,
+                                        const int32_t set_id,
+                                        const int32_t out,
+                                        const int32_t out1,
+                                        int32_t &state)
+{
+  int ret = OB_SUCCESS;
+  NfaState tmp;
+  tmp.type_ = type;
+  tmp.set_id_ = set_id;
+  tmp.out_ = out;
+  tmp.out1_ = out1;
+  state = static_cast<int32_t>(nfa_states_.count());
+  if (nfa_states_.count() >= MAX_NFA_STATE_CNT) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_FAIL(nfa_states_.push_back(tmp))) {
+    LOG_WARN("push back failed", K(ret));
+  }
+  return ret;
+}
+
+// Thompson construction, %start is the entry of %node and all its exits go to %next. The
+// repeats are expanded into copies of the child.
+int ObExprRegexAutomaton::compile_node(const int32_t node, const int32_t next, int32_t &start)
+{
+  int ret = OB_SUCCESS;
+  const Node n = nodes_.at(node);
+  switch (n.type_) {
+    case NODE_EMPTY: {
+      start = next;
+      break;
+    }
+    case NODE_SET: {
+      ret = add_nfa_state(NFA_CHAR, n.set_id_, next, -1, start);
+      break;
+    }
+    case NODE_CONCAT: {
+      StateArray children;
+      for (int32_t child = n.child_; OB_SUCC(ret) && -1 != child; child = nodes_.at(child).sibling_) {
+        ret = children.push_back(child);
+      }
+      start = next;
+      for (int64_t i = children.count() - 1; OB_SUCC(ret) && i >= 0; --i) {
+        ret = compile_node(children.at(i), start, start);
+      }
+      break;
+    }
+    case NODE_ALT: {
+      StateArray starts;
+      int32_t child_start = -1;
+      for (int32_t child = n.child_; OB_SUCC(ret) && -1 != child; child = nodes_.at(child).sibling_) {
+        if (OB_FAIL(compile_node(child, next, child_start))) {
+        } else if (OB_FAIL(starts.push_back(child_start))) {
+          LOG_WARN("push back failed", K(ret));
+        }
+      }
+      if (OB_SUCC(ret)) {
+        start = starts.at(starts.count() - 1);
+        for (int64_t i = starts.count() - 2; OB_SUCC(ret) && i >= 0; --i) {
+          ret = add_nfa_state(NFA_SPLIT, -1, starts.at(i), start, start);
+        }
+      }
+      break;
+    }
+    case NODE_REPEAT: {
+      int32_t body = -1;
+      start = next;
+      if (-1 == n.max_) {
+        int32_t loop = -1;
+        if (OB_FAIL(add_nfa_state(NFA_SPLIT, -1, -1, next, loop))) {
+        } else if (OB_FAIL(compile_node(n.child_, loop, body))) {
+        } else {
+          nfa_states_.at(loop).out_ = body;
+          start = loop;
+        }
+      } else {
+        // (x(x(x)?)?)? for the optional copies
+        for (int32_t i = n.min_; OB_SUCC(ret) && i < n.max_; ++i) {
+          if (OB_FAIL(compile_node(n.child_, start, body))) {
+          } else if (OB_FAIL(add_nfa_state(NFA_SPLIT, -1, body, next, start))) {
+          }
+        }
+      }
+      for (int32_t i = 0; OB_SUCC(ret) && i < n.min_; ++i) {
+        ret = compile_node(n.child_, start, start);
+      }
+      break;
+    }
+    default: {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected node type", K(ret), K(n));
+      break;
+    }
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::add_closure(const int32_t state, StateArray &states)
+{
+  int ret = OB_SUCCESS;
+  closure_stack_.reuse();
+  if (OB_FAIL(closure_stack_.push_back(state))) {
+    LOG_WARN("push back failed", K(ret));
+  }
+  while (OB_SUCC(ret) && closure_stack_.count() > 0) {
+    const int32_t s = closure_stack_.at(closure_stack_.count() - 1);
+    closure_stack_.pop_back();
+    if (marks_[s] != mark_gen_) {
+      const NfaState &nfa_state = nfa_states_.at(s);
+      marks_[s] = mark_gen_;
+      if (NFA_SPLIT != nfa_state.type_) {
+        ret = states.push_back(s);
+      } else if (OB_FAIL(closure_stack_.push_back(nfa_state.out1_))) {
+      } else if (OB_FAIL(closure_stack_.push_back(nfa_state.out_))) {
+      }
+    }
+  }
+  return ret;
+}
+
+void ObExprRegexAutomaton::next_mark_gen()
+{
+  if (INT32_MAX == mark_gen_) {
+    MEMSET(marks_, 0, sizeof(int32_t) * nfa_state_cnt_);
+    mark_gen_ = 0;
+  }
+  ++mark_gen_;
+}
+
+int ObExprRegexAutomaton::reset_dfa()
+{
+  int ret = OB_SUCCESS;
+  StateArray states;
+  MEMSET(trans_, 0xFF, sizeof(int32_t) * class_cnt_ * MAX_DFA_STATE_CNT);
+  MEMSET(dfa_buckets_, 0xFF, sizeof(int32_t) * DFA_BUCKET_CNT);
+  dfa_state_cnt_ = 0;
+  dfa_pool_size_ = 0;
+  next_mark_gen();
+  if (OB_FAIL(add_closure(nfa_start_, states))) {
+    LOG_WARN("add closure failed", K(ret));
+  } else if (OB_FAIL(find_or_add_dfa_state(states, dfa_start_))) {
+    LOG_WARN("add dfa state failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprRegexAutomaton::find_or_add_dfa_state(StateArray &states, int32_t &dfa_state)
+{
+  int ret = OB_SUCCESS;
+  const int64_t cnt = states.count();
+  uint64_t hash = 14695981039346656037ULL;
+  if (cnt > 0) {
+    lib::ob_sort(states.get_data(), states.get_data() + cnt);
+  }
+  for (int64_t i = 0; i < cnt; ++i) {
+    hash = (hash ^ static_cast<uint64_t>(states.at(i))) * 1099511628211ULL;
+  }
+  int64_t bucket = static_cast<int64_t>(hash & (DFA_BUCKET_CNT - 1));
+  dfa_state = UNKNOWN_STATE;
+  while (UNKNOWN_STATE == dfa_state && UNKNOWN_STATE != dfa_buckets_[bucket]) {
+    const int32_t d = dfa_buckets_[bucket];
+    if (dfa_cnts_[d] == cnt
+        && (0 == cnt || 0 == MEMCMP(dfa_pool_ + dfa_offsets_[d], states.get_data(),
+                                    sizeof(int32_t) * cnt))) {
+      dfa_state = d;
+    } else {
+      bucket = (bucket + 1) & (DFA_BUCKET_CNT - 1);
+    }
+  }
+  if (UNKNOWN_STATE != dfa_state) {
+  } else if (OB_UNLIKELY(dfa_state_cnt_ >= MAX_DFA_STATE_CNT
+                         || dfa_pool_size_ + cnt > dfa_pool_cap_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("dfa cache is full", K(ret), K(dfa_state_cnt_), K(dfa_pool_size_), K(cnt));
+  } else {
+    bool is_accept = false;
+    dfa_state = dfa_state_cnt_++;
+    dfa_offsets_[dfa_state] = static_cast<int32_t>(dfa_pool_size_);
+    dfa_cnts_[dfa_state] = static_cast<int32_t>(cnt);
+    for (int64_t i = 0; i < cnt; ++i) {
+      dfa_pool_[dfa_pool_size_++] = states.at(i);
+      is_accept = is_accept || NFA_MATCH == nfa_states_.at(states.at(i)).type_;
+    }
+    dfa_accepts_[dfa_state] = is_accept;
+    dfa_buckets_[bucket] = dfa_state;
+  }
+  return ret;
+}
+
+// Builds the transition of %dfa_state on %cls. The cache is dropped when it is full, and the
+// transition is not recorded in that case since %dfa_state is gone.
+int ObExprRegexAutomaton::step(const int32_t dfa_state, const int32_t cls, int32_t &next)
+{
+  int ret = OB_SUCCESS;
+  const int32_t *nfa_set = dfa_pool_ + dfa_offsets_[dfa_state];
+  const int32_t nfa_cnt = dfa_cnts_[dfa_state];
+  bool need_record = true;
+  next_states_.reuse();
+  next_mark_gen();
+  for (int32_t i = 0; OB_SUCC(ret) && i < nfa_cnt; ++i) {
+    const NfaState &nfa_state = nfa_states_.at(nfa_set[i]);
+    if (NFA_CHAR == nfa_state.type_ && is_in_set(nfa_state.set_id_, cls)) {
+      ret = add_closure(nfa_state.out_, next_states_);
+    }
+  }
+  // the unanchored pattern restarts at every position
+  if (OB_SUCC(ret) && !anchored_start_) {
+    ret = add_closure(nfa_start_, next_states_);
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("add closure failed", K(ret));
+  } else if (dfa_state_cnt_ >= MAX_DFA_STATE_CNT
+             || dfa_pool_size_ + next_states_.count() > dfa_pool_cap_) {
+    need_record = false;
+    if (OB_FAIL(reset_dfa())) {
+      LOG_WARN("reset dfa failed", K(ret));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(find_or_add_dfa_state(next_states_, next))) {
+    LOG_WARN("add dfa state failed", K(ret));
+  } else if (need_record) {
+    trans_[dfa_state * class_cnt_ + cls] = next;
+  }
+  return ret;
+}
+
+// Returns the position before the line terminator at the end of %text, where '$' also
+// matches, or -1.
+int64_t ObExprRegexAutomaton::find_end_terminator(const ObString &text, const bool is_utf16) const
+{
+  int64_t res = -1;
+  const unsigned char *str = reinterpret_cast<const unsigned char *>(text.ptr());
+  const int64_t len = text.length();
+  if (is_utf16) {
+    const uint32_t last = len >= 2 ? ((static_cast<uint32_t>(str[len - 2]) << 8) | str[len - 1]) : 0;
+    const uint32_t prev = len >= 4 ? ((static_cast<uint32_t>(str[len - 4]) << 8) | str[len - 3]) : 0;
+    if (len < 2) {
+    } else if (unix_lines_) {
+      res = '\n' == last ? len - 2 : -1;
+    } else if ('\n' == last && '\r' == prev) {
+      res = len - 4;
+    } else if (is_line_terminator(last)) {
+      res = len - 2;
+    }
+  } else if (len > 0) {
+    const uint32_t last = str[len - 1];
+    if (unix_lines_) {
+      res = '\n' == last ? len - 1 : -1;
+    } else if ('\n' == last && len >= 2 && '\r' == str[len - 2]) {
+      res = len - 2;
+    } else if (last >= 0x0A && last <= 0x0D) {
+      res = len - 1;
+    } else if (len >= 2 && 0xC2 == str[len - 2] && 0x85 == last) {
+      res = len - 2;
+    } else if (len >= 3 && 0xE2 == str[len - 3] && 0x80 == str[len - 2]
+               && (0xA8 == last || 0xA9 == last)) {
+      res = len - 3;
+    }
+  }
+  return res;
+}
+
+bool ObExprRegexAutomaton::may_match(const ObString &text, const ObCollationType cs_type) const
+{
+  bool bret = true;
+  if (!inited_ || literal_utf8_.empty()) {
+  } else if (CS_TYPE_UTF8MB4_BIN == cs_type || CS_TYPE_UTF8MB4_GENERAL_CI == cs_type) {
+    bret = NULL != search_literal(text.ptr(), text.length(),
+                                  literal_utf8_.ptr(), literal_utf8_.length());
+  } else if (CS_TYPE_UTF16_BIN == cs_type || CS_TYPE_UTF16_GENERAL_CI == cs_type) {
+    // the literal found at an odd offset is not aligned to the code units
+    const char *begin = text.ptr();
+    const char *end = text.ptr() + text.length();
+    const char *found = NULL;
+    bret = false;
+    while (!bret && begin < end
+           && NULL != (found = search_literal(begin, end - begin,
+                                              literal_utf16_.ptr(), literal_utf16_.length()))) {
+      if (0 == (found - text.ptr()) % 2) {
+        bret = true;
+      } else {
+        begin = found + 1;
+      }
+    }
+  }
+  return bret;
+}
+
+int ObExprRegexAutomaton::match(const ObString &text,
+                                const ObCollationType cs_type,
+                                bool &result,
+                                bool &is_done)
+{
+  int ret = OB_SUCCESS;
+  const bool is_utf8 = CS_TYPE_UTF8MB4_BIN == cs_type || CS_TYPE_UTF8MB4_GENERAL_CI == cs_type;
+  const bool is_utf16 = CS_TYPE_UTF16_BIN == cs_type || CS_TYPE_UTF16_GENERAL_CI == cs_type;
+  result = false;
+  is_done = false;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("regexp automaton not inited", K(ret));
+  } else if (!is_utf8 && !is_utf16) {
+    // left to ICU
+  } else if (!may_match(text, cs_type)) {
+    is_done = true;
+  } else {
+    const unsigned char *str = reinterpret_cast<const unsigned char *>(text.ptr());
+    const int64_t len = text.length();
+    const int64_t end_pos = anchored_end_ ? find_end_terminator(text, is_utf16) : -1;
+    int32_t dfa_state = dfa_start_;
+    int64_t pos = 0;
+    bool is_valid = true;
+    bool is_end = false;
+    if (dfa_accepts_[dfa_state] && (!anchored_end_ || 0 == len || 0 == end_pos)) {
+      result = true;
+      is_end = true;
+    }
+    while (OB_SUCC(ret) && is_valid && !is_end && pos < len) {
+      uint32_t cp = 0;
+      if (!decode_code_point(str, len, is_utf16, pos, cp) || (ascii_only_ && cp >= 0x80)) {
+        is_valid = false;
+      } else {
+        const int32_t cls = cp < 0x80 ? ascii_classes_[cp] : get_class(cp);
+        int32_t next = trans_[dfa_state * class_cnt_ + cls];
+        if (UNKNOWN_STATE == next && OB_FAIL(step(dfa_state, cls, next))) {
+          LOG_WARN("build dfa state failed", K(ret), K(dfa_state), K(cls));
+        } else {
+          dfa_state = next;
+          if (!dfa_accepts_[dfa_state]) {
+            is_end = anchored_start_ && 0 == dfa_cnts_[dfa_state];
+          } else if (!anchored_end_ || pos == len || pos == end_pos) {
+            result = true;
+            is_end = true;
+          }
+        }
+      }
+    }
+    is_done = OB_SUCC(ret) && is_valid;
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
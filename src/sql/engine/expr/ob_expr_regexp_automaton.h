@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_REGEXP_AUTOMATON_
+#define OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_REGEXP_AUTOMATON_
+
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_se_array.h"
+#include "lib/charset/ob_charset.h"
+#include "lib/string/ob_string.h"
+#include "common/ob_target_specific.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Returns the first occurrence of %literal in %text or NULL, used to prefilter the texts.
+OB_DECLARE_DEFAULT_AND_AVX2_CODE(
+const char *find_literal(const char *text,
+                         const int64_t text_len,
+                         const char *literal,
+                         const int64_t literal_len);
+)
+
+// ObExprRegexAutomaton matches a regular expression in linear time with a lazily built DFA.
+//
+// The pattern is compiled into a Thompson NFA over the equivalence classes of the code points
+// used by the pattern, and the DFA states are built from the NFA state sets on demand. The
+// text is decoded from utf8 or utf16 directly, without being converted for ICU.
+//
+// Only a subset of the ICU syntax is supported: literals, '.', bracket expressions without
+// nested sets, \d \w \s and their negations, groups, alternations, greedy or lazy quantifiers,
+// '^' at the beginning and '$' at the end of the pattern. Everything else, e.g. back
+// references, lookaround, \b, possessive quantifiers and inline flags, is left to ICU.
+//
+// The longest literal that must appear in any match is extracted from the pattern, so that
+// the texts without it are rejected by a memmem before matching.
+class ObExprRegexAutomaton
+{
+public:
+  ObExprRegexAutomaton();
+  ~ObExprRegexAutomaton();
+
+  // %pattern is the preprocessed pattern in utf16, %flags are the ICU flags of the pattern.
+  // %is_supported is false if the pattern can only be matched by ICU.
+  int init(const common::ObString &pattern, const uint32_t flags, bool &is_supported);
+  void destroy();
+
+  // Returns false if %text does not contain the literal required by the pattern.
+  bool may_match(const common::ObString &text, const common::ObCollationType cs_type) const;
+
+  // Finds any match of the pattern in %text. %is_done is false if the text can not be matched
+  // by the automaton, e.g. for invalid code points, and it must be matched by ICU.
+  int match(const common::ObString &text,
+            const common::ObCollationType cs_type,
+            bool &result,
+            bool &is_done);
+
+  TO_STRING_KV(K_(inited), K_(anchored_start), K_(anchored_end), K_(ascii_only),
+               K_(class_cnt), K_(nfa_state_cnt), K_(dfa_state_cnt), K_(literal_utf8));
+
+private:
+  enum NodeType
+  {
+    NODE_EMPTY = 0,
+    NODE_SET,
+    NODE_CONCAT,
+    NODE_ALT,
+    NODE_REPEAT,
+  };
+  struct Node
+  {
+    Node() : type_(NODE_EMPTY), set_id_(-1), min_(0), max_(0), child_(-1), sibling_(-1) {}
+    TO_STRING_KV(K_(type), K_(set_id), K_(min), K_(max), K_(child), K_(sibling));
+    int32_t type_;
+    int32_t set_id_;
+    int32_t min_;
+    int32_t max_;   // -1 for infinite
+    int32_t child_; // the first child
+    int32_t sibling_;
+  };
+  struct Range
+  {
+    Range() : lo_(0), hi_(0) {}
+    Range(const uint32_t lo, const uint32_t hi) : lo_(lo), hi_(hi) {}
+    bool operator<(const Range &other) const { return lo_ < other.lo_; }
+    TO_STRING_KV(K_(lo), K_(hi));
+    uint32_t lo_;
+    uint32_t hi_;
+  };
+  struct CharSet
+  {
+    CharSet() : offset_(0), cnt_(0) {}
+    TO_STRING_KV(K_(offset), K_(cnt));
+    int32_t offset_; // in ranges_
+    int32_t cnt_;
+  };
+  enum NfaStateType
+  {
+    NFA_CHAR = 0,
+    NFA_SPLIT,
+    NFA_MATCH,
+  };
+  struct NfaState
+  {
+    NfaState() : type_(NFA_MATCH), set_id_(-1), out_(-1), out1_(-1) {}
+    TO_STRING_KV(K_(type), K_(set_id), K_(out), K_(out1));
+    int32_t type_;
+    int32_t set_id_;
+    int32_t out_;
+    int32_t out1_;
+  };
+  typedef common::ObSEArray<Range, 16> RangeArray;
+  typedef common::ObSEArray<int32_t, 64> StateArray;
+
+  static const uint32_t MAX_CODE_POINT = 0x10FFFF;
+  static const int64_t MAX_PATTERN_LEN = 4096;
+  static const int64_t MAX_GROUP_DEPTH = 32;
+  static const int64_t MAX_REPEAT_CNT = 1000;
+  static const int64_t MAX_NFA_STATE_CNT = 2048;
+  static const int64_t MAX_CLASS_CNT = 256;
+  static const int64_t MAX_DFA_STATE_CNT = 256;
+  static const int64_t MAX_DFA_POOL_SIZE = 64 * 1024;
+  static const int64_t DFA_BUCKET_CNT = 512; // power of 2, larger than MAX_DFA_STATE_CNT
+  static const int32_t UNKNOWN_STATE = -1;
+
+  // parse
+  int parse_alt(int32_t &node);
+  int parse_concat(int32_t &node);
+  int parse_repeat(int32_t &node);
+  int parse_atom(int32_t &node);
+  int parse_class(int32_t &set_id);
+  int parse_escape(const bool in_class, RangeArray &ranges, bool &is_single, uint32_t &cp);
+  int parse_number(int32_t &value);
+  int add_node(const NodeType type, const int32_t set_id, int32_t &node);
+  int add_set(RangeArray &ranges, const bool negated, const bool fold_case, int32_t &set_id);
+  int add_literal_set(const uint32_t cp, int32_t &set_id);
+  int append_child(const int32_t parent, const int32_t child);
+  bool is_literal_node(const int32_t node, uint32_t &cp) const;
+  int extract_literal();
+  int encode_literal(const common::ObIArray<uint32_t> &cps);
+
+  // compile
+  int build_classes();
+  int compile_node(const int32_t node, const int32_t next, int32_t &start);
+  int add_nfa_state(const NfaStateType type, const int32_t set_id,
+                    const int32_t out, const int32_t out1, int32_t &state);
+
+  // dfa
+  void next_mark_gen();
+  int reset_dfa();
+  int add_closure(const int32_t state, StateArray &states);
+  int find_or_add_dfa_state(StateArray &states, int32_t &dfa_state);
+  int step(const int32_t dfa_state, const int32_t cls, int32_t &next);
+  inline int32_t get_class(const uint32_t cp) const;
+  inline bool is_in_set(const int32_t set_id, const int32_t cls) const
+  {
+    return 0 != (set_bits_[set_id * set_word_cnt_ + (cls >> 6)] & (1ULL << (cls & 63)));
+  }
+  int64_t find_end_terminator(const common::ObString &text, const bool is_utf16) const;
+
+private:
+  bool inited_;
+  common::ObArenaAllocator allocator_;
+  // pattern
+  const uint32_t *pattern_;
+  int64_t pattern_len_;
+  int64_t pos_;
+  int64_t depth_;
+  bool fold_case_;
+  bool dot_all_;
+  bool unix_lines_;
+  bool anchored_start_;
+  bool anchored_end_;
+  bool ascii_only_;
+  int32_t root_;
+  common::ObSEArray<Node, 32> nodes_;
+  common::ObSEArray<Range, 32> ranges_;
+  common::ObSEArray<CharSet, 16> sets_;
+  // literal prefilter
+  common::ObString literal_utf8_;
+  common::ObString literal_utf16_;
+  // classes
+  common::ObSEArray<uint32_t, 32> boundaries_;
+  int32_t class_cnt_;
+  int32_t ascii_classes_[128];
+  int64_t set_word_cnt_;
+  uint64_t *set_bits_;
+  // nfa
+  common::ObSEArray<NfaState, 64> nfa_states_;
+  int32_t nfa_state_cnt_;
+  int32_t nfa_start_;
+  StateArray closure_stack_;
+  StateArray next_states_;
+  // lazy dfa, the transitions are reset when the states or the pool are full
+  int32_t *trans_;
+  int32_t *dfa_offsets_;
+  int32_t *dfa_cnts_;
+  bool *dfa_accepts_;
+  int32_t *dfa_pool_;
+  int64_t dfa_pool_size_;
+  int64_t dfa_pool_cap_;
+  int32_t *dfa_buckets_;
+  int32_t dfa_state_cnt_;
+  int32_t dfa_start_;
+  int32_t *marks_;
+  int32_t mark_gen_;
+  DISALLOW_COPY_AND_ASSIGN(ObExprRegexAutomaton);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+#endif // OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_REGEXP_AUTOMATON_
@@ -18,9 +18,11 @@
 #include "lib/allocator/ob_malloc.h"
 #include "lib/charset/ob_charset.h"
 #include "sql/engine/expr/ob_expr_regexp_context.h"
+#include "sql/engine/expr/ob_expr_regexp_automaton.h"
 #include "sql/engine/expr/ob_expr_util.h"
 #include "sql/resolver/expr/ob_raw_expr_util.h"
 #include "sql/session/ob_sql_session_info.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 namespace oceanbase
 {
 using namespace common;
@@ -31,7 +33,8 @@ ObExprRegexContext::ObExprRegexContext()
   : ObExprOperatorCtx(),
     inited_(false),
     cflags_(0),
-    regexp_engine_(NULL)
+    regexp_engine_(NULL),
+    automaton_(NULL)
 {
 }
 
@@ -54,6 +57,7 @@ void ObExprRegexContext::destroy()
       uregex_close(regexp_engine_);
       regexp_engine_ = NULL;
     }
+    OB_DELETE(ObExprRegexAutomaton, "SqlRegexDfa", automaton_);
   }
 }
 
@@ -151,10 +155,48 @@ int ObExprRegexContext::init(ObExprStringBuf &string_buf,
         inited_ = true;
       }
     }
+    if (OB_SUCC(ret) && reusable) {
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+      bool is_supported = false;
+      if (!tenant_config.is_valid() || !tenant_config->_enable_regexp_automaton) {
+      } else if (OB_ISNULL(automaton_ = OB_NEW(ObExprRegexAutomaton, "SqlRegexDfa"))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("allocate memory failed", K(ret));
+      } else if (OB_FAIL(automaton_->init(pattern, cflags, is_supported))) {
+        LOG_WARN("failed to init regexp automaton", K(ret));
+      }
+      if (OB_FAIL(ret) || !is_supported) {
+        OB_DELETE(ObExprRegexAutomaton, "SqlRegexDfa", automaton_);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObExprRegexContext::fast_match(const ObString &text,
+                                   const ObCollationType cs_type,
+                                   bool &result,
+                                   bool &is_done)
+{
+  int ret = OB_SUCCESS;
+  result = false;
+  is_done = false;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("regexp context not inited yet", K(ret), K(inited_));
+  } else if (NULL == automaton_) {
+    // not supported
+  } else if (OB_FAIL(automaton_->match(text, cs_type, result, is_done))) {
+    LOG_WARN("failed to match by automaton", K(ret));
   }
   return ret;
 }
 
+bool ObExprRegexContext::may_match(const ObString &text, const ObCollationType cs_type) const
+{
+  return NULL == automaton_ || automaton_->may_match(text, cs_type);
+}
+
 int ObExprRegexContext::match(ObExprStringBuf &string_buf,
                               const ObString &text,
                               const int64_t start,
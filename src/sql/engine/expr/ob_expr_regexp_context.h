@@ -28,6 +28,7 @@ namespace oceanbase
 {
 namespace sql
 {
+class ObExprRegexAutomaton;
 
 struct ObExprRegexpSessionVariables {
   TO_STRING_KV(K_(regexp_stack_limit), K_(regexp_time_limit));
@@ -65,6 +66,17 @@ public:
             const int64_t start,
             bool &result) const;
 
+  // Matches %text in utf8 or utf16 by the automaton, without converting it for ICU. %is_done
+  // is false if the pattern or the text is not supported, and match() must be used then.
+  int fast_match(const ObString &text,
+                 const ObCollationType cs_type,
+                 bool &result,
+                 bool &is_done);
+
+  // Returns false if %text can not be matched, because it does not contain the literal
+  // required by the pattern.
+  bool may_match(const ObString &text, const ObCollationType cs_type) const;
+
   int find(ObExprStringBuf &string_buf,
            const ObString &text,
            const int64_t start,
@@ -147,6 +159,8 @@ private:
   int cflags_;
   ObInplaceAllocator pattern_wc_allocator_;
   URegularExpression *regexp_engine_;
+  // only built for the reusable context of the constant pattern
+  ObExprRegexAutomaton *automaton_;
 };
 }
 }
@@ -177,6 +177,7 @@ int ObExprRegexpCount::eval_regexp_count(
       ObString text_utf16;
       ObString text_str;
       bool is_null = true;
+      bool is_no_match = false;
       if (reusable) {
         if (NULL == (regexp_ctx = static_cast<ObExprRegexContext *>(
                     ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
@@ -213,7 +214,9 @@ int ObExprRegexpCount::eval_regexp_count(
         expr_datum.set_null();
       } else {
         is_null = false;
-        if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
+        if (1 == pos && !regexp_ctx->may_match(text_str, expr.args_[0]->datum_meta_.cs_type_)) {
+          is_no_match = true;
+        } else if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
             expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_GENERAL_CI) {
           if (OB_FAIL(ObExprUtil::convert_string_collation(text_str, expr.args_[0]->datum_meta_.cs_type_, text_utf16,
                                 ObCharset::is_bin_sort(expr.args_[0]->datum_meta_.cs_type_) ? CS_TYPE_UTF16_BIN : CS_TYPE_UTF16_GENERAL_CI,
@@ -225,7 +228,7 @@ int ObExprRegexpCount::eval_regexp_count(
         }
       }
       if (OB_FAIL(ret) || is_null) {
-      } else if (OB_FAIL(regexp_ctx->count(tmp_alloc, text_utf16, pos - 1, res_count))) {
+      } else if (!is_no_match && OB_FAIL(regexp_ctx->count(tmp_alloc, text_utf16, pos - 1, res_count))) {
         LOG_WARN("failed to regexp count", K(ret));
       } else {
         number::ObNumber nmb;
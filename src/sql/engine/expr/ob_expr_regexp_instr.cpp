@@ -255,6 +255,7 @@ int ObExprRegexpInstr::eval_regexp_instr(
       ObString text_utf16;
       ObString text_str;
       bool is_null = true;
+      bool is_no_match = false;
       if (reusable) {
         if (NULL == (regexp_ctx = static_cast<ObExprRegexContext *>(
                     ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_)))) {
@@ -295,7 +296,9 @@ int ObExprRegexpInstr::eval_regexp_instr(
         expr_datum.set_null();
       } else {
         is_null = false;
-        if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
+        if (1 == pos && !regexp_ctx->may_match(text_str, expr.args_[0]->datum_meta_.cs_type_)) {
+          is_no_match = true;
+        } else if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
             expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_GENERAL_CI) {
           if (OB_FAIL(ObExprUtil::convert_string_collation(text_str, expr.args_[0]->datum_meta_.cs_type_, text_utf16,
                                                       ObCharset::is_bin_sort(expr.args_[0]->datum_meta_.cs_type_) ? CS_TYPE_UTF16_BIN : CS_TYPE_UTF16_GENERAL_CI,
@@ -307,7 +310,7 @@ int ObExprRegexpInstr::eval_regexp_instr(
         }
       }
       if (OB_FAIL(ret) || is_null) {
-      } else if (OB_FAIL(regexp_ctx->find(tmp_alloc, text_utf16, pos - 1, occur,
+      } else if (!is_no_match && OB_FAIL(regexp_ctx->find(tmp_alloc, text_utf16, pos - 1, occur,
                                           return_opt_val, subexpr_val, res_pos))) {
         LOG_WARN("failed to regexp find loc", K(ret));
       } else if (lib::is_mysql_mode()) {
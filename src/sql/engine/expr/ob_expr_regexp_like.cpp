@@ -219,7 +219,11 @@ int ObExprRegexpLike::eval_regexp_like(
                (lib::is_mysql_mode() && NULL != match_type && match_type->is_null())) {
       expr_datum.set_null();
     } else {
-      if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
+      bool is_done = false;
+      if (OB_FAIL(regexp_ctx->fast_match(text_str, expr.args_[0]->datum_meta_.cs_type_, match, is_done))) {
+        LOG_WARN("fail to fast match", K(ret), K(text));
+      } else if (is_done) {
+      } else if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
         expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_GENERAL_CI) {
         if (OB_FAIL(ObExprUtil::convert_string_collation(text_str, expr.args_[0]->datum_meta_.cs_type_, text_utf16,
                                         ObCharset::is_bin_sort(expr.args_[0]->datum_meta_.cs_type_) ? CS_TYPE_UTF16_BIN : CS_TYPE_UTF16_GENERAL_CI,
@@ -230,7 +234,7 @@ int ObExprRegexpLike::eval_regexp_like(
         text_utf16 = text_str;
       }
       if (OB_FAIL(ret)) {
-      } else if (OB_FAIL(regexp_ctx->match(tmp_alloc, text_utf16, start_pos - 1, match))) {
+      } else if (!is_done && OB_FAIL(regexp_ctx->match(tmp_alloc, text_utf16, start_pos - 1, match))) {
         LOG_WARN("fail to match", K(ret), K(text));
       } else {
         expr_datum.set_int32(match);
@@ -349,6 +349,7 @@ int ObExprRegexpReplace::eval_regexp_replace(
         ObString text_utf16;
         ObString to_utf16;
         ObString text_str;
+        bool is_no_match = false;
         if (ob_is_text_tc(expr.args_[0]->datum_meta_.type_)) {
           if (OB_FAIL(ObTextStringHelper::get_string(expr, tmp_alloc, 0, text, text_str))) {
             LOG_WARN("get text string failed", K(ret));
@@ -357,6 +358,10 @@ int ObExprRegexpReplace::eval_regexp_replace(
           text_str = text->get_string();
         }
         if (OB_FAIL(ret)) {
+        } else if (1 == pos && !regexp_ctx->may_match(text_str, expr.args_[0]->datum_meta_.cs_type_)) {
+          // nothing to replace, return the text without converting it for ICU
+          is_no_match = true;
+          res_coll_type = expr.args_[0]->datum_meta_.cs_type_;
         } else if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
                    expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_GENERAL_CI) {
           res_coll_type = ObCharset::is_bin_sort(expr.args_[0]->datum_meta_.cs_type_) ? CS_TYPE_UTF16_BIN : CS_TYPE_UTF16_GENERAL_CI;
@@ -368,7 +373,7 @@ int ObExprRegexpReplace::eval_regexp_replace(
           res_coll_type = expr.args_[0]->datum_meta_.cs_type_;
           text_utf16 = text_str;
         }
-        if (OB_FAIL(ret)) {
+        if (OB_FAIL(ret) || is_no_match) {
         } else if (expr.arg_cnt_ > 2 && (expr.args_[2]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
             expr.args_[2]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_GENERAL_CI)) {
           if (OB_FAIL(ObExprUtil::convert_string_collation(to_str, expr.args_[2]->datum_meta_.cs_type_, to_utf16,
@@ -380,9 +385,13 @@ int ObExprRegexpReplace::eval_regexp_replace(
           to_utf16 = to_str;
         }
         if (OB_FAIL(ret)) {
+        } else if (is_no_match) {
+          res_replace = text_str;
         } else if (OB_FAIL(regexp_ctx->replace(tmp_alloc, text_utf16, to_utf16, pos - 1,
                                               occur, res_replace))) {
           LOG_WARN("failed to regexp replace str", K(ret));
+        }
+        if (OB_FAIL(ret)) {
         } else if (res_replace.empty() && lib::is_oracle_mode()) {
           expr_datum.set_null();
         } else {
@@ -633,6 +642,7 @@ int ObExprRegexpReplace::vector_regexp_replace(VECTOR_EVAL_FUNC_ARG_DECL) {
       } else {
         ObString text_utf16;
         ObString text_str;
+        bool is_no_match = false;
         if (ob_is_text_tc(expr.args_[0]->datum_meta_.type_)) {
           if (OB_FAIL(ObTextStringHelper::get_string(expr, tmp_alloc, 0, i, text_vec, text_str))) {
             LOG_WARN("get text string failed", K(ret));
@@ -641,6 +651,9 @@ int ObExprRegexpReplace::vector_regexp_replace(VECTOR_EVAL_FUNC_ARG_DECL) {
           text_str = text_vec->get_string(i);
         }
         if (OB_FAIL(ret)) {
+        } else if (1 == pos && !regexp_ctx->may_match(text_str, expr.args_[0]->datum_meta_.cs_type_)) {
+          is_no_match = true;
+          res_coll_type = expr.args_[0]->datum_meta_.cs_type_;
         } else if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
                   expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_GENERAL_CI) {
           res_coll_type = ObCharset::is_bin_sort(expr.args_[0]->datum_meta_.cs_type_) ?
@@ -655,9 +668,13 @@ int ObExprRegexpReplace::vector_regexp_replace(VECTOR_EVAL_FUNC_ARG_DECL) {
           text_utf16 = text_str;
         }
         if (OB_FAIL(ret)) {
+        } else if (is_no_match) {
+          res_replace = text_str;
         } else if (OB_FAIL(regexp_ctx->replace(tmp_alloc, text_utf16, to_utf16, pos - 1,
                                               occur, res_replace))) {
           LOG_WARN("failed to regexp replace str", K(ret));
+        }
+        if (OB_FAIL(ret)) {
         } else if (res_replace.empty() && lib::is_oracle_mode()) {
           res_vec->set_null(i);
         } else {
@@ -257,6 +257,7 @@ int ObExprRegexpSubstr::eval_regexp_substr(
       ObCollationType res_coll_type = CS_TYPE_INVALID;
       bool is_null = true;
       bool is_final = false;
+      bool is_no_match = false;
       uint32_t flags = 0;
       if (reusable) {
         if (NULL == (regexp_ctx = static_cast<ObExprRegexContext *>(
@@ -297,7 +298,9 @@ int ObExprRegexpSubstr::eval_regexp_substr(
       if (OB_FAIL(ret) || is_final) {
       } else {
         is_null = false;
-        if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
+        if (1 == pos && !regexp_ctx->may_match(text_str, expr.args_[0]->datum_meta_.cs_type_)) {
+          is_no_match = true;
+        } else if (expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_BIN ||
             expr.args_[0]->datum_meta_.cs_type_ == CS_TYPE_UTF8MB4_GENERAL_CI) {
           res_coll_type = ObCharset::is_bin_sort(expr.args_[0]->datum_meta_.cs_type_) ? CS_TYPE_UTF16_BIN : CS_TYPE_UTF16_GENERAL_CI;
           if (OB_FAIL(ObExprUtil::convert_string_collation(text_str, expr.args_[0]->datum_meta_.cs_type_, text_utf16,
@@ -310,7 +313,7 @@ int ObExprRegexpSubstr::eval_regexp_substr(
         }
       }
       if (OB_FAIL(ret) || is_null || is_final) {
-      } else if (OB_FAIL(regexp_ctx->substr(tmp_alloc, text_utf16, pos - 1,
+      } else if (!is_no_match && OB_FAIL(regexp_ctx->substr(tmp_alloc, text_utf16, pos - 1,
                                             occur, subexpr_val, res_substr))) {
         LOG_WARN("failed to regexp substr", K(ret));
       } else if (res_substr.empty() && lib::is_oracle_mode() && expr.args_[0]->datum_meta_.is_clob()) {
@@ -269,7 +269,10 @@ struct GenericProber final: public ProberBase<GenericItem> {
 struct IHashTable {
 
   virtual int init(ObIAllocator &alloc, const int64_t max_batch_size) = 0;
-  virtual int build_prepare(int64_t row_count, int64_t bucket_count) = 0;
+  virtual int build_prepare(int64_t row_count,
+                            int64_t bucket_count,
+                            int64_t radix_shift,
+                            int64_t radix_bits) = 0;
   virtual int insert_batch(JoinTableCtx &ctx,
                            ObHJStoredRow **stored_rows,
                            const int64_t size,
@@ -307,6 +310,18 @@ struct IHashTable {
 //
 // Buckets is array of <hash_value, store_row_ptr> pair, store rows linked in one bucket are
 // the same hash value.
+//
+// Radix clustered layout:
+//   If radix bits are set in build_prepare, the high bits of bucket position are taken from
+//   the partition bits of hash value, and the low bits from the low bits of hash value:
+//
+//   +--------------------+--------------------+-----+--------------------------+
+//   | buckets of part 0  | buckets of part 1  | ... | buckets of part (n - 1)  |
+//   +--------------------+--------------------+-----+--------------------------+
+//
+//   Each partition owns a continuous slice of buckets, so building the hash table partition
+//   by partition only touches a cache sized slice of buckets at a time. Linear probing is
+//   unchanged and may run into next slice, it only costs locality, not correctness.
 template <typename Bucket, typename Prober>
 struct HashTable : public IHashTable
 {
@@ -316,6 +331,10 @@ struct HashTable : public IHashTable
       : buckets_(nullptr),
         nbuckets_(0),
         bit_cnt_(0),
+        radix_shift_(0),
+        radix_mask_(0),
+        slice_bits_(0),
+        slice_mask_(0),
         row_count_(0),
         collisions_(0),
         used_buckets_(0),
@@ -328,7 +347,10 @@ struct HashTable : public IHashTable
   {
   }
   int init(ObIAllocator &alloc, const int64_t max_batch_size) override;
-  int build_prepare(int64_t row_count, int64_t bucket_count) override;
+  int build_prepare(int64_t row_count,
+                    int64_t bucket_count,
+                    int64_t radix_shift,
+                    int64_t radix_bits) override;
   virtual int insert_batch(JoinTableCtx &ctx,
                            ObHJStoredRow **stored_rows,
                            const int64_t size,
@@ -380,9 +402,20 @@ protected:
 private:
   int init_probe_key_data(JoinTableCtx &ctx, OutputInfo &output_info);
   Item *new_item() { return &items_->at(item_pos_++); }
+protected:
+  // start position of linear probing, equals to `hash_val & (nbuckets_ - 1)` if not radix clustered
+  inline uint64_t get_bucket_pos(const uint64_t hash_val) const
+  {
+    return (hash_val & slice_mask_) | (((hash_val >> radix_shift_) & radix_mask_) << slice_bits_);
+  }
+private:
   int probe_batch_opt(JoinTableCtx &ctx, OutputInfo &output_info);
   int probe_batch_normal(JoinTableCtx &ctx, OutputInfo &output_info);
   int probe_batch_del_match(JoinTableCtx &ctx, OutputInfo &output_info);
+  // Group prefetching for the first probe of a batch: prefetch buckets of all probe rows,
+  // locate the item list of each row into ctx.cur_items_ and prefetch the items, so that
+  // the following key comparison of the batch does not stall on each cache miss.
+  void locate_items_batch(JoinTableCtx &ctx, const OutputInfo &output_info);
   // Get stored row list which has the same hash value.
   // return NULL if not found.
   inline Item *get(const uint64_t hash_val);
@@ -401,6 +434,11 @@ protected:
   BucketArray *buckets_;
   int64_t nbuckets_;
   int64_t bit_cnt_;
+  // for radix clustered layout
+  int64_t radix_shift_;
+  uint64_t radix_mask_;
+  int64_t slice_bits_;
+  uint64_t slice_mask_;
   int64_t row_count_;
   int64_t collisions_;
   int64_t used_buckets_;
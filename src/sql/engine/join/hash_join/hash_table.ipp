@@ -61,11 +61,28 @@ int HashTable<Bucket, Prober>::init(ObIAllocator &alloc, const int64_t max_batch
 }
 
 template <typename Bucket, typename Prober>
-int HashTable<Bucket, Prober>::build_prepare(int64_t row_count, int64_t bucket_count)
+int HashTable<Bucket, Prober>::build_prepare(int64_t row_count,
+                                             int64_t bucket_count,
+                                             int64_t radix_shift,
+                                             int64_t radix_bits)
 {
   int ret = OB_SUCCESS;
   row_count_ = row_count;
   nbuckets_ = std::max(nbuckets_, bucket_count);
+  radix_shift_ = 0;
+  radix_mask_ = 0;
+  slice_bits_ = 0;
+  slice_mask_ = nbuckets_ - 1;
+  if (radix_bits > 0 && radix_shift >= 0
+      && 0 == (nbuckets_ & (nbuckets_ - 1))
+      && __builtin_ctzll(nbuckets_) > radix_bits
+      // bucket only stores the low 63 bits of hash value
+      && radix_shift + radix_bits < static_cast<int64_t>(sizeof(uint64_t) * CHAR_BIT)) {
+    radix_shift_ = radix_shift;
+    radix_mask_ = (1UL << radix_bits) - 1;
+    slice_bits_ = __builtin_ctzll(nbuckets_) - radix_bits;
+    slice_mask_ = (1UL << slice_bits_) - 1;
+  }
   collisions_ = 0;
   used_buckets_ = 0;
   buckets_->reuse();
@@ -76,7 +93,8 @@ int HashTable<Bucket, Prober>::build_prepare(int64_t row_count, int64_t bucket_c
     OZ (items_->init(row_count));
   }
 
-  LOG_DEBUG("build prepare", K(row_count), K(bucket_count), K_(nbuckets), KP(items_), K(sizeof(Bucket)));
+  LOG_DEBUG("build prepare", K(row_count), K(bucket_count), K_(nbuckets), KP(items_), K(sizeof(Bucket)),
+            K(radix_shift), K(radix_bits), K_(slice_bits));
   return ret;
 }
 
@@ -86,7 +104,7 @@ template <typename Bucket, typename Prober>
 inline typename Bucket::Item *HashTable<Bucket, Prober>::get(const uint64_t hash_val)
 {
   uint64_t mask = nbuckets_ - 1;
-  uint64_t pos = hash_val & mask;
+  uint64_t pos = get_bucket_pos(hash_val);
   typename Bucket::Item *item = reinterpret_cast<typename Bucket::Item *>(END_ITEM);
   Bucket *bucket = &buckets_->at(pos);
   if (bucket->used()) {
@@ -115,7 +133,7 @@ void HashTable<Bucket, Prober>::get(uint64_t hash_val, Bucket *&bkt)
   Bucket tmp_bucket;
   tmp_bucket.hash_value_ = hash_val;
   uint64_t mask = nbuckets_ - 1;
-  uint64_t pos = tmp_bucket.hash_value() & mask;
+  uint64_t pos = get_bucket_pos(tmp_bucket.hash_value());
   bkt = NULL;
   for (int64_t i = 0; i < nbuckets_; i += 1, pos = ((pos + 1) & mask)) {
     Bucket &bucket = buckets_->at(pos);
@@ -140,7 +158,7 @@ void HashTable<Bucket, Prober>::set(JoinTableCtx &ctx,
   Bucket tmp_bucket;
   tmp_bucket.hash_value_ = hash_val;
   uint64_t mask = nbuckets_ - 1;
-  uint64_t pos = tmp_bucket.hash_value_ & mask;
+  uint64_t pos = get_bucket_pos(tmp_bucket.hash_value_);
   for (int64_t i = 0; i < nbuckets_; i += 1, pos = ((pos + 1) & mask)) {
     Bucket &bucket = buckets_->at(pos);
     if (!bucket.used()) {
@@ -187,7 +205,7 @@ void HashTable<Bucket, Prober>::del(const uint64_t hash_val, const RowMeta &row_
   Bucket tmp_bucket;
   tmp_bucket.hash_value_ = hash_val;
   uint64_t mask = nbuckets_ - 1;
-  uint64_t pos = tmp_bucket.hash_value_ & mask;
+  uint64_t pos = get_bucket_pos(tmp_bucket.hash_value_);
   for (int64_t i = 0; i < nbuckets_; i += 1, pos = ((pos + 1) & mask)) {
     Bucket &bucket = buckets_->at(pos);
     if (!bucket.used()) {
@@ -265,9 +283,8 @@ int HashTable<Bucket, Prober>::insert_batch(JoinTableCtx &ctx,
                                             int64_t &collisions)
 {
   int ret = OB_SUCCESS;
-  auto mask = nbuckets_ - 1;
   for (auto i = 0; i < size; i++) {
-    __builtin_prefetch((&buckets_->at(stored_rows[i]->get_hash_value(ctx.build_row_meta_) & mask)),
+    __builtin_prefetch((&buckets_->at(get_bucket_pos(stored_rows[i]->get_hash_value(ctx.build_row_meta_)))),
                         1 /* write */, 3 /* high temporal locality*/);
   }
   for (int64_t i = 0; i < size; ++i) {
@@ -297,30 +314,44 @@ int HashTable<Bucket, Prober>::probe_prepare(JoinTableCtx &ctx, OutputInfo &outp
   return ret;
 }
 
+template <typename Bucket, typename Prober>
+void HashTable<Bucket, Prober>::locate_items_batch(JoinTableCtx &ctx, const OutputInfo &output_info)
+{
+  uint64_t *hash_vals = ctx.probe_batch_rows_->hash_vals_;
+  for (int64_t i = 0; i < output_info.selector_cnt_; i++) {
+    int64_t hash_val = hash_vals[output_info.selector_[i]];
+    __builtin_prefetch(&buckets_->at(get_bucket_pos(hash_val)), 0, 1 /*low temporal locality*/);
+  }
+  for (int64_t i = 0; i < output_info.selector_cnt_; i++) {
+    Item *item = get(hash_vals[output_info.selector_[i]]);
+    ctx.cur_items_[i] = item;
+    // normalized item is stored in bucket, which is already in cache
+    if (std::is_same<Item, GenericItem>::value && END_ITEM != reinterpret_cast<uint64_t>(item)) {
+      __builtin_prefetch(item, 0 /* for read */, 3 /* high temporal locality */);
+    }
+  }
+}
+
 template <typename Bucket, typename Prober>
 int HashTable<Bucket, Prober>::probe_batch_normal(JoinTableCtx &ctx, OutputInfo &output_info)
 {
   int ret = OB_SUCCESS;
   if (output_info.first_probe_) {
     uint64_t *hash_vals = ctx.probe_batch_rows_->hash_vals_;
-    uint64_t mask = nbuckets_ - 1;
-    for (int64_t i = 0; i < output_info.selector_cnt_; i++) {
-      int64_t hash_val = hash_vals[output_info.selector_[i]];
-      __builtin_prefetch(&buckets_->at(hash_val & mask), 0, 1 /*low temporal locality*/);
-    }
+    locate_items_batch(ctx, output_info);
     int64_t new_selector_cnt = 0;
     int64_t batch_idx = 0;
     Item *item = NULL;
     for (int64_t i = 0; i < output_info.selector_cnt_; i++) {
       batch_idx = output_info.selector_[i];
-      item = get(hash_vals[batch_idx]);
+      item = reinterpret_cast<Item *>(ctx.cur_items_[i]);
       OB_ASSERT(NULL != item);
       if (END_ITEM != reinterpret_cast<uint64_t>(item)) {
         ctx.cur_items_[new_selector_cnt] = item;
         output_info.selector_[new_selector_cnt++] = batch_idx;
       }
       LOG_DEBUG("first probe", KP(item), K(i), K(new_selector_cnt), K(batch_idx),
-                K(hash_vals[output_info.selector_[i]]), K(output_info.selector_cnt_));
+                K(hash_vals[batch_idx]), K(output_info.selector_cnt_));
     }
     output_info.selector_cnt_ = new_selector_cnt;
     output_info.first_probe_ = false;
@@ -338,10 +369,8 @@ int HashTable<Bucket, Prober>::probe_batch_normal(JoinTableCtx &ctx, OutputInfo
       LOG_DEBUG("probe batch", KP(item), K(i), K(new_selector_cnt), K(batch_idx), K(output_info.selector_cnt_), K(ctx.cur_items_[i]));
     }
     output_info.selector_cnt_ = new_selector_cnt;
-  }
-
-  if (std::is_same<Item, GenericItem>::value) {
-    if (OB_SUCC(ret)) {
+    // items of the first probe are prefetched in locate_items_batch
+    if (std::is_same<Item, GenericItem>::value) {
       for (int64_t i = 0; i < output_info.selector_cnt_; i++) {
         __builtin_prefetch(ctx.cur_items_[i], 0 /* for read */, 3 /* high temporal locality */);
       }
@@ -414,18 +443,15 @@ int HashTable<Bucket, Prober>::probe_batch_opt(JoinTableCtx &ctx, OutputInfo &ou
   int ret = OB_SUCCESS;
   if (output_info.first_probe_) {
     uint64_t *hash_vals = ctx.probe_batch_rows_->hash_vals_;
-    uint64_t mask = nbuckets_ - 1;
-    for (int64_t i = 0; i < output_info.selector_cnt_; i++) {
-      int64_t hash_val = hash_vals[output_info.selector_[i]];
-      __builtin_prefetch(&buckets_->at(hash_val & mask), 0, 1 /*low temporal locality*/);
-    }
+    locate_items_batch(ctx, output_info);
     int64_t new_selector_cnt = 0;
     int64_t batch_idx = 0;
     Item *item = NULL;
     bool matched = false;
     for (int64_t i = 0; i < output_info.selector_cnt_; i++) {
       batch_idx = output_info.selector_[i];
-      item = get(hash_vals[batch_idx]);
+      // new_selector_cnt <= i, ctx.cur_items_[i] is read before it may be overwritten
+      item = reinterpret_cast<Item *>(ctx.cur_items_[i]);
       OB_ASSERT(NULL != item);
       while (END_ITEM != reinterpret_cast<uint64_t>(item)) {
         ret = prober_.equal(ctx, item, batch_idx, matched);
@@ -442,7 +468,7 @@ int HashTable<Bucket, Prober>::probe_batch_opt(JoinTableCtx &ctx, OutputInfo &ou
         }
       }
       LOG_DEBUG("first probe", KP(item), K(i), K(new_selector_cnt), K(batch_idx),
-                K(hash_vals[output_info.selector_[i]]), K(output_info.selector_cnt_));
+                K(hash_vals[batch_idx]), K(output_info.selector_cnt_));
     }
     output_info.selector_cnt_ = new_selector_cnt;
     output_info.first_probe_ = false;
@@ -488,6 +514,10 @@ int HashTable<Bucket, Prober>::probe_batch_del_match(JoinTableCtx &ctx, OutputIn
   int64_t result_idx = 0;
   ObEvalCtx::BatchInfoScopeGuard batch_info_guard(*ctx.eval_ctx_);
   batch_info_guard.set_batch_size(ctx.probe_batch_rows_->brs_.size_);
+  for (int64_t i = 0; i < output_info.selector_cnt_; i++) {
+    uint64_t hash_val = ctx.probe_batch_rows_->hash_vals_[output_info.selector_[i]];
+    __builtin_prefetch(&buckets_->at(get_bucket_pos(hash_val)), 0, 1 /*low temporal locality*/);
+  }
   for (int64_t i = 0; OB_SUCC(ret) && i < output_info.selector_cnt_; i++) {
     Bucket *bkt = nullptr;
     get(ctx.probe_batch_rows_->hash_vals_[output_info.selector_[i]], bkt);
@@ -634,9 +664,8 @@ inline int GenericSharedHashTable::insert_batch(JoinTableCtx &ctx,
                                          int64_t &collisions)
 {
   int ret = OB_SUCCESS;
-  auto mask = nbuckets_ - 1;
   for (auto i = 0; i < size; i++) {
-    __builtin_prefetch((&buckets_->at(stored_rows[i]->get_hash_value(ctx.build_row_meta_) & mask)),
+    __builtin_prefetch((&buckets_->at(get_bucket_pos(stored_rows[i]->get_hash_value(ctx.build_row_meta_)))),
                         1 , 3);
   }
   for (int64_t i = 0; OB_SUCC(ret) && i < size; ++i) {
@@ -662,7 +691,7 @@ inline int GenericSharedHashTable::atomic_set(const uint64_t hash_val,
   new_bucket.used_ = true;
   new_bucket.set_item(item);
   uint64_t mask = nbuckets_ - 1;
-  uint64_t pos = new_bucket.hash_value_ & mask;
+  uint64_t pos = get_bucket_pos(new_bucket.hash_value_);
   bool added = false;
   GenericBucket old_bucket;
   uint64_t old_val;
@@ -715,9 +744,8 @@ inline int NormalizedSharedHashTable<Bucket, Prober>::insert_batch(JoinTableCtx
                                                    int64_t &collisions)
 {
   int ret = OB_SUCCESS;
-  auto mask = this->nbuckets_ - 1;
   for (auto i = 0; i < size; i++) {
-    __builtin_prefetch((&this->buckets_->at(stored_rows[i]->get_hash_value(ctx.build_row_meta_) & mask)),
+    __builtin_prefetch((&this->buckets_->at(this->get_bucket_pos(stored_rows[i]->get_hash_value(ctx.build_row_meta_)))),
                         1 /* write */, 3 /* high temporal locality*/);
   }
   for (int64_t i = 0; OB_SUCC(ret) && i < size; ++i) {
@@ -744,7 +772,7 @@ inline int NormalizedSharedHashTable<Bucket, Prober>::atomic_set(JoinTableCtx &c
   new_bucket.used_ = true;
   const RowMeta &row_meta = ctx.build_row_meta_;
   uint64_t mask = this->nbuckets_ - 1;
-  uint64_t pos = new_bucket.hash_value_ & mask;
+  uint64_t pos = this->get_bucket_pos(new_bucket.hash_value_);
   bool added = false;
   Bucket old_bucket;
   uint64_t old_val;
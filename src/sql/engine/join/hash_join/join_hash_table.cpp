@@ -79,9 +79,13 @@ int JoinHashTable::init(JoinTableCtx &hjt_ctx, ObIAllocator &allocator)
   return ret;
 }
 
-int JoinHashTable::build_prepare(JoinTableCtx &ctx, int64_t row_count, int64_t bucket_count) {
+int JoinHashTable::build_prepare(JoinTableCtx &ctx,
+                                 int64_t row_count,
+                                 int64_t bucket_count,
+                                 int64_t radix_shift,
+                                 int64_t radix_bits) {
   ctx.reuse();
-  return hash_table_->build_prepare(row_count, bucket_count);
+  return hash_table_->build_prepare(row_count, bucket_count, radix_shift, radix_bits);
 }
 
 int JoinHashTable::build(JoinPartitionRowIter &iter, JoinTableCtx &ctx) {
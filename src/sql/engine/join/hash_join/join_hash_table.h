@@ -26,7 +26,12 @@ public:
   {}
   int init(JoinTableCtx &hjt_ctx, ObIAllocator &allocator);
   bool use_normalized_ht(JoinTableCtx &hjt_ctx);
-  int build_prepare(JoinTableCtx &ctx, int64_t row_count, int64_t bucket_count);
+  // radix_bits > 0 means buckets are clustered by partition bits of hash value
+  int build_prepare(JoinTableCtx &ctx,
+                    int64_t row_count,
+                    int64_t bucket_count,
+                    int64_t radix_shift = 0,
+                    int64_t radix_bits = 0);
   int build(JoinPartitionRowIter &iter, JoinTableCtx &jt_ctx);
   int probe_prepare(JoinTableCtx &ctx, OutputInfo &output_info);
   int probe_batch(JoinTableCtx &ctx, OutputInfo &output_info);
@@ -133,9 +133,11 @@ ObHashJoinVecOp::ObHashJoinVecOp(ObExecContext &ctx_, const ObOpSpec &spec, ObOp
   hj_processor_(NONE),
   force_hash_join_spill_(false),
   hash_join_processor_(7),
+  enable_radix_cluster_(true),
   tenant_id_(-1),
   profile_(ObSqlWorkAreaType::HASH_WORK_AREA),
   sql_mem_processor_(profile_, op_monitor_info_),
+  compress_callback_(sql_mem_processor_),
   state_(JS_PROCESS_LEFT),
   drain_mode_(HashJoinDrainMode::NONE_DRAIN),
   remain_data_memory_size_(0),
@@ -239,6 +241,7 @@ int ObHashJoinVecOp::inner_open()
     if (tenant_config.is_valid()) {
       force_hash_join_spill_ = tenant_config->_force_hash_join_spill;
       hash_join_processor_ = tenant_config->_enable_hash_join_processor;
+      enable_radix_cluster_ = tenant_config->_enable_hash_join_radix_cluster;
       if (0 == (hash_join_processor_ & HJ_PROCESSOR_MASK)) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("unexpect hash join processor", K(ret), K(hash_join_processor_));
@@ -697,6 +700,12 @@ void ObHashJoinVecOp::destroy()
 int ObHashJoinVecOp::inner_close()
 {
   int ret = OB_SUCCESS;
+  ObSqlMemMgrProcessor::set_compress_stat(sql_mem_processor_.get_compress_raw_size(),
+                                          sql_mem_processor_.get_compressed_size(),
+                                          op_monitor_info_.otherstat_7_id_,
+                                          op_monitor_info_.otherstat_7_value_,
+                                          op_monitor_info_.otherstat_8_id_,
+                                          op_monitor_info_.otherstat_8_value_);
   sql_mem_processor_.unregister_profile();
   if (is_shared_) {
     IGNORE_RETURN sync_wait_close();
@@ -969,6 +978,25 @@ int64_t ObHashJoinVecOp::calc_bucket_number(const int64_t row_count)
   return bucket_cnt;
 }
 
+// In recursive mode, the in-memory partitions are inserted into hash table one by one.
+// If bucket array is too large to fit in L2 cache, cluster buckets by partition bits,
+// then the buckets touched while building one partition are continuous and cache sized.
+int64_t ObHashJoinVecOp::calc_radix_bits()
+{
+  int64_t radix_bits = 0;
+  const int64_t bucket_cnt = profile_.get_bucket_size();
+  if (enable_radix_cluster_
+      && HJProcessor::RECURSIVE == hj_processor_
+      && part_count_ > 1
+      && 0 == (part_count_ & (part_count_ - 1))
+      && bucket_cnt * cur_join_table_->get_one_bucket_size()
+         > MIN_RADIX_CLUSTER_L2_RATIO * INIT_L2_CACHE_SIZE
+      && bucket_cnt / part_count_ >= MIN_RADIX_CLUSTER_SLICE_BUCKETS) {
+    radix_bits = __builtin_ctzll(part_count_);
+  }
+  return radix_bits;
+}
+
 // calculate row_count, input_size, bucket_num, and set to profile
 int ObHashJoinVecOp::calc_basic_info(bool global_info)
 {
@@ -1274,6 +1302,8 @@ int ObHashJoinVecOp::create_partition(bool is_left, int64_t part_id, ObHJPartiti
   } else {
     part->get_row_store().set_dir_id(sql_mem_processor_.get_dir_id());
     part->get_row_store().set_io_event_observer(&io_event_observer_);
+    // the memory of partitions is accounted by the operator, only the compression is reported
+    part->get_row_store().set_callback(&compress_callback_);
     LOG_DEBUG("debug init batch", K(part_level_), K(part_id),
       K((tmp_batch_round << 32) + part_id), K(tmp_batch_round));
   }
@@ -2032,15 +2062,18 @@ int ObHashJoinVecOp::prepare_hash_table()
               K(build_ht_thread_ptr), K(reinterpret_cast<uint64_t>(this)));
   }
   if (OB_SUCC(ret) && need_build_hash_table) {
-    if (OB_FAIL(cur_join_table_->build_prepare(jt_ctx_, profile_.get_row_count(), profile_.get_bucket_size()))) {
+    const int64_t radix_bits = calc_radix_bits();
+    if (OB_FAIL(cur_join_table_->build_prepare(jt_ctx_, profile_.get_row_count(), profile_.get_bucket_size(),
+                                               part_shift_, radix_bits))) {
       LOG_WARN("trace failed to  prepare hash table",
                K(profile_.get_expect_size()), K(profile_.get_bucket_size()), K(profile_.get_row_count()),
-               K(get_mem_used()), K(sql_mem_processor_.get_mem_bound()), K(cur_dumped_partition_));
+               K(get_mem_used()), K(sql_mem_processor_.get_mem_bound()), K(cur_dumped_partition_),
+               K(radix_bits));
     } else if (OB_FAIL(sql_mem_processor_.update_used_mem_size(get_mem_used()))) {
       LOG_WARN("failed to update used mem size", K(ret));
     }
     LOG_TRACE("trace prepare hash table", K(ret), K(profile_.get_bucket_size()), K(profile_.get_row_count()),
-              K(part_count_), K(profile_.get_expect_size()), K(spec_.id_));
+              K(part_count_), K(part_shift_), K(radix_bits), K(profile_.get_expect_size()), K(spec_.id_));
   }
   if (OB_SUCC(ret) && is_shared_ && OB_FAIL(sync_wait_init_build_hash(build_ht_thread_ptr))) {
     LOG_WARN("failed to sync wait init hash table", K(ret));
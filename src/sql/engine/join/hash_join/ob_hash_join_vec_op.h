@@ -345,6 +345,7 @@ private:
   int64_t calc_max_data_size(const int64_t extra_memory_size);
   int get_max_memory_size(int64_t input_size);
   int64_t calc_bucket_number(const int64_t row_count);
+  int64_t calc_radix_bits();
   int calc_basic_info(bool global_info = false);
   int get_processor_type();
   int build_hash_table_in_memory(int64_t &num_left_rows);
@@ -525,15 +526,20 @@ private:
   static const int64_t MIN_BATCH_ROW_CNT_NESTLOOP = 256;
   static const int64_t PRICE_PER_ROW = 48;
   static const int64_t MAX_PART_COUNT_PER_LEVEL = INIT_LTB_SIZE<< 1;
+  // buckets are clustered by partition only if bucket array is much larger than L2 cache
+  static const int64_t MIN_RADIX_CLUSTER_L2_RATIO = 8;
+  static const int64_t MIN_RADIX_CLUSTER_SLICE_BUCKETS = 1024;
 
   int64_t max_output_cnt_;
   HJState hj_state_;
   HJProcessor hj_processor_;
   bool force_hash_join_spill_;
   int8_t hash_join_processor_;
+  bool enable_radix_cluster_;
   int64_t tenant_id_;
   ObSqlWorkAreaProfile profile_;
   ObSqlMemMgrProcessor sql_mem_processor_;
+  ObSqlMemCompressCallback compress_callback_;
 
   ObJoinState state_;
   HashJoinDrainMode drain_mode_;
@@ -0,0 +1,958 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/join/ob_merge_join_vec_op.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/session/ob_sql_session_info.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+static const int64_t BATCH_MULTIPLE_TIMES = 10;
+
+OB_SERIALIZE_MEMBER((ObMergeJoinVecSpec, ObJoinVecSpec), equal_cond_infos_,
+                    merge_directions_,
+                    left_child_fetcher_all_exprs_,
+                    right_child_fetcher_all_exprs_);
+
+OB_SERIALIZE_MEMBER(ObMergeJoinVecSpec::EqualConditionInfo,
+                    expr_, ser_cmp_func_, is_opposite_);
+
+const int64_t ObMergeJoinVecSpec::MERGE_DIRECTION_ASC = 1;
+const int64_t ObMergeJoinVecSpec::MERGE_DIRECTION_DESC = -1;
+
+int ObMergeJoinVecSpec::set_merge_directions(const ObIArray<ObOrderDirection> &merge_directions)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(merge_directions_.init(merge_directions.count()))) {
+    LOG_WARN("fail to init merge direction", K(ret));
+  }
+  ARRAY_FOREACH(merge_directions, i) {
+    if (OB_FAIL(merge_directions_.push_back(is_ascending_direction(merge_directions.at(i))
+                                            ? MERGE_DIRECTION_ASC
+                                            : MERGE_DIRECTION_DESC))) {
+      LOG_WARN("failed to add merge direction", K(ret), K(i));
+    }
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::ChildBatchFetcher::init(ObOperator &child,
+                                              const ExprFixedArray &all_exprs,
+                                              const ObMergeJoinVecSpec &spec,
+                                              const bool is_left,
+                                              const ObMemAttr &mem_attr,
+                                              lib::MemoryContext &mem_context)
+{
+  int ret = OB_SUCCESS;
+  const int64_t batch_size = spec.max_batch_size_;
+  ObIAllocator &alloc = mem_context->get_arena_allocator();
+  child_ = &child;
+  all_exprs_ = &all_exprs;
+  rows_.set_attr(mem_attr);
+  group_starts_.set_attr(mem_attr);
+  for (int64_t i = 0; OB_SUCC(ret) && i < spec.equal_cond_infos_.count(); i++) {
+    const ObMergeJoinVecSpec::EqualConditionInfo &info = spec.equal_cond_infos_.at(i);
+    ObExpr *key_expr = is_left ? info.get_left_expr() : info.get_right_expr();
+    int64_t key_idx = -1;
+    if (!has_exist_in_array(all_exprs, key_expr, &key_idx)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("join key is not fetched from child", K(ret), K(is_left), KPC(key_expr));
+    } else if (OB_FAIL(key_exprs_.push_back(key_expr))) {
+      LOG_WARN("failed to push back key expr", K(ret));
+    } else if (OB_FAIL(key_idxs_.push_back(key_idx))) {
+      LOG_WARN("failed to push back key idx", K(ret));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < STORE_CNT; i++) {
+    // the stores are dumped by the operator according to the memory bound
+    if (OB_FAIL(stores_[i].init(all_exprs,
+                                batch_size,
+                                mem_attr,
+                                0 /*mem_limit*/,
+                                true /*enable_dump*/,
+                                0 /*row_extra_size*/,
+                                spec.compress_type_))) {
+      LOG_WARN("init row store failed", K(ret));
+    } else if (OB_FAIL(readers_[i].init(&stores_[i]))) {
+      LOG_WARN("init row store reader failed", K(ret));
+    } else {
+      stores_[i].set_allocator(mem_context->get_malloc_allocator());
+      stores_[i].set_mem_stat(&join_op_.sql_mem_processor_);
+      stores_[i].set_io_event_observer(&join_op_.io_event_observer_);
+      stores_[i].set_dir_id(join_op_.sql_mem_processor_.get_dir_id());
+      readers_[i].set_iteration_age(&join_op_.iter_age_);
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(stored_rows_ = static_cast<ObCompactRow **>(
+                       alloc.alloc(sizeof(*stored_rows_) * batch_size)))
+             || OB_ISNULL(selector_ = static_cast<uint16_t *>(
+                          alloc.alloc(sizeof(*selector_) * batch_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc memory", K(ret), K(batch_size));
+  }
+  return ret;
+}
+
+void ObMergeJoinVecOp::ChildBatchFetcher::reset()
+{
+  for (int64_t i = 0; i < STORE_CNT; i++) {
+    readers_[i].reset();
+    stores_[i].reuse();
+  }
+  cur_store_ = 0;
+  rows_.reuse();
+  group_starts_.reuse();
+  cur_ = 0;
+  group_begin_ = 0;
+  group_end_ = 0;
+  iter_end_ = false;
+}
+
+void ObMergeJoinVecOp::ChildBatchFetcher::destroy()
+{
+  for (int64_t i = 0; i < STORE_CNT; i++) {
+    readers_[i].reset();
+    stores_[i].reset();
+  }
+  cur_store_ = 0;
+  rows_.destroy();
+  group_starts_.destroy();
+  key_exprs_.destroy();
+  key_idxs_.destroy();
+  child_ = NULL;
+  all_exprs_ = NULL;
+  stored_rows_ = NULL;
+  selector_ = NULL;
+  cur_ = 0;
+  group_begin_ = 0;
+  group_end_ = 0;
+  iter_end_ = false;
+}
+
+int ObMergeJoinVecOp::ChildBatchFetcher::get_row(const int64_t idx, const ObCompactRow *&row)
+{
+  int ret = OB_SUCCESS;
+  if (!stores_[cur_store_].has_dumped()) {
+    row = rows_.at(idx);
+  } else if (OB_FAIL(readers_[cur_store_].get_row(idx, row))) {
+    LOG_WARN("failed to get row from store", K(ret), K(idx), K(cur_store_));
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::ChildBatchFetcher::dump()
+{
+  int ret = OB_SUCCESS;
+  ObRATempRowStore &store = stores_[cur_store_];
+  if (store.is_empty_save_block_cnt()) {
+    // only the block being written is in memory
+  } else if (OB_FAIL(store.dump(false /*all_dump*/))) {
+    LOG_WARN("failed to dump row store", K(ret));
+  } else {
+    readers_[cur_store_].reset();
+  }
+  return ret;
+}
+
+bool ObMergeJoinVecOp::ChildBatchFetcher::has_next_group_in_memory() const
+{
+  bool found = iter_end_;
+  for (int64_t i = cur_ + 1; !found && i < rows_.count(); i++) {
+    found = group_starts_.at(i);
+  }
+  return found;
+}
+
+int ObMergeJoinVecOp::ChildBatchFetcher::get_next_group()
+{
+  int ret = OB_SUCCESS;
+  bool recycled = false;
+  bool group_end = false;
+  group_begin_ = cur_;
+  group_end_ = cur_;
+  while (OB_SUCC(ret) && !group_end) {
+    if (group_end_ > group_begin_) {
+      while (group_end_ < rows_.count() && !group_starts_.at(group_end_)) {
+        group_end_++;
+      }
+    } else if (group_end_ < rows_.count()) {
+      group_end_++;
+      continue;
+    }
+    if (group_end_ < rows_.count() || iter_end_) {
+      group_end = true;
+    } else if (!recycled && OB_FAIL(recycle_store())) {
+      LOG_WARN("failed to recycle row store", K(ret));
+    } else if (FALSE_IT(recycled = true)) {
+    } else if (OB_FAIL(fetch_batch())) {
+      LOG_WARN("failed to fetch batch", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    cur_ = group_end_;
+  }
+  return ret;
+}
+
+// The rows before the current group are not referenced anymore, the rows of the
+// current group are moved to the other store, and the current store is reused.
+int ObMergeJoinVecOp::ChildBatchFetcher::recycle_store()
+{
+  int ret = OB_SUCCESS;
+  const int64_t keep_cnt = rows_.count() - group_begin_;
+  const int64_t next_idx = (cur_store_ + 1) % STORE_CNT;
+  ObRATempRowStore &cur_store = stores_[cur_store_];
+  ObRATempRowStore &next_store = stores_[next_idx];
+  if (0 == group_begin_) {
+    // nothing to recycle
+  } else if (0 == keep_cnt) {
+    readers_[cur_store_].reset();
+    cur_store.reuse();
+    rows_.reuse();
+    group_starts_.reuse();
+  } else {
+    const ObCompactRow *row = NULL;
+    ObCompactRow *new_row = NULL;
+    for (int64_t i = 0; OB_SUCC(ret) && i < keep_cnt; i++) {
+      if (OB_FAIL(get_row(group_begin_ + i, row))) {
+        LOG_WARN("failed to get row", K(ret), K(i));
+      } else if (OB_FAIL(next_store.add_row(row, new_row))) {
+        LOG_WARN("failed to add row", K(ret));
+      } else {
+        rows_.at(i) = new_row;
+        group_starts_.at(i) = group_starts_.at(group_begin_ + i);
+      }
+    }
+    if (OB_SUCC(ret)) {
+      while (rows_.count() > keep_cnt) {
+        rows_.pop_back();
+        group_starts_.pop_back();
+      }
+      readers_[cur_store_].reset();
+      cur_store.reuse();
+      cur_store_ = next_idx;
+      if (OB_FAIL(join_op_.process_dump())) {
+        LOG_WARN("failed to process dump", K(ret));
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    cur_ -= group_begin_;
+    group_end_ -= group_begin_;
+    group_begin_ = 0;
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::ChildBatchFetcher::fetch_batch()
+{
+  int ret = OB_SUCCESS;
+  const ObBatchRows *brs = NULL;
+  const int64_t start_pos = rows_.count();
+  const int64_t batch_size = stores_[cur_store_].get_max_batch_size();
+  // fetch until some rows are got or the child is iterated to the end
+  while (OB_SUCC(ret) && !iter_end_ && rows_.count() == start_pos) {
+    int64_t stored_cnt = 0;
+    join_op_.clear_evaluated_flag();
+    if (OB_FAIL(child_->get_next_batch(batch_size, brs))) {
+      LOG_WARN("failed to get next batch", K(ret));
+    } else if (brs->size_ > 0
+               && OB_FAIL(stores_[cur_store_].add_batch(*all_exprs_, eval_ctx_, *brs,
+                                                        stored_cnt, stored_rows_))) {
+      LOG_WARN("failed to add batch", K(ret));
+    } else {
+      for (int64_t i = 0; OB_SUCC(ret) && i < stored_cnt; i++) {
+        if (OB_FAIL(rows_.push_back(stored_rows_[i]))) {
+          LOG_WARN("failed to push back row", K(ret));
+        } else if (OB_FAIL(group_starts_.push_back(false))) {
+          LOG_WARN("failed to push back group flag", K(ret));
+        }
+      }
+      if (OB_SUCC(ret) && stored_cnt > 0 && OB_FAIL(calc_group_starts(*brs, start_pos))) {
+        LOG_WARN("failed to calc group starts", K(ret));
+      } else if (OB_SUCC(ret) && stored_cnt > 0 && OB_FAIL(join_op_.process_dump())) {
+        LOG_WARN("failed to process dump", K(ret));
+      }
+      iter_end_ = brs->end_;
+    }
+  }
+  return ret;
+}
+
+// Compare the join keys of the adjacent rows in vectors to find the first row of
+// each group, the first row of the batch is compared with the last stored row.
+int ObMergeJoinVecOp::ChildBatchFetcher::calc_group_starts(const ObBatchRows &brs,
+                                                           const int64_t start_pos)
+{
+  int ret = OB_SUCCESS;
+  int64_t sel_cnt = 0;
+  for (int64_t i = 0; i < brs.size_; i++) {
+    if (!brs.skip_->at(i)) {
+      selector_[sel_cnt++] = i;
+    }
+  }
+  if (OB_UNLIKELY(sel_cnt != rows_.count() - start_pos)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected stored row count", K(ret), K(sel_cnt), K(start_pos), K(rows_.count()));
+  } else {
+    group_starts_.at(start_pos) = (0 == start_pos);
+  }
+  for (int64_t k = 0; OB_SUCC(ret) && k < key_exprs_.count(); k++) {
+    const ObExpr &key_expr = *key_exprs_.at(k);
+    const ObIVector *vec = key_expr.get_vector(eval_ctx_);
+    bool is_null = false;
+    const char *payload = NULL;
+    ObLength len = 0;
+    int cmp = 0;
+    if (!group_starts_.at(start_pos)) {
+      const ObCompactRow *last_row = NULL;
+      const int64_t key_idx = key_idxs_.at(k);
+      if (OB_FAIL(get_row(start_pos - 1, last_row))) {
+        LOG_WARN("failed to get last row", K(ret), K(start_pos));
+      } else if (FALSE_IT(is_null = last_row->is_null(key_idx))) {
+      } else if (!is_null) {
+        last_row->get_cell_payload(get_row_meta(), key_idx, payload, len);
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(vec->null_first_cmp(key_expr, selector_[0], is_null, payload, len, cmp))) {
+        LOG_WARN("failed to compare join key", K(ret), K(k));
+      } else if (0 != cmp) {
+        group_starts_.at(start_pos) = true;
+      }
+    }
+    for (int64_t i = 1; OB_SUCC(ret) && i < sel_cnt; i++) {
+      if (group_starts_.at(start_pos + i)) {
+        // already differs in the previous join keys
+      } else if (FALSE_IT(vec->get_payload(selector_[i - 1], is_null, payload, len))) {
+      } else if (OB_FAIL(vec->null_first_cmp(key_expr, selector_[i], is_null, payload, len, cmp))) {
+        LOG_WARN("failed to compare join key", K(ret), K(k), K(i));
+      } else if (0 != cmp) {
+        group_starts_.at(start_pos + i) = true;
+      }
+    }
+  }
+  return ret;
+}
+
+ObMergeJoinVecOp::ObMergeJoinVecOp(ObExecContext &exec_ctx, const ObOpSpec &spec,
+                                   ObOpInput *input)
+  : ObJoinVecOp(exec_ctx, spec, input),
+    state_(JS_JOIN_BEGIN),
+    mem_context_(NULL),
+    profile_(ObSqlWorkAreaType::HASH_WORK_AREA),
+    sql_mem_processor_(profile_, op_monitor_info_),
+    iter_age_(),
+    left_fetcher_(*this),
+    right_fetcher_(*this),
+    need_left_group_(true),
+    need_right_group_(true),
+    left_output_rows_(NULL),
+    right_output_rows_(NULL),
+    output_cnt_(0),
+    left_group_idx_(0),
+    right_group_idx_(0),
+    left_cand_idxs_(NULL),
+    right_cand_idxs_(NULL),
+    left_matched_(),
+    right_matched_(),
+    right_matched_cnt_(0),
+    rest_idx_(0),
+    cond_skip_(NULL),
+    selector_(NULL),
+    selected_rows_(NULL)
+{
+}
+
+int ObMergeJoinVecOp::inner_open()
+{
+  int ret = OB_SUCCESS;
+  const int64_t batch_size = MY_SPEC.max_batch_size_;
+  if (OB_FAIL(ObJoinVecOp::inner_open())) {
+    LOG_WARN("failed to open in base class", K(ret));
+  } else if (OB_ISNULL(left_) || OB_ISNULL(right_) || OB_ISNULL(ctx_.get_my_session())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null", K(ret), KP(left_), KP(right_));
+  } else if (OB_FAIL(init_mem_context())) {
+    LOG_WARN("fail to init memory context", K(ret));
+  } else {
+    const uint64_t tenant_id = ctx_.get_my_session()->get_effective_tenant_id();
+    ObMemAttr mem_attr(tenant_id, ObModIds::OB_SQL_MERGE_JOIN, ObCtxIds::WORK_AREA);
+    ObIAllocator &alloc = mem_context_->get_arena_allocator();
+    left_matched_.set_attr(ObMemAttr(tenant_id, "SqlMJVecMatch"));
+    right_matched_.set_attr(ObMemAttr(tenant_id, "SqlMJVecMatch"));
+    void *skip_buf = NULL;
+    const int64_t cache_size = batch_size * BATCH_MULTIPLE_TIMES
+                               * (left_->get_spec().width_ + right_->get_spec().width_);
+    if (OB_FAIL(sql_mem_processor_.init(&mem_context_->get_malloc_allocator(),
+                                        tenant_id,
+                                        std::max(2L << 20, cache_size),
+                                        MY_SPEC.type_,
+                                        MY_SPEC.id_,
+                                        &ctx_))) {
+      LOG_WARN("failed to init sql memory manager processor", K(ret));
+    } else if (OB_FAIL(left_fetcher_.init(*left_, MY_SPEC.left_child_fetcher_all_exprs_, MY_SPEC,
+                                   true, mem_attr, mem_context_))) {
+      LOG_WARN("init left batch fetcher failed", K(ret));
+    } else if (OB_FAIL(right_fetcher_.init(*right_, MY_SPEC.right_child_fetcher_all_exprs_,
+                                           MY_SPEC, false, mem_attr, mem_context_))) {
+      LOG_WARN("init right batch fetcher failed", K(ret));
+    } else if (OB_ISNULL(left_output_rows_ = static_cast<const ObCompactRow **>(
+                         alloc.alloc(sizeof(*left_output_rows_) * batch_size)))
+               || OB_ISNULL(right_output_rows_ = static_cast<const ObCompactRow **>(
+                            alloc.alloc(sizeof(*right_output_rows_) * batch_size)))
+               || OB_ISNULL(left_cand_idxs_ = static_cast<int64_t *>(
+                            alloc.alloc(sizeof(*left_cand_idxs_) * batch_size)))
+               || OB_ISNULL(right_cand_idxs_ = static_cast<int64_t *>(
+                            alloc.alloc(sizeof(*right_cand_idxs_) * batch_size)))
+               || OB_ISNULL(skip_buf = alloc.alloc(ObBitVector::memory_size(batch_size)))
+               || OB_ISNULL(selector_ = static_cast<uint16_t *>(
+                            alloc.alloc(sizeof(*selector_) * batch_size)))
+               || OB_ISNULL(selected_rows_ = static_cast<const ObCompactRow **>(
+                            alloc.alloc(sizeof(*selected_rows_) * batch_size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc memory", K(ret), K(batch_size));
+    } else {
+      cond_skip_ = to_bit_vector(skip_buf);
+      cond_skip_->reset(batch_size);
+    }
+    LOG_TRACE("trace init sql mem mgr for merge join", K(profile_.get_cache_size()),
+              K(profile_.get_expect_size()));
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::init_mem_context()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(mem_context_)) {
+    ObSQLSessionInfo *session = ctx_.get_my_session();
+    uint64_t tenant_id = session->get_effective_tenant_id();
+    lib::ContextParam param;
+    param.set_mem_attr(tenant_id,
+                       ObModIds::OB_SQL_MERGE_JOIN,
+                       ObCtxIds::WORK_AREA)
+      .set_properties(lib::USE_TL_PAGE_OPTIONAL);
+    if (OB_FAIL(CURRENT_CONTEXT->CREATE_CONTEXT(mem_context_, param))) {
+      LOG_WARN("create entity failed", K(ret));
+    } else if (OB_ISNULL(mem_context_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("null memory entity returned", K(ret));
+    }
+  }
+  return ret;
+}
+
+// Dump the stores of both children if the rows in memory exceed the memory bound,
+// it is called after rows are added to the stores, when the output rows of the
+// last batch are not referenced anymore.
+int ObMergeJoinVecOp::process_dump()
+{
+  int ret = OB_SUCCESS;
+  bool updated = false;
+  bool dumped = false;
+  UNUSED(updated);
+  if (OB_FAIL(sql_mem_processor_.update_max_available_mem_size_periodically(
+      &mem_context_->get_malloc_allocator(),
+      [&](int64_t cur_cnt) {
+        return left_fetcher_.get_row_cnt_in_memory()
+               + right_fetcher_.get_row_cnt_in_memory() > cur_cnt;
+      },
+      updated))) {
+    LOG_WARN("failed to update max available memory size periodically", K(ret));
+  } else if (sql_mem_processor_.get_data_size() > sql_mem_processor_.get_mem_bound()
+             && GCONF.is_sql_operator_dump_enabled()
+             && OB_FAIL(sql_mem_processor_.extend_max_memory_size(
+               &mem_context_->get_malloc_allocator(),
+               [&](int64_t max_memory_size) {
+                 return sql_mem_processor_.get_data_size() > max_memory_size;
+               },
+               dumped, sql_mem_processor_.get_data_size()))) {
+    LOG_WARN("failed to extend max memory size", K(ret));
+  } else if (!dumped) {
+  } else if (OB_FAIL(left_fetcher_.dump())) {
+    LOG_WARN("failed to dump left row store", K(ret));
+  } else if (OB_FAIL(right_fetcher_.dump())) {
+    LOG_WARN("failed to dump right row store", K(ret));
+  } else {
+    sql_mem_processor_.set_number_pass(1);
+    LOG_TRACE("trace merge join dump", K(sql_mem_processor_.get_data_size()),
+              K(left_fetcher_.get_row_cnt_in_memory()),
+              K(right_fetcher_.get_row_cnt_in_memory()),
+              K(sql_mem_processor_.get_mem_bound()));
+  }
+  return ret;
+}
+
+void ObMergeJoinVecOp::reset()
+{
+  state_ = JS_JOIN_BEGIN;
+  left_fetcher_.reset();
+  right_fetcher_.reset();
+  need_left_group_ = true;
+  need_right_group_ = true;
+  output_cnt_ = 0;
+  left_group_idx_ = 0;
+  right_group_idx_ = 0;
+  left_matched_.reuse();
+  right_matched_.reuse();
+  right_matched_cnt_ = 0;
+  rest_idx_ = 0;
+  sql_mem_processor_.reset();
+}
+
+int ObMergeJoinVecOp::inner_rescan()
+{
+  int ret = OB_SUCCESS;
+  reset();
+  if (OB_FAIL(ObJoinVecOp::inner_rescan())) {
+    LOG_WARN("failed to rescan ObJoin", K(ret));
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::inner_close()
+{
+  reset();
+  sql_mem_processor_.unregister_profile();
+  left_fetcher_.destroy();
+  right_fetcher_.destroy();
+  left_matched_.destroy();
+  right_matched_.destroy();
+  left_output_rows_ = NULL;
+  right_output_rows_ = NULL;
+  left_cand_idxs_ = NULL;
+  right_cand_idxs_ = NULL;
+  cond_skip_ = NULL;
+  selector_ = NULL;
+  selected_rows_ = NULL;
+  if (NULL != mem_context_) {
+    DESTROY_CONTEXT(mem_context_);
+    mem_context_ = NULL;
+  }
+  return ObJoinVecOp::inner_close();
+}
+
+void ObMergeJoinVecOp::destroy()
+{
+  sql_mem_processor_.unregister_profile_if_necessary();
+  left_fetcher_.destroy();
+  right_fetcher_.destroy();
+  left_matched_.destroy();
+  right_matched_.destroy();
+  if (NULL != mem_context_) {
+    DESTROY_CONTEXT(mem_context_);
+    mem_context_ = NULL;
+  }
+  ObJoinVecOp::destroy();
+}
+
+int ObMergeJoinVecOp::inner_get_next_batch(const int64_t max_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  const int64_t batch_size = std::min(max_row_cnt, MY_SPEC.max_batch_size_);
+  bool need_flush = false;
+  clear_evaluated_flag();
+  output_cnt_ = 0;
+  // the rows loaded from the dumped blocks for the last batch are released
+  iter_age_.inc();
+  while (OB_SUCC(ret) && !need_flush && output_cnt_ < batch_size && JS_JOIN_END != state_) {
+    switch (state_) {
+      case JS_JOIN_BEGIN: {
+        need_left_group_ = true;
+        need_right_group_ = true;
+        state_ = JS_COMPARE;
+        break;
+      }
+      case JS_COMPARE: {
+        int cmp = 0;
+        // The output rows reference the rows in the stores of the fetchers, so
+        // the output is returned before the fetcher recycles its store to fetch
+        // new batches from the child.
+        if (output_cnt_ > 0
+            && ((need_left_group_ && !left_fetcher_.has_next_group_in_memory())
+                || (need_right_group_ && !right_fetcher_.has_next_group_in_memory()))) {
+          need_flush = true;
+        } else if (need_left_group_ && OB_FAIL(left_fetcher_.get_next_group())) {
+          LOG_WARN("failed to get next left group", K(ret));
+        } else if (need_right_group_ && OB_FAIL(right_fetcher_.get_next_group())) {
+          LOG_WARN("failed to get next right group", K(ret));
+        } else if (FALSE_IT(need_left_group_ = false)) {
+        } else if (FALSE_IT(need_right_group_ = false)) {
+        } else if (!left_fetcher_.has_group() && !right_fetcher_.has_group()) {
+          state_ = JS_JOIN_END;
+        } else if (!right_fetcher_.has_group()) {
+          // all the rest rows of the left child are unmatched
+          state_ = need_left_unmatched() ? JS_LEFT_UNMATCHED : JS_JOIN_END;
+          rest_idx_ = 0;
+        } else if (!left_fetcher_.has_group()) {
+          state_ = need_right_unmatched() ? JS_RIGHT_UNMATCHED : JS_JOIN_END;
+          rest_idx_ = 0;
+        } else if (OB_FAIL(compare_groups(cmp))) {
+          LOG_WARN("failed to compare groups", K(ret));
+        } else if (cmp < 0) {
+          if (need_left_unmatched()) {
+            state_ = JS_LEFT_UNMATCHED;
+            rest_idx_ = 0;
+          } else {
+            need_left_group_ = true;
+          }
+        } else if (cmp > 0) {
+          if (need_right_unmatched()) {
+            state_ = JS_RIGHT_UNMATCHED;
+            rest_idx_ = 0;
+          } else {
+            need_right_group_ = true;
+          }
+        } else if (OB_FAIL(begin_join_group())) {
+          LOG_WARN("failed to begin join group", K(ret));
+        }
+        break;
+      }
+      case JS_LEFT_UNMATCHED:
+      case JS_RIGHT_UNMATCHED: {
+        const bool is_left = (JS_LEFT_UNMATCHED == state_);
+        bool done = false;
+        if (OB_FAIL(output_unmatched_rows(is_left, batch_size, done))) {
+          LOG_WARN("failed to output unmatched rows", K(ret), K(is_left));
+        } else if (done) {
+          need_left_group_ = is_left;
+          need_right_group_ = !is_left;
+          state_ = JS_COMPARE;
+        }
+        break;
+      }
+      case JS_JOIN_GROUP: {
+        if (OB_FAIL(join_group(batch_size))) {
+          LOG_WARN("failed to join group", K(ret));
+        }
+        break;
+      }
+      case JS_GROUP_LEFT_REST: {
+        bool done = false;
+        if (OB_FAIL(output_group_rest_rows(true, batch_size, done))) {
+          LOG_WARN("failed to output left rest rows", K(ret));
+        } else if (done) {
+          state_ = JS_GROUP_RIGHT_REST;
+          rest_idx_ = 0;
+        }
+        break;
+      }
+      case JS_GROUP_RIGHT_REST: {
+        bool done = false;
+        if (OB_FAIL(output_group_rest_rows(false, batch_size, done))) {
+          LOG_WARN("failed to output right rest rows", K(ret));
+        } else if (done) {
+          need_left_group_ = true;
+          need_right_group_ = true;
+          state_ = JS_COMPARE;
+        }
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected join state", K(ret), K(state_));
+        break;
+      }
+    }
+  }
+  if (OB_SUCC(ret) && output_cnt_ > 0) {
+    clear_evaluated_flag();
+    if (!is_right_semi_anti()
+        && OB_FAIL(project_rows(left_fetcher_, left_output_rows_, 0, output_cnt_))) {
+      LOG_WARN("failed to project left rows", K(ret));
+    } else if (!is_left_semi_anti()
+               && OB_FAIL(project_rows(right_fetcher_, right_output_rows_, 0, output_cnt_))) {
+      LOG_WARN("failed to project right rows", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    brs_.size_ = output_cnt_;
+    brs_.end_ = (JS_JOIN_END == state_);
+    brs_.skip_->reset(output_cnt_);
+    brs_.all_rows_active_ = true;
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::compare_groups(int &cmp)
+{
+  int ret = OB_SUCCESS;
+  const ObCompactRow *l_row = NULL;
+  const ObCompactRow *r_row = NULL;
+  cmp = 0;
+  if (OB_FAIL(left_fetcher_.get_group_row(0, l_row))) {
+    LOG_WARN("failed to get left group row", K(ret));
+  } else if (OB_FAIL(right_fetcher_.get_group_row(0, r_row))) {
+    LOG_WARN("failed to get right group row", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && 0 == cmp && i < MY_SPEC.equal_cond_infos_.count(); i++) {
+    const ObMergeJoinVecSpec::EqualConditionInfo &info = MY_SPEC.equal_cond_infos_.at(i);
+    const int64_t l_idx = left_fetcher_.get_key_idx(i);
+    const int64_t r_idx = right_fetcher_.get_key_idx(i);
+    const bool l_null = l_row->is_null(l_idx);
+    const bool r_null = r_row->is_null(r_idx);
+    if (l_null && r_null) {
+      // null only equals to null in null safe equal
+      cmp = T_OP_NSEQ == info.expr_->type_ ? 0 : -1;
+    } else {
+      const char *l_payload = NULL;
+      const char *r_payload = NULL;
+      ObLength l_len = 0;
+      ObLength r_len = 0;
+      if (!l_null) {
+        l_row->get_cell_payload(left_fetcher_.get_row_meta(), l_idx, l_payload, l_len);
+      }
+      if (!r_null) {
+        r_row->get_cell_payload(right_fetcher_.get_row_meta(), r_idx, r_payload, r_len);
+      }
+      if (OB_FAIL(info.ns_cmp_func_(info.get_left_expr()->obj_meta_,
+                                    info.get_right_expr()->obj_meta_,
+                                    l_payload, l_len, l_null,
+                                    r_payload, r_len, r_null, cmp))) {
+        LOG_WARN("failed to compare join keys", K(ret), K(i));
+      } else {
+        cmp *= static_cast<int>(MY_SPEC.merge_directions_.at(i));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::begin_join_group()
+{
+  int ret = OB_SUCCESS;
+  // without other join conditions, all rows of the equal groups are matched
+  const bool all_matched = MY_SPEC.other_join_conds_.empty();
+  left_group_idx_ = 0;
+  right_group_idx_ = 0;
+  left_matched_.reuse();
+  right_matched_.reuse();
+  right_matched_cnt_ = all_matched ? right_fetcher_.get_group_size() : 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < left_fetcher_.get_group_size(); i++) {
+    if (OB_FAIL(left_matched_.push_back(all_matched))) {
+      LOG_WARN("failed to push back match flag", K(ret));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < right_fetcher_.get_group_size(); i++) {
+    if (OB_FAIL(right_matched_.push_back(all_matched))) {
+      LOG_WARN("failed to push back match flag", K(ret));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (all_matched && !output_matched_pairs()) {
+    state_ = JS_GROUP_LEFT_REST;
+    rest_idx_ = 0;
+  } else {
+    state_ = JS_JOIN_GROUP;
+  }
+  return ret;
+}
+
+// Join the rows of the equal groups in batches, the pairs of rows are put in the
+// output batch and filtered by the other join conditions.
+int ObMergeJoinVecOp::join_group(const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  const bool has_other_conds = !MY_SPEC.other_join_conds_.empty();
+  const int64_t l_cnt = left_fetcher_.get_group_size();
+  const int64_t r_cnt = right_fetcher_.get_group_size();
+  const int64_t begin = output_cnt_;
+  int64_t cand_cnt = 0;
+  while (OB_SUCC(ret) && begin + cand_cnt < batch_size && left_group_idx_ < l_cnt) {
+    if (is_right_semi_anti() && right_matched_cnt_ >= r_cnt) {
+      // all the right rows are matched
+      left_group_idx_ = l_cnt;
+    } else if (right_group_idx_ >= r_cnt
+               || (is_left_semi_anti() && left_matched_.at(left_group_idx_))) {
+      left_group_idx_++;
+      right_group_idx_ = 0;
+    } else if (is_right_semi_anti() && right_matched_.at(right_group_idx_)) {
+      right_group_idx_++;
+    } else if (OB_FAIL(left_fetcher_.get_group_row(left_group_idx_,
+                                                   left_output_rows_[begin + cand_cnt]))) {
+      LOG_WARN("failed to get left group row", K(ret), K(left_group_idx_));
+    } else if (OB_FAIL(right_fetcher_.get_group_row(right_group_idx_,
+                                                    right_output_rows_[begin + cand_cnt]))) {
+      LOG_WARN("failed to get right group row", K(ret), K(right_group_idx_));
+    } else {
+      left_cand_idxs_[cand_cnt] = left_group_idx_;
+      right_cand_idxs_[cand_cnt] = right_group_idx_;
+      cand_cnt++;
+      right_group_idx_++;
+    }
+  }
+  if (OB_SUCC(ret) && cand_cnt > 0) {
+    if (has_other_conds && OB_FAIL(calc_other_conds_batch(begin, cand_cnt))) {
+      LOG_WARN("failed to calc other join conditions", K(ret));
+    } else {
+      int64_t output_idx = begin;
+      for (int64_t i = 0; i < cand_cnt; i++) {
+        if (has_other_conds && cond_skip_->at(begin + i)) {
+          // not matched
+        } else {
+          left_matched_.at(left_cand_idxs_[i]) = true;
+          if (!right_matched_.at(right_cand_idxs_[i])) {
+            right_matched_.at(right_cand_idxs_[i]) = true;
+            right_matched_cnt_++;
+          }
+          if (output_matched_pairs()) {
+            left_output_rows_[output_idx] = left_output_rows_[begin + i];
+            right_output_rows_[output_idx] = right_output_rows_[begin + i];
+            output_idx++;
+          }
+        }
+      }
+      output_cnt_ = output_idx;
+    }
+  }
+  if (OB_SUCC(ret) && left_group_idx_ >= l_cnt) {
+    state_ = JS_GROUP_LEFT_REST;
+    rest_idx_ = 0;
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::calc_other_conds_batch(const int64_t begin, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  const ObIArray<ObExpr *> &conds = MY_SPEC.other_join_conds_;
+  const int64_t end = begin + size;
+  clear_evaluated_flag();
+  cond_skip_->reset(end);
+  if (OB_FAIL(project_rows(left_fetcher_, left_output_rows_, begin, size))) {
+    LOG_WARN("failed to project left rows", K(ret));
+  } else if (OB_FAIL(project_rows(right_fetcher_, right_output_rows_, begin, size))) {
+    LOG_WARN("failed to project right rows", K(ret));
+  } else {
+    const EvalBound bound(end, begin, end, false);
+    ARRAY_FOREACH(conds, i) {
+      ObExpr *cond = conds.at(i);
+      ObIVector *res = NULL;
+      if (OB_FAIL(cond->eval_vector(eval_ctx_, *cond_skip_, bound))) {
+        LOG_WARN("fail to calc other join condition", K(ret), KPC(cond));
+      } else if (FALSE_IT(res = cond->get_vector(eval_ctx_))) {
+      } else {
+        for (int64_t j = begin; j < end; j++) {
+          if (!cond_skip_->at(j) && !res->is_true(j)) {
+            cond_skip_->set(j);
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObMergeJoinVecOp::output_unmatched_rows(const bool is_left,
+                                            const int64_t batch_size,
+                                            bool &done)
+{
+  int ret = OB_SUCCESS;
+  ChildBatchFetcher &fetcher = is_left ? left_fetcher_ : right_fetcher_;
+  const int64_t cnt = fetcher.get_group_size();
+  for (; OB_SUCC(ret) && rest_idx_ < cnt && output_cnt_ < batch_size; rest_idx_++) {
+    const ObCompactRow *row = NULL;
+    if (OB_FAIL(fetcher.get_group_row(rest_idx_, row))) {
+      LOG_WARN("failed to get group row", K(ret), K(rest_idx_));
+    } else {
+      left_output_rows_[output_cnt_] = is_left ? row : NULL;
+      right_output_rows_[output_cnt_] = is_left ? NULL : row;
+      output_cnt_++;
+    }
+  }
+  done = (rest_idx_ >= cnt);
+  return ret;
+}
+
+// output the matched rows of semi join and the unmatched rows of outer join and
+// anti join in the equal groups
+int ObMergeJoinVecOp::output_group_rest_rows(const bool is_left,
+                                             const int64_t batch_size,
+                                             bool &done)
+{
+  int ret = OB_SUCCESS;
+  ChildBatchFetcher &fetcher = is_left ? left_fetcher_ : right_fetcher_;
+  const ObIArray<bool> &matched = is_left ? left_matched_ : right_matched_;
+  const int64_t cnt = fetcher.get_group_size();
+  const bool output_matched = is_left ? LEFT_SEMI_JOIN == MY_SPEC.join_type_
+                                      : RIGHT_SEMI_JOIN == MY_SPEC.join_type_;
+  const bool output_unmatched = is_left ? need_left_unmatched() : need_right_unmatched();
+  if (!output_matched && !output_unmatched) {
+    rest_idx_ = cnt;
+  }
+  for (; OB_SUCC(ret) && rest_idx_ < cnt && output_cnt_ < batch_size; rest_idx_++) {
+    const ObCompactRow *row = NULL;
+    if (!(matched.at(rest_idx_) ? output_matched : output_unmatched)) {
+    } else if (OB_FAIL(fetcher.get_group_row(rest_idx_, row))) {
+      LOG_WARN("failed to get group row", K(ret), K(rest_idx_));
+    } else {
+      left_output_rows_[output_cnt_] = is_left ? row : NULL;
+      right_output_rows_[output_cnt_] = is_left ? NULL : row;
+      output_cnt_++;
+    }
+  }
+  done = (rest_idx_ >= cnt);
+  return ret;
+}
+
+// Project the rows in [begin, begin + size) to the exprs of the child, the NULL
+// rows are the blank rows of outer join.
+int ObMergeJoinVecOp::project_rows(const ChildBatchFetcher &fetcher,
+                                   const ObCompactRow **rows,
+                                   const int64_t begin,
+                                   const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  const ExprFixedArray &exprs = fetcher.get_all_exprs();
+  const RowMeta &row_meta = fetcher.get_row_meta();
+  const int64_t end = begin + size;
+  int64_t sel_cnt = 0;
+  for (int64_t i = begin; i < end; i++) {
+    if (NULL != rows[i]) {
+      selector_[sel_cnt] = i;
+      selected_rows_[sel_cnt] = rows[i];
+      sel_cnt++;
+    }
+  }
+  for (int64_t col_idx = 0; OB_SUCC(ret) && col_idx < exprs.count(); col_idx++) {
+    ObExpr *expr = exprs.at(col_idx);
+    ObIVector *vec = NULL;
+    if (OB_UNLIKELY(expr->is_const_expr())) {
+      continue;
+    } else if (OB_FAIL(expr->init_vector_default(eval_ctx_, end))) {
+      LOG_WARN("fail to init vector", K(ret));
+    } else if (FALSE_IT(vec = expr->get_vector(eval_ctx_))) {
+    } else if (sel_cnt > 0
+               && OB_FAIL(vec->from_rows(row_meta, selected_rows_, selector_, sel_cnt, col_idx))) {
+      LOG_WARN("fail to set rows to vector", K(ret), K(col_idx), KPC(expr));
+    } else {
+      if (sel_cnt < size) {
+        for (int64_t i = begin; i < end; i++) {
+          if (NULL == rows[i]) {
+            vec->set_null(i);
+          }
+        }
+      }
+      expr->set_evaluated_projected(eval_ctx_);
+    }
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
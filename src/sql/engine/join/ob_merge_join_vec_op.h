@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_JOIN_OB_MERGE_JOIN_VEC_OP_
+#define OCEANBASE_SQL_ENGINE_JOIN_OB_MERGE_JOIN_VEC_OP_
+
+#include "sql/engine/join/ob_join_vec_op.h"
+#include "sql/engine/basic/ob_temp_row_store.h"
+#include "sql/engine/ob_sql_mem_mgr_processor.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+class ObMergeJoinVecSpec: public ObJoinVecSpec
+{
+  OB_UNIS_VERSION_V(1);
+public:
+  struct EqualConditionInfo {
+    OB_UNIS_VERSION(1);
+  public:
+    EqualConditionInfo()
+      : expr_(NULL), ns_cmp_func_(NULL), is_opposite_(false)
+    {}
+    TO_STRING_KV(K(expr_), KP(ns_cmp_func_), K(is_opposite_));
+    inline ObExpr *get_left_expr() const
+    { return is_opposite_ ? expr_->args_[1] : expr_->args_[0]; }
+    inline ObExpr *get_right_expr() const
+    { return is_opposite_ ? expr_->args_[0] : expr_->args_[1]; }
+
+    ObExpr *expr_;
+    // compares the key of the left child with the key of the right child
+    union {
+      NullSafeRowCmpFunc ns_cmp_func_;
+      sql::serializable_function ser_cmp_func_;
+    };
+    // is_opposite_ is true if args_[0] of the equal condition comes from the
+    // right child and args_[1] comes from the left child
+    bool is_opposite_;
+  };
+
+public:
+  ObMergeJoinVecSpec(common::ObIAllocator &alloc, const ObPhyOperatorType type)
+    : ObJoinVecSpec(alloc, type),
+      equal_cond_infos_(alloc),
+      merge_directions_(alloc),
+      left_child_fetcher_all_exprs_(alloc),
+      right_child_fetcher_all_exprs_(alloc)
+  {}
+  virtual ~ObMergeJoinVecSpec() {}
+
+  int set_merge_directions(const common::ObIArray<ObOrderDirection> &merge_directions);
+
+private:
+  static const int64_t MERGE_DIRECTION_ASC;
+  static const int64_t MERGE_DIRECTION_DESC;
+
+public:
+  common::ObFixedArray<EqualConditionInfo, common::ObIAllocator> equal_cond_infos_;
+  common::ObFixedArray<int64_t, common::ObIAllocator> merge_directions_;
+  // the output of the child and the join keys from the child
+  ExprFixedArray left_child_fetcher_all_exprs_;
+  ExprFixedArray right_child_fetcher_all_exprs_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObMergeJoinVecSpec);
+};
+
+// ObMergeJoinVecOp is the merge join of vectorization 2.0.
+//
+// The batches of each child are copied into a row store, and the rows are split
+// into groups with the same join keys by comparing the adjacent rows of the key
+// vectors. The groups of the two children are then merged at group granularity:
+// the join keys are compared once per group, and the rows of two equal groups
+// are joined in batches, which are filtered by the other join conditions with
+// vector evaluation.
+//
+// The row stores are registered to the sql memory manager. If the rows kept in
+// memory exceed the memory bound, the stores are dumped, and the rows are read
+// back by the random access readers of the stores, which hold the loaded blocks
+// until the next output batch.
+class ObMergeJoinVecOp: public ObJoinVecOp
+{
+private:
+  enum ObJoinState {
+    JS_JOIN_BEGIN = 0,
+    JS_COMPARE,
+    JS_LEFT_UNMATCHED,
+    JS_RIGHT_UNMATCHED,
+    JS_JOIN_GROUP,
+    JS_GROUP_LEFT_REST,
+    JS_GROUP_RIGHT_REST,
+    JS_JOIN_END
+  };
+
+  // ChildBatchFetcher keeps the fetched rows of a child, and returns them as
+  // ranges of rows with the same join keys.
+  class ChildBatchFetcher
+  {
+  public:
+    typedef common::ObSEArray<const ObCompactRow *, 16> RowArray;
+    typedef common::ObSEArray<bool, 16> FlagArray;
+    ChildBatchFetcher(ObMergeJoinVecOp &join_op)
+      : join_op_(join_op), eval_ctx_(join_op.eval_ctx_), child_(NULL), all_exprs_(NULL),
+        key_exprs_(), key_idxs_(), cur_store_(0), stored_rows_(NULL), selector_(NULL),
+        rows_(), group_starts_(), cur_(0), group_begin_(0), group_end_(0), iter_end_(false)
+    {}
+    ~ChildBatchFetcher() { destroy(); }
+    int init(ObOperator &child,
+             const ExprFixedArray &all_exprs,
+             const ObMergeJoinVecSpec &spec,
+             const bool is_left,
+             const lib::ObMemAttr &mem_attr,
+             lib::MemoryContext &mem_context);
+    void reset();
+    void destroy();
+    // the next group can be found without fetching new batches from the child
+    bool has_next_group_in_memory() const;
+    int get_next_group();
+    inline bool has_group() const { return group_end_ > group_begin_; }
+    inline int64_t get_group_size() const { return group_end_ - group_begin_; }
+    inline int get_group_row(const int64_t idx, const ObCompactRow *&row)
+    { return get_row(group_begin_ + idx, row); }
+    inline int64_t get_key_idx(const int64_t key) const { return key_idxs_.at(key); }
+    inline const RowMeta &get_row_meta() const { return stores_[cur_store_].get_row_meta(); }
+    inline const ExprFixedArray &get_all_exprs() const { return *all_exprs_; }
+    inline int64_t get_row_cnt_in_memory() const
+    { return stores_[cur_store_].get_row_cnt_in_memory(); }
+    // dump the blocks of the current store except the one being written
+    int dump();
+  private:
+    int get_row(const int64_t idx, const ObCompactRow *&row);
+    int recycle_store();
+    int fetch_batch();
+    int calc_group_starts(const ObBatchRows &brs, const int64_t start_pos);
+  private:
+    static const int64_t STORE_CNT = 2;
+    ObMergeJoinVecOp &join_op_;
+    ObEvalCtx &eval_ctx_;
+    ObOperator *child_;
+    const ExprFixedArray *all_exprs_;
+    common::ObSEArray<ObExpr *, 4> key_exprs_;
+    // the column index of the join keys in all_exprs_
+    common::ObSEArray<int64_t, 4> key_idxs_;
+    // the rows are kept in one of the stores, and the rows of the unfinished
+    // group are moved to the other one when the store is recycled
+    ObRATempRowStore stores_[STORE_CNT];
+    // the readers must be destroyed before the stores
+    ObRATempRowStore::RAReader readers_[STORE_CNT];
+    int64_t cur_store_;
+    ObCompactRow **stored_rows_;
+    // the positions of the active rows in the fetched batch
+    uint16_t *selector_;
+    // the stored rows of the current store, they are read by the reader instead
+    // once the store is dumped
+    RowArray rows_;
+    // whether the row starts a new group
+    FlagArray group_starts_;
+    int64_t cur_;
+    int64_t group_begin_;
+    int64_t group_end_;
+    bool iter_end_;
+    DISALLOW_COPY_AND_ASSIGN(ChildBatchFetcher);
+  };
+
+public:
+  ObMergeJoinVecOp(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOpInput *input);
+  virtual ~ObMergeJoinVecOp() {}
+
+  virtual int inner_open() override;
+  virtual int inner_rescan() override;
+  virtual int inner_get_next_row() override { return common::OB_NOT_IMPLEMENT; }
+  virtual int inner_get_next_batch(const int64_t max_row_cnt) override;
+  virtual int inner_close() override;
+  virtual void destroy() override;
+
+private:
+  void reset();
+  int init_mem_context();
+  int process_dump();
+  int compare_groups(int &cmp);
+  int begin_join_group();
+  int join_group(const int64_t batch_size);
+  int calc_other_conds_batch(const int64_t begin, const int64_t size);
+  int output_unmatched_rows(const bool is_left, const int64_t batch_size, bool &done);
+  int output_group_rest_rows(const bool is_left, const int64_t batch_size, bool &done);
+  int project_rows(const ChildBatchFetcher &fetcher,
+                   const ObCompactRow **rows,
+                   const int64_t begin,
+                   const int64_t size);
+  inline bool is_left_semi_anti() const
+  { return LEFT_SEMI_JOIN == MY_SPEC.join_type_ || LEFT_ANTI_JOIN == MY_SPEC.join_type_; }
+  inline bool is_right_semi_anti() const
+  { return RIGHT_SEMI_JOIN == MY_SPEC.join_type_ || RIGHT_ANTI_JOIN == MY_SPEC.join_type_; }
+  // the matched rows of an equal group are output in pairs
+  inline bool output_matched_pairs() const
+  { return !is_left_semi_anti() && !is_right_semi_anti(); }
+  inline bool need_left_unmatched() const
+  { return need_left_join() || LEFT_ANTI_JOIN == MY_SPEC.join_type_; }
+  inline bool need_right_unmatched() const
+  { return need_right_join() || RIGHT_ANTI_JOIN == MY_SPEC.join_type_; }
+
+private:
+  ObJoinState state_;
+  lib::MemoryContext mem_context_;
+  ObSqlWorkAreaProfile profile_;
+  ObSqlMemMgrProcessor sql_mem_processor_;
+  // the blocks loaded by the readers of the stores are kept until the output
+  // batch is returned
+  ObTempBlockStore::IterationAge iter_age_;
+  ChildBatchFetcher left_fetcher_;
+  ChildBatchFetcher right_fetcher_;
+  bool need_left_group_;
+  bool need_right_group_;
+  // the rows of the output batch, NULL means the blank row of the child
+  const ObCompactRow **left_output_rows_;
+  const ObCompactRow **right_output_rows_;
+  int64_t output_cnt_;
+  // the position of the current row pair of the equal groups
+  int64_t left_group_idx_;
+  int64_t right_group_idx_;
+  int64_t *left_cand_idxs_;
+  int64_t *right_cand_idxs_;
+  common::ObSEArray<bool, 16> left_matched_;
+  common::ObSEArray<bool, 16> right_matched_;
+  // right semi and anti join stop joining the group once all right rows are matched
+  int64_t right_matched_cnt_;
+  // the position of the next row to output of the unmatched group or the rest
+  // rows of the equal groups
+  int64_t rest_idx_;
+  ObBitVector *cond_skip_;
+  uint16_t *selector_;
+  const ObCompactRow **selected_rows_;
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+#endif // OCEANBASE_SQL_ENGINE_JOIN_OB_MERGE_JOIN_VEC_OP_
@@ -0,0 +1,675 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/join/ob_nested_loop_join_vec_op.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/basic/ob_material_op.h"
+#include "sql/engine/basic/ob_material_vec_op.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+OB_SERIALIZE_MEMBER((ObNestedLoopJoinVecSpec, ObJoinVecSpec),
+                    rescan_params_,
+                    gi_partition_id_expr_,
+                    enable_gi_partition_pruning_,
+                    group_rescan_,
+                    group_size_,
+                    left_rescan_params_,
+                    right_rescan_params_);
+
+ObNestedLoopJoinVecOp::ObNestedLoopJoinVecOp(ObExecContext &exec_ctx,
+                                             const ObOpSpec &spec,
+                                             ObOpInput *input)
+  : ObJoinVecOp(exec_ctx, spec, input),
+    batch_state_(JS_FILL_LEFT), mem_context_(nullptr), defered_right_rescan_(false),
+    iter_end_(false), op_max_batch_size_(0), max_group_size_(OB_MAX_BULK_JOIN_ROWS),
+    group_join_buffer_(), left_store_(), stored_rows_(nullptr), left_rows_(nullptr),
+    left_size_(0), is_left_end_(false), dup_rows_(nullptr), selector_(nullptr),
+    left_matched_(nullptr), cond_skip_(nullptr), l_idx_(0), match_right_batch_end_(false),
+    no_match_row_found_(true), need_output_row_(false)
+{
+}
+
+int ObNestedLoopJoinVecOp::inner_open()
+{
+  int ret = OB_SUCCESS;
+  const int64_t batch_size = MY_SPEC.max_batch_size_;
+  int64_t simulate_group_size = - EVENT_CALL(EventTable::EN_DAS_SIMULATE_GROUP_SIZE);
+  int64_t group_size = MY_SPEC.group_size_;
+  if (OB_ISNULL(left_) || OB_ISNULL(right_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("nlp_op child is null", KP(left_), KP(right_), K(ret));
+  } else if (OB_FAIL(ObJoinVecOp::inner_open())) {
+    LOG_WARN("failed to open in base class", K(ret));
+  } else if (OB_FAIL(init_mem_context())) {
+    LOG_WARN("failed to init mem context", K(ret));
+  } else {
+    if (simulate_group_size > 0) {
+      group_size = simulate_group_size;
+      LOG_TRACE("simulate group size is", K(simulate_group_size));
+    }
+    if (MY_SPEC.group_rescan_) {
+      max_group_size_ = group_size + MY_SPEC.plan_->get_batch_size();
+      LOG_TRACE("max group size of NLJ is", K(max_group_size_), K(MY_SPEC.plan_->get_batch_size()));
+    }
+    const uint64_t tenant_id = ctx_.get_my_session()->get_effective_tenant_id();
+    ObMemAttr mem_attr(tenant_id, ObModIds::OB_SQL_NLJ_CACHE, ObCtxIds::WORK_AREA);
+    ObIAllocator &alloc = mem_context_->get_arena_allocator();
+    void *matched_buf = nullptr;
+    void *skip_buf = nullptr;
+    if (OB_FAIL(left_store_.init(left_->get_spec().output_,
+                                 batch_size,
+                                 mem_attr,
+                                 0 /*mem_limit*/,
+                                 false /*enable_dump*/,
+                                 0 /*row_extra_size*/,
+                                 MY_SPEC.compress_type_))) {
+      LOG_WARN("init left row store failed", K(ret));
+    } else if (FALSE_IT(left_store_.set_allocator(mem_context_->get_malloc_allocator()))) {
+    } else if (OB_ISNULL(stored_rows_ = static_cast<ObCompactRow **>(
+                         alloc.alloc(sizeof(*stored_rows_) * batch_size)))
+               || OB_ISNULL(left_rows_ = static_cast<const ObCompactRow **>(
+                            alloc.alloc(sizeof(*left_rows_) * batch_size)))
+               || OB_ISNULL(dup_rows_ = static_cast<const ObCompactRow **>(
+                            alloc.alloc(sizeof(*dup_rows_) * batch_size)))
+               || OB_ISNULL(selector_ = static_cast<uint16_t *>(
+                            alloc.alloc(sizeof(*selector_) * batch_size)))
+               || OB_ISNULL(matched_buf = alloc.alloc(ObBitVector::memory_size(batch_size)))
+               || OB_ISNULL(skip_buf = alloc.alloc(ObBitVector::memory_size(batch_size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc memory", K(ret), K(batch_size));
+    } else {
+      left_matched_ = to_bit_vector(matched_buf);
+      left_matched_->reset(batch_size);
+      cond_skip_ = to_bit_vector(skip_buf);
+      cond_skip_->reset(batch_size);
+    }
+  }
+  if (OB_SUCC(ret) && MY_SPEC.group_rescan_) {
+    if (OB_FAIL(group_join_buffer_.init(this,
+                                        max_group_size_,
+                                        group_size,
+                                        &MY_SPEC.rescan_params_,
+                                        &MY_SPEC.left_rescan_params_,
+                                        &MY_SPEC.right_rescan_params_))) {
+      LOG_WARN("init batch info failed", KR(ret));
+    }
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::init_mem_context()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(mem_context_)) {
+    ObSQLSessionInfo *session = ctx_.get_my_session();
+    uint64_t tenant_id = session->get_effective_tenant_id();
+    lib::ContextParam param;
+    param.set_mem_attr(tenant_id,
+                       ObModIds::OB_SQL_NLJ_CACHE,
+                       ObCtxIds::WORK_AREA)
+      .set_properties(lib::USE_TL_PAGE_OPTIONAL);
+    if (OB_FAIL(CURRENT_CONTEXT->CREATE_CONTEXT(mem_context_, param))) {
+      LOG_WARN("create entity failed", K(ret));
+    } else if (OB_ISNULL(mem_context_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("null memory entity returned", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::rescan()
+{
+  int ret = OB_SUCCESS;
+  //NLJ's rescan should only drive left child's rescan,
+  //the right child's rescan is defer to rescan_right_operator() driven by get_next_batch();
+  defered_right_rescan_ = true;
+  if (!MY_SPEC.group_rescan_) {
+    if (OB_FAIL(left_->rescan())) {
+      LOG_WARN("rescan left child operator failed", KR(ret), "child op_type", left_->op_name());
+    } else if (OB_FAIL(inner_rescan())) {
+      LOG_WARN("failed to inner rescan", KR(ret));
+    }
+  } else {
+    if (OB_FAIL(group_join_buffer_.init_above_group_params())) {
+      LOG_WARN("init above bnlj params failed", KR(ret));
+    } else if (OB_FAIL(group_join_buffer_.rescan_left())) {
+      LOG_WARN("rescan left failed", KR(ret));
+    } else if (OB_FAIL(inner_rescan())) {
+      LOG_WARN("inner rescan failed", KR(ret));
+    }
+  }
+
+#ifndef NDEBUG
+  OX(OB_ASSERT(false == brs_.end_));
+#endif
+
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::inner_rescan()
+{
+  int ret = OB_SUCCESS;
+  reset_buf_state();
+  set_param_null();
+  if (OB_FAIL(ObJoinVecOp::inner_rescan())) {
+    LOG_WARN("failed to rescan", K(ret));
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::inner_close()
+{
+  reset_buf_state();
+  left_store_.reset();
+  return ObJoinVecOp::inner_close();
+}
+
+void ObNestedLoopJoinVecOp::destroy()
+{
+  left_store_.reset();
+  if (MY_SPEC.group_rescan_) {
+    group_join_buffer_.destroy();
+  }
+  if (nullptr != mem_context_) {
+    DESTROY_CONTEXT(mem_context_);
+    mem_context_ = nullptr;
+  }
+  ObJoinVecOp::destroy();
+}
+
+void ObNestedLoopJoinVecOp::reset_buf_state()
+{
+  batch_state_ = JS_FILL_LEFT;
+  iter_end_ = false;
+  left_store_.reuse();
+  left_size_ = 0;
+  is_left_end_ = false;
+  l_idx_ = 0;
+  match_right_batch_end_ = false;
+  no_match_row_found_ = true;
+  need_output_row_ = false;
+}
+
+int ObNestedLoopJoinVecOp::do_drain_exch_multi_lvel_bnlj()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(try_open())) {
+    LOG_WARN("fail to open operator", K(ret));
+  } else if (!exch_drained_) {
+    // the drain request is triggered by current NLJ operator, and current NLJ is a multi level Batch NLJ
+    // It will block rescan request for it's child operator, if the drain request is passed to it's child operator
+    // The child operators will be marked as iter-end_, and will not get any row if rescan is blocked
+    // So we block the drain request here; Only set current operator to end;
+    exch_drained_ = true;
+    brs_.end_ = true;
+    batch_reach_end_ = true;
+    row_reach_end_ = true;
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::do_drain_exch()
+{
+  int ret = OB_SUCCESS;
+  if (!MY_SPEC.group_rescan_ || !group_join_buffer_.is_multi_level()) {
+    if (OB_FAIL(ObOperator::do_drain_exch())) {
+      LOG_WARN("failed to drain NLJ operator", K(ret));
+    }
+  } else if (!is_operator_end()) {
+    // the drain request is triggered by parent operator
+    // NLJ needs to pass the drain request to it's child operator
+    LOG_TRACE("The drain request is passed by parent operator");
+    if (OB_FAIL(ObOperator::do_drain_exch())) {
+      LOG_WARN("failed to drain normal NLJ operator", K(ret));
+    }
+  } else if (OB_FAIL(do_drain_exch_multi_lvel_bnlj())) {
+    LOG_WARN("failed to drain multi level NLJ operator", K(ret));
+  }
+  return ret;
+}
+
+void ObNestedLoopJoinVecOp::set_param_null()
+{
+  set_pushdown_param_null(MY_SPEC.rescan_params_);
+}
+
+int ObNestedLoopJoinVecOp::prepare_rescan_params()
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < MY_SPEC.rescan_params_.count(); ++i) {
+    if (OB_FAIL(MY_SPEC.rescan_params_.at(i).set_dynamic_param(eval_ctx_))) {
+      LOG_WARN("fail to set dynamic param", K(ret));
+    }
+  }
+  // notify the GI of the right child to prune the partitions with the part id of the left row
+  if (OB_SUCC(ret) && MY_SPEC.enable_gi_partition_pruning_) {
+    ObDatum *datum = nullptr;
+    if (OB_FAIL(MY_SPEC.gi_partition_id_expr_->eval(eval_ctx_, datum))) {
+      LOG_WARN("fail eval value", K(ret));
+    } else {
+      ctx_.get_gi_pruning_info().set_part_id(datum->get_int());
+    }
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::rescan_right_operator()
+{
+  int ret = OB_SUCCESS;
+  bool do_rescan = false;
+  if (defered_right_rescan_) {
+    do_rescan = true;
+    defered_right_rescan_ = false;
+  } else if (PHY_MATERIAL == right_->get_spec().type_) {
+    if (OB_FAIL(static_cast<ObMaterialOp*>(right_)->rewind())) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("rewind failed", K(ret));
+      }
+    }
+  } else if (PHY_VEC_MATERIAL == right_->get_spec().type_) {
+    if (OB_FAIL(static_cast<ObMaterialVecOp*>(right_)->rewind())) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("rewind failed", K(ret));
+      }
+    }
+  } else {
+    do_rescan = true;
+  }
+  if (OB_SUCC(ret) && do_rescan) {
+    if (OB_FAIL(right_->rescan())) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("rescan right failed", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::get_left_batch()
+{
+  int ret = OB_SUCCESS;
+  const ObBatchRows *left_brs = nullptr;
+  if (MY_SPEC.group_rescan_) {
+    if (OB_FAIL(group_get_left_batch()) && OB_ITER_END != ret) {
+      LOG_WARN("fail to get left batch", K(ret));
+    }
+  } else {
+    // Reset exec param before get left batch, because the exec param still reference
+    // to the previous row, when get next left batch, it may become wild pointer.
+    set_param_null();
+    if (is_left_end_) {
+      ret = OB_ITER_END;
+    } else if (OB_FAIL(left_->get_next_batch(op_max_batch_size_, left_brs))) {
+      LOG_WARN("fail to get next batch", K(ret));
+    } else if (FALSE_IT(is_left_end_ = left_brs->end_)) {
+    } else if (left_brs->end_ && 0 == left_brs->size_) {
+      ret = OB_ITER_END;
+    } else if (OB_FAIL(save_left_batch(*left_brs))) {
+      LOG_WARN("fail to save left batch", K(ret));
+    }
+  }
+  return ret;
+}
+
+// The left rows of the group are read from the group join buffer as datums, they
+// are exposed as uniform vectors and saved like the batch of the left child.
+int ObNestedLoopJoinVecOp::group_get_left_batch()
+{
+  int ret = OB_SUCCESS;
+  const ObBatchRows *left_brs = nullptr;
+  bool has_next = false;
+  int64_t read_size = 0;
+  if (OB_FAIL(group_join_buffer_.batch_fill_group_buffer(op_max_batch_size_, left_brs))) {
+    if (OB_ITER_END != ret) {
+      LOG_WARN("batch fill group buffer failed", KR(ret));
+    }
+  } else if (OB_FAIL(group_join_buffer_.has_next_left_row(has_next))) {
+    LOG_WARN("check has next failed", KR(ret));
+  } else if (!has_next) {
+    ret = OB_ITER_END;
+  } else if (OB_FAIL(group_join_buffer_.get_next_batch_from_store(op_max_batch_size_,
+                                                                  read_size))) {
+    if (OB_ITER_END != ret) {
+      LOG_WARN("get next batch from store failed", KR(ret));
+    }
+  } else {
+    const ExprFixedArray &left_exprs = left_->get_spec().output_;
+    for (int64_t i = 0; OB_SUCC(ret) && i < left_exprs.count(); i++) {
+      ObExpr *expr = left_exprs.at(i);
+      if (!expr->is_batch_result()) {
+      } else if (OB_FAIL(expr->init_vector(eval_ctx_, VEC_UNIFORM, read_size))) {
+        LOG_WARN("fail to init vector", K(ret), KPC(expr));
+      } else {
+        expr->set_evaluated_projected(eval_ctx_);
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ObBatchRows group_brs;
+      cond_skip_->reset(read_size);
+      group_brs.skip_ = cond_skip_;
+      group_brs.size_ = read_size;
+      group_brs.end_ = false;
+      group_brs.all_rows_active_ = true;
+      if (OB_FAIL(save_left_batch(group_brs))) {
+        LOG_WARN("fail to save left batch", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+// Save the active rows of the left batch to the row store, the rows are kept at
+// their positions in the batch so that the semi and anti join output the left
+// batch in the original order.
+int ObNestedLoopJoinVecOp::save_left_batch(const ObBatchRows &left_brs)
+{
+  int ret = OB_SUCCESS;
+  int64_t stored_cnt = 0;
+  left_store_.reuse();
+  if (OB_FAIL(left_store_.add_batch(left_->get_spec().output_, eval_ctx_, left_brs,
+                                    stored_cnt, stored_rows_))) {
+    LOG_WARN("fail to add left batch", K(ret));
+  } else {
+    for (int64_t i = 0, j = 0; i < left_brs.size_; i++) {
+      left_rows_[i] = left_brs.skip_->at(i) ? nullptr : stored_rows_[j++];
+    }
+    left_size_ = left_brs.size_;
+    left_matched_->reset(left_size_);
+    l_idx_ = 0;
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::rescan_right_op()
+{
+  int ret = OB_SUCCESS;
+  if (MY_SPEC.group_rescan_) {
+    if (OB_FAIL(group_join_buffer_.rescan_right())) {
+      if (OB_ITER_END == ret) {
+        ret = OB_ERR_UNEXPECTED;
+      }
+      LOG_WARN("rescan right failed", KR(ret));
+    } else if (OB_FAIL(group_join_buffer_.fill_cur_row_group_param())) {
+      LOG_WARN("fill group param failed", KR(ret));
+    }
+  } else {
+    // the rescan params are calculated from the left row, which is projected
+    // to the first position of the left exprs
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+    batch_info_guard.set_batch_size(1);
+    batch_info_guard.set_batch_idx(0);
+    clear_evaluated_flag();
+    if (OB_FAIL(project_left_row(l_idx_, 1))) {
+      LOG_WARN("fail to project left row", K(ret));
+    } else if (OB_FAIL(prepare_rescan_params())) {
+      LOG_WARN("failed to prepare rescan params", K(ret));
+    } else if (OB_FAIL(rescan_right_operator())) {
+      LOG_WARN("failed to rescan right op", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::get_next_batch_from_right(const ObBatchRows *&right_brs)
+{
+  int ret = OB_SUCCESS;
+  right_brs = &right_->get_brs();
+  if (!MY_SPEC.group_rescan_) {
+    ret = right_->get_next_batch(op_max_batch_size_, right_brs);
+  } else {
+    ret = group_join_buffer_.get_next_batch_from_right(op_max_batch_size_, right_brs);
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::process_right_batch()
+{
+  int ret = OB_SUCCESS;
+  const ObBatchRows *right_brs = nullptr;
+  reset_batchrows();
+  clear_evaluated_flag();
+  DASGroupScanMarkGuard mark_guard(ctx_.get_das_ctx(), MY_SPEC.group_rescan_);
+  if (OB_FAIL(get_next_batch_from_right(right_brs))) {
+    LOG_WARN("fail to get next right batch", K(ret), K(MY_SPEC));
+  } else if (0 == right_brs->size_ && right_brs->end_) {
+    match_right_batch_end_ = true;
+  } else if (OB_FAIL(project_left_row(l_idx_, right_brs->size_))) {
+    LOG_WARN("fail to project left row", K(ret));
+  } else {
+    brs_.size_ = right_brs->size_;
+    brs_.skip_->deep_copy(*right_brs->skip_, right_brs->size_);
+    if (!MY_SPEC.other_join_conds_.empty() && OB_FAIL(calc_other_conds_batch(right_brs->size_))) {
+      LOG_WARN("fail to calc other join conditions", K(ret));
+    } else {
+      const int64_t match_cnt = brs_.size_ - brs_.skip_->accumulate_bit_cnt(brs_.size_);
+      if (match_cnt > 0) {
+        if (is_left_semi_anti()) {
+          left_matched_->set(l_idx_);
+          match_right_batch_end_ = true;
+        } else {
+          need_output_row_ = true;
+          no_match_row_found_ = false;
+        }
+      }
+      match_right_batch_end_ = match_right_batch_end_ || right_brs->end_;
+    }
+  }
+  // outer join
+  if (OB_SUCC(ret) && match_right_batch_end_ && no_match_row_found_ && need_left_join()) {
+    need_output_row_ = true;
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::calc_other_conds_batch(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  const ObIArray<ObExpr *> &conds = MY_SPEC.other_join_conds_;
+  ARRAY_FOREACH(conds, i) {
+    ObExpr *cond = conds.at(i);
+    ObIVector *res = nullptr;
+    if (OB_FAIL(cond->eval_vector(eval_ctx_, *brs_.skip_, EvalBound(size, false)))) {
+      LOG_WARN("fail to calc other join condition", K(ret), KPC(cond));
+    } else {
+      res = cond->get_vector(eval_ctx_);
+      for (int64_t j = 0; j < size; j++) {
+        if (!brs_.skip_->at(j) && !res->is_true(j)) {
+          brs_.skip_->set(j);
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+// broadcast the left row to [0, size) of the left exprs
+int ObNestedLoopJoinVecOp::project_left_row(const int64_t l_idx, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  const ExprFixedArray &left_exprs = left_->get_spec().output_;
+  const RowMeta &row_meta = left_store_.get_row_meta();
+  for (int64_t i = 0; i < size; i++) {
+    dup_rows_[i] = left_rows_[l_idx];
+  }
+  for (int64_t col_idx = 0; OB_SUCC(ret) && col_idx < left_exprs.count(); col_idx++) {
+    ObExpr *expr = left_exprs.at(col_idx);
+    if (OB_UNLIKELY(expr->is_const_expr())) {
+    } else if (OB_FAIL(expr->init_vector_default(eval_ctx_, size))) {
+      LOG_WARN("fail to init vector", K(ret));
+    } else if (OB_FAIL(expr->get_vector(eval_ctx_)->from_rows(row_meta, dup_rows_, size,
+                                                              col_idx))) {
+      LOG_WARN("fail to set left row to vector", K(ret), K(col_idx), KPC(expr));
+    } else {
+      expr->set_evaluated_projected(eval_ctx_);
+    }
+  }
+  return ret;
+}
+
+// project the left batch back to the left exprs for semi and anti join
+int ObNestedLoopJoinVecOp::project_left_batch()
+{
+  int ret = OB_SUCCESS;
+  const ExprFixedArray &left_exprs = left_->get_spec().output_;
+  const RowMeta &row_meta = left_store_.get_row_meta();
+  int64_t sel_cnt = 0;
+  for (int64_t i = 0; i < left_size_; i++) {
+    if (nullptr != left_rows_[i]) {
+      selector_[sel_cnt] = i;
+      dup_rows_[sel_cnt] = left_rows_[i];
+      sel_cnt++;
+    }
+  }
+  for (int64_t col_idx = 0; OB_SUCC(ret) && col_idx < left_exprs.count(); col_idx++) {
+    ObExpr *expr = left_exprs.at(col_idx);
+    if (OB_UNLIKELY(expr->is_const_expr())) {
+    } else if (OB_FAIL(expr->init_vector_default(eval_ctx_, left_size_))) {
+      LOG_WARN("fail to init vector", K(ret));
+    } else if (sel_cnt > 0
+               && OB_FAIL(expr->get_vector(eval_ctx_)->from_rows(row_meta, dup_rows_, selector_,
+                                                                 sel_cnt, col_idx))) {
+      LOG_WARN("fail to set left rows to vector", K(ret), K(col_idx), KPC(expr));
+    } else {
+      expr->set_evaluated_projected(eval_ctx_);
+    }
+  }
+  return ret;
+}
+
+int ObNestedLoopJoinVecOp::output()
+{
+  int ret = OB_SUCCESS;
+  if (is_left_semi_anti()) {
+    reset_batchrows();
+    clear_evaluated_flag();
+    if (OB_FAIL(project_left_batch())) {
+      LOG_WARN("fail to project left batch", K(ret));
+    } else {
+      const bool is_semi = (LEFT_SEMI_JOIN == MY_SPEC.join_type_);
+      for (int64_t i = 0; i < left_size_; i++) {
+        if (nullptr == left_rows_[i] || is_semi != left_matched_->at(i)) {
+          brs_.skip_->set(i);
+        }
+      }
+      brs_.size_ = left_size_;
+      left_matched_->reset(left_size_);
+    }
+  } else if (match_right_batch_end_ && no_match_row_found_ && need_left_join()) {
+    // outer join: generate a blank row for LEFT OUTER JOIN
+    // Note: optimizer guarantee there is NO RIGHT/FULL OUTER JOIN for NLJ
+    reset_batchrows();
+    clear_evaluated_flag();
+    if (OB_FAIL(blank_row_batch(right_->get_spec().output_, 1))) {
+      LOG_WARN("fail to blank right row", K(ret));
+    } else if (OB_FAIL(project_left_row(l_idx_, 1))) {
+      LOG_WARN("fail to project left row", K(ret));
+    } else {
+      brs_.size_ = 1;
+    }
+  } else {
+    // the joined rows of the right batch are in place
+  }
+  return ret;
+}
+
+void ObNestedLoopJoinVecOp::reset_right_batch_state()
+{
+  match_right_batch_end_ = false;
+  l_idx_++;
+  no_match_row_found_ = true;
+}
+
+void ObNestedLoopJoinVecOp::skip_l_idx()
+{
+  while (l_idx_ < left_size_ && nullptr == left_rows_[l_idx_]) {
+    l_idx_++;
+  }
+}
+
+int ObNestedLoopJoinVecOp::inner_get_next_batch(const int64_t max_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (iter_end_) {
+    brs_.size_ = 0;
+    brs_.end_ = true;
+  }
+  op_max_batch_size_ = min(max_row_cnt, MY_SPEC.max_batch_size_);
+  while (!iter_end_ && OB_SUCC(ret)) {
+    clear_evaluated_flag();
+    if (JS_FILL_LEFT == batch_state_) {
+      if (OB_FAIL(get_left_batch())) {
+        if (OB_ITER_END == ret) {
+          ret = OB_SUCCESS;
+          brs_.size_ = 0;
+          brs_.end_ = true;
+          iter_end_ = true;
+        } else {
+          LOG_WARN("fail to get left batch", K(ret));
+        }
+      } else {
+        batch_state_ = JS_RESCAN_RIGHT_OP;
+      }
+    }
+    if (OB_SUCC(ret) && JS_RESCAN_RIGHT_OP == batch_state_) {
+      skip_l_idx();
+      if (l_idx_ >= left_size_) {
+        batch_state_ = is_left_semi_anti() ? JS_OUTPUT : JS_FILL_LEFT;
+        l_idx_ = 0;
+      } else if (OB_FAIL(rescan_right_op())) {
+        LOG_WARN("fail to rescan right op", K(ret));
+      } else {
+        batch_state_ = JS_PROCESS_RIGHT_BATCH;
+      }
+    }
+    if (OB_SUCC(ret) && JS_PROCESS_RIGHT_BATCH == batch_state_) {
+      if (OB_FAIL(process_right_batch())) {
+        LOG_WARN("fail to process right batch", K(ret));
+      } else if (need_output_row_) {
+        batch_state_ = JS_OUTPUT;
+        need_output_row_ = false;
+      } else if (match_right_batch_end_) {
+        batch_state_ = JS_RESCAN_RIGHT_OP;
+        reset_right_batch_state();
+      }
+    }
+    if (OB_SUCC(ret) && JS_OUTPUT == batch_state_) {
+      if (OB_FAIL(output())) {
+        LOG_WARN("fail to output", K(ret));
+      } else {
+        if (is_left_semi_anti()) {
+          batch_state_ = JS_FILL_LEFT;
+        } else if (match_right_batch_end_) {
+          batch_state_ = JS_RESCAN_RIGHT_OP;
+          reset_right_batch_state();
+        } else {
+          batch_state_ = JS_PROCESS_RIGHT_BATCH;
+        }
+        break;
+      }
+    }
+  }
+  if (OB_SUCC(ret) && iter_end_) {
+    set_param_null();
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_JOIN_OB_NESTED_LOOP_JOIN_VEC_OP_
+#define OCEANBASE_SQL_ENGINE_JOIN_OB_NESTED_LOOP_JOIN_VEC_OP_
+
+#include "sql/engine/join/ob_join_vec_op.h"
+#include "sql/engine/basic/ob_temp_row_store.h"
+#include "sql/engine/basic/ob_group_join_buffer.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+class ObNestedLoopJoinVecSpec : public ObJoinVecSpec
+{
+  OB_UNIS_VERSION_V(1);
+public:
+  ObNestedLoopJoinVecSpec(common::ObIAllocator &alloc, const ObPhyOperatorType type)
+    : ObJoinVecSpec(alloc, type),
+      rescan_params_(alloc),
+      gi_partition_id_expr_(nullptr),
+      enable_gi_partition_pruning_(false),
+      group_rescan_(false),
+      group_size_(OB_MAX_BULK_JOIN_ROWS),
+      left_rescan_params_(alloc),
+      right_rescan_params_(alloc)
+  {}
+
+public:
+  common::ObFixedArray<ObDynamicParamSetter, common::ObIAllocator> rescan_params_;
+  // the partition id of the left row, which is used to prune the partitions of the right child
+  ObExpr *gi_partition_id_expr_;
+  bool enable_gi_partition_pruning_;
+  // for group join buffer
+  bool group_rescan_;
+  int64_t group_size_;
+  // for multi level batch rescan, see ObNestedLoopJoinSpec
+  common::ObFixedArray<ObDynamicParamSetter, common::ObIAllocator> left_rescan_params_;
+  common::ObFixedArray<ObDynamicParamSetter, common::ObIAllocator> right_rescan_params_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObNestedLoopJoinVecSpec);
+};
+
+// ObNestedLoopJoinVecOp is the nested loop join of vectorization 2.0.
+//
+// The left batch is kept in a row store. With group rescan, the left rows are
+// buffered by ObGroupJoinBufffer, which pushes the rescan params of the whole
+// group down to DAS as one multi-range scan, and the right batches of each left
+// row are read by the group id. The left row is broadcast to the vectors of the
+// right batch, and the other join conditions are evaluated with vectors.
+class ObNestedLoopJoinVecOp : public ObJoinVecOp
+{
+public:
+  enum ObJoinBatchState {
+    JS_FILL_LEFT = 0,
+    JS_RESCAN_RIGHT_OP,
+    JS_PROCESS_RIGHT_BATCH,
+    JS_OUTPUT
+  };
+
+  ObNestedLoopJoinVecOp(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOpInput *input);
+  virtual ~ObNestedLoopJoinVecOp() {}
+
+  virtual int inner_open() override;
+  virtual int rescan() override;
+  virtual int inner_rescan() override;
+  virtual int inner_get_next_row() override { return common::OB_NOT_IMPLEMENT; }
+  virtual int inner_get_next_batch(const int64_t max_row_cnt) override;
+  virtual int inner_close() override;
+  virtual void destroy() override;
+  virtual OperatorOpenOrder get_operator_open_order() const override final
+  { return OPEN_SELF_FIRST; }
+
+private:
+  void reset_buf_state();
+  int init_mem_context();
+  void set_param_null();
+  int prepare_rescan_params();
+  int rescan_right_operator();
+  int get_left_batch();
+  int group_get_left_batch();
+  int save_left_batch(const ObBatchRows &left_brs);
+  int rescan_right_op();
+  int process_right_batch();
+  int calc_other_conds_batch(const int64_t size);
+  int output();
+  int project_left_row(const int64_t l_idx, const int64_t size);
+  int project_left_batch();
+  void reset_right_batch_state();
+  void skip_l_idx();
+  int get_next_batch_from_right(const ObBatchRows *&right_brs);
+  virtual int do_drain_exch() override;
+  int do_drain_exch_multi_lvel_bnlj();
+  inline bool is_left_semi_anti() const
+  { return LEFT_SEMI_JOIN == MY_SPEC.join_type_ || LEFT_ANTI_JOIN == MY_SPEC.join_type_; }
+
+private:
+  ObJoinBatchState batch_state_;
+  lib::MemoryContext mem_context_;
+  bool defered_right_rescan_;
+  bool iter_end_;
+  int64_t op_max_batch_size_;
+  int64_t max_group_size_;
+  ObGroupJoinBufffer group_join_buffer_;
+  // the left batch, the rows are kept at their positions in the batch and the
+  // skipped positions are NULL
+  ObTempRowStore left_store_;
+  ObCompactRow **stored_rows_;
+  const ObCompactRow **left_rows_;
+  int64_t left_size_;
+  bool is_left_end_;
+  // the left row broadcast to the right batch
+  const ObCompactRow **dup_rows_;
+  uint16_t *selector_;
+  ObBitVector *left_matched_;
+  ObBitVector *cond_skip_;
+  int64_t l_idx_;
+  bool match_right_batch_end_;
+  bool no_match_row_found_;
+  bool need_output_row_;
+  DISALLOW_COPY_AND_ASSIGN(ObNestedLoopJoinVecOp);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+#endif // OCEANBASE_SQL_ENGINE_JOIN_OB_NESTED_LOOP_JOIN_VEC_OP_
@@ -34,6 +34,7 @@
 #include "sql/spm/ob_spm_evolution_plan.h"
 #include "sql/engine/ob_exec_feedback_info.h"
 #include "sql/engine/expr/ob_expr_sql_udt_utils.h"
+#include "sql/engine/expr/ob_expr_jit.h"
 
 namespace oceanbase
 {
@@ -145,7 +146,9 @@ ObPhysicalPlan::ObPhysicalPlan(MemoryContext &mem_context /* = CURRENT_CONTEXT *
     online_sample_percent_(1.),
     can_set_feedback_info_(true),
     need_switch_to_table_lock_worker_(false),
-    data_complement_gen_doc_id_(false)
+    data_complement_gen_doc_id_(false),
+    expr_jit_ctx_(NULL),
+    expr_jit_checked_(false)
 {
 }
 
@@ -250,12 +253,15 @@ void ObPhysicalPlan::reset()
   can_set_feedback_info_.store(true);
   need_switch_to_table_lock_worker_ = false;
   data_complement_gen_doc_id_ = false;
+  ObExprJit::destroy_ctx(expr_jit_ctx_);
+  expr_jit_checked_ = false;
 }
 void ObPhysicalPlan::destroy()
 {
 #ifndef NDEBUG
   bit_set_.reset();
 #endif
+  ObExprJit::destroy_ctx(expr_jit_ctx_);
   sql_expression_factory_.destroy();
   expr_op_factory_.destroy();
   stat_.expected_worker_map_.destroy();
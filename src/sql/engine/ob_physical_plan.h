@@ -54,6 +54,7 @@ class ObPhyOperatorMonnitorInfo;
 struct ObAuditRecordData;
 class ObOpSpec;
 class ObEvolutionPlan;
+class ObExprJitCtx;
 
 //class ObPhysicalPlan: public common::ObDLinkBase<ObPhysicalPlan>
 typedef common::ObFixedArray<common::ObFixedArray<int64_t, common::ObIAllocator>, common::ObIAllocator> PhyRowParamMap;
@@ -353,6 +354,10 @@ public:
   inline bool get_is_insert_overwrite() const { return insert_overwrite_; }
   inline void set_use_rich_format(const bool v) { use_rich_format_ = v; }
   inline bool get_use_rich_format() const { return use_rich_format_; }
+  inline ObExprJitCtx *get_expr_jit_ctx() const { return expr_jit_ctx_; }
+  inline void set_expr_jit_ctx(ObExprJitCtx *jit_ctx) { expr_jit_ctx_ = jit_ctx; }
+  inline bool is_expr_jit_checked() const { return expr_jit_checked_; }
+  inline void set_expr_jit_checked(const bool v) { expr_jit_checked_ = v; }
   inline uint64_t get_append_table_id() const { return append_table_id_; }
   void set_record_plan_info(bool v) { need_record_plan_info_ = v; }
   bool need_record_plan_info() const { return need_record_plan_info_; }
@@ -712,6 +717,9 @@ private:
   std::atomic<bool> can_set_feedback_info_;
   bool need_switch_to_table_lock_worker_; // for table lock switch worker thread
   bool data_complement_gen_doc_id_;
+  // the compiled expression trees of the hot plan, not serialized
+  ObExprJitCtx *expr_jit_ctx_;
+  bool expr_jit_checked_;
 };
 
 inline void ObPhysicalPlan::set_affected_last_insert_id(bool affected_last_insert_id)
@@ -13,6 +13,7 @@
 #ifndef OB_SQL_MEM_MGR_PROCESSOR_H
 #define OB_SQL_MEM_MGR_PROCESSOR_H
 
+#include "lib/stat/ob_diagnose_info.h"
 #include "share/rc/ob_tenant_base.h"
 #include "ob_tenant_sql_memory_manager.h"
 #include "sql/engine/basic/ob_chunk_row_store.h"
@@ -29,7 +30,7 @@ public:
     profile_(profile), op_monitor_info_(&op_monitor_info),
     sql_mem_mgr_(nullptr), mem_callback_(nullptr), tenant_id_(OB_INVALID_ID),
     periodic_cnt_(1024), origin_max_mem_size_(0), default_available_mem_size_(0),
-    is_auto_mgr_(false), dir_id_(0),
+    is_auto_mgr_(false), dir_id_(0), compress_raw_size_(0), compressed_size_(0),
     dummy_ptr_(nullptr), dummy_alloc_(nullptr)
   {
     // trace memory dump
@@ -40,7 +41,7 @@ public:
     profile_(profile), op_monitor_info_(nullptr),
     sql_mem_mgr_(nullptr), mem_callback_(nullptr), tenant_id_(OB_INVALID_ID),
     periodic_cnt_(1024), origin_max_mem_size_(0), default_available_mem_size_(0),
-    is_auto_mgr_(false), dir_id_(0),
+    is_auto_mgr_(false), dir_id_(0), compress_raw_size_(0), compressed_size_(0),
     dummy_ptr_(nullptr), dummy_alloc_(nullptr) {}
   virtual ~ObSqlMemMgrProcessor() {}
 
@@ -131,6 +132,34 @@ public:
       mem_callback_->dumped(delta_size);
     }
   }
+  void compressed(int64_t raw_size, int64_t compressed_size)
+  {
+    compress_raw_size_ += raw_size;
+    compressed_size_ += compressed_size;
+    EVENT_ADD(ObStatEventIds::SQL_SPILL_COMPRESS_RAW_BYTES, raw_size);
+    EVENT_ADD(ObStatEventIds::SQL_SPILL_COMPRESSED_BYTES, compressed_size);
+    if (OB_NOT_NULL(mem_callback_)) {
+      mem_callback_->compressed(raw_size, compressed_size);
+    }
+  }
+  // the compression of dumped data is reported by each operator in its own otherstat slots,
+  // see set_compress_stat()
+  int64_t get_compress_raw_size() const { return compress_raw_size_; }
+  int64_t get_compressed_size() const { return compressed_size_; }
+  static void set_compress_stat(const int64_t raw_size,
+                                const int64_t compressed_size,
+                                int16_t &saved_size_id,
+                                int64_t &saved_size,
+                                int16_t &ratio_id,
+                                int64_t &ratio)
+  {
+    if (raw_size > 0) {
+      saved_size_id = ObSqlMonitorStatIds::SPILL_COMPRESS_SAVED_SIZE;
+      saved_size = raw_size - compressed_size;
+      ratio_id = ObSqlMonitorStatIds::SPILL_COMPRESS_RATIO;
+      ratio = compressed_size * 100 / raw_size;
+    }
+  }
   int64_t get_dumped_size() const { return profile_.dumped_size_; }
   int64_t get_max_dumped_size() const { return profile_.max_dumped_size_; }
   void reset_delta_size() { profile_.delta_size_ = 0; }
@@ -194,6 +223,9 @@ private:
   int64_t default_available_mem_size_;
   bool is_auto_mgr_;
   int64_t dir_id_;
+  // total size of compressed dumped data, before and after compression
+  int64_t compress_raw_size_;
+  int64_t compressed_size_;
   char *dummy_ptr_;
   ObIAllocator *dummy_alloc_;
 };
@@ -223,6 +255,24 @@ public:
   );
 };
 
+// Forward only the compression of dumped data to the processor, it is used by the stores whose
+// memory and dump size are accounted by the operator itself, e.g. the partitions of hash join.
+class ObSqlMemCompressCallback : public ObSqlMemoryCallback
+{
+public:
+  explicit ObSqlMemCompressCallback(ObSqlMemMgrProcessor &processor) : processor_(processor) {}
+  virtual ~ObSqlMemCompressCallback() {}
+  virtual void alloc(int64_t size) override { UNUSED(size); }
+  virtual void free(int64_t size) override { UNUSED(size); }
+  virtual void dumped(int64_t size) override { UNUSED(size); }
+  virtual void compressed(int64_t raw_size, int64_t compressed_size) override
+  {
+    processor_.compressed(raw_size, compressed_size);
+  }
+private:
+  ObSqlMemMgrProcessor &processor_;
+};
+
 } // sql
 } // oceanbase
 #endif /* OB_SQL_MEM_MGR_PROCESSOR_H */
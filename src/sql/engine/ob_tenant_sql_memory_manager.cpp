@@ -1189,7 +1189,9 @@ int ObTenantSqlMemoryManager::calculate_global_bound_size_by_interval_info(
           K(sql_mem_callback_.get_total_alloc_size()), K(tenant_id_), K(profile_cnt_),
           K(pre_profile_cnt_), K(pre_profile_cnt), K(calc_info.get_global_bound_size()),
           K(total_memory_size), K(cur_profile_cnt), K(calc_info.get_mem_target()), K(auto_calc),
-          K(sql_mem_callback_.get_total_dump_size()));
+          K(sql_mem_callback_.get_total_dump_size()),
+          K(sql_mem_callback_.get_total_compress_saved_size()),
+          K(sql_mem_callback_.get_compress_ratio()));
       }
       if (OB_FAIL(try_push_profiles_work_area_size(calc_info.get_global_bound_size()))) {
         LOG_WARN("failed to push profiles work area size",
@@ -457,20 +457,38 @@ class ObTenantSqlMemoryCallback : public ObSqlMemoryCallback
 {
 public:
   ObTenantSqlMemoryCallback() :
-    total_alloc_size_(0), total_dump_size_(0)
+    total_alloc_size_(0), total_dump_size_(0), total_compress_raw_size_(0),
+    total_compressed_size_(0)
   {}
 
 public:
   virtual void alloc(int64_t size) override;
   virtual void free(int64_t size) override;
   virtual void dumped(int64_t size) override;
+  virtual void compressed(int64_t raw_size, int64_t compressed_size) override;
 
-  void reset() { total_alloc_size_ = 0; total_dump_size_ = 0; }
+  void reset()
+  {
+    total_alloc_size_ = 0;
+    total_dump_size_ = 0;
+    total_compress_raw_size_ = 0;
+    total_compressed_size_ = 0;
+  }
   int64_t get_total_alloc_size() const { return total_alloc_size_; }
   int64_t get_total_dump_size() const { return total_dump_size_; }
+  int64_t get_total_compress_saved_size() const
+  { return ATOMIC_LOAD(&total_compress_raw_size_) - ATOMIC_LOAD(&total_compressed_size_); }
+  // percentage of compressed size to raw size, 100 if nothing has been compressed
+  int64_t get_compress_ratio() const
+  {
+    const int64_t raw_size = ATOMIC_LOAD(&total_compress_raw_size_);
+    return raw_size > 0 ? ATOMIC_LOAD(&total_compressed_size_) * 100 / raw_size : 100;
+  }
 private:
   int64_t total_alloc_size_;
   int64_t total_dump_size_;
+  int64_t total_compress_raw_size_;
+  int64_t total_compressed_size_;
 };
 
 class ObSqlWorkAreaInterval
@@ -837,6 +855,12 @@ OB_INLINE void ObTenantSqlMemoryCallback::dumped(int64_t size)
   (ATOMIC_AAF(&total_dump_size_, size));
 }
 
+OB_INLINE void ObTenantSqlMemoryCallback::compressed(int64_t raw_size, int64_t compressed_size)
+{
+  (ATOMIC_AAF(&total_compress_raw_size_, raw_size));
+  (ATOMIC_AAF(&total_compressed_size_, compressed_size));
+}
+
 } // sql
 } // oceanbase
 #endif /* OB_DTL_FC_SERVER_H */
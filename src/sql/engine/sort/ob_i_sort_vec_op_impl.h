@@ -61,6 +61,10 @@ public:
     info.otherstat_4_value_ = op_monitor_info_.otherstat_4_value_;
     info.otherstat_6_id_ = op_monitor_info_.otherstat_6_id_;
     info.otherstat_6_value_ = op_monitor_info_.otherstat_6_value_;
+    ObSqlMemMgrProcessor::set_compress_stat(sql_mem_processor_.get_compress_raw_size(),
+                                            sql_mem_processor_.get_compressed_size(),
+                                            info.otherstat_7_id_, info.otherstat_7_value_,
+                                            info.otherstat_8_id_, info.otherstat_8_value_);
   }
   void set_input_rows(int64_t input_rows)
   {
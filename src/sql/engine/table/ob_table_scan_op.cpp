@@ -1521,13 +1521,18 @@ void ObTableScanOp::fill_sql_plan_monitor_info()
     // 1. how many bytes read from io (IO_READ_BYTES)
     // 2. how many bytes in total (DATA_BLOCK_READ_CNT + INDEX_BLOCK_READ_CNT) * 16K (approximately, many diff for each table)
     // 3. how many rows processed before filtering (MEMSTORE_READ_ROW_COUNT + SSSTORE_READ_ROW_COUNT)
+    // 4. how many rows decoded by filters and for projection in column store scan
     op_monitor_info_.otherstat_1_id_ = ObSqlMonitorStatIds::IO_READ_BYTES;
     op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::TOTAL_READ_BYTES;
     op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::TOTAL_READ_ROW_COUNT;
+    op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::COLUMNAR_FILTER_ROW_COUNT;
+    op_monitor_info_.otherstat_5_id_ = ObSqlMonitorStatIds::COLUMNAR_PROJECT_ROW_COUNT;
     op_monitor_info_.otherstat_1_value_ = EVENT_GET(ObStatEventIds::IO_READ_BYTES, di);
     // NOTE: this is not always accurate, as block size change be change from default 16K to any value
     op_monitor_info_.otherstat_2_value_ = (EVENT_GET(ObStatEventIds::DATA_BLOCK_READ_CNT, di) + EVENT_GET(ObStatEventIds::INDEX_BLOCK_READ_CNT, di)) * 16 * 1024;
     op_monitor_info_.otherstat_3_value_ = EVENT_GET(ObStatEventIds::MEMSTORE_READ_ROW_COUNT, di) + EVENT_GET(ObStatEventIds::SSSTORE_READ_ROW_COUNT, di);
+    op_monitor_info_.otherstat_4_value_ = EVENT_GET(ObStatEventIds::COLUMNAR_FILTER_ROW_CNT, di);
+    op_monitor_info_.otherstat_5_value_ = EVENT_GET(ObStatEventIds::COLUMNAR_PROJECT_ROW_CNT, di);
   }
 }
 
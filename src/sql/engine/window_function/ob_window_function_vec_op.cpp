@@ -307,6 +307,10 @@ int ObWindowFunctionVecOp::inner_open()
     LOG_WARN("init window function failed", K(ret));
   } else if (OB_FAIL(reset_for_scan(ctx_.get_my_session()->get_effective_tenant_id()))) {
     LOG_WARN("reset for scan failed", K(ret));
+  } else {
+    op_monitor_info_.otherstat_1_id_ = ObSqlMonitorStatIds::WINFUNC_FULL_FRAME_COUNT;
+    op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::WINFUNC_INCR_FRAME_COUNT;
+    op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::WINFUNC_SEG_TREE_FRAME_COUNT;
   }
   LOG_TRACE("window function inner open", K(MY_SPEC), K(MY_SPEC.single_part_parallel_), K(MY_SPEC.range_dist_parallel_));
   return ret;
@@ -2186,6 +2190,7 @@ int ObWindowFunctionVecOp::compute_wf_values(WinFuncColExpr *end, int64_t &check
       winfunc::AggrExpr *agg_expr = static_cast<winfunc::AggrExpr *>(it->wf_expr_);
       agg_expr->last_valid_frame_.reset();
       agg_expr->last_aggr_row_ = nullptr;
+      agg_expr->seg_tree_ = nullptr;
     }
     while (OB_SUCC(ret) && total_size > 0) {
       clear_evaluated_flag();
@@ -254,6 +254,10 @@ public:
   }
 
   static bool all_supported_winfuncs(const ObIArray<ObWinFunRawExpr *> &win_exprs);
+  // plan monitor counters of the ways the frames of aggregate functions are calculated
+  inline void inc_full_frame_cnt() { op_monitor_info_.otherstat_1_value_++; }
+  inline void inc_incr_frame_cnt() { op_monitor_info_.otherstat_2_value_++; }
+  inline void inc_seg_tree_frame_cnt() { op_monitor_info_.otherstat_3_value_++; }
 private:
   struct cell_info
   {
@@ -111,12 +111,22 @@ int WinExprWrapper<Derived>::process_partition(WinExprEvalCtx &ctx, const int64_
             }
           } else if (whole_frame) {
             ctx.win_col_.agg_ctx_->removal_info_.reset_for_new_frame();
-            if (OB_FAIL(static_cast<Derived *>(this)->process_window(ctx, cur_frame, row_idx, agg_row, is_null))) {
+            if (agg_expr->use_seg_tree(ctx, cur_frame)) {
+              if (OB_FAIL(agg_expr->seg_tree_process_window(ctx, cur_frame, row_idx, agg_row))) {
+                LOG_WARN("eval aggregate function with segment tree failed", K(ret));
+              } else {
+                ctx.win_col_.op_.inc_seg_tree_frame_cnt();
+              }
+            } else if (OB_FAIL(static_cast<Derived *>(this)->process_window(ctx, cur_frame, row_idx, agg_row, is_null))) {
               LOG_WARN("eval aggregate function failed", K(ret));
+            } else {
+              ctx.win_col_.op_.inc_full_frame_cnt();
             }
           } else if (OB_FAIL(static_cast<Derived *>(this)->accum_process_window(
                        ctx, cur_frame, prev_frame, row_idx, agg_row, is_null))) {
             LOG_WARN("increase evaluation function failed", K(ret));
+          } else {
+            ctx.win_col_.op_.inc_incr_frame_cnt();
           }
           if (OB_FAIL(ret)) {
           } else {
@@ -1281,6 +1291,183 @@ int AggrExpr::accum_process_window(WinExprEvalCtx &ctx, const Frame &cur_frame,
   return ret;
 }
 
+bool AggrExpr::use_seg_tree(WinExprEvalCtx &ctx, const Frame &frame) const
+{
+  const WinFuncInfo &wf_info = ctx.win_col_.wf_info_;
+  const ObWindowFunctionVecSpec &spec =
+    static_cast<const ObWindowFunctionVecSpec &>(ctx.win_col_.op_.get_spec());
+  // only the extremum of MIN/MAX slides out of the frame, SUM/COUNT/AVG are
+  // calculated incrementally by removing the rows out of the frame.
+  // the head of the frame is fixed if the upper bound is unbounded preceding.
+  return nullptr != seg_tree_
+         || (common::REMOVE_EXTRENUM == wf_info.remove_type_
+             && ctx.win_col_.agg_ctx_->removal_info_.enable_removal_opt_
+             && !wf_info.upper_.is_unbounded_
+             && !spec.is_push_down()
+             && frame.tail_ - frame.head_ >= SEG_TREE_MIN_FRAME_SIZE);
+}
+
+int AggrExpr::seg_tree_process_window(WinExprEvalCtx &ctx, const Frame &frame,
+                                      const int64_t row_idx, char *agg_row)
+{
+  int ret = OB_SUCCESS;
+  int64_t extremum_idx = -1;
+  bool is_null = false;
+  aggregate::RemovalInfo &removal_info = ctx.win_col_.agg_ctx_->removal_info_;
+  if (nullptr == seg_tree_) {
+    void *buf = ctx.allocator_.alloc(sizeof(MinMaxSegTree));
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret));
+    } else {
+      MinMaxSegTree *seg_tree = new (buf) MinMaxSegTree(T_FUN_MIN == ctx.win_col_.wf_info_.func_type_);
+      if (OB_FAIL(seg_tree->build(ctx, ctx.win_col_.part_first_row_idx_,
+                                  ctx.win_col_.op_.get_part_end_idx()))) {
+        LOG_WARN("build segment tree failed", K(ret));
+      } else {
+        seg_tree_ = seg_tree;
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(seg_tree_->query(frame, extremum_idx))) {
+    LOG_WARN("query segment tree failed", K(ret), K(frame));
+  } else if (OB_FAIL(process_window(ctx, Frame(extremum_idx, extremum_idx + 1), row_idx, agg_row,
+                                    is_null))) {
+    LOG_WARN("process window failed", K(ret), K(extremum_idx));
+  } else {
+    // the removal info of the row of the extremum is the removal info of the frame except the
+    // count of null values, which is used to check whether the result of the next frame is null
+    removal_info.null_cnt_ = seg_tree_->get_null_cnt(frame);
+    if (removal_info.null_cnt_ == frame.tail_ - frame.head_) {
+      ctx.win_col_.agg_ctx_->row_meta().locate_notnulls_bitmap(agg_row).unset(0);
+    } else {
+      ctx.win_col_.agg_ctx_->row_meta().locate_notnulls_bitmap(agg_row).set(0);
+    }
+  }
+  return ret;
+}
+
+int MinMaxSegTree::build(WinExprEvalCtx &ctx, const int64_t part_start, const int64_t part_end)
+{
+  int ret = OB_SUCCESS;
+  ObWindowFunctionVecOp &op = ctx.win_col_.op_;
+  ObEvalCtx &eval_ctx = op.get_eval_ctx();
+  ObBitVector &eval_skip = *op.get_batch_ctx().bound_eval_skip_;
+  ObExpr *param = nullptr;
+  ObEvalCtx::BatchInfoScopeGuard guard(eval_ctx);
+  part_start_ = part_start;
+  row_cnt_ = part_end - part_start;
+  if (OB_UNLIKELY(row_cnt_ <= 0 || ctx.win_col_.wf_info_.aggr_info_.param_exprs_.count() != 1)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid partition or params", K(ret), K(part_start), K(part_end));
+  } else if (FALSE_IT(param = ctx.win_col_.wf_info_.aggr_info_.param_exprs_.at(0))) {
+  } else if (OB_ISNULL(param->basic_funcs_)
+             || OB_ISNULL(cmp_func_ = param->basic_funcs_->null_first_cmp_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid compare function", K(ret), KPC(param));
+  } else if (OB_ISNULL(values_ = static_cast<ObDatum *>(
+                       ctx.allocator_.alloc(sizeof(ObDatum) * row_cnt_)))
+             || OB_ISNULL(nodes_ = static_cast<int64_t *>(
+                          ctx.allocator_.alloc(sizeof(int64_t) * row_cnt_ * 2)))
+             || OB_ISNULL(null_cnts_ = static_cast<int64_t *>(
+                          ctx.allocator_.alloc(sizeof(int64_t) * (row_cnt_ + 1))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(row_cnt_));
+  } else {
+    null_cnts_[0] = 0;
+  }
+  // copy the param values of the partition
+  for (int64_t row_start = part_start; OB_SUCC(ret) && row_start < part_end;) {
+    const int64_t batch_size = std::min(part_end - row_start, op.get_spec().max_batch_size_);
+    op.clear_evaluated_flag();
+    guard.set_batch_size(batch_size);
+    eval_skip.unset_all(0, batch_size);
+    if (OB_FAIL(ctx.input_rows_.attach_rows(op.get_all_expr(), op.get_input_row_meta(), eval_ctx,
+                                            row_start, row_start + batch_size, false))) {
+      LOG_WARN("attach rows failed", K(ret));
+    } else if (OB_FAIL(param->eval_vector(eval_ctx, eval_skip, EvalBound(batch_size, true)))) {
+      LOG_WARN("eval param failed", K(ret));
+    } else {
+      ObIVector *vec = param->get_vector(eval_ctx);
+      for (int64_t i = 0; OB_SUCC(ret) && i < batch_size; i++) {
+        const int64_t idx = row_start - part_start + i;
+        ObDatum &value = values_[idx];
+        if (vec->is_null(i)) {
+          value.set_null();
+          null_cnts_[idx + 1] = null_cnts_[idx] + 1;
+        } else {
+          const char *payload = nullptr;
+          ObLength len = 0;
+          vec->get_payload(i, payload, len);
+          ObDatum src(payload, len, false);
+          if (OB_FAIL(value.deep_copy(src, ctx.allocator_))) {
+            LOG_WARN("deep copy datum failed", K(ret));
+          } else {
+            null_cnts_[idx + 1] = null_cnts_[idx];
+          }
+        }
+      }
+      row_start += batch_size;
+    }
+  }
+  // build the tree bottom up
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_cnt_; i++) {
+    nodes_[row_cnt_ + i] = i;
+  }
+  for (int64_t i = row_cnt_ - 1; OB_SUCC(ret) && i > 0; i--) {
+    if (OB_FAIL(pick(nodes_[2 * i], nodes_[2 * i + 1], nodes_[i]))) {
+      LOG_WARN("pick extremum failed", K(ret));
+    }
+  }
+  LOG_TRACE("build min max segment tree", K(ret), K(*this));
+  return ret;
+}
+
+int MinMaxSegTree::query(const Frame &frame, int64_t &row_idx) const
+{
+  int ret = OB_SUCCESS;
+  int64_t res = -1;
+  if (OB_UNLIKELY(frame.head_ < part_start_ || frame.tail_ > part_start_ + row_cnt_
+                  || frame.is_empty())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("frame out of partition", K(ret), K(frame), K(*this));
+  } else {
+    for (int64_t l = frame.head_ - part_start_ + row_cnt_, r = frame.tail_ - part_start_ + row_cnt_;
+         OB_SUCC(ret) && l < r; l >>= 1, r >>= 1) {
+      if ((l & 1) && OB_FAIL(pick(res, nodes_[l++], res))) {
+        LOG_WARN("pick extremum failed", K(ret));
+      } else if ((r & 1) && OB_FAIL(pick(res, nodes_[--r], res))) {
+        LOG_WARN("pick extremum failed", K(ret));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      row_idx = res + part_start_;
+    }
+  }
+  return ret;
+}
+
+// the later row is picked if the values are equal, so that the extremum stays in
+// the sliding frame for more rows
+int MinMaxSegTree::pick(const int64_t l, const int64_t r, int64_t &res) const
+{
+  int ret = OB_SUCCESS;
+  int cmp_ret = 0;
+  if (l < 0 || r < 0) {
+    res = (l < 0 ? r : l);
+  } else if (values_[l].is_null() || values_[r].is_null()) {
+    res = (values_[l].is_null() && (!values_[r].is_null() || r > l)) ? r : l;
+  } else if (OB_FAIL(cmp_func_(values_[l], values_[r], cmp_ret))) {
+    LOG_WARN("compare failed", K(ret));
+  } else if (0 == cmp_ret) {
+    res = std::max(l, r);
+  } else {
+    res = ((cmp_ret < 0) == is_min_) ? l : r;
+  }
+  return ret;
+}
+
 void AggrExpr::destroy()
 {
   if (aggr_processor_ != nullptr) {
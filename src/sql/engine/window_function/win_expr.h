@@ -295,10 +295,46 @@ public:
   virtual int generate_extra(ObIAllocator &allocator, void *&extra) override;
 };
 
+// MinMaxSegTree is a segment tree over the param values of MIN/MAX of a partition,
+// each node keeps the row index of the extremum of its range. It finds the
+// extremum of a sliding frame in O(log n) when the extremum of the previous frame
+// slides out, instead of aggregating all rows of the new frame again.
+class MinMaxSegTree
+{
+public:
+  MinMaxSegTree(const bool is_min) :
+    is_min_(is_min), part_start_(0), row_cnt_(0), cmp_func_(nullptr), values_(nullptr),
+    nodes_(nullptr), null_cnts_(nullptr)
+  {}
+  int build(WinExprEvalCtx &ctx, const int64_t part_start, const int64_t part_end);
+  // get the row index of the extremum of the frame, a null row is returned if all
+  // rows of the frame are null
+  int query(const Frame &frame, int64_t &row_idx) const;
+  inline int64_t get_null_cnt(const Frame &frame) const
+  {
+    return null_cnts_[frame.tail_ - part_start_] - null_cnts_[frame.head_ - part_start_];
+  }
+  TO_STRING_KV(K_(is_min), K_(part_start), K_(row_cnt));
+private:
+  int pick(const int64_t l, const int64_t r, int64_t &res) const;
+private:
+  bool is_min_;
+  int64_t part_start_;
+  int64_t row_cnt_;
+  ObExprCmpFuncType cmp_func_;
+  // param values of the rows of the partition
+  ObDatum *values_;
+  // nodes_[row_cnt_ + i] is the leaf of row i, nodes_[1] is the root
+  int64_t *nodes_;
+  // null_cnts_[i] is the count of null values in [0, i)
+  int64_t *null_cnts_;
+};
+
 class AggrExpr final: public WinExprWrapper<AggrExpr>
 {
 public:
-  AggrExpr(): aggr_processor_(nullptr), last_valid_frame_(), last_aggr_row_(nullptr) {}
+  AggrExpr(): aggr_processor_(nullptr), last_valid_frame_(), last_aggr_row_(nullptr),
+    seg_tree_(nullptr) {}
   int process_window(WinExprEvalCtx &ctx, const Frame &frame, const int64_t row_idx,
                      char *res, bool &is_null) override;
 
@@ -314,6 +350,12 @@ public:
 
   static int set_result_for_invalid_frame(WinExprEvalCtx &ctx, char *agg_row);
 
+  // whether the frame which can not be calculated incrementally is calculated with
+  // the segment tree
+  bool use_seg_tree(WinExprEvalCtx &ctx, const Frame &frame) const;
+  int seg_tree_process_window(WinExprEvalCtx &ctx, const Frame &frame, const int64_t row_idx,
+                              char *agg_row);
+
   virtual void destroy() override;
 
 private:
@@ -328,6 +370,11 @@ public:
   Frame last_valid_frame_;
   aggregate::RemovalInfo last_removal_info_;
   char *last_aggr_row_;
+  // built over the current partition when needed, allocated by `WinExprEvalCtx::allocator_`
+  MinMaxSegTree *seg_tree_;
+private:
+  // frames smaller than this are cheaper to aggregate again than to build the segment tree
+  static const int64_t SEG_TREE_MIN_FRAME_SIZE = 64;
 };
 
 } // end winfunc
@@ -131,6 +131,7 @@ enum CacheRefHandleID
   SQL_PLAN_HANDLE,
   CALLSTMT_HANDLE,
   PC_DIAG_HANDLE,
+  EXPR_JIT_HANDLE,
   MAX_HANDLE
 };
 
@@ -44,6 +44,7 @@
 #endif
 #include "pl/pl_cache/ob_pl_cache_mgr.h"
 #include "sql/plan_cache/ob_values_table_compression.h"
+#include "sql/engine/expr/ob_expr_jit.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::common::hash;
@@ -286,6 +287,36 @@ struct ObGetTableIdOp
   const uint64_t table_id_;
 };
 
+struct ObGetHotPlanIdOp
+{
+  explicit ObGetHotPlanIdOp(common::ObIArray<uint64_t> *key_array)
+    : key_array_(key_array)
+  {}
+
+  int operator()(common::hash::HashMapPair<ObCacheObjID, ObILibCacheObject *> &entry)
+  {
+    int ret = common::OB_SUCCESS;
+    ObPhysicalPlan *plan = NULL;
+    if (OB_ISNULL(key_array_) || OB_ISNULL(entry.second)) {
+      ret = common::OB_NOT_INIT;
+      SQL_PC_LOG(WARN, "invalid argument", K(ret));
+    } else if (ObLibCacheNameSpace::NS_CRSR != entry.second->get_ns()) {
+      // not sql plan
+      // do nothing
+    } else if (OB_ISNULL(plan = dynamic_cast<ObPhysicalPlan *>(entry.second))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected null plan", K(ret), K(plan));
+    } else if (!ObExprJit::is_hot_plan(*plan)) {
+      // do nothing
+    } else if (OB_FAIL(key_array_->push_back(entry.first))) {
+      SQL_PC_LOG(WARN, "fail to push back plan_id", K(ret));
+    }
+    return ret;
+  }
+
+  common::ObIArray<uint64_t> *key_array_;
+};
+
 // true means entry_left is more active than entry_right
 bool stat_compare(const LCKeyValue &left, const LCKeyValue &right)
 {
@@ -1314,6 +1345,33 @@ int ObPlanCache::evict_plan(uint64_t table_id)
   return ret;
 }
 
+int ObPlanCache::compile_hot_plans()
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<uint64_t, 16> plan_ids;
+  ObGetHotPlanIdOp plan_id_op(&plan_ids);
+  ObGlobalReqTimeService::check_req_timeinfo();
+  if (OB_FAIL(co_mgr_.foreach_cache_obj(plan_id_op))) {
+    SQL_PC_LOG(WARN, "fail to traverse id2stat_map", K(ret));
+  } else {
+    for (int64_t i = 0; i < plan_ids.count(); i++) {
+      ObCacheObjGuard guard(EXPR_JIT_HANDLE);
+      ObPhysicalPlan *plan = NULL;
+      int tmp_ret = ref_plan(plan_ids.at(i), guard); //plan引用计数加1
+      if (OB_HASH_NOT_EXIST == tmp_ret) {
+        // the plan is evicted, do nothing
+      } else if (OB_SUCCESS != tmp_ret
+                 || OB_ISNULL(plan = static_cast<ObPhysicalPlan*>(guard.cache_obj_))) {
+        LOG_WARN("get plan failed", K(tmp_ret), KP(plan));
+      } else if (OB_SUCCESS != (tmp_ret = ObExprJit::compile_plan(*plan))) {
+        // the plan is still executed by the interpreter
+        LOG_WARN("failed to compile hot plan", K(tmp_ret), K(plan->get_plan_id()));
+      }
+    }
+  }
+  return ret;
+}
+
 template<typename CallBack>
 int ObPlanCache::foreach_cache_evict(CallBack &cb)
 {
@@ -2718,6 +2776,11 @@ void ObPlanCacheEliminationTask::run_plan_cache_task()
   }  else if (OB_FAIL(plan_cache_->cache_evict_by_glitch_node())) {
     SQL_PC_LOG(ERROR, "Plan cache evict by glitch failed, please check", K(ret));
   }
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(plan_cache_->get_tenant_id()));
+  if (tenant_config.is_valid() && tenant_config->_enable_sql_expr_jit
+      && OB_FAIL(plan_cache_->compile_hot_plans())) {
+    SQL_PC_LOG(WARN, "failed to compile hot plans", K(ret));
+  }
 }
 
 void ObPlanCacheEliminationTask::run_free_cache_obj_task()
@@ -288,6 +288,8 @@ public:
                                   ObILibCacheObject *cache_obj);
   int evict_plan(uint64_t table_id);
   int evict_plan_by_table_name(uint64_t database_id, ObString tab_name);
+  // compile the expressions of the hot plans, called by the background evict task
+  int compile_hot_plans();
 
   /**
    * memory related
@@ -534,6 +534,13 @@ int ObMicroBlockHandleMgr::submit_async_io(
     micro_block_handle.block_state_ = ObSSTableMicroBlockState::NEED_MULTI_IO;
     ret = OB_SUCCESS;
     // continue and use prefetch in batch later
+  } else if (use_cache && is_data_block && OB_SUCCESS == data_block_cache_->prefetch_secondary_cache_block(
+      tenant_id, index_block_info, macro_handle, &block_io_allocator_)) {
+    // the washed micro block is read back from the secondary cache instead of the macro block
+    micro_block_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
+    cache_mem_ctrl_.add_hold_size(micro_block_handle.get_handle_size());
+    micro_block_handle.io_handle_ = macro_handle;
+    micro_block_handle.allocator_ = &block_io_allocator_;
   } else if (OB_FAIL(cache->prefetch(tenant_id, macro_id, index_block_info, use_cache,
                               macro_handle, &block_io_allocator_))) {
     LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(macro_handle),
@@ -798,6 +798,8 @@ int ObMultipleMerge::update_and_report_tablet_stat()
     access_ctx_->table_scan_stat_->row_cache_hit_cnt_ += access_ctx_->table_store_stat_.row_cache_hit_cnt_;
     access_ctx_->table_scan_stat_->row_cache_miss_cnt_ += access_ctx_->table_store_stat_.row_cache_miss_cnt_;
   }
+  EVENT_ADD(ObStatEventIds::COLUMNAR_FILTER_ROW_CNT, access_ctx_->table_store_stat_.cs_filter_row_cnt_);
+  EVENT_ADD(ObStatEventIds::COLUMNAR_PROJECT_ROW_CNT, access_ctx_->table_store_stat_.cs_project_row_cnt_);
   if (MTL(compaction::ObTenantTabletScheduler *)->enable_adaptive_compaction()) {
     report_tablet_stat();
   }
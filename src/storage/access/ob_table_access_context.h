@@ -78,6 +78,8 @@ struct ObTableScanStoreStat
     rowkey_prefix_ = 0;
     logical_read_cnt_ = 0;
     physical_read_cnt_ = 0;
+    cs_filter_row_cnt_ = 0;
+    cs_project_row_cnt_ = 0;
   }
 public:
   OB_INLINE bool enable_get_row_cache() const
@@ -109,7 +111,8 @@ public:
                K_(fuse_row_cache_hit_cnt), K_(fuse_row_cache_miss_cnt), K_(fuse_row_cache_put_cnt),
                K_(micro_access_cnt), K_(pushdown_micro_access_cnt),
                K_(empty_read_cnt), K_(rowkey_prefix),
-               K_(logical_read_cnt), K_(physical_read_cnt));
+               K_(logical_read_cnt), K_(physical_read_cnt),
+               K_(cs_filter_row_cnt), K_(cs_project_row_cnt));
   int64_t row_cache_hit_cnt_;
   int64_t row_cache_miss_cnt_;
   int64_t row_cache_put_cnt_;
@@ -126,6 +129,10 @@ public:
   int64_t rowkey_prefix_;
   int64_t logical_read_cnt_;
   int64_t physical_read_cnt_;
+  // rows decoded by pushdown filters and for projection in columnar scan,
+  // reported as COLUMNAR_FILTER_ROW_CNT and COLUMNAR_PROJECT_ROW_CNT
+  int64_t cs_filter_row_cnt_;
+  int64_t cs_project_row_cnt_;
 };
 
 struct ObTableAccessContext
@@ -103,6 +103,7 @@ ObCSMicroBlockTransformer::ObCSMicroBlockTransformer()
     orig_desc_buf_(nullptr), orig_desc_buf_size_(0), stream_decoding_ctx_buf_(nullptr),
     stream_decoding_ctx_buf_size_(0), stream_row_cnt_arr_(nullptr), stream_meta_len_arr_(nullptr),
     all_string_data_offset_(0), all_string_uncompress_len_(0),
+    hash_index_buf_(nullptr), hash_index_size_(0),
     allocator_("BlkTransformer")
 {
 }
@@ -113,9 +114,14 @@ int ObCSMicroBlockTransformer::init(const ObMicroBlockHeader *header,
   const bool is_part_tranform, const int32_t *store_ids, const int32_t store_ids_cnt)
 {
   int ret = OB_SUCCESS;
+  int64_t data_payload_len = payload_len;
   if (IS_INIT) {
     ret = OB_INIT_TWICE;
     LOG_WARN("ObCSMicroBlockTransformer has inited", K(ret));
+  } else if (header->is_contain_hash_index()
+      && OB_UNLIKELY(header->hash_index_offset_from_end_ >= payload_len)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid hash index size", K(ret), K(payload_len), KPC(header));
   } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(
       static_cast<ObCompressorType>(header->compressor_type_), compressor_))) {
     LOG_WARN("fail to get compressor", K(ret), KPC(header));
@@ -126,15 +132,20 @@ int ObCSMicroBlockTransformer::init(const ObMicroBlockHeader *header,
     column_headers_ = reinterpret_cast<const ObCSColumnHeader *>(payload_buf_ + sizeof(ObAllColumnHeader));
     column_meta_begin_offset_ = sizeof(ObAllColumnHeader) + sizeof(ObCSColumnHeader) * header->column_count_;
     is_part_tranform_ = is_part_tranform;
+    if (header->is_contain_hash_index()) {
+      hash_index_size_ = header->hash_index_offset_from_end_;
+      data_payload_len = payload_len - hash_index_size_;
+      hash_index_buf_ = payload_buf_ + data_payload_len;
+    }
   }
 
   if (OB_FAIL(ret)) {
   } else if (OB_UNLIKELY(!all_column_header_->is_valid() || all_column_header_->is_full_transformed())) {
     ret = OB_INVALID_DATA;
     LOG_WARN("invalid all column header", K(ret), KPC(all_column_header_));
-  } else if (OB_FAIL(decode_stream_offsets_(payload_len))) {
+  } else if (OB_FAIL(decode_stream_offsets_(data_payload_len))) {
     LOG_WARN("fail to decode_stream_offsets", K(ret));
-  } else if (OB_FAIL(build_all_string_data_desc_(payload_len))) {
+  } else if (OB_FAIL(build_all_string_data_desc_(data_payload_len))) {
     LOG_WARN("fail to build_all_string_data_desc_", K(ret));
   } else if (OB_FAIL(build_original_transform_desc_(store_ids, store_ids_cnt))) {
     LOG_WARN("fail to build transform desc", K(ret));
@@ -537,6 +548,8 @@ int ObCSMicroBlockTransformer::calc_full_transform_size(int64_t &size) const
         buf += sizeof(ObStringStreamDecoderCtx);
       }
     }
+    // <6> hash index
+    size += hash_index_size_;
   }
 
   return ret;
@@ -706,6 +719,16 @@ int ObCSMicroBlockTransformer::full_transform(char *buf, const int64_t buf_len,
       ctx_buf += sizeof(ObStringStreamDecoderCtx);
     }
   }
+  // <7> hash index, keep it at the end of block so that it can be located by hash_index_offset_from_end_
+  if (OB_SUCC(ret) && hash_index_size_ > 0) {
+    if (OB_UNLIKELY(tmp_pos + hash_index_size_ > buf_len)) {
+      ret = OB_BUF_NOT_ENOUGH;
+      LOG_WARN("buf not enough", K(ret), K(tmp_pos), K(buf_len), K_(hash_index_size));
+    } else {
+      MEMCPY(buf + tmp_pos, hash_index_buf_, hash_index_size_);
+      tmp_pos += hash_index_size_;
+    }
+  }
   if (OB_SUCC(ret)) {
     pos = tmp_pos;
   }
@@ -188,6 +188,9 @@ private:
 
   uint32_t all_string_data_offset_; // this offset is relative to payload_buf
   uint32_t all_string_uncompress_len_;
+  // hash index is appended after stream offsets and is copied to the end of full transformed block
+  const char *hash_index_buf_;
+  uint32_t hash_index_size_;
   common::ObArenaAllocator allocator_;
 };
 
@@ -506,6 +506,8 @@ int ObCSEncodeBlockGetReader::init(
   if (OB_FAIL(ret)) {
   } else if (OB_FAIL(transform_helper_.init(&decoder_allocator_, block_data, store_id_array_, request_cnt))) {
     LOG_WARN("fail to init transform helper", K(ret));
+  } else if (OB_FAIL(init_hash_index(block_data, hash_index_, transform_helper_.get_micro_block_header()))) {
+    LOG_WARN("fail to init hash index", K(ret));
   } else if (typeid(ObRowkeyReadInfo) == typeid(read_info)) {
     ObObjMeta col_type;
     const int64_t col_cnt = MIN(request_cnt, transform_helper_.get_micro_block_header()->column_count_);
@@ -530,7 +532,7 @@ int ObCSEncodeBlockGetReader::get_row(const ObMicroBlockData &block_data,
   reuse();
   if (OB_FAIL(init(block_data, read_info))) {
     LOG_WARN("failed to do inner init", K(ret), K(block_data), K(read_info));
-  } else if (OB_FAIL(locate_row(rowkey, read_info.get_datum_utils(), row_id, found))) {
+  } else if (OB_FAIL(locate_row(rowkey, read_info, row_id, found))) {
     LOG_WARN("failed to locate row", K(ret), K(rowkey));
   } else {
     row.row_flag_.reset();
@@ -570,17 +572,57 @@ int ObCSEncodeBlockGetReader::get_all_columns(const int64_t row_id, ObDatumRow &
   return ret;
 }
 
+int ObCSEncodeBlockGetReader::locate_row_fast_path(const ObDatumRowkey &rowkey,
+  const ObStorageDatumUtils &datum_utils, int64_t &row_id, bool &need_binary_search, bool &found)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash_value = 0;
+  need_binary_search = false;
+  if (OB_FAIL(rowkey.murmurhash(0, datum_utils, hash_value))) {
+    LOG_WARN("Failed to calc rowkey hash", K(ret), K(rowkey), K(datum_utils));
+  } else {
+    const uint8_t tmp_row_id = hash_index_.find(hash_value);
+    if (tmp_row_id == ObMicroBlockHashIndex::NO_ENTRY) {
+      found = false;
+    } else if (tmp_row_id == ObMicroBlockHashIndex::COLLISION) {
+      need_binary_search = true;
+    } else if (OB_UNLIKELY(tmp_row_id >= transform_helper_.get_micro_block_header()->row_count_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected row id", K(ret), K(tmp_row_id), KPC(transform_helper_.get_micro_block_header()));
+    } else {
+      const ObStorageDatum *datums = rowkey.datums_;
+      int32_t cmp_result = 0;
+      for (int64_t i = 0; OB_SUCC(ret) && 0 == cmp_result && i < rowkey.get_datum_cnt(); ++i) {
+        if (OB_FAIL(decoders_[i].quick_compare(
+                    datums[i], datum_utils.get_cmp_funcs().at(i), tmp_row_id, cmp_result))) {
+          LOG_WARN("decode and compare cell failed", K(ret), K(tmp_row_id), K(i), K(datums[i]));
+        }
+      }
+      if (OB_SUCC(ret) && 0 == cmp_result) {
+        found = true;
+        row_id = tmp_row_id;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObCSEncodeBlockGetReader::locate_row(const ObDatumRowkey &rowkey,
-  const ObStorageDatumUtils &datum_utils, int64_t &row_id, bool &found)
+  const ObITableReadInfo &read_info, int64_t &row_id, bool &found)
 {
   int ret = OB_SUCCESS;
+  const ObStorageDatumUtils &datum_utils = read_info.get_datum_utils();
+  bool need_binary_search = true;
+  found = false;
+  row_id = -1;
 
   if (OB_UNLIKELY(rowkey.get_datum_cnt() > datum_utils.get_rowkey_count())) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "Invalid argument to locate row", K(ret), K(rowkey), K(datum_utils));
-  } else {
-    found = false;
-    row_id = -1;
+  } else if (hash_index_.is_inited() && rowkey.get_datum_cnt() == read_info.get_schema_rowkey_count()
+      && OB_FAIL(locate_row_fast_path(rowkey, datum_utils, row_id, need_binary_search, found))) {
+    LOG_WARN("failed to locate row by hash index", K(ret), K(rowkey));
+  } else if (need_binary_search) {
     // reader_
     const int64_t rowkey_cnt = rowkey.get_datum_cnt();
     const ObStorageDatum *datums = rowkey.datums_;
@@ -639,6 +681,8 @@ int ObCSEncodeBlockGetReader::init(const ObMicroBlockData &block_data,
     }
     if (OB_FAIL(transform_helper_.init(&decoder_allocator_, block_data, store_id_array_, request_cnt))) {
       LOG_WARN("fail to init transform helper", K(ret));
+    } else if (OB_FAIL(init_hash_index(block_data, hash_index_, transform_helper_.get_micro_block_header()))) {
+      LOG_WARN("fail to init hash index", K(ret));
     } else if (OB_FAIL(do_init(block_data, request_cnt))) {
       LOG_WARN("failed to do init", K(ret), K(block_data), K(request_cnt));
     }
@@ -665,7 +709,7 @@ int ObCSEncodeBlockGetReader::exist_row(const ObMicroBlockData &block_data,
                           read_info.get_columns_desc(),
                           rowkey_cnt))) {
     LOG_WARN("failed to do inner init", K(ret), K(block_data), K(read_info));
-  } else if (OB_FAIL(locate_row(rowkey, read_info.get_datum_utils(), row_id, found))) {
+  } else if (OB_FAIL(locate_row(rowkey, read_info, row_id, found))) {
     LOG_WARN("failed to locate row", K(ret), K(rowkey));
   } else if (found) {
     exist = true;
@@ -721,7 +765,7 @@ int ObCSEncodeBlockGetReader::get_row_id(
                           read_info.get_columns_desc(),
                           rowkey_cnt))) {
     LOG_WARN("failed to do inner init", K(ret), K(block_data), K(read_info));
-  } else if (OB_FAIL(locate_row(rowkey, read_info.get_datum_utils(), row_id, found))) {
+  } else if (OB_FAIL(locate_row(rowkey, read_info, row_id, found))) {
     LOG_WARN("failed to locate row", K(ret), K(rowkey));
   } else if (!found) {
     ret = OB_BEYOND_THE_RANGE;
@@ -139,7 +139,7 @@ class ObCSEncodeBlockGetReader : public ObIMicroBlockGetReader, public ObICSEnco
 {
 public:
   void reuse();
-  ObCSEncodeBlockGetReader() = default;
+  ObCSEncodeBlockGetReader() : hash_index_() {}
   virtual ~ObCSEncodeBlockGetReader() = default;
   virtual int get_row(const ObMicroBlockData &block_data, const ObDatumRowkey &rowkey,
     const ObITableReadInfo &read_info, ObDatumRow &row) final;
@@ -163,8 +163,12 @@ private:
   int init(const ObMicroBlockData &block_data, const ObITableReadInfo &read_info);
   int init(const ObMicroBlockData &block_data, const int64_t schema_rowkey_cnt,
            const ObColDescIArray &cols_desc, const int64_t request_cnt);
-  int locate_row(const ObDatumRowkey &rowkey, const ObStorageDatumUtils &datum_utils,
+  int locate_row(const ObDatumRowkey &rowkey, const ObITableReadInfo &read_info,
     int64_t &row_id, bool &found);
+  int locate_row_fast_path(const ObDatumRowkey &rowkey, const ObStorageDatumUtils &datum_utils,
+    int64_t &row_id, bool &need_binary_search, bool &found);
+private:
+  ObMicroBlockHashIndex hash_index_;
 };
 
 class ObMicroBlockCSDecoder : public ObIMicroBlockDecoder
@@ -83,7 +83,7 @@ int ObMicroBlockCSEncoder::alloc_and_init_encoder_(const int64_t column_index, O
 
 ObMicroBlockCSEncoder::ObMicroBlockCSEncoder()
   : allocator_("CSEncAlloc", OB_MALLOC_MIDDLE_BLOCK_SIZE),
-    ctx_(), row_buf_holder_(), data_buffer_(), all_string_data_buffer_(),
+    ctx_(), row_buf_holder_(), data_buffer_(), all_string_data_buffer_(), hash_index_buffer_(),
     all_col_datums_(OB_MALLOC_NORMAL_BLOCK_SIZE, ModulePageAllocator("CSBlkEnc", MTL_ID())),
     pivot_allocator_(lib::ObMemAttr(MTL_ID(), blocksstable::OB_ENCODING_LABEL_PIVOT), OB_MALLOC_MIDDLE_BLOCK_SIZE),
     datum_row_offset_arr_(OB_MALLOC_NORMAL_BLOCK_SIZE, ModulePageAllocator("CSBlkEnc", MTL_ID())),
@@ -201,6 +201,7 @@ void ObMicroBlockCSEncoder::reset()
   expand_pct_ = DEFAULT_ESTIMATE_REAL_SIZE_PCT;
   row_buf_holder_.reset();
   all_string_data_buffer_.reset();
+  hash_index_buffer_.reset();
   free_encoders_();
   encoders_.reset();
   stream_offsets_.reset();
@@ -225,6 +226,7 @@ void ObMicroBlockCSEncoder::reuse()
   // pivot_allocator_  pivot array memory is cached until encoder reset()
   row_buf_holder_.reuse();
   all_string_data_buffer_.reuse();
+  hash_index_buffer_.reuse();
   datum_row_offset_arr_.reuse();
   estimate_size_ = 0;
   // estimate_size_limit_
@@ -624,17 +626,21 @@ int ObMicroBlockCSEncoder::build_block(char *&buf, int64_t &size)
     } else if (OB_FAIL(store_stream_offsets_(stream_offsets_length))) {
       LOG_WARN("fail to store stream offsets", K(ret));
 
+    // <4> store hash index
+    } else if (OB_FAIL(store_hash_index_())) {
+      LOG_WARN("fail to store hash index", K(ret), K(hash_index_buffer_.length()));
+
     } else {
       ObMicroBlockHeader *header = get_header(data_buffer_);
       const int64_t header_size = header->header_size_;
       char *tmp_buf = data_buffer_.data() + header_size;
       ObAllColumnHeader *all_column_header = reinterpret_cast<ObAllColumnHeader*>(tmp_buf);
       ObCSColumnHeader *column_headers = reinterpret_cast<ObCSColumnHeader*>(tmp_buf + sizeof(ObAllColumnHeader));
-      // <4> fill column headers
+      // <5> fill column headers
       for (int64_t i = 0; i < encoders_.count(); i++) {
         column_headers[i] = encoders_.at(i)->get_column_header();
       }
-      // <5> fill all column header
+      // <6> fill all column header
       all_column_header->reuse();
       all_column_header->all_string_data_length_ = all_string_data_size;
       all_column_header->stream_offsets_length_ = stream_offsets_length;
@@ -642,8 +648,10 @@ int ObMicroBlockCSEncoder::build_block(char *&buf, int64_t &size)
       if (is_all_string_compress) {
         all_column_header->set_is_all_string_compressed();
       }
-      // <6> fill micro header
+      // <7> fill micro header
       header->row_count_ = datum_row_offset_arr_.count();
+      header->contains_hash_index_ = hash_index_buffer_.length() > 0 ? 1 : 0;
+      header->hash_index_offset_from_end_ = hash_index_buffer_.length();
       header->has_string_out_row_ = has_string_out_row_;
       header->all_lob_in_row_ = !has_lob_out_row_;
       header->max_merged_trans_version_ = max_merged_trans_version_;
@@ -671,6 +679,56 @@ int ObMicroBlockCSEncoder::build_block(char *&buf, int64_t &size)
   return ret;
 }
 
+int ObMicroBlockCSEncoder::append_hash_index(ObMicroBlockHashIndexBuilder &hash_index_builder)
+{
+  int ret = OB_SUCCESS;
+  hash_index_buffer_.reuse();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (!hash_index_builder.is_valid()) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (hash_index_builder.is_abandoned()) {
+    // the space was not enough when rows were appended
+    ret = OB_NOT_SUPPORTED;
+  } else if (is_contain_uncommitted_row()
+      || hash_index_builder.get_row_count() != datum_row_offset_arr_.count()) {
+    // rows beyond MAX_OFFSET_SUPPORTED are not indexed, fall back to binary search
+    ret = OB_NOT_SUPPORTED;
+  } else if (!hash_index_buffer_.is_inited() && OB_FAIL(hash_index_buffer_.init(
+      ObMicroBlockHashIndex::get_serialize_size(ObMicroBlockHashIndex::MAX_BUCKET_NUMBER)))) {
+    LOG_WARN("fail to init hash index buffer", K(ret));
+  } else if (OB_FAIL(hash_index_builder.build_block(hash_index_buffer_))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("fail to build hash index", K(ret));
+    }
+    hash_index_buffer_.reuse();
+  }
+  return ret;
+}
+
+int ObMicroBlockCSEncoder::store_hash_index_()
+{
+  int ret = OB_SUCCESS;
+  if (0 == hash_index_buffer_.length()) {
+    // no hash index
+  } else if (data_buffer_.length() + hash_index_buffer_.length() > block_size_upper_bound_) {
+    // the estimated block size may be smaller than the encoded one, the micro block is built
+    // without hash index rather than exceeding the upper bound of block size
+    LOG_TRACE("cs micro block is built without hash index since it exceeds upper bound",
+        K(data_buffer_.length()), K(hash_index_buffer_.length()), K_(block_size_upper_bound));
+    hash_index_buffer_.reuse();
+  } else if (OB_FAIL(data_buffer_.write(hash_index_buffer_.data(), hash_index_buffer_.length()))) {
+    LOG_WARN("fail to write hash index", K(ret), K(hash_index_buffer_.length()));
+  }
+  return ret;
+}
+
+bool ObMicroBlockCSEncoder::has_enough_space_for_hash_index(const int64_t hash_index_size) const
+{
+  return get_block_size() + hash_index_size <= block_size_upper_bound_;
+}
+
 int ObMicroBlockCSEncoder::init_column_ctxs_()
 {
   int ret = OB_SUCCESS;
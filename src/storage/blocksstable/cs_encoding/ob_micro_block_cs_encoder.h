@@ -63,6 +63,10 @@ public:
   }
   virtual int64_t get_original_size() const override { return all_headers_size_ + estimate_size_; }
   virtual void dump_diagnose_info() const override;
+  // hash index is built only if every row of the micro block has been added to the builder,
+  // it is appended after stream offsets in build_block().
+  virtual int append_hash_index(ObMicroBlockHashIndexBuilder &hash_index_builder) override;
+  virtual bool has_enough_space_for_hash_index(const int64_t hash_index_size) const override;
 
 private:
   int inner_init_();
@@ -105,6 +109,7 @@ private:
   int store_columns_(int64_t &column_data_offset);
   int store_all_string_data_(uint32_t &data_size, bool &use_compress);
   int store_stream_offsets_(int64_t &stream_offsets_length);
+  int store_hash_index_();
   template <typename T>
   int do_encode_stream_offsets_(ObIntegerStreamEncoderCtx enc_ctx);
 
@@ -123,6 +128,7 @@ private:
   ObMicroBufferWriter row_buf_holder_;
   ObMicroBufferWriter data_buffer_;
   ObMicroBufferWriter all_string_data_buffer_;
+  ObMicroBufferWriter hash_index_buffer_;
 
   common::ObArray<ObColDatums *> all_col_datums_;
   ObArenaAllocator pivot_allocator_;
@@ -17,6 +17,7 @@
 #include "ob_bit_stream.h"
 #include "ob_integer_array.h"
 #include "ob_raw_decoder.h"
+#include "storage/ob_storage_util.h"
 
 namespace oceanbase
 {
@@ -358,9 +359,9 @@ int ObHexStringDecoder::pushdown_operator(
     const sql::PushdownFilterInfo &pd_filter_info,
     ObBitmap &result_bitmap) const
 {
-  // No enough meta data to improve comparison operation, so only implement is null, not null operator here
-  // Other pushdown operators will retrograde to row-wise decode and compare
-  UNUSEDx(parent, meta_data);
+  // No enough meta data to improve comparison operation, so value operators unpack and compare
+  // cells in place instead of retrograding to row-wise decode
+  UNUSED(meta_data);
   int ret = OB_SUCCESS;
   const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
   const char *col_data = reinterpret_cast<const char *>(header_) + col_ctx.col_header_->length_;
@@ -391,6 +392,19 @@ int ObHexStringDecoder::pushdown_operator(
         }
         break;
       }
+      case sql::WHITE_OP_EQ:
+      case sql::WHITE_OP_NE:
+      case sql::WHITE_OP_GT:
+      case sql::WHITE_OP_GE:
+      case sql::WHITE_OP_LT:
+      case sql::WHITE_OP_LE:
+      case sql::WHITE_OP_BT:
+      case sql::WHITE_OP_IN: {
+        if (OB_FAIL(traverse_all_data(parent, col_ctx, row_index, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("Failed to traverse all data and evaluate operator", K(ret), K(op_type));
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
       }
@@ -399,5 +413,108 @@ int ObHexStringDecoder::pushdown_operator(
   return ret;
 }
 
+int ObHexStringDecoder::traverse_all_data(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const common::ObIArray<common::ObDatum> &ref_datums = filter.get_datums();
+  const static uint32_t min_buf_size = 128;
+  const int64_t buf_size = std::max(header_->max_string_size_, min_buf_size);
+  char *buf = nullptr;
+  if (OB_UNLIKELY(pd_filter_info.count_ != result_bitmap.size()
+                  || (sql::WHITE_OP_IN == op_type && 0 == ref_datums.count())
+                  || (sql::WHITE_OP_BT == op_type && 2 != ref_datums.count())
+                  || (sql::WHITE_OP_IN != op_type && sql::WHITE_OP_BT != op_type && 1 != ref_datums.count()))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Filter pushdown operator: Invalid argument",
+        K(ret), K(col_ctx), K(pd_filter_info), K(result_bitmap.size()), K(filter));
+  } else if (OB_ISNULL(buf = static_cast<char *>(col_ctx.allocator_->alloc(buf_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to allocate memory", K(ret), K(buf_size));
+  } else {
+    const char *col_data = reinterpret_cast<const char *>(header_) + col_ctx.col_header_->length_;
+    int64_t fix_data_offset = 0;
+    if (col_ctx.has_extend_value() && col_ctx.is_fix_length()) {
+      fix_data_offset = col_ctx.micro_block_header_->row_count_ * col_ctx.micro_block_header_->extend_value_bit_;
+      fix_data_offset = (fix_data_offset + CHAR_BIT - 1) / CHAR_BIT;
+    }
+    ObDatumCmpFuncType cmp_func = filter.cmp_func_;
+    ObGetFilterCmpRetFunc get_cmp_ret = get_filter_cmp_ret_func(op_type);
+    ObStorageDatum cur_datum;
+    const char *cell_data = nullptr;
+    int64_t cell_len = 0;
+    const char *row_data = nullptr;
+    int64_t row_len = 0;
+    int64_t row_id = 0;
+    for (int64_t offset = 0; OB_SUCC(ret) && offset < pd_filter_info.count_; ++offset) {
+      row_id = offset + pd_filter_info.start_;
+      if (nullptr != parent && parent->can_skip_filter(offset)) {
+        continue;
+      } else if (col_ctx.has_extend_value() && result_bitmap.test(offset)) {
+        // datum in this row is null
+        if (OB_FAIL(result_bitmap.set(offset, false))) {
+          LOG_WARN("Failed to set null value to false", K(ret), K(offset), K(pd_filter_info));
+        }
+        continue;
+      }
+      // unpack the cell into the reused buffer
+      int64_t str_len = header_->max_string_size_;
+      if (col_ctx.is_fix_length()) {
+        cell_data = col_data + fix_data_offset + row_id * header_->length_;
+      } else if (OB_FAIL(locate_row_data(col_ctx, row_index, row_id, row_data, row_len))) {
+        LOG_WARN("Failed to read row data from row index", K(ret), KP(row_index), K(row_id));
+      } else if (OB_FAIL(ObRawDecoder::locate_cell_data(cell_data, cell_len,
+          row_data, row_len, *col_ctx.micro_block_header_, *col_ctx.col_header_, *header_))) {
+        LOG_WARN("Failed to locate cell data", K(ret), K(row_len), KP(row_data), K(row_id), K(col_ctx));
+      } else {
+        const ObVarHexCellHeader *cell_header = reinterpret_cast<const ObVarHexCellHeader *>(cell_data);
+        cell_data += sizeof(*cell_header);
+        str_len = (cell_len - sizeof(*cell_header)) * 2 - cell_header->odd_;
+      }
+      if (OB_SUCC(ret)) {
+        ObHexStringUnpacker unpacker(header_->hex_char_array_,
+            reinterpret_cast<const unsigned char *>(cell_data));
+        unpacker.unpack(reinterpret_cast<unsigned char *>(buf), str_len);
+        cur_datum.pack_ = static_cast<int32_t>(str_len);
+        cur_datum.ptr_ = buf;
+        if (col_ctx.obj_meta_.is_fixed_len_char_type() && nullptr != col_ctx.col_param_
+            && OB_FAIL(storage::pad_column(col_ctx.obj_meta_, col_ctx.col_param_->get_accuracy(),
+                                           *col_ctx.allocator_, cur_datum))) {
+          LOG_WARN("Failed to pad column", K(ret), K(row_id));
+        }
+      }
+      // evaluate the filter on the unpacked cell
+      bool result = false;
+      int cmp_res = 0;
+      if (OB_FAIL(ret)) {
+      } else if (sql::WHITE_OP_IN == op_type) {
+        if (OB_FAIL(filter.exist_in_datum_set(cur_datum, result))) {
+          LOG_WARN("Failed to check datum in hashset", K(ret), K(cur_datum));
+        }
+      } else if (OB_FAIL(cmp_func(cur_datum, ref_datums.at(0), cmp_res))) {
+        LOG_WARN("Failed to compare datum", K(ret), K(cur_datum), K(ref_datums.at(0)));
+      } else if (sql::WHITE_OP_BT != op_type) {
+        result = get_cmp_ret(cmp_res);
+      } else if (cmp_res < 0) {
+        result = false;
+      } else if (OB_FAIL(cmp_func(cur_datum, ref_datums.at(1), cmp_res))) {
+        LOG_WARN("Failed to compare datum", K(ret), K(cur_datum), K(ref_datums.at(1)));
+      } else {
+        result = cmp_res <= 0;
+      }
+      if (OB_SUCC(ret) && result && OB_FAIL(result_bitmap.set(offset))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(offset), K(pd_filter_info), K(filter));
+      }
+    }
+  }
+  return ret;
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
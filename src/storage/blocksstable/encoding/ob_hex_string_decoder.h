@@ -72,6 +72,15 @@ public:
       const sql::PushdownFilterInfo &pd_filter_info,
       ObBitmap &result_bitmap) const override;
 private:
+  // unpack the cells of @pd_filter_info one by one and evaluate value operators on them
+  int traverse_all_data(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex* row_index,
+      const sql::ObWhiteFilterExecutor &filter,
+      const sql::PushdownFilterInfo &pd_filter_info,
+      ObBitmap &result_bitmap) const;
+
   template <typename VectorType>
   int inner_decode_vector(
       const ObColumnDecoderCtx &decoder_ctx,
@@ -14,6 +14,7 @@
 
 #include "ob_rle_decoder.h"
 #include "ob_dict_decoder.h"
+#include "ob_raw_decoder.h"
 #include "storage/blocksstable/ob_block_sstable_struct.h"
 #include "storage/access/ob_pushdown_aggregate.h"
 #include "ob_bit_stream.h"
@@ -272,6 +273,12 @@ int ObRLEDecoder::eq_ne_operator(
     const int64_t dict_meta_length = col_ctx.col_header_->length_ - meta_header_->offset_;
     const ObDatum &ref_datum = filter.get_datums().at(0);
     if (dict_count > 0) {
+      // collect matched refs first, then traverse runs only once
+      bool found = false;
+      const int64_t ref_bitset_size = dict_count + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
       ObDatumCmpFuncType cmp_func = filter.cmp_func_;
       ObDictDecoderIterator traverse_it = dict_decoder_.begin(&col_ctx, dict_meta_length);
       ObDictDecoderIterator end_it = dict_decoder_.end(&col_ctx, dict_meta_length);
@@ -281,15 +288,16 @@ int ObRLEDecoder::eq_ne_operator(
         if (OB_FAIL(cmp_func(*traverse_it, ref_datum, cmp_res))) {
           LOG_WARN("Failed to compare datum", K(ret), K(*traverse_it), K(ref_datum));
         } else if (cmp_res == 0) {
-          if (OB_FAIL(cmp_ref_and_set_res(parent, col_ctx, dict_ref,
-              sql::WHITE_OP_EQ, true, pd_filter_info, result_bitmap))) {
-            LOG_WARN("Failed to compare reference and set result bitmap",
-                K(ret), K(dict_ref), K(filter));
-          }
+          found = true;
+          ref_bitset->set(dict_ref);
         }
         ++traverse_it;
         ++dict_ref;
       }
+      if (OB_SUCC(ret) && found && OB_FAIL(set_res_with_bitset(parent, col_ctx,
+          ref_bitset, pd_filter_info, result_bitmap))) {
+        LOG_WARN("Failed to set result_bitmap", K(ret), K(filter));
+      }
     }
     if (OB_SUCC(ret) && filter.get_op_type() == sql::WHITE_OP_NE) {
       if (OB_FAIL(result_bitmap.bit_not())) {
@@ -463,25 +471,25 @@ int ObRLEDecoder::cmp_ref_and_set_res(
 {
   UNUSED(parent);
   int ret = OB_SUCCESS;
-  const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
   const ObIntArrayFuncTable &refs = ObIntArrayFuncTable::instance(meta_header_->ref_byte_);
-  int64_t row_id;
-  int64_t next_row_id;
+  const int64_t dict_count = dict_decoder_.get_dict_header()->count_;
+  int64_t begin_run = 0;
+  int64_t end_run = 0;
   int64_t ref;
   ObGetFilterCmpRetFunc get_cmp_ret = get_filter_cmp_ret_func(cmp_op);
-  for (int64_t i = 0; OB_SUCC(ret) && i < meta_header_->count_ ; ++i) {
-    ref = refs.at_(meta_header_->payload_ + ref_offset_, i);
-    if (get_cmp_ret(ref - dict_ref)
-        && (ref < dict_decoder_.get_dict_header()->count_ || sql::WHITE_OP_EQ == cmp_op)) {
-      row_id = row_ids.at_(meta_header_->payload_, i);
-      next_row_id = i != meta_header_->count_ - 1
-                          ? row_ids.at_(meta_header_->payload_, i + 1)
-                          : col_ctx.micro_block_header_->row_count_;
-      for (int64_t idx = row_id; OB_SUCC(ret) && idx < next_row_id; ++idx) {
-        if (idx >= pd_filter_info.start_ && idx < pd_filter_info.start_ + pd_filter_info.count_
-            && OB_FAIL(result_bitmap.set(idx - pd_filter_info.start_, flag))) {
-          LOG_WARN("Failed to set result_bitmap",
-              K(ret), K(row_id), K(pd_filter_info), K(next_row_id), K(idx));
+  get_filter_run_range(pd_filter_info, begin_run, end_run);
+  if (sql::WHITE_OP_EQ == cmp_op) {
+    if (OB_FAIL(eq_ref_and_set_res(col_ctx, dict_ref, begin_run, end_run, flag,
+        pd_filter_info, result_bitmap))) {
+      LOG_WARN("Failed to compare reference and set result bitmap",
+          K(ret), K(dict_ref), K(begin_run), K(end_run), K(pd_filter_info));
+    }
+  } else {
+    for (int64_t i = begin_run; OB_SUCC(ret) && i < end_run; ++i) {
+      ref = refs.at_(meta_header_->payload_ + ref_offset_, i);
+      if (get_cmp_ret(ref - dict_ref) && ref < dict_count) {
+        if (OB_FAIL(set_run_res(col_ctx, i, flag, pd_filter_info, result_bitmap))) {
+          LOG_WARN("Failed to set result_bitmap", K(ret), K(i), K(ref), K(pd_filter_info));
         }
       }
     }
@@ -498,23 +506,57 @@ int ObRLEDecoder::set_res_with_bitset(
 {
   UNUSED(parent);
   int ret = OB_SUCCESS;
-  const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
   const ObIntArrayFuncTable &refs = ObIntArrayFuncTable::instance(meta_header_->ref_byte_);
-  int64_t row_id;
-  int64_t next_row_id;
+  int64_t begin_run = 0;
+  int64_t end_run = 0;
   int64_t ref;
-  for (int64_t i = 0; OB_SUCC(ret) && i < meta_header_->count_ ; ++i) {
+  get_filter_run_range(pd_filter_info, begin_run, end_run);
+  for (int64_t i = begin_run; OB_SUCC(ret) && i < end_run; ++i) {
     ref = refs.at_(meta_header_->payload_ + ref_offset_, i);
     if (ref_bitset->exist(ref)) {
-      row_id = row_ids.at_(meta_header_->payload_, i);
-      next_row_id = i != meta_header_->count_ - 1
-                          ? row_ids.at_(meta_header_->payload_, i + 1)
-                          : col_ctx.micro_block_header_->row_count_;
-      for (int64_t idx = row_id; OB_SUCC(ret) && idx < next_row_id; ++idx) {
-        if (idx >= pd_filter_info.start_ && idx < pd_filter_info.start_ + pd_filter_info.count_
-            && OB_FAIL(result_bitmap.set(idx - pd_filter_info.start_))) {
-          LOG_WARN("Failed to set result_bitmap",
-              K(ret), K(row_id), K(pd_filter_info), K(next_row_id), K(idx));
+      if (OB_FAIL(set_run_res(col_ctx, i, true, pd_filter_info, result_bitmap))) {
+        LOG_WARN("Failed to set result_bitmap", K(ret), K(i), K(ref), K(pd_filter_info));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObRLEDecoder::eq_ref_and_set_res(
+    const ObColumnDecoderCtx &col_ctx,
+    const int64_t dict_ref,
+    const int64_t begin_run,
+    const int64_t end_run,
+    const bool flag,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const uint8_t ref_byte = meta_header_->ref_byte_;
+  if (OB_UNLIKELY(0 == ref_byte || 0 != (ref_byte & (ref_byte - 1)))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected ref byte", K(ret), K(ref_byte));
+  } else {
+    // compare the refs of the runs with the multitarget kernel, then fill the matched runs
+    const int32_t fix_len_tag = get_value_len_tag_map()[ref_byte];
+    raw_compare_function cmp_function = RawCompareFunctionFactory::instance().get_cmp_function(
+                                          false, fix_len_tag, sql::WHITE_OP_EQ);
+    const unsigned char *ref_data =
+        reinterpret_cast<const unsigned char *>(meta_header_->payload_ + ref_offset_);
+    uint8_t selection[RUN_CMP_BATCH_SIZE];
+    if (OB_ISNULL(cmp_function)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected nullptr compare function", K(ret), K(fix_len_tag));
+    }
+    for (int64_t batch_begin = begin_run; OB_SUCC(ret) && batch_begin < end_run;
+         batch_begin += RUN_CMP_BATCH_SIZE) {
+      const int64_t batch_end = MIN(batch_begin + RUN_CMP_BATCH_SIZE, end_run);
+      cmp_function(ref_data, static_cast<uint64_t>(dict_ref), selection,
+                   static_cast<uint32_t>(batch_begin), static_cast<uint32_t>(batch_end));
+      for (int64_t i = batch_begin; OB_SUCC(ret) && i < batch_end; ++i) {
+        if (0 != selection[i - batch_begin]
+            && OB_FAIL(set_run_res(col_ctx, i, flag, pd_filter_info, result_bitmap))) {
+          LOG_WARN("Failed to set result_bitmap", K(ret), K(i), K(dict_ref), K(pd_filter_info));
         }
       }
     }
@@ -522,6 +564,43 @@ int ObRLEDecoder::set_res_with_bitset(
   return ret;
 }
 
+void ObRLEDecoder::get_filter_run_range(
+    const sql::PushdownFilterInfo &pd_filter_info,
+    int64_t &begin_run,
+    int64_t &end_run) const
+{
+  const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
+  const int64_t run_count = meta_header_->count_;
+  // the run contains the first row to filter, row id of the first run is always 0
+  begin_run = MAX(0, row_ids.upper_bound_(meta_header_->payload_, 0, run_count,
+                                          pd_filter_info.start_) - 1);
+  end_run = row_ids.lower_bound_(meta_header_->payload_, 0, run_count,
+                                 pd_filter_info.start_ + pd_filter_info.count_);
+}
+
+int ObRLEDecoder::set_run_res(
+    const ObColumnDecoderCtx &col_ctx,
+    const int64_t run_idx,
+    const bool flag,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
+  const int64_t row_id = row_ids.at_(meta_header_->payload_, run_idx);
+  const int64_t next_row_id = run_idx != meta_header_->count_ - 1
+                              ? row_ids.at_(meta_header_->payload_, run_idx + 1)
+                              : col_ctx.micro_block_header_->row_count_;
+  const int64_t begin = MAX(row_id, pd_filter_info.start_);
+  const int64_t end = MIN(next_row_id, pd_filter_info.start_ + pd_filter_info.count_);
+  if (begin < end
+      && OB_FAIL(result_bitmap.set_bitmap_batch(begin - pd_filter_info.start_, end - begin, flag))) {
+    LOG_WARN("Failed to set result_bitmap",
+        K(ret), K(row_id), K(next_row_id), K(pd_filter_info), K(flag));
+  }
+  return ret;
+}
+
 template<typename T>
 int ObRLEDecoder::extract_ref_and_null_count(
     const int32_t *row_ids,
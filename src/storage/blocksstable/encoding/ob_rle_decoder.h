@@ -31,6 +31,8 @@ class ObRLEDecoder : public ObIColumnDecoder
 {
 public:
   static const ObColumnHeader::Type type_ = ObColumnHeader::RLE;
+  // refs of runs compared by the multitarget kernel in one batch
+  static const int64_t RUN_CMP_BATCH_SIZE = 256;
 
   ObRLEDecoder() : meta_header_(NULL),
                    ref_offset_(0), dict_decoder_()
@@ -135,6 +137,30 @@ private:
       const sql::PushdownFilterInfo &pd_filter_info,
       ObBitmap &result_bitmap) const;
 
+  // set result of the runs in [begin_run, end_run) whose ref equals @dict_ref
+  int eq_ref_and_set_res(
+      const ObColumnDecoderCtx &col_ctx,
+      const int64_t dict_ref,
+      const int64_t begin_run,
+      const int64_t end_run,
+      const bool flag,
+      const sql::PushdownFilterInfo &pd_filter_info,
+      ObBitmap &result_bitmap) const;
+
+  // runs in [begin_run, end_run) overlap with the rows of @pd_filter_info
+  void get_filter_run_range(
+      const sql::PushdownFilterInfo &pd_filter_info,
+      int64_t &begin_run,
+      int64_t &end_run) const;
+
+  // set result of the rows of run @run_idx in the range of @pd_filter_info in batch
+  int set_run_res(
+      const ObColumnDecoderCtx &col_ctx,
+      const int64_t run_idx,
+      const bool flag,
+      const sql::PushdownFilterInfo &pd_filter_info,
+      ObBitmap &result_bitmap) const;
+
   template <typename T>
   int extract_ref_and_null_count(
       const int32_t *row_ids,
@@ -966,10 +966,13 @@ int ObMacroBlockWriter::update_micro_commit_info(const ObDatumRow &row)
 int ObMacroBlockWriter::init_hash_index_builder(const ObMacroDataSeq &start_seq)
 {
   int ret = OB_SUCCESS;
-  if (data_store_desc_->get_tablet_id().is_user_tablet()
-      && !data_store_desc_->is_major_or_meta_merge_type()
-      && start_seq.is_data_block()) {
-    // only build hash index for data block in minor
+  if (!data_store_desc_->get_tablet_id().is_user_tablet() || !start_seq.is_data_block()) {
+  } else if (!data_store_desc_->is_major_or_meta_merge_type()
+      || (CS_ENCODING_ROW_STORE == data_store_desc_->get_row_store_type()
+          && data_store_desc_->is_major_merge_type()
+          && !data_store_desc_->is_cg()
+          && data_store_desc_->get_major_working_cluster_version() >= DATA_VERSION_4_3_3_0)) {
+    // build hash index for data block in minor, and for cs encoding data block of row store in major
     if (OB_FAIL(hash_index_builder_.init_if_needed(data_store_desc_))) {
       STORAGE_LOG(WARN, "Failed to build hash_index builder", K(ret));
     }
@@ -977,6 +980,12 @@ int ObMacroBlockWriter::init_hash_index_builder(const ObMacroDataSeq &start_seq)
   return ret;
 }
 
+bool ObMacroBlockWriter::is_hash_index_row_store_type() const
+{
+  const ObRowStoreType row_store_type = data_store_desc_->get_row_store_type();
+  return FLAT_ROW_STORE == row_store_type || CS_ENCODING_ROW_STORE == row_store_type;
+}
+
 int ObMacroBlockWriter::init_data_pre_warmer(const ObMacroDataSeq &start_seq)
 {
   int ret = OB_SUCCESS;
@@ -1013,20 +1022,34 @@ int ObMacroBlockWriter::append_row_and_hash_index(const ObDatumRow &row)
       STORAGE_LOG(WARN, "Failed to append row in micro writer", K(ret), K(row));
     }
   } else if (hash_index_builder_.is_valid()) {
-    if (OB_UNLIKELY(FLAT_ROW_STORE != data_store_desc_->get_row_store_type())) {
+    if (OB_UNLIKELY(!is_hash_index_row_store_type())) {
       ret = OB_ERR_UNEXPECTED;
       STORAGE_LOG(WARN, "Unexpected row store type", K(ret), K(data_store_desc_->get_row_store_type()));
+    } else if (hash_index_builder_.is_abandoned()) {
+      // the current micro block is built without hash index
     } else {
       int64_t hash_index_size = hash_index_builder_.estimate_size(true);
       if (OB_UNLIKELY(!micro_writer_->has_enough_space_for_hash_index(hash_index_size))) {
-        ret = OB_BUF_NOT_ENOUGH;
+        if (CS_ENCODING_ROW_STORE != data_store_desc_->get_row_store_type()) {
+          ret = OB_BUF_NOT_ENOUGH;
+        } else {
+          // the row has been appended to cs encoder, which does not rebuild the micro block for
+          // hash index, so the micro block is built without hash index
+          hash_index_builder_.abandon();
+          STORAGE_LOG(TRACE, "cs micro block is built without hash index since space is not enough",
+              K(hash_index_size), "row_count", hash_index_builder_.get_row_count());
+        }
       } else if (OB_FAIL(hash_index_builder_.add(row))) {
         if (ret != OB_NOT_SUPPORTED) {
           STORAGE_LOG(WARN, "Failed to append hash index", K(ret), K(row));
         } else {
           ret = OB_SUCCESS;
+          // cs encoding micro block holds much more rows, only the micro block with too many rows
+          // is built without hash index
+          if (FLAT_ROW_STORE == data_store_desc_->get_row_store_type()) {
+            hash_index_builder_.reset();
+          }
         }
-        hash_index_builder_.reset();
       }
     }
   }
@@ -1167,7 +1190,7 @@ int ObMacroBlockWriter::build_hash_index_block()
 {
   int ret = OB_SUCCESS;
   if (hash_index_builder_.is_valid()) {
-    if (OB_UNLIKELY(FLAT_ROW_STORE != data_store_desc_->get_row_store_type())) {
+    if (OB_UNLIKELY(!is_hash_index_row_store_type())) {
       ret = OB_ERR_UNEXPECTED;
       STORAGE_LOG(WARN, "Unexpected row store type", K(ret), K(data_store_desc_->get_row_store_type()));
     } else if (OB_FAIL(micro_writer_->append_hash_index(hash_index_builder_))) {
@@ -1175,8 +1198,10 @@ int ObMacroBlockWriter::build_hash_index_block()
         LOG_WARN("Failed to append hash index to micro block writer", K(ret));
       } else {
         ret = OB_SUCCESS;
+        if (FLAT_ROW_STORE == data_store_desc_->get_row_store_type()) {
+          hash_index_builder_.reset();
+        }
       }
-      hash_index_builder_.reset();
     }
   }
   return ret;
@@ -179,6 +179,7 @@ private:
   int append(const ObDataMacroBlockMeta &macro_meta);
   int check_order(const ObDatumRow &row);
   int init_hash_index_builder(const ObMacroDataSeq &start_seq);
+  bool is_hash_index_row_store_type() const;
   int init_data_pre_warmer(const ObMacroDataSeq &start_seq);
   int append_row_and_hash_index(const ObDatumRow &row);
   int init_pre_agg_util(const ObDataStoreDesc &data_store_desc);
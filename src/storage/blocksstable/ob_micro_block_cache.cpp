@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX STORAGE
 
 #include "storage/blocksstable/ob_micro_block_cache.h"
+#include "storage/blocksstable/ob_micro_block_secondary_cache.h"
 #include "storage/blocksstable/ob_block_manager.h"
 #include "storage/blocksstable/ob_macro_block_handle.h"
 #include "storage/blocksstable/ob_shared_macro_block_manager.h"
@@ -419,6 +420,12 @@ int ObIMicroBlockIOCallback::process_block(
         LOG_WARN("Fail to get kvcache", K(ret));
       } else if (OB_UNLIKELY(OB_SUCCESS == (ret = kvcache->get(key, micro_block, cache_handle)))) {
         // entry exist, no need to put
+      } else if (!kvcache->admit(tenant_id_, key, ObKVStoreMemBlock::get_align_size(sizeof(ObMicroBlockCacheKey),
+          sizeof(ObMicroBlockCacheValue) + header.header_size_ + header.original_length_))) {
+        // rejected by the admission policy before any memory of the cache is taken
+        if (OB_FAIL(read_block_and_copy(header, *reader, buffer, size, block_data, micro_block, cache_handle))) {
+          LOG_WARN("Fail to read micro block and copy to cache value", K(ret));
+        }
       } else if (OB_FAIL(cache_->put_cache_block(
           block_des_meta_, buffer, key, *reader, *allocator_, micro_block, cache_handle, rowkey_col_descs_))) {
         LOG_WARN("Failed to put block to cache", K(ret));
@@ -536,6 +543,59 @@ const char *ObAsyncSingleMicroBlockIOCallback::get_data()
   return reinterpret_cast<const char *>(micro_block_);
 }
 
+/*-----------------------------------ObSecondaryCacheMicroBlockIOCallback-----------------------------------*/
+ObSecondaryCacheMicroBlockIOCallback::ObSecondaryCacheMicroBlockIOCallback()
+  : ObIMicroBlockIOCallback(),
+    secondary_cache_(nullptr),
+    location_(),
+    block_size_(0),
+    micro_block_(nullptr),
+    cache_handle_()
+{
+  STATIC_ASSERT(sizeof(*this) <= CALLBACK_BUF_SIZE, "IOCallback buf size not enough");
+}
+
+ObSecondaryCacheMicroBlockIOCallback::~ObSecondaryCacheMicroBlockIOCallback()
+{
+  // micro_block_ is always kept in block cache
+  micro_block_ = nullptr;
+}
+
+int64_t ObSecondaryCacheMicroBlockIOCallback::size() const
+{
+  return sizeof(*this);
+}
+
+int ObSecondaryCacheMicroBlockIOCallback::inner_process(const char *data_buffer, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  const char *block_buf = nullptr;
+  int64_t block_size = 0;
+  ObTimeGuard time_guard("SecondaryCache_Callback_Process", 100000); //100ms
+  if (OB_ISNULL(cache_) || OB_ISNULL(secondary_cache_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Invalid micro block cache callback, ", K(ret), KP_(cache), KP_(secondary_cache));
+  } else if (OB_UNLIKELY(size <= 0 || data_buffer == nullptr)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid data buffer size", K(ret), K(size), KP(data_buffer));
+  } else if (OB_FAIL(secondary_cache_->check_entry(location_, data_buffer, size, block_buf, block_size))) {
+    // the micro block is read from the macro block by sync io then
+    LOG_WARN("Fail to check micro block read from secondary cache", K(ret), K_(location));
+  } else {
+    const ObMicroBlockCacheKey key(tenant_id_, block_id_, offset_, block_size_);
+    if (OB_FAIL(static_cast<ObDataMicroBlockCache *>(cache_)->put_secondary_cache_block(
+        key, block_buf, block_size, micro_block_, cache_handle_))) {
+      LOG_WARN("Fail to put micro block read from secondary cache", K(ret), K(key));
+    }
+  }
+  return ret;
+}
+
+const char *ObSecondaryCacheMicroBlockIOCallback::get_data()
+{
+  return reinterpret_cast<const char *>(micro_block_);
+}
+
 /*-----------------------------------ObMultiDataBlockIOCallback-----------------------------------*/
 ObMultiDataBlockIOCallback::ObMultiDataBlockIOCallback()
   : ObIMicroBlockIOCallback(),
@@ -1049,6 +1109,18 @@ void ObDataMicroBlockCache::destroy()
 {
   common::ObKVCache<ObMicroBlockCacheKey, ObMicroBlockCacheValue>::destroy();
   allocator_.destroy();
+  secondary_cache_ = nullptr;
+}
+
+int ObDataMicroBlockCache::set_secondary_cache(ObMicroBlockSecondaryCache *secondary_cache)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(set_wash_callback(secondary_cache))) {
+    LOG_WARN("Fail to set wash callback", K(ret), KP(secondary_cache));
+  } else {
+    ATOMIC_STORE(&secondary_cache_, secondary_cache);
+  }
+  return ret;
 }
 
 int ObDataMicroBlockCache::prefetch_multi_block(
@@ -1344,6 +1416,112 @@ int ObDataMicroBlockCache::reserve_kvpair(
   return ret;
 }
 
+int ObDataMicroBlockCache::prefetch_secondary_cache_block(
+    const uint64_t tenant_id,
+    const ObMicroIndexInfo &idx_row,
+    ObMacroBlockHandle &macro_handle,
+    ObIAllocator *allocator)
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockSecondaryCache *secondary_cache = ATOMIC_LOAD(&secondary_cache_);
+  const ObMicroBlockCacheKey key(tenant_id, idx_row.get_macro_id(), idx_row.get_block_offset(), idx_row.get_block_size());
+  ObMicroBlockSecondaryCache::Location location;
+  void *buf = nullptr;
+  ObSecondaryCacheMicroBlockIOCallback *callback = nullptr;
+  if (OB_ISNULL(secondary_cache)) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_ISNULL(allocator)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(allocator));
+  } else if (OB_FAIL(secondary_cache->get_location(key, location))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("Fail to get micro block location in secondary cache", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(buf = allocator->alloc(sizeof(ObSecondaryCacheMicroBlockIOCallback)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate callback memory failed", K(ret));
+  } else {
+    callback = new (buf) ObSecondaryCacheMicroBlockIOCallback;
+    callback->cache_ = this;
+    callback->put_size_stat_ = this;
+    callback->allocator_ = allocator;
+    callback->tenant_id_ = tenant_id;
+    callback->block_id_ = idx_row.get_macro_id();
+    callback->offset_ = idx_row.get_block_offset();
+    callback->block_size_ = idx_row.get_block_size();
+    callback->secondary_cache_ = secondary_cache;
+    callback->location_ = location;
+    macro_handle.reuse();
+    if (OB_FAIL(secondary_cache->async_read(location, *callback, macro_handle.get_io_handle()))) {
+      LOG_WARN("Fail to read micro block from secondary cache", K(ret), K(key), K(location));
+      callback->~ObSecondaryCacheMicroBlockIOCallback();
+      allocator->free(callback);
+    } else {
+      EVENT_INC(ObStatEventIds::IO_READ_PREFETCH_MICRO_COUNT);
+    }
+  }
+  if (OB_FAIL(ret) && OB_ENTRY_NOT_EXIST != ret) {
+    // fall back to read the micro block from the macro block
+    ret = OB_ENTRY_NOT_EXIST;
+  }
+  return ret;
+}
+
+int ObDataMicroBlockCache::put_secondary_cache_block(
+    const ObMicroBlockCacheKey &key,
+    const char *data_buf,
+    const int64_t block_size,
+    const ObMicroBlockCacheValue *&micro_block,
+    common::ObKVCacheHandle &cache_handle)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(data_buf) || OB_UNLIKELY(block_size < static_cast<int64_t>(sizeof(ObMicroBlockHeader)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(data_buf), K(block_size));
+  } else if (OB_SUCC(get(key, micro_block, cache_handle))) {
+    // put by another reader
+  } else if (OB_ENTRY_NOT_EXIST != ret) {
+    LOG_WARN("Fail to get micro block from block cache", K(ret), K(key));
+  } else {
+    ret = OB_SUCCESS;
+    // the secondary cache keeps decompressed micro blocks, which start with the micro block header
+    const ObMicroBlockHeader *header = reinterpret_cast<const ObMicroBlockHeader *>(data_buf);
+    const ObRowStoreType row_store_type = static_cast<ObRowStoreType>(header->row_store_type_);
+    ObKVCacheInstHandle inst_handle;
+    ObKVCachePair *kvpair = nullptr;
+    bool need_decoder = false;
+    const int64_t value_size = calc_value_size(block_size, row_store_type, need_decoder);
+    if (OB_FAIL(alloc(
+        key.get_tenant_id(), sizeof(ObMicroBlockCacheKey), value_size, kvpair, cache_handle, inst_handle))) {
+      LOG_WARN("Fail to allocate kvpair from kvcache", K(ret), K(value_size), K(key));
+    } else {
+      char *block_buf = reinterpret_cast<char *>(kvpair->value_) + sizeof(ObMicroBlockCacheValue);
+      MEMCPY(block_buf, data_buf, block_size);
+      kvpair->key_ = new (kvpair->key_) ObMicroBlockCacheKey(key);
+      ObMicroBlockCacheValue *cache_value = new (kvpair->value_) ObMicroBlockCacheValue(block_buf, block_size);
+      ObMicroBlockData &micro_data = cache_value->get_block_data();
+      micro_data.type_ = get_type();
+      if (need_decoder && OB_FAIL(write_extra_buf(
+          row_store_type, block_buf, block_size, block_buf + block_size, micro_data))) {
+        LOG_WARN("Fail to cache decoder on extra buffer for data block", K(ret), KPC(cache_value));
+      } else if (FALSE_IT(micro_block = cache_value)) {
+        // not checked by the admission policy, the block was admitted before it was washed to the secondary cache
+      } else if (OB_FAIL(put_kvpair(inst_handle, kvpair, cache_handle, false /* overwrite */))) {
+        if (OB_ENTRY_EXIST != ret) {
+          LOG_WARN("Fail to put micro block cache", K(ret));
+        } else {
+          ret = OB_SUCCESS;
+        }
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    cache_handle.reset();
+    micro_block = nullptr;
+  }
+  return ret;
+}
+
 ObMicroBlockData::Type ObDataMicroBlockCache::get_type()
 {
   return ObMicroBlockData::DATA_BLOCK;
@@ -22,6 +22,7 @@
 #include "storage/meta_mem/ob_tablet_handle.h"
 #include "lib/stat/ob_diagnose_info.h"
 #include "storage/blocksstable/ob_block_manager.h"
+#include "storage/blocksstable/ob_micro_block_secondary_cache.h"
 
 
 namespace oceanbase
@@ -310,6 +311,26 @@ protected:
   bool is_data_block_;
 };
 
+class ObSecondaryCacheMicroBlockIOCallback : public ObIMicroBlockIOCallback
+{
+public:
+  ObSecondaryCacheMicroBlockIOCallback();
+  virtual ~ObSecondaryCacheMicroBlockIOCallback();
+  virtual int64_t size() const;
+  virtual int inner_process(const char *data_buffer, const int64_t size) override;
+  virtual const char *get_data() override;
+  TO_STRING_KV("callback_type:", "ObSecondaryCacheMicroBlockIOCallback", KP_(micro_block), K_(cache_handle),
+      K_(block_id), K_(offset), K_(block_size), K_(location));
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObSecondaryCacheMicroBlockIOCallback);
+  friend class ObDataMicroBlockCache;
+  ObMicroBlockSecondaryCache *secondary_cache_;
+  ObMicroBlockSecondaryCache::Location location_;
+  int64_t block_size_;
+  const ObMicroBlockCacheValue *micro_block_;
+  common::ObKVCacheHandle cache_handle_;
+};
+
 class ObMicroBlockBufTransformer final
 {
  public:
@@ -404,11 +425,21 @@ class ObDataMicroBlockCache
     public ObIMicroBlockCache
 {
 public:
-  ObDataMicroBlockCache() {}
+  ObDataMicroBlockCache() : secondary_cache_(nullptr) {}
   virtual ~ObDataMicroBlockCache() {}
   int init(const char *cache_name, const int64_t priority = 1);
   virtual void destroy() override;
+  // washed data micro blocks are kept in secondary_cache if it is not null
+  int set_secondary_cache(ObMicroBlockSecondaryCache *secondary_cache);
   using ObIMicroBlockCache::prefetch;
+  // Read the washed micro block back from the secondary cache asynchronously like prefetch,
+  // the io callback puts it into the block cache.
+  // return OB_ENTRY_NOT_EXIST if the micro block can not be read from the secondary cache.
+  int prefetch_secondary_cache_block(
+      const uint64_t tenant_id,
+      const ObMicroIndexInfo &idx_row,
+      ObMacroBlockHandle &macro_handle,
+      ObIAllocator *allocator);
   int prefetch_multi_block(
       const uint64_t tenant_id,
       const MacroBlockId &macro_id,
@@ -443,6 +474,14 @@ public:
   virtual void cache_hit(int64_t &hit_cnt);
   virtual void cache_miss(int64_t &miss_cnt);
 private:
+  friend class ObSecondaryCacheMicroBlockIOCallback;
+  // put the micro block read back from the secondary cache into the block cache
+  int put_secondary_cache_block(
+      const ObMicroBlockCacheKey &key,
+      const char *block_buf,
+      const int64_t block_size,
+      const ObMicroBlockCacheValue *&micro_block,
+      common::ObKVCacheHandle &cache_handle);
   int64_t calc_value_size(const int64_t data_length, const ObRowStoreType &type, bool &need_decoder);
   int write_extra_buf(
       const ObRowStoreType row_store_type,
@@ -452,6 +491,7 @@ private:
       ObMicroBlockData &micro_data);
 private:
   common::ObConcurrentFIFOAllocator allocator_;
+  ObMicroBlockSecondaryCache *secondary_cache_;
   DISALLOW_COPY_AND_ASSIGN(ObDataMicroBlockCache);
 };
 
@@ -79,6 +79,8 @@ int ObMicroBlockHashIndexBuilder::add(const ObDatumRow &row)
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "Invalid input argument", K(ret),
                     K(row), K(schema_rowkey_col_cnt));
+  } else if (is_abandoned_) {
+    ret = OB_NOT_SUPPORTED;
   } else if (can_be_added_to_hash_index(row)) {
     // Caculate hash value by schema_rowkey_col_cnt.
     uint64_t hash_value = 0;
@@ -104,7 +106,7 @@ int ObMicroBlockHashIndexBuilder::build_block(ObMicroBufferWriter &buffer)
 {
   int ret = OB_SUCCESS;
   // ObMicroBlockHashIndexBuilder must be valid when call build_block.
-  if (OB_UNLIKELY(count_ <= ObMicroBlockHashIndex::MIN_ROWS_BUILD_HASH_INDEX)) {
+  if (OB_UNLIKELY(is_abandoned_ || count_ <= ObMicroBlockHashIndex::MIN_ROWS_BUILD_HASH_INDEX)) {
     ret = OB_NOT_SUPPORTED;
   } else {
     uint16_t num_buckets = caculate_bucket_number(count_);
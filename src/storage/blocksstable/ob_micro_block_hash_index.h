@@ -94,6 +94,7 @@ public:
     : count_(0),
       row_index_(0),
       last_key_with_L_flag_(false),
+      is_abandoned_(false),
       data_store_desc_(nullptr),
       is_inited_(false)
   {
@@ -106,9 +107,16 @@ public:
     row_index_ = 0;
     count_ = 0;
     last_key_with_L_flag_ = false;
+    is_abandoned_ = false;
     is_inited_ = false;
   }
   OB_INLINE bool is_empty() const { return 0 == count_; }
+  // The current micro block is built without hash index, add and build_block return
+  // OB_NOT_SUPPORTED until reuse.
+  OB_INLINE void abandon() { is_abandoned_ = true; }
+  OB_INLINE bool is_abandoned() const { return is_abandoned_; }
+  // count of rows added to the builder, rows after MAX_OFFSET_SUPPORTED are not counted
+  OB_INLINE uint32_t get_row_count() const { return row_index_; }
   OB_INLINE uint16_t caculate_bucket_number(uint32_t count) const
   {
     uint16_t estimated_num_buckets =
@@ -119,7 +127,7 @@ public:
   OB_INLINE int64_t estimate_size(bool plus_one = false) const
   {
     int64_t size = 0;
-    if (is_valid()) {
+    if (is_valid() && !is_abandoned_) {
       const uint32_t count = plus_one ? (count_ + 1) : count_;
       if (count > ObMicroBlockHashIndex::MIN_ROWS_BUILD_HASH_INDEX) {
         uint16_t estimated_num_buckets = caculate_bucket_number(count);
@@ -133,6 +141,7 @@ public:
     row_index_ = 0;
     count_ = 0;
     last_key_with_L_flag_ = false;
+    is_abandoned_ = false;
     is_inited_ = true;
   }
   int add(const ObDatumRow &row);
@@ -145,6 +154,7 @@ private:
   uint32_t count_;
   uint32_t row_index_;
   bool last_key_with_L_flag_;
+  bool is_abandoned_;
   const ObDataStoreDesc *data_store_desc_;
   bool is_inited_;
   uint8_t buckets_[ObMicroBlockHashIndex::MAX_BUCKET_NUMBER];
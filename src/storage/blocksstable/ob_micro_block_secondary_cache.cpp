@@ -0,0 +1,535 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include "storage/blocksstable/ob_micro_block_secondary_cache.h"
+#include <fcntl.h>
+#include "lib/file/ob_file.h"
+#include "lib/checksum/ob_crc64.h"
+#include "lib/utility/utility.h"
+#include "lib/stat/ob_diagnose_info.h"
+#include "share/io/ob_io_manager.h"
+#include "share/config/ob_server_config.h"
+#include "storage/blocksstable/ob_micro_block_cache.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+
+int ObMicroBlockSecondaryCache::IndexKey::hash(uint64_t &hash_value) const
+{
+  hash_value = murmurhash(&block_id_, sizeof(block_id_), tenant_id_);
+  return OB_SUCCESS;
+}
+
+ObMicroBlockSecondaryCache::ObMicroBlockSecondaryCache()
+  : is_inited_(false),
+    fd_(-1),
+    segment_cnt_(0),
+    tenant_limit_pct_(100),
+    lock_(),
+    cond_(),
+    buffers_(),
+    fill_buf_idx_(0),
+    flush_buf_idx_(0),
+    next_segment_id_(0),
+    segment_seq_(0),
+    segments_(nullptr),
+    index_map_(),
+    tenant_used_map_()
+{
+}
+
+ObMicroBlockSecondaryCache::~ObMicroBlockSecondaryCache()
+{
+  destroy();
+}
+
+int ObMicroBlockSecondaryCache::init(const char *dir, const int64_t cache_size, const int64_t tenant_limit_pct)
+{
+  int ret = OB_SUCCESS;
+  char path[OB_MAX_FILE_NAME_LENGTH] = {0};
+  const ObMemAttr attr(OB_SERVER_TENANT_ID, "MicroSecCache");
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("The micro block secondary cache has been inited", K(ret));
+  } else if (OB_ISNULL(dir) || OB_UNLIKELY(cache_size < SEGMENT_SIZE
+      || tenant_limit_pct <= 0 || tenant_limit_pct > 100)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(dir), K(cache_size), K(tenant_limit_pct));
+  } else if (OB_FAIL(databuff_printf(path, sizeof(path), "%s/micro_block_secondary_cache", dir))) {
+    LOG_WARN("Fail to print cache file path", K(ret), K(dir));
+  } else if (OB_FAIL(cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+    LOG_WARN("Fail to init thread cond", K(ret));
+  } else if (OB_FAIL(index_map_.create(INDEX_BUCKET_NUM, "MicroSecCache", "MicroSecCache"))) {
+    LOG_WARN("Fail to create index map", K(ret));
+  } else if (OB_FAIL(tenant_used_map_.create(TENANT_BUCKET_NUM, "MicroSecCache", "MicroSecCache"))) {
+    LOG_WARN("Fail to create tenant used map", K(ret));
+  } else {
+    fd_ = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+    if (fd_ < 0 && EINVAL == errno) {
+      // file systems such as tmpfs do not support direct io
+      fd_ = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    }
+    if (fd_ < 0) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("Fail to open cache file", K(ret), K(path), K(errno));
+    } else {
+      segment_cnt_ = cache_size / SEGMENT_SIZE;
+      tenant_limit_pct_ = tenant_limit_pct;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    void *buf = nullptr;
+    if (OB_ISNULL(buf = ob_malloc(sizeof(Segment) * segment_cnt_, attr))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("Fail to allocate segments", K(ret), K_(segment_cnt));
+    } else {
+      segments_ = static_cast<Segment *>(buf);
+      for (int64_t i = 0; i < segment_cnt_; ++i) {
+        new (segments_ + i) Segment();
+      }
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < BUFFER_CNT; ++i) {
+    if (OB_ISNULL(buffers_[i].buf_ = static_cast<char *>(ob_malloc_align(DIO_ALIGN_SIZE, SEGMENT_SIZE, attr)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("Fail to allocate segment buffer", K(ret), K(i));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    is_inited_ = true;
+    LOG_INFO("Succeed to init micro block secondary cache", K(path), K(cache_size), K(*this));
+  } else {
+    destroy();
+  }
+  return ret;
+}
+
+int ObMicroBlockSecondaryCache::start()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("The micro block secondary cache has not been inited", K(ret));
+  } else if (OB_FAIL(lib::ThreadPool::start())) {
+    LOG_WARN("Fail to start flush thread", K(ret));
+  }
+  return ret;
+}
+
+void ObMicroBlockSecondaryCache::stop()
+{
+  lib::ThreadPool::stop();
+  if (is_inited_) {
+    ObThreadCondGuard guard(cond_);
+    cond_.signal();
+  }
+}
+
+void ObMicroBlockSecondaryCache::wait()
+{
+  lib::ThreadPool::wait();
+}
+
+void ObMicroBlockSecondaryCache::destroy()
+{
+  stop();
+  wait();
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  for (int64_t i = 0; i < BUFFER_CNT; ++i) {
+    if (OB_NOT_NULL(buffers_[i].buf_)) {
+      ob_free_align(buffers_[i].buf_);
+      buffers_[i].buf_ = nullptr;
+    }
+    buffers_[i].pos_ = 0;
+    buffers_[i].is_sealed_ = false;
+    buffers_[i].items_.reset();
+  }
+  if (OB_NOT_NULL(segments_)) {
+    for (int64_t i = 0; i < segment_cnt_; ++i) {
+      segments_[i].~Segment();
+    }
+    ob_free(segments_);
+    segments_ = nullptr;
+  }
+  index_map_.destroy();
+  tenant_used_map_.destroy();
+  cond_.destroy();
+  segment_cnt_ = 0;
+  fill_buf_idx_ = 0;
+  flush_buf_idx_ = 0;
+  next_segment_id_ = 0;
+  segment_seq_ = 0;
+  is_inited_ = false;
+}
+
+int ObMicroBlockSecondaryCache::set_tenant_limit_percentage(const int64_t tenant_limit_pct)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(tenant_limit_pct <= 0 || tenant_limit_pct > 100)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(tenant_limit_pct));
+  } else {
+    ATOMIC_STORE(&tenant_limit_pct_, tenant_limit_pct);
+  }
+  return ret;
+}
+
+void ObMicroBlockSecondaryCache::on_wash(const ObIKVCacheKey &key, const ObIKVCacheValue &value)
+{
+  if (IS_INIT) {
+    const ObMicroBlockCacheKey &block_key = static_cast<const ObMicroBlockCacheKey &>(key);
+    const ObMicroBlockData &block_data = static_cast<const ObMicroBlockCacheValue &>(value).get_block_data();
+    if (ObMicroBlockData::DATA_BLOCK == block_data.type_
+        && block_data.is_valid()
+        && get_entry_size(block_data.get_buf_size()) <= SEGMENT_SIZE) {
+      const IndexKey index_key(block_key.get_tenant_id(), block_key.get_micro_block_id());
+      if (!append_(index_key, block_data.get_buf(), block_data.get_buf_size())) {
+        EVENT_INC(ObStatEventIds::BLOCK_SECONDARY_CACHE_DROP_COUNT);
+      }
+    }
+  }
+}
+
+int ObMicroBlockSecondaryCache::get_location(const ObMicroBlockCacheKey &key, Location &location)
+{
+  int ret = OB_SUCCESS;
+  const IndexKey index_key(key.get_tenant_id(), key.get_micro_block_id());
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("The micro block secondary cache has not been inited", K(ret));
+  } else if (OB_FAIL(index_map_.get_refactored(index_key, location))) {
+    if (OB_HASH_NOT_EXIST == ret) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      LOG_WARN("Fail to get location of micro block", K(ret), K(index_key));
+    }
+  } else if (location.segment_seq_ != ATOMIC_LOAD(&segments_[location.segment_id_].seq_)) {
+    ret = OB_ENTRY_NOT_EXIST;
+  }
+  if (OB_ENTRY_NOT_EXIST == ret) {
+    EVENT_INC(ObStatEventIds::BLOCK_SECONDARY_CACHE_MISS);
+  }
+  return ret;
+}
+
+int ObMicroBlockSecondaryCache::async_read(
+    const Location &location,
+    ObIOCallback &callback,
+    ObIOHandle &io_handle)
+{
+  int ret = OB_SUCCESS;
+  ObIOInfo io_info;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("The micro block secondary cache has not been inited", K(ret));
+  } else if (OB_UNLIKELY(location.segment_id_ < 0 || location.segment_id_ >= segment_cnt_ || location.size_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(location));
+  } else {
+    // the cache file is a server level resource like the block file, the io manager aligns the io for direct io
+    io_info.tenant_id_ = OB_SERVER_TENANT_ID;
+    io_info.fd_.first_id_ = ObIOFd::NORMAL_FILE_ID;
+    io_info.fd_.second_id_ = fd_;
+    io_info.offset_ = location.segment_id_ * SEGMENT_SIZE + location.offset_;
+    io_info.size_ = get_entry_size(location.size_);
+    io_info.flag_.set_mode(ObIOMode::READ);
+    io_info.flag_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+    io_info.flag_.set_resource_group_id(THIS_WORKER.get_group_id());
+    io_info.flag_.set_sys_module_id(ObIOModule::MICRO_BLOCK_CACHE_IO);
+    io_info.callback_ = &callback;
+    io_info.timeout_us_ = max(min(THIS_WORKER.get_timeout_remain(), GCONF._data_storage_io_timeout), 0);
+    if (OB_FAIL(ObIOManager::get_instance().aio_read(io_info, io_handle))) {
+      LOG_WARN("Fail to read cache file", K(ret), K(io_info), K(location));
+    }
+  }
+  return ret;
+}
+
+int ObMicroBlockSecondaryCache::check_entry(
+    const Location &location,
+    const char *entry_buf,
+    const int64_t entry_size,
+    const char *&block_buf,
+    int64_t &block_size) const
+{
+  int ret = OB_SUCCESS;
+  const EntryHeader *header = reinterpret_cast<const EntryHeader *>(entry_buf);
+  const char *data = reinterpret_cast<const char *>(header + 1);
+  block_buf = nullptr;
+  block_size = 0;
+  if (OB_ISNULL(entry_buf) || OB_UNLIKELY(entry_size < get_entry_size(location.size_)
+      || location.segment_id_ < 0 || location.segment_id_ >= segment_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(entry_buf), K(entry_size), K(location));
+  } else if (location.segment_seq_ != ATOMIC_LOAD(&segments_[location.segment_id_].seq_)) {
+    // the segment was recycled while reading
+    ret = OB_ENTRY_NOT_EXIST;
+    EVENT_INC(ObStatEventIds::BLOCK_SECONDARY_CACHE_MISS);
+  } else if (OB_UNLIKELY(EntryHeader::MAGIC != header->magic_
+      || location.size_ != header->data_size_
+      || header->checksum_ != static_cast<int64_t>(ob_crc64(data, location.size_)))) {
+    ret = OB_CHECKSUM_ERROR;
+    LOG_ERROR("Micro block in secondary cache is corrupted", K(ret), K(location),
+        K(header->magic_), K(header->data_size_), K(header->checksum_));
+  } else {
+    block_buf = data;
+    block_size = location.size_;
+    EVENT_INC(ObStatEventIds::BLOCK_SECONDARY_CACHE_HIT);
+  }
+  return ret;
+}
+
+int ObMicroBlockSecondaryCache::get(
+    const ObMicroBlockCacheKey &key,
+    ObIAllocator &allocator,
+    const char *&block_buf,
+    int64_t &block_size)
+{
+  int ret = OB_SUCCESS;
+  Location location;
+  block_buf = nullptr;
+  block_size = 0;
+  if (OB_FAIL(get_location(key, location))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("Fail to get location of micro block", K(ret), K(key));
+    }
+  } else {
+    const int64_t offset = location.segment_id_ * SEGMENT_SIZE + location.offset_;
+    const int64_t entry_size = get_entry_size(location.size_);
+    const int64_t io_offset = lower_align(offset, DIO_ALIGN_SIZE);
+    const int64_t io_size = upper_align(offset + entry_size, DIO_ALIGN_SIZE) - io_offset;
+    char *buf = nullptr;
+    if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(io_size + DIO_ALIGN_SIZE)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("Fail to allocate read buffer", K(ret), K(io_size));
+    } else {
+      char *io_buf = reinterpret_cast<char *>(upper_align(reinterpret_cast<int64_t>(buf), DIO_ALIGN_SIZE));
+      if (io_size != unintr_pread(fd_, io_buf, io_size, io_offset)) {
+        ret = OB_IO_ERROR;
+        LOG_WARN("Fail to read cache file", K(ret), K(location), K(io_offset), K(io_size), K(errno));
+      } else if (OB_FAIL(check_entry(location, io_buf + offset - io_offset, entry_size, block_buf, block_size))) {
+        LOG_WARN("Fail to check micro block entry", K(ret), K(key), K(location));
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t ObMicroBlockSecondaryCache::get_tenant_used_size(const uint64_t tenant_id)
+{
+  int64_t used_size = 0;
+  if (IS_INIT) {
+    ObSpinLockGuard guard(lock_);
+    if (OB_SUCCESS != tenant_used_map_.get_refactored(tenant_id, used_size)) {
+      used_size = 0;
+    }
+  }
+  return used_size;
+}
+
+void ObMicroBlockSecondaryCache::run1()
+{
+  int ret = OB_SUCCESS;
+  int64_t last_fill_pos = 0;
+  lib::set_thread_name("MicroSecCache");
+  while (!has_set_stop()) {
+    SegmentBuffer &buffer = buffers_[flush_buf_idx_];
+    if (ATOMIC_LOAD(&buffer.is_sealed_)) {
+      if (OB_FAIL(flush_buf_(buffer))) {
+        LOG_WARN("Fail to flush segment buffer", K(ret), K(*this));
+      }
+      flush_buf_idx_ = (flush_buf_idx_ + 1) % BUFFER_CNT;
+    } else {
+      {
+        ObThreadCondGuard guard(cond_);
+        if (!has_set_stop() && !ATOMIC_LOAD(&buffer.is_sealed_)) {
+          (void) cond_.wait(FLUSH_INTERVAL_US / 1000);
+        }
+      }
+      // micro blocks are only readable after flushed, do not keep them in an idle buffer for too long
+      ObSpinLockGuard guard(lock_);
+      if (&buffers_[fill_buf_idx_] == &buffer && !buffer.is_sealed_) {
+        if (buffer.pos_ > 0 && buffer.pos_ == last_fill_pos) {
+          seal_fill_buf_();
+          last_fill_pos = 0;
+        } else {
+          last_fill_pos = buffer.pos_;
+        }
+      }
+    }
+  }
+}
+
+int64_t ObMicroBlockSecondaryCache::get_entry_size(const int64_t data_size)
+{
+  return upper_align(sizeof(EntryHeader) + data_size, sizeof(int64_t));
+}
+
+bool ObMicroBlockSecondaryCache::append_(const IndexKey &key, const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  bool appended = false;
+  bool need_signal = false;
+  const int64_t entry_size = get_entry_size(size);
+  const int64_t checksum = static_cast<int64_t>(ob_crc64(buf, size));
+  {
+    ObSpinLockGuard guard(lock_);
+    SegmentBuffer *buffer = &buffers_[fill_buf_idx_];
+    int64_t used_size = 0;
+    if (OB_FAIL(tenant_used_map_.get_refactored(key.tenant_id_, used_size))) {
+      if (OB_HASH_NOT_EXIST == ret) {
+        ret = OB_SUCCESS;
+      }
+    }
+    if (OB_FAIL(ret) || used_size + entry_size > get_tenant_limit_size_()) {
+      // micro blocks in segment buffers are not counted, so the limit can be exceeded by a few segments
+    } else {
+      if (!buffer->is_sealed_ && buffer->pos_ + entry_size > SEGMENT_SIZE) {
+        seal_fill_buf_();
+        need_signal = true;
+        buffer = &buffers_[fill_buf_idx_];
+      }
+      if (buffer->is_sealed_) {
+        // the flush thread is falling behind
+      } else {
+        SegmentItem item;
+        item.key_ = key;
+        item.offset_ = buffer->pos_;
+        item.size_ = size;
+        if (OB_FAIL(buffer->items_.push_back(item))) {
+          LOG_WARN("Fail to push back segment item", K(ret), K(item));
+        } else {
+          EntryHeader *header = reinterpret_cast<EntryHeader *>(buffer->buf_ + buffer->pos_);
+          header->magic_ = EntryHeader::MAGIC;
+          header->data_size_ = static_cast<int32_t>(size);
+          header->checksum_ = checksum;
+          MEMCPY(header + 1, buf, size);
+          buffer->pos_ += entry_size;
+          appended = true;
+        }
+      }
+    }
+  }
+  if (need_signal) {
+    ObThreadCondGuard guard(cond_);
+    cond_.signal();
+  }
+  return appended;
+}
+
+void ObMicroBlockSecondaryCache::seal_fill_buf_()
+{
+  ATOMIC_STORE(&buffers_[fill_buf_idx_].is_sealed_, true);
+  fill_buf_idx_ = (fill_buf_idx_ + 1) % BUFFER_CNT;
+}
+
+int ObMicroBlockSecondaryCache::flush_buf_(SegmentBuffer &buffer)
+{
+  int ret = OB_SUCCESS;
+  const int64_t segment_id = next_segment_id_;
+  Segment &segment = segments_[segment_id];
+  const int64_t write_size = upper_align(buffer.pos_, DIO_ALIGN_SIZE);
+  recycle_segment_(segment, segment_id);
+  if (write_size != unintr_pwrite(fd_, buffer.buf_, write_size, segment_id * SEGMENT_SIZE)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("Fail to write cache file", K(ret), K(segment_id), K(write_size), K(errno));
+  } else if (OB_FAIL(segment.items_.assign(buffer.items_))) {
+    LOG_WARN("Fail to assign segment items", K(ret), K(segment_id));
+  } else {
+    const int64_t segment_seq = ++segment_seq_;
+    Location location;
+    location.segment_id_ = segment_id;
+    location.segment_seq_ = segment_seq;
+    ATOMIC_STORE(&segment.seq_, segment_seq);
+    for (int64_t i = 0; i < segment.items_.count(); ++i) {
+      int tmp_ret = OB_SUCCESS;
+      const SegmentItem &item = segment.items_.at(i);
+      location.offset_ = item.offset_;
+      location.size_ = item.size_;
+      if (OB_TMP_FAIL(index_map_.set_refactored(item.key_, location, 1 /* overwrite */))) {
+        LOG_WARN("Fail to set location of micro block", K(tmp_ret), K(item), K(location));
+      }
+    }
+    update_tenant_used_size_(segment.items_, true /* is_inc */);
+    next_segment_id_ = (segment_id + 1) % segment_cnt_;
+    EVENT_INC(ObStatEventIds::BLOCK_SECONDARY_CACHE_WRITE_COUNT);
+    EVENT_ADD(ObStatEventIds::BLOCK_SECONDARY_CACHE_WRITE_SIZE, write_size);
+  }
+  if (OB_FAIL(ret)) {
+    segment.items_.reuse();
+  }
+  ObSpinLockGuard guard(lock_);
+  buffer.pos_ = 0;
+  buffer.items_.reuse();
+  ATOMIC_STORE(&buffer.is_sealed_, false);
+  return ret;
+}
+
+void ObMicroBlockSecondaryCache::recycle_segment_(Segment &segment, const int64_t segment_id)
+{
+  const int64_t segment_seq = ATOMIC_LOAD(&segment.seq_);
+  if (segment_seq > 0) {
+    // readers compare the sequence before and after reading, so they never see the data overwritten
+    ATOMIC_STORE(&segment.seq_, 0);
+    LocationMatcher matcher(segment_id, segment_seq);
+    for (int64_t i = 0; i < segment.items_.count(); ++i) {
+      bool is_erased = false;
+      // the micro block may be written again into a newer segment
+      (void) index_map_.erase_if(segment.items_.at(i).key_, matcher, is_erased);
+    }
+    update_tenant_used_size_(segment.items_, false /* is_inc */);
+    segment.items_.reuse();
+  }
+}
+
+void ObMicroBlockSecondaryCache::update_tenant_used_size_(
+    const ObIArray<SegmentItem> &items,
+    const bool is_inc)
+{
+  int ret = OB_SUCCESS;
+  ObSpinLockGuard guard(lock_);
+  for (int64_t i = 0; i < items.count(); ++i) {
+    const SegmentItem &item = items.at(i);
+    int64_t used_size = 0;
+    if (OB_FAIL(tenant_used_map_.get_refactored(item.key_.tenant_id_, used_size))) {
+      if (OB_HASH_NOT_EXIST == ret) {
+        ret = OB_SUCCESS;
+      } else {
+        LOG_WARN("Fail to get tenant used size", K(ret), K(item));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (FALSE_IT(used_size += (is_inc ? 1 : -1) * get_entry_size(item.size_))) {
+    } else if (used_size <= 0) {
+      if (OB_FAIL(tenant_used_map_.erase_refactored(item.key_.tenant_id_))) {
+        LOG_WARN("Fail to erase tenant used size", K(ret), K(item));
+      }
+    } else if (OB_FAIL(tenant_used_map_.set_refactored(item.key_.tenant_id_, used_size, 1 /* overwrite */))) {
+      LOG_WARN("Fail to set tenant used size", K(ret), K(item), K(used_size));
+    }
+  }
+}
+
+int64_t ObMicroBlockSecondaryCache::get_tenant_limit_size_() const
+{
+  return segment_cnt_ * SEGMENT_SIZE / 100 * ATOMIC_LOAD(&tenant_limit_pct_);
+}
+
+}//end namespace blocksstable
+}//end namespace oceanbase
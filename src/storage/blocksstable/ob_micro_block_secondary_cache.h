@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_MICRO_BLOCK_SECONDARY_CACHE_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_MICRO_BLOCK_SECONDARY_CACHE_H_
+
+#include "lib/hash/ob_hashmap.h"
+#include "lib/container/ob_array.h"
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/thread/thread_pool.h"
+#include "share/cache/ob_kvcache_struct.h"
+#include "share/io/ob_io_define.h"
+#include "storage/blocksstable/ob_block_sstable_struct.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+class ObMicroBlockCacheKey;
+
+// Second tier of user block cache on local disk.
+//
+// Decompressed data micro blocks washed out of user block cache are appended to an in-memory segment
+// buffer by the wash callback, sealed segment buffers are written to the cache file by a background
+// thread. The file is a ring of SEGMENT_SIZE segments, the oldest segment is recycled when the ring is
+// full, so micro blocks are evicted in FIFO order. The index from micro block to its location is only
+// kept in memory, the cache starts empty and the file is truncated on startup.
+//
+// Washing never waits for the disk, a micro block is dropped if all segment buffers are waiting to be
+// written, or if the micro blocks of its tenant on disk have taken more than tenant_limit_pct_ of the cache.
+// Reading never waits for the disk either, micro blocks are read through the io manager asynchronously
+// and checked by the io callback, see async_read and check_entry.
+class ObMicroBlockSecondaryCache : public common::ObIKVCacheWashCallback, public lib::ThreadPool
+{
+public:
+  struct Location
+  {
+    Location() : segment_id_(-1), segment_seq_(0), offset_(0), size_(0) {}
+    TO_STRING_KV(K_(segment_id), K_(segment_seq), K_(offset), K_(size));
+    int64_t segment_id_;
+    int64_t segment_seq_;
+    int64_t offset_;  // offset of the entry header in the segment
+    int64_t size_;    // size of the micro block
+  };
+public:
+  ObMicroBlockSecondaryCache();
+  virtual ~ObMicroBlockSecondaryCache();
+  int init(const char *dir, const int64_t cache_size, const int64_t tenant_limit_pct);
+  int start();
+  void stop();
+  void wait();
+  void destroy();
+  int set_tenant_limit_percentage(const int64_t tenant_limit_pct);
+  virtual void on_wash(const common::ObIKVCacheKey &key, const common::ObIKVCacheValue &value) override;
+  // return OB_ENTRY_NOT_EXIST if the micro block is not in the cache.
+  int get_location(const ObMicroBlockCacheKey &key, Location &location);
+  // Submit the read of the entry at location to the io manager, the callback gets the entry and
+  // must check it with check_entry, the segment may have been recycled before the read is done.
+  int async_read(const Location &location, common::ObIOCallback &callback, common::ObIOHandle &io_handle);
+  // @param block_buf: decompressed micro block in the entry buf.
+  // return OB_ENTRY_NOT_EXIST if the segment has been recycled, OB_CHECKSUM_ERROR if the entry is corrupted.
+  int check_entry(
+      const Location &location,
+      const char *entry_buf,
+      const int64_t entry_size,
+      const char *&block_buf,
+      int64_t &block_size) const;
+  // synchronous read, only for test and tools.
+  // @param block_buf: decompressed micro block allocated from allocator.
+  // return OB_ENTRY_NOT_EXIST if the micro block is not in the cache.
+  int get(
+      const ObMicroBlockCacheKey &key,
+      common::ObIAllocator &allocator,
+      const char *&block_buf,
+      int64_t &block_size);
+  int64_t get_tenant_used_size(const uint64_t tenant_id);
+  virtual void run1() override;
+  inline bool is_inited() const { return is_inited_; }
+  TO_STRING_KV(K_(is_inited), K_(fd), K_(segment_cnt), K_(tenant_limit_pct), K_(fill_buf_idx),
+      K_(flush_buf_idx), K_(next_segment_id), K_(segment_seq));
+public:
+  static const int64_t SEGMENT_SIZE = 2L << 20; // 2MB
+private:
+  struct IndexKey
+  {
+    IndexKey() : tenant_id_(common::OB_INVALID_TENANT_ID), block_id_() {}
+    IndexKey(const uint64_t tenant_id, const ObMicroBlockId &block_id)
+      : tenant_id_(tenant_id), block_id_(block_id) {}
+    int hash(uint64_t &hash_value) const;
+    bool operator ==(const IndexKey &other) const
+    {
+      return tenant_id_ == other.tenant_id_ && block_id_ == other.block_id_;
+    }
+    TO_STRING_KV(K_(tenant_id), K_(block_id));
+    uint64_t tenant_id_;
+    ObMicroBlockId block_id_;
+  };
+  struct EntryHeader
+  {
+    static const int32_t MAGIC = 0x4D534543; // "MSEC"
+    int32_t magic_;
+    int32_t data_size_;
+    int64_t checksum_;
+  };
+  struct SegmentItem
+  {
+    TO_STRING_KV(K_(key), K_(offset), K_(size));
+    IndexKey key_;
+    int64_t offset_;
+    int64_t size_;
+  };
+  struct SegmentBuffer
+  {
+    SegmentBuffer() : buf_(nullptr), pos_(0), is_sealed_(false), items_() {}
+    char *buf_;
+    int64_t pos_;
+    bool is_sealed_;
+    common::ObArray<SegmentItem> items_;
+  };
+  struct Segment
+  {
+    Segment() : seq_(0), items_() {}
+    int64_t seq_;   // 0 means the segment keeps nothing
+    common::ObArray<SegmentItem> items_;
+  };
+  class LocationMatcher
+  {
+  public:
+    LocationMatcher(const int64_t segment_id, const int64_t segment_seq)
+      : segment_id_(segment_id), segment_seq_(segment_seq) {}
+    bool operator()(const common::hash::HashMapPair<IndexKey, Location> &entry) const
+    {
+      return entry.second.segment_id_ == segment_id_ && entry.second.segment_seq_ == segment_seq_;
+    }
+  private:
+    int64_t segment_id_;
+    int64_t segment_seq_;
+  };
+  static int64_t get_entry_size(const int64_t data_size);
+  bool append_(const IndexKey &key, const char *buf, const int64_t size);
+  void seal_fill_buf_();
+  int flush_buf_(SegmentBuffer &buffer);
+  void recycle_segment_(Segment &segment, const int64_t segment_id);
+  void update_tenant_used_size_(const common::ObIArray<SegmentItem> &items, const bool is_inc);
+  int64_t get_tenant_limit_size_() const;
+private:
+  static const int64_t BUFFER_CNT = 4;
+  static const int64_t FLUSH_INTERVAL_US = 1000L * 1000L; // 1s
+  static const int64_t INDEX_BUCKET_NUM = 100000;
+  static const int64_t TENANT_BUCKET_NUM = 64;
+  bool is_inited_;
+  int fd_;
+  int64_t segment_cnt_;
+  int64_t tenant_limit_pct_;
+  common::ObSpinLock lock_;   // protects fill_buf_idx_, segment buffers and tenant_used_map_
+  common::ObThreadCond cond_;
+  SegmentBuffer buffers_[BUFFER_CNT];
+  int64_t fill_buf_idx_;
+  int64_t flush_buf_idx_;     // only accessed by the flush thread
+  int64_t next_segment_id_;   // only accessed by the flush thread
+  int64_t segment_seq_;
+  Segment *segments_;
+  common::hash::ObHashMap<IndexKey, Location> index_map_;
+  common::hash::ObHashMap<uint64_t, int64_t, common::hash::NoPthreadDefendMode> tenant_used_map_;
+  DISALLOW_COPY_AND_ASSIGN(ObMicroBlockSecondaryCache);
+};
+
+}//end namespace blocksstable
+}//end namespace oceanbase
+
+#endif //OCEANBASE_STORAGE_BLOCKSSTABLE_OB_MICRO_BLOCK_SECONDARY_CACHE_H_
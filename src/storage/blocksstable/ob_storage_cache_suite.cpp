@@ -25,6 +25,7 @@ ObStorageCacheSuite::ObStorageCacheSuite()
     bf_cache_(),
     fuse_row_cache_(),
     storage_meta_cache_(),
+    secondary_block_cache_(),
     is_inited_(false)
 {
 }
@@ -115,8 +116,47 @@ int ObStorageCacheSuite::set_bf_cache_miss_count_threshold(const int64_t bf_cach
   return ret;
 }
 
+int ObStorageCacheSuite::init_secondary_block_cache(
+    const char *dir,
+    const int64_t cache_size,
+    const int64_t tenant_limit_pct)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "The cache suite has not been inited, ", K(ret));
+  } else if (0 == cache_size) {
+    STORAGE_LOG(INFO, "micro block secondary cache is disabled");
+  } else if (OB_FAIL(secondary_block_cache_.init(dir, cache_size, tenant_limit_pct))) {
+    STORAGE_LOG(WARN, "fail to init micro block secondary cache", K(ret), K(dir), K(cache_size));
+  } else if (OB_FAIL(secondary_block_cache_.start())) {
+    STORAGE_LOG(WARN, "fail to start micro block secondary cache", K(ret));
+  } else if (OB_FAIL(user_block_cache_.set_secondary_cache(&secondary_block_cache_))) {
+    STORAGE_LOG(WARN, "fail to set secondary cache for user block cache", K(ret));
+  }
+  if (OB_FAIL(ret)) {
+    secondary_block_cache_.destroy();
+  }
+  return ret;
+}
+
+int ObStorageCacheSuite::set_secondary_block_cache_tenant_limit(const int64_t tenant_limit_pct)
+{
+  int ret = OB_SUCCESS;
+  if (!secondary_block_cache_.is_inited()) {
+    // disabled
+  } else if (OB_FAIL(secondary_block_cache_.set_tenant_limit_percentage(tenant_limit_pct))) {
+    STORAGE_LOG(WARN, "fail to set tenant limit of secondary cache", K(ret), K(tenant_limit_pct));
+  }
+  return ret;
+}
+
 void ObStorageCacheSuite::destroy()
 {
+  if (secondary_block_cache_.is_inited()) {
+    (void) user_block_cache_.set_secondary_cache(nullptr);
+  }
+  secondary_block_cache_.destroy();
   index_block_cache_.destroy();
   user_block_cache_.destroy();
   user_row_cache_.destroy();
@@ -16,6 +16,7 @@
 #include "storage/meta_mem/ob_storage_meta_cache.h"
 #include "share/schema/ob_table_schema.h"
 #include "ob_micro_block_cache.h"
+#include "ob_micro_block_secondary_cache.h"
 #include "ob_row_cache.h"
 #include "ob_fuse_row_cache.h"
 #include "ob_bloom_filter_cache.h"
@@ -47,6 +48,9 @@ public:
       const int64_t bf_cache_priority,
       const int64_t storage_meta_cache_priority);
   int set_bf_cache_miss_count_threshold(const int64_t bf_cache_miss_count_threshold);
+  // keeps the data micro blocks washed out of user block cache in a file under dir, 0 == cache_size disables it
+  int init_secondary_block_cache(const char *dir, const int64_t cache_size, const int64_t tenant_limit_pct);
+  int set_secondary_block_cache_tenant_limit(const int64_t tenant_limit_pct);
   ObDataMicroBlockCache &get_block_cache() { return user_block_cache_; }
   ObIndexMicroBlockCache &get_index_block_cache() { return index_block_cache_; }
   ObDataMicroBlockCache &get_micro_block_cache(const bool is_data_block)
@@ -55,6 +59,7 @@ public:
   ObBloomFilterCache &get_bf_cache() { return bf_cache_; }
   ObFuseRowCache &get_fuse_row_cache() { return fuse_row_cache_; }
   ObStorageMetaCache &get_storage_meta_cache() { return storage_meta_cache_; }
+  ObMicroBlockSecondaryCache &get_secondary_block_cache() { return secondary_block_cache_; }
   void destroy();
   inline bool is_inited() const { return is_inited_; }
   TO_STRING_KV(K(is_inited_));
@@ -67,6 +72,7 @@ private:
   ObBloomFilterCache bf_cache_;
   ObFuseRowCache fuse_row_cache_;
   ObStorageMetaCache storage_meta_cache_;
+  ObMicroBlockSecondaryCache secondary_block_cache_;
   bool is_inited_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObStorageCacheSuite);
@@ -39,6 +39,7 @@ ObCOSSTableRowScanner::ObCOSSTableRowScanner()
     group_by_project_idx_(0),
     group_size_(0),
     batch_size_(1),
+    filter_group_size_(1),
     column_group_cnt_(-1),
     current_(OB_INVALID_CS_ROW_ID),
     end_(OB_INVALID_CS_ROW_ID),
@@ -106,6 +107,7 @@ int ObCOSSTableRowScanner::init(
     iter_param_ = &param;
     access_ctx_ = &context;
     batch_size_ = param.get_storage_rowsets_size();
+    filter_group_size_ = batch_size_;
     reverse_scan_ = context.query_flag_.is_reverse_scan();
     batched_row_store_ = static_cast<ObBlockBatchedRowStore*>(context.block_row_store_);
     block_row_store_ = context.block_row_store_;
@@ -134,6 +136,7 @@ void ObCOSSTableRowScanner::reset()
   end_ = OB_INVALID_CS_ROW_ID;
   group_size_ = 0;
   batch_size_ = 1;
+  filter_group_size_ = 1;
   reverse_scan_ = false;
   state_ = BEGIN;
   blockscan_state_ = MAX_STATE;
@@ -165,6 +168,7 @@ void ObCOSSTableRowScanner::reuse()
   end_ = OB_INVALID_CS_ROW_ID;
   group_size_ = 0;
   batch_size_ = 1;
+  filter_group_size_ = 1;
   reverse_scan_ = false;
   state_ = BEGIN;
   blockscan_state_ = MAX_STATE;
@@ -713,6 +717,8 @@ int ObCOSSTableRowScanner::inner_filter(
     } else {
       int64_t select_cnt = result_bitmap->popcnt();
       EVENT_ADD(ObStatEventIds::PUSHDOWN_STORAGE_FILTER_ROW_CNT, select_cnt);
+      access_ctx_->table_store_stat_.cs_filter_row_cnt_ += group_size;
+      adjust_filter_group_size(group_size, select_cnt);
     }
   } else {
     EVENT_ADD(ObStatEventIds::PUSHDOWN_STORAGE_FILTER_ROW_CNT, group_size);
@@ -808,6 +814,7 @@ int ObCOSSTableRowScanner::fetch_output_rows()
       if (count > 0) {
         int64_t group_idx = 0;
         access_ctx_->out_cnt_ += count;
+        access_ctx_->table_store_stat_.cs_project_row_cnt_ += count;
         if (OB_FAIL(get_group_idx(group_idx))) {
           LOG_WARN("Fail to get group idx", K(ret));
         } else if (OB_FAIL(batched_row_store_->fill_rows(group_idx, count))) {
@@ -861,6 +868,7 @@ int ObCOSSTableRowScanner::inner_get_next_row(const ObDatumRow *&store_row)
       for (int64_t i = 0; i < cg_datum_row->count_; ++i) {
         store_row->storage_datums_[getter_projector_.at(i)] = cg_datum_row->storage_datums_[i];
       }
+      ++access_ctx_->table_store_stat_.cs_project_row_cnt_;
     }
   }
   return ret;
@@ -889,17 +897,28 @@ int ObCOSSTableRowScanner::get_next_group_size(const ObCSRowId begin, int64_t &g
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("Unexpected rowid", K(begin), K(end_));
     } else {
-      group_size = MIN(batch_size_, begin - end_ + 1);
+      group_size = MIN(filter_group_size_, begin - end_ + 1);
     }
   } else if (begin > end_) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Unexpected rowid", K(begin), K(end_));
   } else {
-    group_size = MIN(batch_size_, end_ - begin + 1);
+    group_size = MIN(filter_group_size_, end_ - begin + 1);
   }
   return ret;
 }
 
+void ObCOSSTableRowScanner::adjust_filter_group_size(const int64_t group_size, const int64_t select_cnt)
+{
+  if (nullptr != access_ctx_->limit_param_) {
+    // larger group may filter rows beyond the limit
+  } else if (select_cnt * SPARSE_SELECT_RATIO < group_size) {
+    filter_group_size_ = MIN(filter_group_size_ * 2, batch_size_ * MAX_FILTER_GROUP_SCALE);
+  } else if (select_cnt * 2 > group_size) {
+    filter_group_size_ = batch_size_;
+  }
+}
+
 int ObCOSSTableRowScanner::check_limit(
     const ObCGBitmap *bitmap,
     bool &limit_end,
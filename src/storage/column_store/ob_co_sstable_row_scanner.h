@@ -75,6 +75,7 @@ public:
                K_(end),
                K_(group_size),
                K_(batch_size),
+               K_(filter_group_size),
                K_(reverse_scan),
                K_(state),
                K_(blockscan_state),
@@ -87,6 +88,12 @@ protected:
   virtual int refresh_blockscan_checker(const blocksstable::ObDatumRowkey &rowkey) override;
 private:
   static const ScanState STATE_TRANSITION[BlockScanState::MAX_STATE];
+  // filter groups are enlarged up to MAX_FILTER_GROUP_SCALE * batch_size_ when less than
+  // 1/SPARSE_SELECT_RATIO of the rows pass the filter, so that the projected column groups
+  // gather more rows for each locate; dense results go back to batch_size_ groups, whose
+  // all true groups are merged and projected as a continuous range without bitmap
+  static const int64_t MAX_FILTER_GROUP_SCALE = 8;
+  static const int64_t SPARSE_SELECT_RATIO = 16;
   virtual int init_row_scanner(
       const ObTableIterParam &param,
       ObTableAccessContext &context,
@@ -135,6 +142,7 @@ private:
     bool &continue_filter);
   int fetch_rows();
   int get_next_group_size(const ObCSRowId begin, int64_t &group_size);
+  void adjust_filter_group_size(const int64_t group_size, const int64_t select_cnt);
   int check_limit(
       const ObCGBitmap *bitmap,
       bool &limit_end,
@@ -176,6 +184,7 @@ private:
   int32_t group_by_project_idx_;
   int64_t group_size_;
   int64_t batch_size_;
+  int64_t filter_group_size_;
   int64_t column_group_cnt_;
   ObCSRowId current_;
   ObCSRowId end_;
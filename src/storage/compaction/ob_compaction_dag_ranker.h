@@ -43,7 +43,7 @@ public:
   static constexpr int64_t DEFAULT_MERGE_THREAD_CNT = 6;
   static constexpr int64_t MAX_MEM_PER_THREAD = 8 * 1024L * 1024L; // 8MB for serial compaction
   static constexpr int64_t MINI_MEM_PER_THREAD = 7 * 1024L * 1024L; // 7MB
-  static constexpr int64_t MINI_PARALLEL_BASE_MEM = 1 << 30; // 1GB
+  static constexpr int64_t MINI_PARALLEL_BASE_MEM = 256 * 1024L * 1024L; // 256MB
   static constexpr int64_t MINOR_MEM_PER_THREAD = 6 * 1024L * 1024L; // 6MB
   static constexpr int64_t MAJOR_MEM_PER_THREAD = 5 * 1024L * 1024L; // 5MB
   static constexpr int64_t CO_MAJOR_CG_BASE_MEM = 3 * 1024L * 1024L; // 3MB
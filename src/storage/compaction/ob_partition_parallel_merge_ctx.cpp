@@ -266,14 +266,28 @@ int ObParallelMergeCtx::init_parallel_mini_merge(compaction::ObBasicTabletMergeC
   ObIMemtable *memtable = nullptr;
   int64_t total_bytes = 0;
   int64_t total_rows = 0; // placeholder
+  const ObTablesHandleArray &tables_handle = merge_ctx.get_tables_handle();
 
   if (OB_UNLIKELY(MINI_MERGE != merge_ctx.get_merge_type())) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "Invalid argument to init parallel mini merge", K(ret), K(merge_ctx));
-  } else if (OB_FAIL(merge_ctx.get_tables_handle().get_first_memtable(memtable))) {
-    STORAGE_LOG(WARN, "failed to get first memtable", K(ret), "merge tables", merge_ctx.get_tables_handle());
+  } else if (OB_FAIL(tables_handle.get_first_memtable(memtable))) {
+    STORAGE_LOG(WARN, "failed to get first memtable", K(ret), "merge tables", tables_handle);
   } else if (memtable->is_data_memtable()) { // only data memtable has mt stat
-    total_bytes = static_cast<memtable::ObMemtable *>(memtable)->get_mt_stat().row_size_;
+    // several frozen memtables may be merged together, the parallel degree
+    // depends on all of them and the ranges are split by the largest one
+    int64_t max_bytes = -1;
+    for (int64_t i = 0; i < tables_handle.get_count(); ++i) {
+      ObITable *table = tables_handle.get_table(i);
+      if (OB_NOT_NULL(table) && table->is_data_memtable()) {
+        const int64_t bytes = static_cast<memtable::ObMemtable *>(table)->get_mt_stat().row_size_;
+        total_bytes += bytes;
+        if (bytes > max_bytes) {
+          max_bytes = bytes;
+          memtable = static_cast<memtable::ObMemtable *>(table);
+        }
+      }
+    }
   } else if (OB_FAIL(memtable->estimate_phy_size(nullptr, nullptr, total_bytes, total_rows))) {
     STORAGE_LOG(WARN, "failed to estimate size from memtable", K(ret));
   }
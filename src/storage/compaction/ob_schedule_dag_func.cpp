@@ -97,5 +97,14 @@ int ObScheduleDagFunc::schedule_mds_table_merge_dag(
   return ret;
 }
 
+int ObScheduleDagFunc::schedule_memtable_frozen_image_dag(
+    ObMemtableFrozenImageParam &param,
+    const bool is_emergency)
+{
+  int ret = OB_SUCCESS;
+  CREATE_DAG(ObMemtableFrozenImageDag);
+  return ret;
+}
+
 } // namespace compaction
 } // namespace oceanbase
@@ -28,6 +28,7 @@ namespace compaction
 {
 struct ObTabletMergeDagParam;
 struct ObCOMergeDagParam;
+struct ObMemtableFrozenImageParam;
 
 class ObScheduleDagFunc
 {
@@ -46,6 +47,9 @@ public:
   static int schedule_mds_table_merge_dag(
       storage::mds::ObMdsTableMergeDagParam &param,
       const bool is_emergency = false);
+  static int schedule_memtable_frozen_image_dag(
+      ObMemtableFrozenImageParam &param,
+      const bool is_emergency = false);
 };
 
 }
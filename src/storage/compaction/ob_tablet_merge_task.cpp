@@ -1414,5 +1414,192 @@ int ObBatchFreezeTabletsTask::process()
 }
 
 
+/*
+ *  ----------------------------------------ObMemtableFrozenImageDag--------------------------------------------
+ */
+int64_t ObMemtableFrozenImageParam::get_hash() const
+{
+  int64_t hash_val = 0;
+  hash_val = common::murmurhash(&ls_id_, sizeof(ls_id_), hash_val);
+  hash_val = common::murmurhash(&tablet_id_, sizeof(tablet_id_), hash_val);
+  return hash_val;
+}
+
+ObMemtableFrozenImageDag::ObMemtableFrozenImageDag()
+  : ObIDag(share::ObDagType::DAG_TYPE_MEMTABLE_FROZEN_IMAGE),
+    is_inited_(false),
+    param_()
+{
+}
+
+ObMemtableFrozenImageDag::~ObMemtableFrozenImageDag()
+{
+}
+
+int ObMemtableFrozenImageDag::init_by_param(
+    const share::ObIDagInitParam *param)
+{
+  int ret = OB_SUCCESS;
+  const ObMemtableFrozenImageParam *init_param = nullptr;
+
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObMemtableFrozenImageDag has been inited", K(ret), KPC(this));
+  } else if (FALSE_IT(init_param = static_cast<const ObMemtableFrozenImageParam *>(param))) {
+  } else if (OB_UNLIKELY(nullptr == init_param || !init_param->is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("get invalid arguments", K(ret), KPC(init_param));
+  } else {
+    param_ = *init_param;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObMemtableFrozenImageDag::create_first_task()
+{
+  int ret = OB_SUCCESS;
+  ObMemtableFrozenImageTask *task = nullptr;
+
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObMemtableFrozenImageDag has not inited", K(ret));
+  } else if (OB_FAIL(create_task(nullptr/*parent*/, task))) {
+    LOG_WARN("failed to create frozen image task", K(ret));
+  }
+  return ret;
+}
+
+bool ObMemtableFrozenImageDag::operator == (const ObIDag &other) const
+{
+  bool is_same = true;
+
+  if (this == &other) {
+    // same
+  } else if (get_type() != other.get_type()) {
+    is_same = false;
+  } else {
+    const ObMemtableFrozenImageParam &other_param = static_cast<const ObMemtableFrozenImageDag &>(other).param_;
+    is_same = param_.ls_id_ == other_param.ls_id_ && param_.tablet_id_ == other_param.tablet_id_;
+  }
+  return is_same;
+}
+
+int64_t ObMemtableFrozenImageDag::hash() const
+{
+  return param_.get_hash();
+}
+
+int ObMemtableFrozenImageDag::fill_info_param(
+    compaction::ObIBasicInfoParam *&out_param,
+    ObIAllocator &allocator) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObMemtableFrozenImageDag not inited", K(ret));
+  } else if (OB_FAIL(ADD_DAG_WARN_INFO_PARAM(out_param,
+                                             allocator,
+                                             get_type(),
+                                             param_.ls_id_.id(),
+                                             param_.tablet_id_.id()))) {
+    LOG_WARN("failed to fill info param", K(ret), K(param_));
+  }
+  return ret;
+}
+
+int ObMemtableFrozenImageDag::fill_dag_key(char *buf, const int64_t buf_len) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(databuff_printf(buf, buf_len, "ls_id=%ld tablet_id=%ld",
+      param_.ls_id_.id(), param_.tablet_id_.id()))) {
+    LOG_WARN("failed to fill dag key", K(ret), K(param_));
+  }
+  return ret;
+}
+
+
+ObMemtableFrozenImageTask::ObMemtableFrozenImageTask()
+  : ObITask(ObITask::TASK_TYPE_MEMTABLE_FROZEN_IMAGE),
+    is_inited_(false),
+    base_dag_(nullptr)
+{
+}
+
+ObMemtableFrozenImageTask::~ObMemtableFrozenImageTask()
+{
+}
+
+int ObMemtableFrozenImageTask::init()
+{
+  int ret = OB_SUCCESS;
+
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObMemtableFrozenImageTask init twice", K(ret));
+  } else if (OB_ISNULL(dag_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null dag", K(ret));
+  } else if (OB_UNLIKELY(ObDagType::ObDagTypeEnum::DAG_TYPE_MEMTABLE_FROZEN_IMAGE != dag_->get_type())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected dag type", K(ret));
+  } else if (FALSE_IT(base_dag_ = static_cast<ObMemtableFrozenImageDag *>(dag_))) {
+  } else if (OB_UNLIKELY(!base_dag_->get_param().is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected not valid param", K(ret), K(base_dag_->get_param()));
+  } else {
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObMemtableFrozenImageTask::process()
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  const ObMemtableFrozenImageParam &param = base_dag_->get_param();
+  ObLSHandle ls_handle;
+  ObTabletHandle tablet_handle;
+  ObArray<ObTableHandleV2> memtable_handles;
+  int64_t build_cnt = 0;
+
+  if (OB_FAIL(MTL(ObLSService *)->get_ls(param.ls_id_, ls_handle, ObLSGetMod::COMPACT_MODE))) {
+    LOG_WARN("failed to get log stream", K(ret), K(param));
+  } else if (OB_ISNULL(ls_handle.get_ls())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null ls", K(ret), K(param));
+  } else if (OB_FAIL(ls_handle.get_ls()->get_tablet_svr()->get_tablet(param.tablet_id_,
+                                                                      tablet_handle,
+                                                                      0 /*timeout_us*/,
+                                                                      storage::ObMDSGetTabletMode::READ_WITHOUT_CHECK))) {
+    LOG_WARN("failed to get tablet", K(ret), K(param));
+  } else if (OB_FAIL(tablet_handle.get_obj()->get_all_memtables(memtable_handles))) {
+    LOG_WARN("failed to get all memtables", K(ret), K(param));
+  }
+
+  // the memtable handles keep the memtables alive until the images are built
+  for (int64_t i = 0; OB_SUCC(ret) && i < memtable_handles.count(); ++i) {
+    ObITable *table = memtable_handles.at(i).get_table();
+    memtable::ObMemtable *memtable = nullptr;
+    if (OB_ISNULL(table) || !table->is_data_memtable()) {
+      // skip
+    } else if (FALSE_IT(memtable = static_cast<memtable::ObMemtable *>(table))) {
+    } else if (!memtable->is_can_flush() || memtable->get_is_flushed()
+               || memtable->get_query_engine().has_frozen_image()) {
+      // the active memtable or the memtable which is not needed any more
+    } else if (OB_TMP_FAIL(memtable->build_frozen_image())) {
+      LOG_WARN_RET(tmp_ret, "failed to build frozen image, the btree is scanned instead", K(param), KPC(memtable));
+    } else {
+      ++build_cnt;
+    }
+    if (OB_FAIL(share::dag_yield())) {
+      LOG_WARN("failed to dag yield", K(ret));
+    }
+  }
+  LOG_INFO("build memtable frozen images finished", K(ret), K(param), K(build_cnt));
+  return ret;
+}
+
+
 } // namespace compaction
 } // namespace oceanbase
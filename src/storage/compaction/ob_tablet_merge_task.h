@@ -407,6 +407,64 @@ private:
 };
 
 
+struct ObMemtableFrozenImageParam : public share::ObIDagInitParam
+{
+public:
+  ObMemtableFrozenImageParam() : ls_id_(), tablet_id_() {}
+  ObMemtableFrozenImageParam(const share::ObLSID &ls_id, const common::ObTabletID &tablet_id)
+    : ls_id_(ls_id), tablet_id_(tablet_id) {}
+  virtual ~ObMemtableFrozenImageParam() {}
+  virtual bool is_valid() const override { return ls_id_.is_valid() && tablet_id_.is_valid(); }
+  int64_t get_hash() const;
+  VIRTUAL_TO_STRING_KV(K_(ls_id), K_(tablet_id));
+public:
+  share::ObLSID ls_id_;
+  common::ObTabletID tablet_id_;
+};
+
+
+// builds the frozen images of the frozen memtables of the tablet in background,
+// the mini merge does not wait for it and uses the image only if it is ready
+class ObMemtableFrozenImageDag : public share::ObIDag
+{
+public:
+  ObMemtableFrozenImageDag();
+  virtual ~ObMemtableFrozenImageDag();
+  int init_by_param(const share::ObIDagInitParam *param);
+  virtual int create_first_task() override;
+  virtual bool operator == (const ObIDag &other) const override;
+  virtual int64_t hash() const override;
+  virtual int fill_info_param(
+      compaction::ObIBasicInfoParam *&out_param,
+      ObIAllocator &allocator) const override;
+  virtual int fill_dag_key(char *buf, const int64_t buf_len) const override;
+  virtual lib::Worker::CompatMode get_compat_mode() const override { return lib::Worker::CompatMode::MYSQL; }
+  virtual uint64_t get_consumer_group_id() const override { return consumer_group_id_; }
+  const ObMemtableFrozenImageParam &get_param() const { return param_; }
+  INHERIT_TO_STRING_KV("ObIDag", ObIDag, K_(is_inited), K_(param));
+private:
+  bool is_inited_;
+  ObMemtableFrozenImageParam param_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObMemtableFrozenImageDag);
+};
+
+
+class ObMemtableFrozenImageTask : public share::ObITask
+{
+public:
+  ObMemtableFrozenImageTask();
+  virtual ~ObMemtableFrozenImageTask();
+  int init();
+  virtual int process() override;
+private:
+  bool is_inited_;
+  ObMemtableFrozenImageDag *base_dag_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObMemtableFrozenImageTask);
+};
+
+
 } // namespace compaction
 } // namespace oceanbase
 
@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "storage/memtable/mvcc/ob_frozen_image.h"
+#include "lib/allocator/ob_malloc.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace memtable
+{
+
+ObFrozenImage::ObFrozenImage()
+  : capacity_(0),
+    count_(0),
+    fingerprints_(nullptr),
+    keys_(nullptr),
+    values_(nullptr)
+{
+}
+
+int ObFrozenImage::init(const int64_t capacity, const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  const int64_t entry_size = sizeof(uint64_t) + sizeof(ObStoreRowkey *) + sizeof(ObMvccRow *);
+  char *buf = nullptr;
+  if (OB_UNLIKELY(nullptr != fingerprints_)) {
+    ret = OB_INIT_TWICE;
+    TRANS_LOG(WARN, "frozen image init twice", K(ret), KPC(this));
+  } else if (OB_UNLIKELY(capacity <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", K(ret), K(capacity));
+  } else if (OB_ISNULL(buf = static_cast<char *>(ob_malloc(entry_size * capacity,
+                                                           ObMemAttr(tenant_id, "MtFrozenImage"))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    TRANS_LOG(WARN, "alloc frozen image failed", K(ret), K(capacity));
+  } else {
+    fingerprints_ = reinterpret_cast<uint64_t *>(buf);
+    keys_ = reinterpret_cast<const ObStoreRowkey **>(buf + sizeof(uint64_t) * capacity);
+    values_ = reinterpret_cast<ObMvccRow **>(buf + (sizeof(uint64_t) + sizeof(ObStoreRowkey *)) * capacity);
+    capacity_ = capacity;
+    count_ = 0;
+  }
+  return ret;
+}
+
+int ObFrozenImage::push_back(const ObStoreRowkey *key, ObMvccRow *value)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(fingerprints_)) {
+    ret = OB_NOT_INIT;
+    TRANS_LOG(WARN, "frozen image not init", K(ret));
+  } else if (OB_UNLIKELY(count_ >= capacity_)) {
+    ret = OB_SIZE_OVERFLOW;
+    TRANS_LOG(WARN, "frozen image is full", K(ret), KPC(this));
+  } else {
+    fingerprints_[count_] = ObStoreRowkeyWrapper(key).get_fingerprint();
+    keys_[count_] = key;
+    values_[count_] = value;
+    count_++;
+  }
+  return ret;
+}
+
+void ObFrozenImage::destroy()
+{
+  if (nullptr != fingerprints_) {
+    ob_free(fingerprints_);
+  }
+  fingerprints_ = nullptr;
+  keys_ = nullptr;
+  values_ = nullptr;
+  capacity_ = 0;
+  count_ = 0;
+}
+
+int ObFrozenImage::compare_(const ObStoreRowkeyWrapper &key,
+                            const uint64_t fingerprint,
+                            const int64_t pos,
+                            int &cmp) const
+{
+  int ret = OB_SUCCESS;
+  const uint64_t pos_fingerprint = fingerprints_[pos];
+  if (0 != fingerprint && 0 != pos_fingerprint && fingerprint != pos_fingerprint) {
+    cmp = pos_fingerprint < fingerprint ? -1 : 1;
+  } else if (OB_FAIL(keys_[pos]->compare(*key.get_rowkey(), cmp))) {
+    TRANS_LOG(WARN, "compare rowkey failed", K(ret), K(pos));
+  }
+  return ret;
+}
+
+int ObFrozenImage::lower_bound(const ObStoreRowkeyWrapper &key, const bool exclude, int64_t &pos) const
+{
+  int ret = OB_SUCCESS;
+  const uint64_t fingerprint = key.get_fingerprint();
+  int64_t low = 0;
+  int64_t high = count_;
+  int cmp = 0;
+  // find the first position whose key is not less than(greater than) the key
+  while (OB_SUCC(ret) && low < high) {
+    const int64_t mid = low + (high - low) / 2;
+    if (OB_FAIL(compare_(key, fingerprint, mid, cmp))) {
+    } else if (cmp < 0 || (exclude && 0 == cmp)) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    pos = low;
+  }
+  return ret;
+}
+
+int ObFrozenImageIterator::set_key_range(const ObFrozenImage &image,
+                                         const ObStoreRowkeyWrapper &min_key,
+                                         const bool start_exclude,
+                                         const ObStoreRowkeyWrapper &max_key,
+                                         const bool end_exclude)
+{
+  int ret = OB_SUCCESS;
+  int cmp = 0;
+  int64_t start_pos = 0;
+  int64_t end_pos = 0;
+  reset();
+  if (OB_FAIL(max_key.compare(min_key, cmp))) {
+    TRANS_LOG(WARN, "compare scan keys failed", K(ret));
+  } else if (FALSE_IT(scan_backward_ = (cmp < 0))) {
+  } else if (!scan_backward_) {
+    if (OB_FAIL(image.lower_bound(min_key, start_exclude, start_pos))) {
+      TRANS_LOG(WARN, "search start key failed", K(ret));
+    } else if (OB_FAIL(image.lower_bound(max_key, !end_exclude, end_pos))) {
+      TRANS_LOG(WARN, "search end key failed", K(ret));
+    } else {
+      pos_ = start_pos;
+      end_pos_ = end_pos;
+    }
+  } else {
+    // the backward scan starts from the min key and ends at the max key
+    if (OB_FAIL(image.lower_bound(min_key, !start_exclude, start_pos))) {
+      TRANS_LOG(WARN, "search start key failed", K(ret));
+    } else if (OB_FAIL(image.lower_bound(max_key, end_exclude, end_pos))) {
+      TRANS_LOG(WARN, "search end key failed", K(ret));
+    } else {
+      pos_ = start_pos - 1;
+      end_pos_ = end_pos - 1;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    image_ = &image;
+  }
+  return ret;
+}
+
+int ObFrozenImageIterator::get_next(ObStoreRowkeyWrapper &key, ObMvccRow *&value)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(image_)) {
+    ret = OB_ITER_END;
+  } else if (scan_backward_ ? pos_ <= end_pos_ : pos_ >= end_pos_) {
+    ret = OB_ITER_END;
+  } else {
+    key = ObStoreRowkeyWrapper(image_->get_key(pos_));
+    value = image_->get_value(pos_);
+    pos_ += scan_backward_ ? -1 : 1;
+  }
+  return ret;
+}
+
+} // namespace memtable
+} // namespace oceanbase
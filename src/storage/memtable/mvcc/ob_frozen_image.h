@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_MEMTABLE_MVCC_OB_FROZEN_IMAGE_
+#define OCEANBASE_MEMTABLE_MVCC_OB_FROZEN_IMAGE_
+
+#include "lib/container/ob_iarray.h"
+#include "storage/memtable/ob_memtable_key.h"
+
+namespace oceanbase
+{
+namespace memtable
+{
+class ObMvccRow;
+
+// ObFrozenImage is the sorted and immutable image of the keys and rows of the
+// frozen memtable, which accepts no more new keys. The image is kept column by
+// column: the fingerprints, the rowkeys and the rows are in three arrays, so
+// the binary search only touches the dense fingerprint array, and the range
+// scan walks the arrays sequentially instead of the btree nodes.
+//
+// The image only replaces the key index. The rows are the same ObMvccRow as in
+// the btree, so the readers and the mini merge see the same versions of the
+// rows no matter whether they scan the image or the btree.
+class ObFrozenImage
+{
+public:
+  ObFrozenImage();
+  ~ObFrozenImage() { destroy(); }
+  // build the image from the sorted keys and rows, the count must not exceed
+  // the capacity passed to init
+  int init(const int64_t capacity, const uint64_t tenant_id);
+  int push_back(const common::ObStoreRowkey *key, ObMvccRow *value);
+  void destroy();
+  int64_t count() const { return count_; }
+  const common::ObStoreRowkey *get_key(const int64_t pos) const { return keys_[pos]; }
+  ObMvccRow *get_value(const int64_t pos) const { return values_[pos]; }
+  // lower_bound returns the position of the first key which is not less
+  // than(or greater than if exclude is true) the key
+  int lower_bound(const ObStoreRowkeyWrapper &key, const bool exclude, int64_t &pos) const;
+  TO_STRING_KV(K_(capacity), K_(count));
+private:
+  int compare_(const ObStoreRowkeyWrapper &key, const uint64_t fingerprint, const int64_t pos, int &cmp) const;
+private:
+  int64_t capacity_;
+  int64_t count_;
+  uint64_t *fingerprints_;
+  const common::ObStoreRowkey **keys_;
+  ObMvccRow **values_;
+  DISALLOW_COPY_AND_ASSIGN(ObFrozenImage);
+};
+
+// ObFrozenImageIterator scans the keys of the frozen image in the range, it has
+// the same interface as the btree iterator
+class ObFrozenImageIterator
+{
+public:
+  ObFrozenImageIterator() : image_(nullptr), pos_(0), end_pos_(0), scan_backward_(false) {}
+  ~ObFrozenImageIterator() {}
+  int set_key_range(const ObFrozenImage &image,
+                    const ObStoreRowkeyWrapper &min_key,
+                    const bool start_exclude,
+                    const ObStoreRowkeyWrapper &max_key,
+                    const bool end_exclude);
+  int get_next(ObStoreRowkeyWrapper &key, ObMvccRow *&value);
+  bool is_inited() const { return nullptr != image_; }
+  bool is_reverse_scan() const { return scan_backward_; }
+  void reset()
+  {
+    image_ = nullptr;
+    pos_ = 0;
+    end_pos_ = 0;
+    scan_backward_ = false;
+  }
+private:
+  const ObFrozenImage *image_;
+  // the next position to scan, and the scan stops at end_pos_. The forward
+  // scan is [pos_, end_pos_), and the backward scan is (end_pos_, pos_]
+  int64_t pos_;
+  int64_t end_pos_;
+  bool scan_backward_;
+};
+
+} // namespace memtable
+} // namespace oceanbase
+
+#endif // OCEANBASE_MEMTABLE_MVCC_OB_FROZEN_IMAGE_
@@ -101,7 +101,7 @@ void BtreeNode<BtreeKey, BtreeVal>::copy(BtreeNode &dest, const int dest_start,
 {
   if (OB_LIKELY(start < end)) {
     for (int i = 0; i < end - start; ++i) {
-      dest.set_key_value(dest_start + i, get_key(start + i), get_val(start + i));
+      dest.set_key_value(dest_start + i, get_key(start + i), get_fingerprint(start + i), get_val(start + i));
       if (dest.is_leaf()) {
         dest.index_.unsafe_insert(dest_start + i, dest_start + i);
       }
@@ -238,6 +238,7 @@ int GetHandle<BtreeKey, BtreeVal>::get(BtreeNode *root, BtreeKey key, BtreeVal &
   int pos = -1;
   bool is_found = false;
   MultibitSet *index = &this->index_;
+  const uint64_t key_fp = BtreeKeyFingerprint<BtreeKey>::get(key);
   index->reset();
   if (OB_ISNULL(root)) {
     ret = OB_ENTRY_NOT_EXIST;
@@ -245,7 +246,7 @@ int GetHandle<BtreeKey, BtreeVal>::get(BtreeNode *root, BtreeKey key, BtreeVal &
   while (OB_SUCCESS == ret && OB_ISNULL(leaf)) {
     if (is_found) {
       pos = 0;
-    } else if (OB_FAIL(root->find_pos(this->get_comp(), key, is_found, pos, index))) {
+    } else if (OB_FAIL(root->find_pos(this->get_comp(), key, key_fp, is_found, pos, index))) {
       break;
     }
     if (pos < 0) {
@@ -354,12 +355,13 @@ int ScanHandle<BtreeKey, BtreeVal>::find_path(BtreeNode *root, BtreeKey key)
   bool may_exist = true;
   bool is_found = false;
   MultibitSet *index = &this->index_;
+  const uint64_t key_fp = BtreeKeyFingerprint<BtreeKey>::get(key);
   index->reset();
   while (OB_NOT_NULL(root) && OB_SUCCESS == ret) {
     root->prefetch();
     if (!may_exist || is_found) {
       pos = 0;
-    } else if (OB_FAIL(root->find_pos(this->get_comp(), key, is_found, pos, index))) {
+    } else if (OB_FAIL(root->find_pos(this->get_comp(), key, key_fp, is_found, pos, index))) {
       break;
     }
     if (pos < 0) {
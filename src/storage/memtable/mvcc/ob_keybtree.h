@@ -43,6 +43,17 @@ class WriteHandle;
 template<typename BtreeKey, typename BtreeVal>
 class GetHandle;
 
+// Memtable rowkeys are searched with the fingerprints of their order perserving
+// encoding, see ObStoreRowkeyWrapper::get_fingerprint.
+template<>
+struct BtreeKeyFingerprint<memtable::ObStoreRowkeyWrapper>
+{
+  OB_INLINE static uint64_t get(const memtable::ObStoreRowkeyWrapper &key)
+  {
+    return key.get_fingerprint();
+  }
+};
+
 // In order to use the keybtree, you need carefully choose the key and value.
 // The key and value must both be 8 byte and last three bit of the value needs
 // to be 0. So we recommend pointers to implement them.
@@ -44,6 +44,19 @@ enum
   NODE_COUNT_PER_ALLOC = 128
 };
 
+// Fixed-width order perserving prefix of the key stored beside the key in
+// btree node. 0 means the key has no fingerprint, specialize it for the key
+// types which can be normalized.
+template<typename BtreeKey>
+struct BtreeKeyFingerprint
+{
+  OB_INLINE static uint64_t get(const BtreeKey &key)
+  {
+    UNUSED(key);
+    return 0;
+  }
+};
+
 template<typename BtreeKey, typename BtreeVal>
 struct CompHelper
 {
@@ -51,6 +64,18 @@ struct CompHelper
   {
     return search_key.compare(idx_key, cmp);
   }
+  // different fingerprints decide the order, fall back to the key comparator on ties
+  OB_INLINE int compare(const BtreeKey search_key, const uint64_t search_fp,
+                        const BtreeKey idx_key, const uint64_t idx_fp, int &cmp) const
+  {
+    int ret = OB_SUCCESS;
+    if (0 != search_fp && 0 != idx_fp && search_fp != idx_fp) {
+      cmp = search_fp < idx_fp ? -1 : 1;
+    } else {
+      ret = search_key.compare(idx_key, cmp);
+    }
+    return ret;
+  }
 };
 
 class RWLock
@@ -223,6 +248,10 @@ public:
   {
     return kvs_[get_real_pos(pos, index)].key_;
   }
+  OB_INLINE uint64_t get_fingerprint(int pos, MultibitSet *index = nullptr) const
+  {
+    return fingerprints_[get_real_pos(pos, index)];
+  }
   OB_INLINE BtreeVal get_val(int pos, MultibitSet *index = nullptr) const
   {
     return ATOMIC_LOAD(&kvs_[get_real_pos(pos, index)].val_);
@@ -234,9 +263,14 @@ public:
   int make_new_root(BtreeKey key1, BtreeNode *node_1, BtreeKey key2, BtreeNode *node_2, int16_t level);
   bool is_overflow(const int64_t delta, MultibitSet *index = nullptr) { return size(index) + delta > NODE_KEY_COUNT; }
   void print(FILE *file, const int depth) const;
-  OB_INLINE int find_pos(CompHelper &nh, BtreeKey key, bool &is_equal, int &pos, MultibitSet *index = nullptr)
+  OB_INLINE int find_pos(CompHelper &nh,
+                         BtreeKey key,
+                         const uint64_t key_fp,
+                         bool &is_equal,
+                         int &pos,
+                         MultibitSet *index = nullptr)
   {
-    int ret = binary_search_upper_bound(nh, key, is_equal, pos, index);
+    int ret = binary_search_upper_bound(nh, key, key_fp, is_equal, pos, index);
     pos -= 1;
     return ret;
   }
@@ -244,6 +278,11 @@ public:
   int get_prev_active_child(int pos);
   OB_INLINE void set_key_value(int pos, BtreeKey key, BtreeVal val)
   {
+    set_key_value(pos, key, BtreeKeyFingerprint<BtreeKey>::get(key), val);
+  }
+  OB_INLINE void set_key_value(int pos, BtreeKey key, const uint64_t key_fp, BtreeVal val)
+  {
+    fingerprints_[pos] = key_fp;
     kvs_[pos].key_ = key;
     ATOMIC_STORE(&kvs_[pos].val_, val);
   }
@@ -273,6 +312,7 @@ public:
 protected:
   OB_INLINE int binary_search_upper_bound(CompHelper &nh,
                                           BtreeKey key,
+                                          const uint64_t key_fp,
                                           bool &is_equal,
                                           int &pos,
                                           MultibitSet *index = nullptr)
@@ -296,7 +336,7 @@ protected:
       __builtin_prefetch(get_key(start + (mid - start) / 2, index).get_ptr(), 0, 3);
       __builtin_prefetch(get_key(start + (end - mid - 1) / 2, index).get_ptr(), 0, 3);
       int cmp_ret = 0;
-      if (OB_FAIL(nh.compare(key, get_key(mid, index), cmp_ret))) {
+      if (OB_FAIL(nh.compare(key, key_fp, get_key(mid, index), get_fingerprint(mid, index), cmp_ret))) {
         OB_LOG(ERROR, "failed to compare", K(key), K(get_key(mid, index)));
       } else if (0 == cmp_ret) {
         is_equal = true;
@@ -335,6 +375,9 @@ private:
   // leaf's key-value is unordered, so index contains the real position of
   // key-value on leaf
   MultibitSet index_; // 8byte
+  // order perserving prefixes of the keys, in the same position as kvs_, they
+  // are compared before the keys so that most compares do not touch the keys
+  uint64_t fingerprints_[NODE_KEY_COUNT]; // 8 * 15 = 120byte
   BtreeKV kvs_[NODE_KEY_COUNT]; // 16 * 15 = 240byte
 };
 
@@ -516,6 +559,7 @@ public:
     bool is_found = false;
     BtreeNode *node = nullptr;
     MultibitSet *index = &this->index_;
+    const uint64_t key_fp = BtreeKeyFingerprint<BtreeKey>::get(key);
     index->reset();
     if (OB_SUCC(path_.get(0, node, pos)) && node == root) {
       // find locked nodes, and remove them from path.
@@ -531,7 +575,7 @@ public:
         pos = -1;
       } else if (is_found) {
         pos = 0;
-      } else if (OB_FAIL(root->find_pos(this->get_comp(), key, is_found, pos, index))) {
+      } else if (OB_FAIL(root->find_pos(this->get_comp(), key, key_fp, is_found, pos, index))) {
         break;
       }
       if (pos < 0) {
@@ -47,6 +47,9 @@ struct ObTxNodeArg
   // scn_ is thee log ts of the redo log
   share::SCN scn_;
   int64_t column_cnt_;
+  // is_delta_ means data_ is a commutative delta of the counter columns
+  // instead of their new value. It is only used for leader
+  bool is_delta_;
 
   TO_STRING_KV(K_(tx_id),
                KP_(data),
@@ -56,7 +59,8 @@ struct ObTxNodeArg
                K_(memstore_version),
                K_(seq_no),
                K_(scn),
-               K_(column_cnt));
+               K_(column_cnt),
+               K_(is_delta));
 
   // Constructor for leader
   ObTxNodeArg(const transaction::ObTransID tx_id,
@@ -73,7 +77,8 @@ struct ObTxNodeArg
     memstore_version_(memstore_version),
     seq_no_(seq_no),
     scn_(share::SCN::max_scn()),
-    column_cnt_(column_cnt) {}
+    column_cnt_(column_cnt),
+    is_delta_(false) {}
 
   // Constructor for follower
   ObTxNodeArg(const transaction::ObTransID tx_id,
@@ -93,7 +98,8 @@ struct ObTxNodeArg
     memstore_version_(memstore_version),
     seq_no_(seq_no),
     scn_(scn),
-    column_cnt_(column_cnt) {}
+    column_cnt_(column_cnt),
+    is_delta_(false) {}
 
   void reset() {
     tx_id_.reset();
@@ -105,6 +111,7 @@ struct ObTxNodeArg
     seq_no_.reset();
     scn_ = share::SCN::min_scn();
     column_cnt_ = 0;
+    is_delta_ = false;
   }
 };
 
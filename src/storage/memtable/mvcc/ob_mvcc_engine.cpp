@@ -335,7 +335,9 @@ int ObMvccEngine::mvcc_write(storage::ObStoreCtx &ctx,
                                       *node,
                                       res))) {
     if (OB_TRY_LOCK_ROW_CONFLICT != ret &&
-        OB_TRANSACTION_SET_VIOLATION != ret) {
+        OB_TRANSACTION_SET_VIOLATION != ret &&
+        OB_EAGAIN != ret &&
+        OB_ERR_CHECK_CONSTRAINT_VIOLATED != ret) {
       TRANS_LOG(WARN, "mvcc write failed", K(ret), KPC(mem_ctx), K(arg));
     }
   } else {
@@ -374,6 +376,7 @@ int ObMvccEngine::build_tx_node_(const ObTxNodeArg &arg,
     node->version_ = arg.memstore_version_;
     node->scn_ = arg.scn_;
     node->seq_no_ = arg.seq_no_;
+    node->type_ = arg.is_delta_ ? NDT_DELTA : NDT_NORMAL;
     node->prev_ = NULL;
     node->next_ = NULL;
   }
@@ -399,9 +402,9 @@ int ObMvccEngine::ensure_kv(const ObMemtableKey *stored_key,
   return ret;
 }
 
-void ObMvccEngine::mvcc_undo(ObMvccRow *value)
+void ObMvccEngine::mvcc_undo(ObMvccRow *value, ObMvccTransNode *node)
 {
-  value->mvcc_undo();
+  value->mvcc_undo(node);
 }
 }
 }
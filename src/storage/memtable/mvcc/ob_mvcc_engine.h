@@ -80,7 +80,7 @@ public:
 
   // mvcc_undo removes the newly written tx node. It never returns error
   // and always succeed.
-  void mvcc_undo(ObMvccRow *value);
+  void mvcc_undo(ObMvccRow *value, ObMvccTransNode *node = NULL);
 
   // mvcc_replay builds the ObMvccTransNode according to the arg
   int mvcc_replay(const ObTxNodeArg &arg,
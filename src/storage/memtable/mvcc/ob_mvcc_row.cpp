@@ -17,6 +17,7 @@
 #include "storage/ob_i_store.h"
 #include "storage/memtable/ob_memtable_data.h"
 #include "storage/memtable/ob_row_compactor.h"
+#include "storage/memtable/ob_memtable_delta.h"
 #include "lib/stat/ob_diagnose_info.h"
 #include "lib/time/ob_time_utility.h"
 #include "lib/time/ob_tsc_timestamp.h"
@@ -393,7 +394,7 @@ int ObMvccRow::unlink_trans_node(const ObMvccTransNode &node)
     if (&node == ATOMIC_LOAD(&list_head_)) {
       // pass
     } else {
-      if (ObDmlFlag::DF_LOCK == node.get_dml_flag()) {
+      if (ObDmlFlag::DF_LOCK == node.get_dml_flag() || NDT_DELTA == node.type_) {
       } else if (EXECUTE_COUNT_PER_SEC(100)) {
         TRANS_LOG(WARN, "unlink middle trans node", K(node), K(*this));
       }
@@ -785,6 +786,7 @@ int ObMvccRow::mvcc_write_(ObStoreCtx &ctx,
   bool &is_new_locked = res.is_new_locked_;
   ObStoreRowLockState &lock_state = res.lock_state_;
   ObExistFlag &exist_flag = lock_state.exist_flag_;
+  const bool is_delta_writer = NDT_DELTA == writer_node.type_;
   bool need_retry = true;
 
   while (OB_SUCC(ret) && need_retry) {
@@ -829,6 +831,14 @@ int ObMvccRow::mvcc_write_(ObStoreCtx &ctx,
         //         so we need look for the next one
         iter = iter->prev_;
         need_retry = true;
+      } else if (NDT_DELTA == iter->type_
+                 && (is_delta_writer || data_tx_id == writer_tx_id)) {
+        // Case 3.1: the newest node is an undecided delta node, the delta
+        //           writer commutes with it and the writer of the same txn
+        //           must not be put above the delta nodes of other txns, so
+        //           we need look for the next one, see ObMemtableRowDelta
+        iter = iter->prev_;
+        need_retry = true;
       } else if (data_tx_id == writer_tx_id) {
         // Case 4: the newest node is not decided and locked by itself, so we
         //         can insert into it
@@ -886,6 +896,16 @@ int ObMvccRow::mvcc_write_(ObStoreCtx &ctx,
                                                                    list_head_->get_seq_no()))) {
         TRANS_LOG(WARN, "check sequence set violation failed", K(ret), KPC(this));
       } else if (nullptr != list_head_ && FALSE_IT(res.is_checked_ = true)) {
+      } else if (is_delta_writer
+                 && OB_FAIL(ObMemtableRowDelta::check_delta_write(ctx.mvcc_acc_ctx_.get_tx_table_guards().tx_table_guard_,
+                                                                  *this,
+                                                                  writer_node,
+                                                                  writer_tx_id,
+                                                                  snapshot_version,
+                                                                  ctx.mvcc_acc_ctx_.write_flag_.is_delta_non_neg()))) {
+        if (OB_EAGAIN != ret && OB_ERR_CHECK_CONSTRAINT_VIOLATED != ret) {
+          TRANS_LOG(WARN, "check delta write failed", K(ret), K(writer_node), KPC(this));
+        }
       } else if (OB_SUCC(check_double_insert_(snapshot_version,
                                               writer_node,
                                               list_head_))) {
@@ -937,13 +957,19 @@ int ObMvccRow::check_double_insert_(const SCN snapshot_version,
   return ret;
 }
 
-void ObMvccRow::mvcc_undo()
+void ObMvccRow::mvcc_undo(ObMvccTransNode *node)
 {
   ObRowLatchGuard guard(latch_);
   ObMvccTransNode *iter = ATOMIC_LOAD(&list_head_);
 
   if (OB_ISNULL(iter)) {
     TRANS_LOG_RET(ERROR, OB_ERR_UNEXPECTED, "mvcc undo with no mvcc data");
+  } else if (NULL != node && node != iter) {
+    // the delta node may be covered by the delta nodes of other txns
+    node->set_aborted();
+    if (OB_SUCCESS != unlink_trans_node(*node)) {
+      TRANS_LOG_RET(ERROR, OB_ERR_UNEXPECTED, "unlink undo node failed", KPC(node), K(*this));
+    }
   } else {
     iter->set_aborted();
     ATOMIC_STORE(&(list_head_), iter->prev_);
@@ -961,8 +987,11 @@ int ObMvccRow::mvcc_write(ObStoreCtx &ctx,
 {
   int ret = OB_SUCCESS;
   const SCN snapshot_version = snapshot.version_;
-  if (max_trans_version_.atomic_load() > snapshot_version
-      || max_elr_trans_version_.atomic_load() > snapshot_version) {
+  // the delta node commutes with the committed newer versions
+  const bool is_delta = NDT_DELTA == node.type_;
+  if (!is_delta
+      && (max_trans_version_.atomic_load() > snapshot_version
+          || max_elr_trans_version_.atomic_load() > snapshot_version)) {
     // Case 3. successfully locked while tsc
     ret = OB_TRANSACTION_SET_VIOLATION;
     TRANS_LOG(WARN, "transaction set violation", K(ret),
@@ -972,13 +1001,16 @@ int ObMvccRow::mvcc_write(ObStoreCtx &ctx,
                                  node,
                                  snapshot,
                                  res))) {
-    TRANS_LOG(WARN, "mvcc write failed", K(ret), K(node), K(ctx));
+    if (OB_EAGAIN != ret && OB_ERR_CHECK_CONSTRAINT_VIOLATED != ret) {
+      TRANS_LOG(WARN, "mvcc write failed", K(ret), K(node), K(ctx));
+    }
   } else if (!res.can_insert_) {
     // Case1: Cannot insert because of write-write conflict
     ret = OB_TRY_LOCK_ROW_CONFLICT;
     TRANS_LOG(WARN, "mvcc write conflict", K(ret), K(ctx), K(node), K(res), K(*this));
-  } else if (max_trans_version_.atomic_load() > snapshot_version
-             || max_elr_trans_version_.atomic_load() > snapshot_version) {
+  } else if (!is_delta
+             && (max_trans_version_.atomic_load() > snapshot_version
+                 || max_elr_trans_version_.atomic_load() > snapshot_version)) {
     // Case 3. successfully locked while tsc
     ret = OB_TRANSACTION_SET_VIOLATION;
     TRANS_LOG(WARN, "transaction set violation", K(ret), K(ctx), K(node), K(*this));
@@ -986,7 +1018,7 @@ int ObMvccRow::mvcc_write(ObStoreCtx &ctx,
       TRANS_LOG(ERROR, "TSC will occurred when already inserted", K(ctx), K(node), KPC(this));
     } else {
       // Tip1: mvcc_write guarantee the tnode will not be inserted if error is reported
-      (void)mvcc_undo();
+      (void)mvcc_undo(res.tx_node_);
     }
   } else if (node.get_dml_flag() == blocksstable::ObDmlFlag::DF_INSERT &&
              res.lock_state_.row_exist()) {
@@ -998,7 +1030,7 @@ int ObMvccRow::mvcc_write(ObStoreCtx &ctx,
       // It may not inserted due to primary key duplicated
     } else {
       // Tip1: mvcc_write guarantee the tnode will not be inserted if error is reported
-      (void)mvcc_undo();
+      (void)mvcc_undo(res.tx_node_);
     }
   }
   return ret;
@@ -34,6 +34,9 @@ namespace memtable
 
 static const uint8_t NDT_NORMAL = 0x0;
 static const uint8_t NDT_COMPACT = 0x1;
+// NDT_DELTA is the uncommitted commutative increment of the counter columns,
+// it is folded into a NDT_NORMAL node before its redo is filled
+static const uint8_t NDT_DELTA = 0x2;
 class ObIMvccCtx;
 class ObMemtable;
 class ObIMemtableCtx;
@@ -292,7 +295,9 @@ struct ObMvccRow
   /*                 ObMvccTransNode &node); */
 
   // mvcc_replay undo the newest write operation when encountering errors
-  void mvcc_undo();
+  // node is the written tx node, which may not be the newest one if it is a
+  // delta node
+  void mvcc_undo(ObMvccTransNode *node = NULL);
 
   // check_row_locked check whether row is locked and returns the corresponding information
   // key is the row key for lock
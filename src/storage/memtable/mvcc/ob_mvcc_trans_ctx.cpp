@@ -17,12 +17,14 @@
 #include "storage/memtable/ob_memtable.h"
 #include "storage/memtable/ob_memtable_context.h"
 #include "storage/memtable/ob_memtable_data.h"
+#include "storage/memtable/ob_memtable_delta.h"
 #include "storage/memtable/ob_memtable_util.h"
 #include "storage/memtable/ob_memtable_mutator.h"
 #include "lib/atomic/atomic128.h"
 #include "storage/memtable/ob_lock_wait_mgr.h"
 #include "storage/tx/ob_trans_ctx.h"
 #include "storage/tx/ob_trans_part_ctx.h"
+#include "storage/tx/ob_trans_service.h"
 #include "storage/tx/ob_tx_stat.h"
 #include "ob_mvcc_ctx.h"
 #include "storage/memtable/ob_memtable_interface.h"
@@ -1776,6 +1778,7 @@ int ObMvccRowCallback::trans_commit()
           TRANS_LOG(WARN, "mvcc trans ctx trans commit error", K(ret), K_(ctx), K_(value));
         } else if (FALSE_IT(tnode_->trans_commit(ctx_.get_commit_version(), ctx_.get_tx_end_scn()))) {
         } else if (FALSE_IT(wakeup_row_waiter_if_need_())) {
+        } else if (FALSE_IT(wakeup_delta_writers_if_need_())) {
         } else if (blocksstable::ObDmlFlag::DF_LOCK == get_dml_flag()) {
           unlink_trans_node();
         } else {
@@ -1847,6 +1850,38 @@ int ObMvccRowCallback::wakeup_row_waiter_if_need_()
   return ret;
 }
 
+/*
+ * wakeup_delta_writers_if_need_ - wakeup txns whose delta nodes wait for folding
+ *
+ * The delta node can not be folded into the redo until its base node is
+ * decided, and the redo submit of the delta writer stops there. When the base
+ * node is committed or aborted, ask the delta writers above it to resubmit,
+ * otherwise a committing delta writer waits until its next timeout round.
+ */
+void ObMvccRowCallback::wakeup_delta_writers_if_need_()
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObTransID, ObMemtableRowDelta::MAX_WAKEUP_TX_CNT> tx_ids;
+  ObTransService *tx_service = MTL(ObTransService *);
+  if (NULL == tnode_ || NULL == tnode_->next_ || ctx_.is_for_replay()) {
+    // no delta writer above
+  } else if (OB_FAIL(ObMemtableRowDelta::get_blocked_delta_txs(*tnode_, tx_ids))) {
+    TRANS_LOG(WARN, "get blocked delta txs failed", K(ret), K(*this));
+  } else if (tx_ids.empty()) {
+    // do nothing
+  } else if (OB_ISNULL(tx_service) || OB_ISNULL(memtable_)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(WARN, "tx service or memtable is null", K(ret), KP(tx_service), KP_(memtable));
+  } else {
+    for (int64_t i = 0; i < tx_ids.count(); ++i) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_TMP_FAIL(tx_service->wakeup_delta_fold(memtable_->get_ls_id(), tx_ids.at(i)))) {
+        TRANS_LOG(WARN, "wakeup delta writer failed", K(tmp_ret), "tx_id", tx_ids.at(i), K(*this));
+      }
+    }
+  }
+}
+
 int ObMvccRowCallback::trans_abort()
 {
   ObRowLatchGuard guard(value_.latch_);
@@ -1862,6 +1897,7 @@ int ObMvccRowCallback::trans_abort()
     if (!(tnode_->is_committed() || tnode_->is_aborted())) {
       tnode_->trans_abort(ctx_.get_tx_end_scn());
       wakeup_row_waiter_if_need_();
+      wakeup_delta_writers_if_need_();
       unlink_trans_node();
     } else if (tnode_->is_committed()) {
       TRANS_LOG_RET(ERROR, OB_ERR_UNEXPECTED, "abort on a committed node", K(*this));
@@ -1877,6 +1913,7 @@ int ObMvccRowCallback::rollback_callback()
   if (NULL != tnode_) {
     tnode_->set_aborted();
     wakeup_row_waiter_if_need_();
+    wakeup_delta_writers_if_need_();
     unlink_trans_node();
   }
 
@@ -1903,6 +1940,13 @@ int ObMvccRowCallback::get_redo(RedoDataNode &redo_node)
   } else if (!is_link_) {
     ret = OB_STATE_NOT_MATCH;
     TRANS_LOG(ERROR, "get_redo: trans_nod not link", K(ret), K(*this));
+  } else if (NDT_DELTA == tnode_->type_
+             && OB_FAIL(memtable_->convert_delta_node(ctx_, &value_, tnode_, old_row_))) {
+    // the delta node must be folded before it is logged, and
+    // OB_TX_DELTA_FOLD_BLOCKED means its base is not decided yet
+    if (OB_TX_DELTA_FOLD_BLOCKED != ret) {
+      TRANS_LOG(WARN, "get_redo: convert delta node failed", K(ret), K(*this));
+    }
   } else {
     uint32_t last_acc_checksum = 0;
     if (NULL != tnode_->prev_) {
@@ -1913,7 +1957,8 @@ int ObMvccRowCallback::get_redo(RedoDataNode &redo_node)
     tnode_->cal_acc_checksum(last_acc_checksum);
     const ObMemtableDataHeader *mtd = reinterpret_cast<const ObMemtableDataHeader *>(tnode_->buf_);
     ObRowData new_row;
-    new_row.set(mtd->buf_, (int32_t)(data_size_ - sizeof(*mtd)));
+    // the row of the converted delta node differs in size from data_size_
+    new_row.set(mtd->buf_, (int32_t)mtd->buf_len_);
     redo_node.set(&key_,
                   old_row_,
                   new_row,
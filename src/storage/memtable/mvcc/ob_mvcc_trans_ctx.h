@@ -537,6 +537,7 @@ private:
   void inc_unsubmitted_cnt_();
   int dec_unsubmitted_cnt_();
   int wakeup_row_waiter_if_need_();
+  void wakeup_delta_writers_if_need_();
 private:
   ObIMvccCtx &ctx_;
   ObMemtableKey key_;
@@ -178,6 +178,8 @@ int ObQueryEngine::init()
 
 void ObQueryEngine::destroy()
 {
+  frozen_image_state_ = FROZEN_IMAGE_NONE;
+  frozen_image_.destroy();
   keybtree_.destroy(true /*is_batch_destroy*/);
   btree_allocator_.reset();
   keyhash_.destroy();
@@ -291,7 +293,7 @@ int ObQueryEngine::scan(const ObMemtableKey *start_key,
                         ObIQueryEngineIterator *&ret_iter)
 {
   int ret = OB_SUCCESS;
-  Iterator<BtreeIterator> *iter = nullptr;
+  Iterator<ScanHandle> *iter = nullptr;
 
   if (IS_NOT_INIT) {
     TRANS_LOG(WARN, "not init", "this", this);
@@ -303,9 +305,15 @@ int ObQueryEngine::scan(const ObMemtableKey *start_key,
     ObStoreRowkeyWrapper scan_start_key_wrapper(start_key->get_rowkey());
     ObStoreRowkeyWrapper scan_end_key_wrapper(end_key->get_rowkey());
     iter->reset();
-    if (OB_FAIL(keybtree_.set_key_range(iter->get_read_handle(),
-                                        scan_start_key_wrapper, start_exclude,
-                                        scan_end_key_wrapper, end_exclude))) {
+    if (has_frozen_image()) {
+      if (OB_FAIL(iter->get_read_handle().get_image_iter().set_key_range(frozen_image_,
+                                                                         scan_start_key_wrapper, start_exclude,
+                                                                         scan_end_key_wrapper, end_exclude))) {
+        TRANS_LOG(WARN, "set key range to frozen image fail", KR(ret));
+      }
+    } else if (OB_FAIL(keybtree_.set_key_range(iter->get_read_handle().get_btree_iter(),
+                                               scan_start_key_wrapper, start_exclude,
+                                               scan_end_key_wrapper, end_exclude))) {
       ret = OB_ERR_UNEXPECTED;
       TRANS_LOG(ERROR, "set key range to btree scan handle fail", KR(ret));
     }
@@ -329,10 +337,59 @@ int ObQueryEngine::scan(const ObMemtableKey *start_key,
 
 void ObQueryEngine::revert_iter(ObIQueryEngineIterator *iter)
 {
-  iter_alloc_.free((Iterator<BtreeIterator> *)iter);
+  iter_alloc_.free((Iterator<ScanHandle> *)iter);
   iter = NULL;
 }
 
+int ObQueryEngine::build_frozen_image()
+{
+  int ret = OB_SUCCESS;
+  Iterator<BtreeIterator> iter;
+  ObStoreRowkeyWrapper scan_start_key_wrapper(&ObStoreRowkey::MIN_STORE_ROWKEY);
+  ObStoreRowkeyWrapper scan_end_key_wrapper(&ObStoreRowkey::MAX_STORE_ROWKEY);
+  const int64_t key_count = keybtree_.size();
+  const int64_t start_ts = ObTimeUtility::current_time();
+  iter.reset();
+
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    TRANS_LOG(WARN, "not init", "this", this);
+  } else if (key_count <= 0) {
+    // no need to build
+  } else if (!ATOMIC_BCAS(&frozen_image_state_, FROZEN_IMAGE_NONE, FROZEN_IMAGE_BUILDING)) {
+    // the image is ready or being built by another thread
+  } else {
+    if (OB_FAIL(frozen_image_.init(key_count, MTL_ID()))) {
+      TRANS_LOG(WARN, "init frozen image fail", KR(ret), K(key_count));
+    } else if (OB_FAIL(keybtree_.set_key_range(iter.get_read_handle(),
+                                               scan_start_key_wrapper,
+                                               true, /*start_exclusive*/
+                                               scan_end_key_wrapper,
+                                               true  /*end_exclusive*/))) {
+      TRANS_LOG(ERROR, "set key range to btree scan handle fail", KR(ret));
+    } else {
+      // the empty rows are kept, as the btree scan does
+      while (OB_SUCC(ret) && OB_SUCC(iter.next_internal())) {
+        if (OB_FAIL(frozen_image_.push_back(iter.get_key()->get_rowkey(), iter.get_value()))) {
+          TRANS_LOG(WARN, "push back frozen image fail", KR(ret));
+        }
+      }
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+      }
+    }
+    if (OB_FAIL(ret)) {
+      // nobody reads the image before it is ready, the build can be retried
+      frozen_image_.destroy();
+      ATOMIC_STORE(&frozen_image_state_, FROZEN_IMAGE_NONE);
+    } else {
+      ATOMIC_STORE(&frozen_image_state_, FROZEN_IMAGE_READY);
+      TRANS_LOG(INFO, "build frozen image", K_(frozen_image), "cost_us", ObTimeUtility::current_time() - start_ts);
+    }
+  }
+  return ret;
+}
+
 int ObQueryEngine::sample_rows(Iterator<BtreeRawIterator> *iter,
                                const ObMemtableKey *start_key,
                                const int start_exclude,
@@ -485,7 +542,16 @@ int ObQueryEngine::split_range(const ObMemtableKey *start_key,
       need_retry = false;
       // Here we can not use ESTIMATE_CHILD_COUNT_THRESHOLD to init SEArray due to the stack size limit
       ObSEArray<ObStoreRowkeyWrapper, ESTIMATE_CHILD_COUNT_THRESHOLD / 2> key_array;
-      if (OB_FAIL(find_split_range_level_(start_key, end_key, range_count, top_level, btree_node_count)) &&
+      if (has_frozen_image()) {
+        // the frozen image splits the range into parts of the same key count
+        if (OB_FAIL(split_frozen_image_(start_key, end_key, range_count, key_array))) {
+          if (OB_ENTRY_NOT_EXIST != ret) {
+            TRANS_LOG(WARN, "split frozen image fail", K(ret), K(*start_key), K(*end_key), K(range_count));
+          }
+        } else if (OB_FAIL(convert_keys_to_store_ranges_(start_key, end_key, range_count, key_array, range_array))) {
+          TRANS_LOG(WARN, "convert keys to store ranges failed", KR(ret), K(range_count), K(key_array));
+        }
+      } else if (OB_FAIL(find_split_range_level_(start_key, end_key, range_count, top_level, btree_node_count)) &&
           OB_ENTRY_NOT_EXIST != ret) {
         TRANS_LOG(WARN, "estimate size fail", K(ret), K(*start_key), K(*end_key));
       } else if (OB_ENTRY_NOT_EXIST == ret) {
@@ -528,6 +594,34 @@ int ObQueryEngine::split_range(const ObMemtableKey *start_key,
   return ret;
 }
 
+int ObQueryEngine::split_frozen_image_(const ObMemtableKey *start_key,
+                                       const ObMemtableKey *end_key,
+                                       const int64_t range_count,
+                                       ObIArray<ObStoreRowkeyWrapper> &key_array)
+{
+  int ret = OB_SUCCESS;
+  int64_t start_pos = 0;
+  int64_t end_pos = 0;
+  if (OB_FAIL(frozen_image_.lower_bound(ObStoreRowkeyWrapper(start_key->get_rowkey()), false, start_pos))) {
+    TRANS_LOG(WARN, "search start key fail", K(ret), K(*start_key));
+  } else if (OB_FAIL(frozen_image_.lower_bound(ObStoreRowkeyWrapper(end_key->get_rowkey()), true, end_pos))) {
+    TRANS_LOG(WARN, "search end key fail", K(ret), K(*end_key));
+  } else if (end_pos - start_pos < range_count) {
+    ret = OB_ENTRY_NOT_EXIST;
+    TRANS_LOG(WARN, "range too small, not enough rows ro split", K(ret), K(start_pos), K(end_pos), K(range_count));
+  } else {
+    const int64_t key_count = end_pos - start_pos;
+    // the i-th range ends at the i-th key, and the last range ends at the end key
+    for (int64_t i = 1; OB_SUCC(ret) && i < range_count; i++) {
+      const int64_t pos = start_pos + key_count * i / range_count - 1;
+      if (OB_FAIL(key_array.push_back(ObStoreRowkeyWrapper(frozen_image_.get_key(pos))))) {
+        TRANS_LOG(WARN, "push back split key fail", K(ret), K(pos));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObQueryEngine::find_split_range_level_(const ObMemtableKey *start_key,
                                            const ObMemtableKey *end_key,
                                            const int64_t range_count,
@@ -17,6 +17,7 @@
 #include "lib/oblog/ob_log_module.h"
 #include "lib/objectpool/ob_concurrency_objpool.h"
 #include "storage/memtable/mvcc/ob_keybtree.h"
+#include "storage/memtable/mvcc/ob_frozen_image.h"
 #include "storage/memtable/ob_memtable_key.h"
 #include "storage/memtable/ob_mt_hash.h"
 
@@ -74,6 +75,34 @@ public:
   // hashtable for point select
   typedef ObMtHash KeyHash;
 
+  // ScanHandle scans the frozen image if the memtable has built it, otherwise
+  // scans the btree
+  class ScanHandle
+  {
+  public:
+    ScanHandle() {}
+    ~ScanHandle() {}
+    int get_next(ObStoreRowkeyWrapper &key, ObMvccRow *&value)
+    {
+      return image_iter_.is_inited() ? image_iter_.get_next(key, value) : btree_iter_.get_next(key, value);
+    }
+    bool is_reverse_scan() const
+    {
+      return image_iter_.is_inited() ? image_iter_.is_reverse_scan() : btree_iter_.is_reverse_scan();
+    }
+    void reset()
+    {
+      btree_iter_.reset();
+      image_iter_.reset();
+    }
+    BtreeIterator &get_btree_iter() { return btree_iter_; }
+    ObFrozenImageIterator &get_image_iter() { return image_iter_; }
+  private:
+    DISALLOW_COPY_AND_ASSIGN(ScanHandle);
+    BtreeIterator btree_iter_;
+    ObFrozenImageIterator image_iter_;
+  };
+
   // ObQueryEngine Iterator implements the iterator interface
   template <typename BtreeIterator>
   class Iterator : public ObIQueryEngineIterator
@@ -152,7 +181,9 @@ public:
     memstore_allocator_(memstore_allocator),
     btree_allocator_(memstore_allocator_),
     keybtree_(btree_allocator_),
-    keyhash_(memstore_allocator_) {}
+    keyhash_(memstore_allocator_),
+    frozen_image_(),
+    frozen_image_state_(FROZEN_IMAGE_NONE) {}
   ~ObQueryEngine() { destroy(); }
   int init();
   void destroy();
@@ -173,6 +204,12 @@ public:
   int scan(const ObMemtableKey *start_key, const bool start_exclude, const ObMemtableKey *end_key,
            const bool end_exclude, ObIQueryEngineIterator *&ret_iter);
   void revert_iter(ObIQueryEngineIterator *iter);
+  // build_frozen_image() builds the sorted image of all the keys for the
+  // frozen memtable, the later scans and range splits use the image instead of
+  // the btree once it is ready. No key may be inserted after the image is
+  // built. Only one thread builds the image, the others return directly
+  int build_frozen_image();
+  bool has_frozen_image() const { return FROZEN_IMAGE_READY == ATOMIC_LOAD(&frozen_image_state_); }
 
 
   // ===================== Ob Query Engine Estimation =====================
@@ -233,6 +270,10 @@ private:
                              int64_t &btree_node_count,
                              int64_t &total_rows);
 
+  int split_frozen_image_(const ObMemtableKey *start_key,
+                          const ObMemtableKey *end_key,
+                          const int64_t range_count,
+                          common::ObIArray<ObStoreRowkeyWrapper> &key_array);
   int convert_keys_to_store_ranges_(const ObMemtableKey *start_key,
                                     const ObMemtableKey *end_key,
                                     const int64_t range_count,
@@ -250,8 +291,17 @@ private:
   KeyBtree keybtree_;
   // The hashtable optimized for fast point select
   KeyHash keyhash_;
+  // The sorted image of the keys built after the memtable is frozen
+  enum FrozenImageState
+  {
+    FROZEN_IMAGE_NONE = 0,
+    FROZEN_IMAGE_BUILDING = 1,
+    FROZEN_IMAGE_READY = 2,
+  };
+  ObFrozenImage frozen_image_;
+  int64_t frozen_image_state_;
   // Iterator allocator for read and estimation
-  IteratorAlloc<BtreeIterator> iter_alloc_;
+  IteratorAlloc<ScanHandle> iter_alloc_;
   IteratorAlloc<BtreeRawIterator> raw_iter_alloc_;
 };
 
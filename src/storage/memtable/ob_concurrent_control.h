@@ -33,7 +33,9 @@ struct ObWriteFlag
   #define OBWF_BIT_CHECK_ROW_LOCKED 1
   #define OBWF_BIT_LOB_AUX          1
   #define OBWF_BIT_SKIP_FLUSH_REDO  1
-  #define OBWF_BIT_RESERVED         55
+  #define OBWF_BIT_DELTA_UPDATE     1
+  #define OBWF_BIT_DELTA_NON_NEG    1
+  #define OBWF_BIT_RESERVED         53
 
   static const uint64_t OBWF_MASK_TABLE_API = (0x1UL << OBWF_BIT_TABLE_API) - 1;
   static const uint64_t OBWF_MASK_TABLE_LOCK = (0x1UL << OBWF_BIT_TABLE_LOCK) - 1;
@@ -57,6 +59,8 @@ struct ObWriteFlag
       uint64_t is_check_row_locked_ : OBWF_BIT_CHECK_ROW_LOCKED; // 0: false(default), 1: true
       uint64_t is_lob_aux_          : OBWF_BIT_LOB_AUX;          // 0: false(default), 1: true
       uint64_t is_skip_flush_redo_  : OBWF_BIT_SKIP_FLUSH_REDO;  // 0: false(default), 1: true
+      uint64_t is_delta_update_     : OBWF_BIT_DELTA_UPDATE;     // 0: false(default), 1: true
+      uint64_t is_delta_non_neg_    : OBWF_BIT_DELTA_NON_NEG;    // 0: false(default), 1: true
       uint64_t reserved_            : OBWF_BIT_RESERVED;
     };
   };
@@ -82,6 +86,13 @@ struct ObWriteFlag
   inline bool is_skip_flush_redo() const { return is_skip_flush_redo_; }
   inline void set_skip_flush_redo() { is_skip_flush_redo_ = true; }
   inline void unset_skip_flush_redo() { is_skip_flush_redo_ = false; }
+  // the update only adds to integer counter columns, so it may be written as
+  // a commutative delta node(see ObMemtableRowDelta)
+  inline bool is_delta_update() const { return is_delta_update_; }
+  inline void set_delta_update() { is_delta_update_ = true; }
+  // the counter columns of the delta update must never become negative
+  inline bool is_delta_non_neg() const { return is_delta_non_neg_; }
+  inline void set_delta_non_neg() { is_delta_non_neg_ = true; }
 
   TO_STRING_KV("is_table_api", is_table_api_,
                "is_table_lock", is_table_lock_,
@@ -91,7 +102,9 @@ struct ObWriteFlag
                "is_write_only_index", is_write_only_index_,
                "is_check_row_locked", is_check_row_locked_,
                "is_lob_aux", is_lob_aux_,
-               "is_skip_flush_redo", is_skip_flush_redo_);
+               "is_skip_flush_redo", is_skip_flush_redo_,
+               "is_delta_update", is_delta_update_,
+               "is_delta_non_neg", is_delta_non_neg_);
 
   OB_UNIS_VERSION(1);
 };
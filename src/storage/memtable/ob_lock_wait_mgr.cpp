@@ -18,6 +18,7 @@
 #include "lib/rowid/ob_urowid.h"
 #include "lib/utility/ob_macro_utils.h"
 #include "observer/ob_server.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "share/deadlock/ob_deadlock_detector_mgr.h"
 #include "lib/function/ob_function.h"
 #include "lib/hash/ob_linear_hash_map.h"
@@ -94,11 +95,13 @@ bool is_rowkey_hash(const uint64_t hash)
 ObLockWaitMgr::ObLockWaitMgr()
     : is_inited_(false),
       hash_(hash_buf_, sizeof(hash_buf_)),
+      fifo_handoff_(false),
       deadlocked_sessions_lock_(common::ObLatchIds::DEADLOCK_DETECT_LOCK),
       deadlocked_sessions_index_(0),
       total_wait_node_(0)
 {
   memset(sequence_, 0, sizeof(sequence_));
+  memset(handoff_slots_, 0, sizeof(handoff_slots_));
 }
 
 ObLockWaitMgr::~ObLockWaitMgr() {}
@@ -207,6 +210,7 @@ void ObLockWaitMgr::run1()
       if (!ObDeadLockDetectorMgr::is_deadlock_enabled()) {
         row_holder_mapper_.clear();
       }
+      refresh_config_();
     }
     ob_usleep(10000);
   }
@@ -379,19 +383,138 @@ void ObLockWaitMgr::wakeup(uint64_t hash)
 {
   TRANS_LOG(DEBUG, "LockWaitMgr.wakeup.start", K(hash));
   Node *node = NULL;
+  if (is_fifo_handoff() && !LockHashHelper::is_table_lock_hash(hash)) {
+    handoff_(hash);
+  } else {
+    do {
+      node = fetch_waiter(hash);
+
+      if (NULL != node) {
+        EVENT_INC(MEMSTORE_WRITE_LOCK_WAKENUP_COUNT);
+        EVENT_ADD(MEMSTORE_WAIT_WRITE_LOCK_TIME, ObTimeUtility::current_time() - node->lock_ts_);
+        node->on_retry_lock(hash);
+        (void)repost(node);
+      }
+      // continue loop to wake up all requests waitting on the transaction.
+      // or continue loop to wake up all requests waitting on the tablelock.
+    } while (!LockHashHelper::is_rowkey_hash(hash) && node != NULL);
+  }
+  TRANS_LOG(DEBUG, "LockWaitMgr.wakeup.done", K(hash));
+}
+
+// Hand off the row to the oldest waiter of the row only. When the txn ends, the
+// oldest waiter of each row it blocks is woken up, and the other waiters are
+// moved to wait on their rows, so they are woken up one by one as the heads
+// finish rather than retrying and conflicting with each other.
+void ObLockWaitMgr::handoff_(uint64_t hash)
+{
+  int ret = OB_SUCCESS;
+  Node *node = NULL;
+  const bool is_row_hash = LockHashHelper::is_rowkey_hash(hash);
+  ObSEArray<uint64_t, 16> handoff_rows;
   do {
     node = fetch_waiter(hash);
+    if (NULL == node) {
+      if (is_row_hash) {
+        clear_handoff_(hash);
+      }
+    } else {
+      const uint64_t row_hash = is_row_hash ? hash : node->row_hash_;
+      if (!is_row_hash && 0 != row_hash && has_exist_in_array(handoff_rows, row_hash)) {
+        // queue behind the head waiter of the same row
+        node->change_hash(row_hash, get_seq(row_hash));
+        if (!wait(node)) {
+          (void)repost(node);
+        } else {
+          // remove the repeated calculations
+          node->try_lock_times_--;
+        }
+      } else {
+        EVENT_INC(MEMSTORE_WRITE_LOCK_WAKENUP_COUNT);
+        EVENT_ADD(MEMSTORE_WAIT_WRITE_LOCK_TIME, ObTimeUtility::current_time() - node->lock_ts_);
+        if (0 != row_hash) {
+          set_handoff_(row_hash, node->tx_id_);
+          if (!is_row_hash && OB_FAIL(handoff_rows.push_back(row_hash))) {
+            TRANS_LOG(WARN, "push back handoff row failed", K(ret), K(hash), K(row_hash));
+          }
+        }
+        // the head wakes up the next waiter of the row if it does not lock the row
+        node->on_retry_lock(0 != row_hash ? row_hash : hash);
+        (void)repost(node);
+      }
+    }
+  } while (!is_row_hash && NULL != node);
+}
 
-    if (NULL != node) {
-      EVENT_INC(MEMSTORE_WRITE_LOCK_WAKENUP_COUNT);
-      EVENT_ADD(MEMSTORE_WAIT_WRITE_LOCK_TIME, ObTimeUtility::current_time() - node->lock_ts_);
-      node->on_retry_lock(hash);
-      (void)repost(node);
+void ObLockWaitMgr::set_handoff_(const uint64_t hash, const int64_t tx_id)
+{
+  HandoffSlot &slot = handoff_slots_[(hash >> 1) % HANDOFF_SLOT_COUNT];
+  // the hash is reset first, so the reader never matches a half written slot
+  ATOMIC_STORE(&slot.hash_, 0);
+  ATOMIC_STORE(&slot.tx_id_, tx_id);
+  ATOMIC_STORE(&slot.expire_ts_, ObClockGenerator::getClock() + HANDOFF_EXPIRE_US);
+  ATOMIC_STORE(&slot.hash_, hash);
+}
+
+void ObLockWaitMgr::clear_handoff_(const uint64_t hash)
+{
+  HandoffSlot &slot = handoff_slots_[(hash >> 1) % HANDOFF_SLOT_COUNT];
+  if (ATOMIC_LOAD(&slot.hash_) == hash) {
+    (void)ATOMIC_BCAS(&slot.hash_, hash, 0);
+  }
+}
+
+bool ObLockWaitMgr::get_handoff_(const uint64_t hash, int64_t &tx_id, int64_t &expire_ts)
+{
+  bool bool_ret = false;
+  HandoffSlot &slot = handoff_slots_[(hash >> 1) % HANDOFF_SLOT_COUNT];
+  if (ATOMIC_LOAD(&slot.hash_) == hash) {
+    tx_id = ATOMIC_LOAD(&slot.tx_id_);
+    expire_ts = ATOMIC_LOAD(&slot.expire_ts_);
+    bool_ret = ATOMIC_LOAD(&slot.hash_) == hash && ObClockGenerator::getClock() < expire_ts;
+  }
+  return bool_ret;
+}
+
+bool ObLockWaitMgr::is_handed_off(const ObTabletID &tablet_id,
+                                  const Key &key,
+                                  const ObTransID &tx_id,
+                                  ObTransID &head_tx_id)
+{
+  bool bool_ret = false;
+  int64_t handoff_tx_id = 0;
+  int64_t expire_ts = 0;
+  if (is_fifo_handoff()
+      && get_handoff_(hash_rowkey(tablet_id, key), handoff_tx_id, expire_ts)
+      && handoff_tx_id != tx_id.get_id()) {
+    head_tx_id = ObTransID(handoff_tx_id);
+    bool_ret = true;
+  }
+  return bool_ret;
+}
+
+void ObLockWaitMgr::on_row_locked(const ObTabletID &tablet_id, const Key &key)
+{
+  uint64_t &hold_key = get_thread_hold_key();
+  if (is_fifo_handoff()
+      && 0 != hold_key
+      && NULL != get_thread_node()
+      && hash_rowkey(tablet_id, key) == hold_key) {
+    clear_handoff_(hold_key);
+    hold_key = 0;
+  }
+}
+
+void ObLockWaitMgr::refresh_config_()
+{
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  if (tenant_config.is_valid()) {
+    const bool fifo_handoff = tenant_config->_enable_lock_wait_fifo_handoff;
+    if (fifo_handoff != ATOMIC_LOAD(&fifo_handoff_)) {
+      ATOMIC_STORE(&fifo_handoff_, fifo_handoff);
+      TRANS_LOG(INFO, "LockWaitMgr.refresh_config", K(fifo_handoff));
     }
-    // continue loop to wake up all requests waitting on the transaction.
-    // or continue loop to wake up all requests waitting on the tablelock.
-  } while (!LockHashHelper::is_rowkey_hash(hash) && node != NULL);
-  TRANS_LOG(DEBUG, "LockWaitMgr.wakeup.done", K(hash));
+  }
 }
 
 ObLockWaitMgr::Node* ObLockWaitMgr::next(Node*& iter, Node* target)
@@ -604,10 +727,21 @@ int ObLockWaitMgr::post_lock(const int tmp_ret,
       int64_t row_lock_seq = get_seq(row_hash);
       int64_t tx_lock_seq = get_seq(tx_hash);
       bool locked = false, wait_on_row = true;
+      bool wait_handoff = false;
+      int64_t head_tx_id = 0;
+      int64_t handoff_expire_ts = 0;
       if (OB_FAIL(rechecker(locked, wait_on_row))) {
         TRANS_LOG(WARN, "recheck lock fail", K(key), K(holder_tx_id));
-      } else if (locked) {
-        uint64_t hash = wait_on_row ? row_hash : tx_hash;
+      } else if (!locked
+                 && is_fifo_handoff()
+                 && get_handoff_(row_hash, head_tx_id, handoff_expire_ts)
+                 && head_tx_id != tx_id.get_id()) {
+        // the row is free but handed off to the head waiter of another txn
+        wait_handoff = true;
+      }
+      if (OB_SUCC(ret) && (locked || wait_handoff)) {
+        const ObTransID wait_tx_id = wait_handoff ? ObTransID(head_tx_id) : holder_tx_id;
+        uint64_t hash = (wait_on_row || wait_handoff) ? row_hash : tx_hash;
         if (hold_key == hash) {
           hold_key = 0;
         }
@@ -618,13 +752,13 @@ int ObLockWaitMgr::post_lock(const int tmp_ret,
         uint32_t holder_session_id = sql::ObSQLSessionInfo::INVALID_SESSID;
         if (OB_ISNULL(tx_service = MTL(transaction::ObTransService *))) {
           ret = OB_ERR_UNEXPECTED;
-          TRANS_LOG(ERROR, "ObTransService is null", K(sess_id), K(tx_id), K(holder_tx_id), K(ls_id));
-        } else if (OB_FAIL(tx_service->get_trans_start_session_id(ls_id, holder_tx_id, holder_session_id))) {
-          TRANS_LOG(WARN, "get transaction start session_id failed", K(sess_id), K(tx_id), K(holder_tx_id), K(ls_id));
+          TRANS_LOG(ERROR, "ObTransService is null", K(sess_id), K(tx_id), K(wait_tx_id), K(ls_id));
+        } else if (OB_FAIL(tx_service->get_trans_start_session_id(ls_id, wait_tx_id, holder_session_id))) {
+          TRANS_LOG(WARN, "get transaction start session_id failed", K(sess_id), K(tx_id), K(wait_tx_id), K(ls_id));
         } else {
           node->set((void *)node,
                     hash,
-                    wait_on_row ? row_lock_seq : tx_lock_seq,
+                    hash == row_hash ? row_lock_seq : tx_lock_seq,
                     timeout,
                     tablet_id.id(),
                     last_compact_cnt,
@@ -633,8 +767,9 @@ int ObLockWaitMgr::post_lock(const int tmp_ret,
                     sess_id,
                     holder_session_id,
                     tx_id,
-                    holder_tx_id,
+                    wait_tx_id,
                     ls_id);
+          node->set_row_hash(row_hash);
           node->set_need_wait();
           advance_tlocal_request_lock_wait_stat(rpc::RequestLockWaitStat::RequestStat::CONFLICTED);
         }
@@ -190,6 +190,10 @@ public:
 public:
   enum { LOCK_BUCKET_COUNT = 16384};
   static const int64_t OB_SESSPAIR_COUNT = 16;
+  static const int64_t HANDOFF_SLOT_COUNT = 4096;
+  // the newcomers of other txns queue behind the head waiter which the row is
+  // handed off to, until the head retries or the handoff expires
+  static const int64_t HANDOFF_EXPIRE_US = 20 * 1000;
   typedef ObMemtableKey Key;
   typedef rpc::ObLockWaitNode Node;
   typedef FixedHash2<Node> Hash;
@@ -268,6 +272,19 @@ public:
   void wakeup(const transaction::ObTransID &tx_id);
   // wakeup the request waiting on the tablelock.
   void wakeup(const transaction::tablelock::ObLockID &lock_id);
+  // In the fifo handoff mode(_enable_lock_wait_fifo_handoff), the waiters of a
+  // row are woken up one by one in the order of arrival. The row is handed off
+  // to the woken head, and the requests of other txns which come later wait
+  // behind it instead of taking the row first
+  bool is_fifo_handoff() const { return ATOMIC_LOAD(&fifo_handoff_); }
+  // check whether the row is handed off to the head waiter of another txn
+  bool is_handed_off(const ObTabletID &tablet_id,
+                     const Key &key,
+                     const transaction::ObTransID &tx_id,
+                     transaction::ObTransID &head_tx_id);
+  // the request has locked the row, so the commit or abort of its txn rather
+  // than the end of the request wakes up the next waiter
+  void on_row_locked(const ObTabletID &tablet_id, const Key &key);
   // for deadlock
   DELEGATE_WITH_RET(row_holder_mapper_, set_hash_holder, void);
   DELEGATE_WITH_RET(row_holder_mapper_, get_hash_holder, int);
@@ -298,7 +315,18 @@ private:
   bool wait(Node* node);
   Node* get(uint64_t hash);
   void wakeup(uint64_t hash);
+  void handoff_(uint64_t hash);
+  void set_handoff_(const uint64_t hash, const int64_t tx_id);
+  void clear_handoff_(const uint64_t hash);
+  bool get_handoff_(const uint64_t hash, int64_t &tx_id, int64_t &expire_ts);
+  void refresh_config_();
 private:
+  struct HandoffSlot
+  {
+    uint64_t hash_;
+    int64_t tx_id_;
+    int64_t expire_ts_;
+  };
 
   static uint64_t& get_thread_hold_key()
   {
@@ -344,6 +372,8 @@ private:
   int64_t sequence_[LOCK_BUCKET_COUNT];
   char hash_buf_[sizeof(SpHashNode) * LOCK_BUCKET_COUNT];
   int64_t last_check_session_idle_ts_;
+  bool fifo_handoff_;
+  HandoffSlot handoff_slots_[HANDOFF_SLOT_COUNT];
 
 public:
   int fullfill_row_key(uint64_t hash, char *row_key, int64_t length);
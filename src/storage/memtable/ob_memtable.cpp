@@ -35,9 +35,11 @@
 #include "storage/memtable/ob_row_conflict_handler.h"
 #include "storage/memtable/ob_concurrent_control.h"
 #include "storage/memtable/ob_row_compactor.h"
+#include "storage/memtable/ob_memtable_delta.h"
 #include "storage/compaction/ob_tablet_merge_task.h"
 #include "storage/compaction/ob_schedule_dag_func.h"
 #include "storage/compaction/ob_compaction_diagnose.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "storage/access/ob_rows_info.h"
 #include "storage/access/ob_sstable_row_lock_checker.h"
 
@@ -1805,6 +1807,44 @@ int ObMemtable::row_compact(ObMvccRow *row,
   return ret;
 }
 
+int ObMemtable::convert_delta_node(ObIMvccCtx &ctx,
+                                   ObMvccRow *row,
+                                   ObMvccTransNode *&node,
+                                   ObRowData &old_row)
+{
+  int ret = OB_SUCCESS;
+  ObTxTableGuard tx_table_guard;
+  ObArenaAllocator row_alloc(ObModIds::OB_MEMTABLE_OBJECT);
+  ObRowData folded_old_row = old_row;
+  if (OB_ISNULL(row) || OB_ISNULL(node)) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", K(ret), KP(row), KP(node));
+  } else if (OB_FAIL(get_tx_table_guard(tx_table_guard))) {
+    TRANS_LOG(WARN, "get tx table guard failed", K(ret));
+  } else if (OB_FAIL(ObMemtableRowDelta::convert_delta_node(tx_table_guard,
+                                                            local_allocator_,
+                                                            row_alloc,
+                                                            *row,
+                                                            node,
+                                                            folded_old_row))) {
+    if (OB_TX_DELTA_FOLD_BLOCKED != ret) {
+      TRANS_LOG(WARN, "convert delta node fail", K(ret), K(*row), KPC(node));
+    }
+  } else if (folded_old_row.data_ != old_row.data_) {
+    // the old row of the callback is allocated from the memtable ctx
+    char *buf = NULL;
+    if (OB_ISNULL(buf = (char *)ctx.old_row_alloc(folded_old_row.size_))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      TRANS_LOG(WARN, "alloc old row failed", K(ret), K(folded_old_row));
+    } else {
+      MEMCPY(buf, folded_old_row.data_, folded_old_row.size_);
+      ctx.old_row_free((void *)(old_row.data_));
+      old_row.set(buf, folded_old_row.size_);
+    }
+  }
+  return ret;
+}
+
 int64_t ObMemtable::get_hash_item_count() const
 {
   return query_engine_.hash_size();
@@ -2135,6 +2175,7 @@ int ObMemtable::flush(share::ObLSID ls_id)
     param.merge_type_ = MINI_MERGE;
     param.merge_version_ = ObVersion::MIN_VERSION;
     fill_compaction_param_(cur_time, param);
+    try_schedule_frozen_image_(ls_id);
 
     if (OB_FAIL(compaction::ObScheduleDagFunc::schedule_tablet_merge_dag(param))) {
       if (OB_EAGAIN != ret && OB_SIZE_OVERFLOW != ret) {
@@ -2165,6 +2206,25 @@ int ObMemtable::flush(share::ObLSID ls_id)
   return ret;
 }
 
+void ObMemtable::try_schedule_frozen_image_(const share::ObLSID &ls_id)
+{
+  int tmp_ret = OB_SUCCESS;
+  bool enable_frozen_image = false;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  if (tenant_config.is_valid()) {
+    enable_frozen_image = tenant_config->_enable_memtable_frozen_image;
+  }
+  if (enable_frozen_image && !query_engine_.has_frozen_image()) {
+    // the image is built in background, the mini merge does not wait for it
+    compaction::ObMemtableFrozenImageParam param(ls_id, key_.tablet_id_);
+    if (OB_TMP_FAIL(compaction::ObScheduleDagFunc::schedule_memtable_frozen_image_dag(param))) {
+      if (OB_EAGAIN != tmp_ret && OB_SIZE_OVERFLOW != tmp_ret) {
+        TRANS_LOG_RET(WARN, tmp_ret, "failed to schedule frozen image dag", K(param));
+      }
+    }
+  }
+}
+
 void ObMemtable::fill_compaction_param_(
     const int64_t current_time,
     ObTabletMergeDagParam &param)
@@ -2198,6 +2258,19 @@ int ObMemtable::estimate_phy_size(const ObStoreRowkey* start_key, const ObStoreR
   return ret;
 }
 
+int ObMemtable::build_frozen_image()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_can_flush())) {
+    // new keys may be still inserted into the memtable
+    ret = OB_STATE_NOT_MATCH;
+    TRANS_LOG(WARN, "memtable is not ready for flush", K(ret), KPC(this));
+  } else if (OB_FAIL(query_engine_.build_frozen_image())) {
+    TRANS_LOG(WARN, "build frozen image failed", K(ret), KPC(this));
+  }
+  return ret;
+}
+
 int ObMemtable::get_split_ranges(const ObStoreRange &input_range,
                                  const int64_t part_cnt,
                                  ObIArray<ObStoreRange> &range_array)
@@ -2708,9 +2781,25 @@ int ObMemtable::set_(
   }
   if (OB_SUCC(ret)) {
     bool is_new_locked = false;
+    bool is_delta = false;
     row_writer.reset();
-    if (OB_FAIL(ret)) {
-      //do nothing
+    // the delta node skips the TSC check, which is only safe when each
+    // statement reads with its own snapshot
+    if (ctx.mvcc_acc_ctx_.write_flag_.is_delta_update()
+        && NULL != ctx.mvcc_acc_ctx_.tx_desc_
+        && ObTxIsolationLevel::RC == ctx.mvcc_acc_ctx_.tx_desc_->get_isolation_level()
+        && nullptr != old_row
+        && nullptr != update_idx
+        && nullptr == mvcc_row
+        && OB_FAIL(delta_set_(param, new_row, *old_row, *update_idx, old_row_data,
+                              mtk, context, row_writer, is_delta))) {
+      if (OB_TRY_LOCK_ROW_CONFLICT != ret &&
+          OB_ERR_CHECK_CONSTRAINT_VIOLATED != ret) {
+        TRANS_LOG(WARN, "delta set fail", K(mtk), K(ret));
+      }
+    } else if (is_delta) {
+      // the delta node is written
+    } else if (FALSE_IT(row_writer.reset())) {
     } else if (OB_FAIL(row_writer.write(param.get_schema_rowkey_count(), new_row, update_idx, buf, len))) {
       TRANS_LOG(WARN, "Failed to write new row", K(ret), K(new_row));
     } else if (OB_UNLIKELY(new_row.flag_.is_not_exist())) {
@@ -2765,7 +2854,8 @@ int ObMemtable::set_(
   if (OB_FAIL(ret) &&
       OB_TRY_LOCK_ROW_CONFLICT != ret &&
       OB_TRANSACTION_SET_VIOLATION != ret &&
-      OB_ERR_PRIMARY_KEY_DUPLICATE != ret) {
+      OB_ERR_PRIMARY_KEY_DUPLICATE != ret &&
+      OB_ERR_CHECK_CONSTRAINT_VIOLATED != ret) {
     TRANS_LOG(WARN, "set end, fail",
         "ret", ret,
         "tablet_id_", key_.tablet_id_,
@@ -2784,6 +2874,68 @@ int ObMemtable::set_(
   return ret;
 }
 
+// Write the update as the delta node if it only adds to the bigint columns,
+// is_delta is false if the update falls back to the normal write
+int ObMemtable::delta_set_(
+    const storage::ObTableIterParam &param,
+    const storage::ObStoreRow &new_row,
+    const storage::ObStoreRow &old_row,
+    const common::ObIArray<int64_t> &update_idx,
+    ObRowData &old_row_data,
+    const ObMemtableKey &mtk,
+    storage::ObTableAccessContext &context,
+    blocksstable::ObRowWriter &row_writer,
+    bool &is_delta)
+{
+  int ret = OB_SUCCESS;
+  char *buf = nullptr;
+  int64_t len = 0;
+  bool is_new_locked = false;
+  ObStoreRow delta_row;
+  ObSEArray<ObObj, OB_ROW_DEFAULT_COLUMNS_COUNT> delta_cells;
+  ObStoreCtx &ctx = *(context.store_ctx_);
+  is_delta = false;
+
+  if (OB_FAIL(ObMemtableRowDelta::build_delta_row(param.get_schema_rowkey_count(),
+                                                  old_row,
+                                                  new_row,
+                                                  update_idx,
+                                                  delta_cells,
+                                                  delta_row,
+                                                  is_delta))) {
+    TRANS_LOG(WARN, "build delta row failed", K(ret), K(new_row));
+  } else if (!is_delta) {
+  } else if (OB_FAIL(row_writer.write(param.get_schema_rowkey_count(), delta_row, &update_idx, buf, len))) {
+    TRANS_LOG(WARN, "Failed to write delta row", K(ret), K(delta_row));
+  } else {
+    ObMemtableData mtd(new_row.flag_.get_dml_flag(), len, buf);
+    ObTxNodeArg arg(
+        ctx.mvcc_acc_ctx_.tx_id_, /*trans id*/
+        &mtd,        /*memtable_data*/
+        &old_row_data,
+        init_timestamp_,  /*memstore_version*/
+        ctx.mvcc_acc_ctx_.tx_scn_,  /*seq_no*/
+        new_row.row_val_.count_ /*column_cnt*/);
+    arg.is_delta_ = true;
+    if (OB_FAIL(mvcc_write_(param,
+                            context,
+                            &mtk,
+                            arg,
+                            false /*check_exist*/,
+                            is_new_locked,
+                            nullptr /*mvcc_row*/))) {
+      if (OB_EAGAIN == ret) {
+        // the base value is not in the memtable or may overflow
+        is_delta = false;
+        ret = OB_SUCCESS;
+      }
+    } else {
+      TRANS_LOG(DEBUG, "delta set end, success", K(new_row), K(delta_row), K(mtd), K(arg));
+    }
+  }
+  return ret;
+}
+
 int ObMemtable::lock_(
     const storage::ObTableIterParam &param,
     storage::ObTableAccessContext &context,
@@ -2890,6 +3042,17 @@ int ObMemtable::mvcc_write_(
                                      value,
                                      is_new_add))) {
     TRANS_LOG(WARN, "create kv failed", K(ret), K(arg), K(*key));
+  } else if (arg.is_delta_ && !mem_ctx->try_set_delta_row(value)) {
+    // the txn writes the delta nodes on one row only, see ObMemtableCtx::try_set_delta_row
+    ret = OB_EAGAIN;
+  } else if (!arg.is_delta_
+             && is_handed_off_to_others_(ctx.mvcc_acc_ctx_, *key, value, res.lock_state_)) {
+    // the free row is handed off to the head waiter, queue behind it
+    ret = post_row_write_conflict_(ctx.mvcc_acc_ctx_,
+                                   *key,
+                                   res.lock_state_,
+                                   value->get_last_compact_cnt(),
+                                   value->get_total_trans_node_cnt());
   } else if (OB_FAIL(mvcc_engine_.mvcc_write(ctx,
                                              snapshot,
                                              *value,
@@ -2908,10 +3071,16 @@ int ObMemtable::mvcc_write_(
                             value->get_max_trans_id());
     } else if (OB_ERR_PRIMARY_KEY_DUPLICATE == ret) {
       mem_ctx->on_key_duplication_retry(*key);
+    } else if (OB_EAGAIN == ret || OB_ERR_CHECK_CONSTRAINT_VIOLATED == ret) {
+      // the delta write is rejected
     } else {
       TRANS_LOG(WARN, "mvcc write fail", K(ret));
     }
-  } else if (nullptr == mvcc_row && OB_FAIL(lock_row_on_frozen_stores_(param,
+  } else if (nullptr == mvcc_row
+             // the delta node lies above the base in this memtable, so the row
+             // has been checked on the frozen stores
+             && !arg.is_delta_
+             && OB_FAIL(lock_row_on_frozen_stores_(param,
                                                                        arg,
                                                                        key,
                                                                        check_exist,
@@ -2925,12 +3094,12 @@ int ObMemtable::mvcc_write_(
                                          context,
                                          res);
     if (res.has_insert()) {
-      (void)mvcc_engine_.mvcc_undo(value);
+      (void)mvcc_engine_.mvcc_undo(value, res.tx_node_);
       res.is_mvcc_undo_ = true;
     }
   } else if (OB_FAIL(mvcc_engine_.ensure_kv(&stored_key, value))) {
     if (res.has_insert()) {
-      (void)mvcc_engine_.mvcc_undo(value);
+      (void)mvcc_engine_.mvcc_undo(value, res.tx_node_);
       res.is_mvcc_undo_ = true;
     }
     TRANS_LOG(WARN, "prepare kv after lock fail", K(ret));
@@ -2944,7 +3113,7 @@ int ObMemtable::mvcc_write_(
                                                         arg.seq_no_,
                                                         arg.column_cnt_,
                                                         param.is_non_unique_local_index_))) {
-    (void)mvcc_engine_.mvcc_undo(value);
+    (void)mvcc_engine_.mvcc_undo(value, res.tx_node_);
     res.is_mvcc_undo_ = true;
     TRANS_LOG(WARN, "register row commit failed", K(ret));
   }
@@ -2964,6 +3133,12 @@ int ObMemtable::mvcc_write_(
 
   if (OB_FAIL(ret) || NULL == res.tx_node_ || !res.has_insert()) {
   } else {
+    if (!arg.is_delta_) {
+      ObLockWaitMgr *lock_wait_mgr = MTL(ObLockWaitMgr*);
+      if (OB_NOT_NULL(lock_wait_mgr)) {
+        lock_wait_mgr->on_row_locked(key_.get_tablet_id(), *key);
+      }
+    }
     const blocksstable::ObDmlFlag &dml_flag = res.tx_node_->get_dml_flag();
     mt_stat_.row_size_ += res.tx_node_->get_data_size();
     if (blocksstable::ObDmlFlag::DF_INSERT == dml_flag) {
@@ -3051,6 +3226,32 @@ int ObMemtable::post_row_write_conflict_(ObMvccAccessCtx &acc_ctx,
   return ret;
 }
 
+bool ObMemtable::is_handed_off_to_others_(ObMvccAccessCtx &acc_ctx,
+                                          const ObMemtableKey &row_key,
+                                          ObMvccRow *value,
+                                          ObStoreRowLockState &lock_state)
+{
+  bool bool_ret = false;
+  ObLockWaitMgr *lock_wait_mgr = MTL(ObLockWaitMgr*);
+  ObMvccTransNode *head = NULL;
+  ObTransID head_tx_id;
+  if (OB_ISNULL(lock_wait_mgr) || !lock_wait_mgr->is_fifo_handoff()) {
+    // the fifo handoff mode is off
+  } else if (NULL != (head = value->get_list_head())
+             && head->get_tx_id() == acc_ctx.get_tx_id()) {
+    // the row is locked by the txn itself
+  } else if (lock_wait_mgr->is_handed_off(key_.get_tablet_id(),
+                                          row_key,
+                                          acc_ctx.get_tx_id(),
+                                          head_tx_id)) {
+    lock_state.is_locked_ = true;
+    lock_state.lock_trans_id_ = head_tx_id;
+    lock_state.mvcc_row_ = value;
+    bool_ret = true;
+  }
+  return bool_ret;
+}
+
 int ObMemtable::get_tx_table_guard(ObTxTableGuard &tx_table_guard)
 {
   int ret = OB_SUCCESS;
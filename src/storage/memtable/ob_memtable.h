@@ -39,6 +39,10 @@ namespace compaction
 {
 class ObTabletMergeDagParam;
 }
+namespace blocksstable
+{
+class ObRowWriter;
+}
 namespace memtable
 {
 class ObMemtableMutatorIterator;
@@ -375,6 +379,10 @@ public:
   int row_compact(ObMvccRow *value,
                   const share::SCN snapshot_version,
                   const int64_t flag);
+  // fold the delta node into a normal node before its redo is filled, and
+  // rebuild the old row of the callback from the folded base. The row latch
+  // must be held
+  int convert_delta_node(ObIMvccCtx &ctx, ObMvccRow *value, ObMvccTransNode *&node, ObRowData &old_row);
   int64_t get_hash_item_count() const;
   int64_t get_hash_alloc_memory() const;
   int64_t get_btree_item_count() const;
@@ -394,6 +402,9 @@ public:
   void set_contain_hotspot_row() { return ATOMIC_STORE(&contain_hotspot_row_, true); }
   virtual int64_t get_upper_trans_version() const override;
   virtual int estimate_phy_size(const ObStoreRowkey* start_key, const ObStoreRowkey* end_key, int64_t& total_bytes, int64_t& total_rows) override;
+  // build the sorted image of the keys once the memtable is ready for flush,
+  // so that the mini merge and the scans do not iterate the btree
+  int build_frozen_image();
   virtual int get_split_ranges(const ObStoreRange &input_range,
                                const int64_t part_cnt,
                                ObIArray<ObStoreRange> &range_array) override;
@@ -421,6 +432,7 @@ public:
   void fill_compaction_param_(
     const int64_t current_time,
     compaction::ObTabletMergeDagParam &param);
+  void try_schedule_frozen_image_(const share::ObLSID &ls_id);
   int resolve_snapshot_version_();
   int resolve_max_end_scn_();
   // User should take response of the recommend scn. All version smaller than
@@ -554,6 +566,16 @@ private:
       const bool check_exist,
       storage::ObTableAccessContext &context,
       ObMvccRowAndWriteResult *mvcc_row = nullptr);
+  int delta_set_(
+      const storage::ObTableIterParam &param,
+      const storage::ObStoreRow &new_row,
+      const storage::ObStoreRow &old_row,
+      const common::ObIArray<int64_t> &update_idx,
+      ObRowData &old_row_data,
+      const ObMemtableKey &mtk,
+      storage::ObTableAccessContext &context,
+      blocksstable::ObRowWriter &row_writer,
+      bool &is_delta);
   int multi_set_(
       const storage::ObTableIterParam &param,
       const common::ObIArray<share::schema::ObColDesc> &columns,
@@ -574,6 +596,10 @@ private:
                                storage::ObStoreRowLockState &lock_state,
                                const int64_t last_compact_cnt,
                                const int64_t total_trans_node_count);
+  bool is_handed_off_to_others_(ObMvccAccessCtx &acc_ctx,
+                                const ObMemtableKey &row_key,
+                                ObMvccRow *value,
+                                storage::ObStoreRowLockState &lock_state);
   bool ready_for_flush_();
   int64_t try_split_range_for_sample_(const ObStoreRange &input_range,
                                       const int64_t range_count,
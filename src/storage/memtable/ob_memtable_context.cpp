@@ -63,6 +63,7 @@ ObMemtableCtx::ObMemtableCtx()
       is_read_only_(false),
       is_master_(true),
       has_row_updated_(false),
+      delta_row_(NULL),
       mem_ctx_obj_pool_(ctx_cb_allocator_),
       lock_mem_ctx_(*this),
       trans_mgr_(*this, ctx_cb_allocator_, mem_ctx_obj_pool_),
@@ -160,6 +161,7 @@ void ObMemtableCtx::reset()
     callback_alloc_count_ = 0;
     callback_mem_used_ = 0;
     has_row_updated_ = false;
+    delta_row_ = NULL;
     trans_mem_total_size_ = 0;
     lock_for_read_retry_count_ = 0;
     lock_for_read_elapse_ = 0;
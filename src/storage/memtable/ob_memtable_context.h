@@ -418,6 +418,12 @@ public:
   uint64_t get_tenant_id() const;
   inline bool has_row_updated() const { return has_row_updated_; }
   inline void set_row_updated() { has_row_updated_ = true; }
+  // The txn appends the delta nodes on one row only, so the folding of the
+  // delta nodes of two txns never waits for each other across rows
+  inline bool try_set_delta_row(ObMvccRow *row)
+  {
+    return ATOMIC_BCAS(&delta_row_, NULL, row) || ATOMIC_LOAD(&delta_row_) == row;
+  }
   int remove_callbacks_for_fast_commit(const ObCallbackScopeArray &callbacks);
   int remove_callbacks_for_fast_commit(const int16_t callback_list_idx, const share::SCN stop_scn);
   int remove_callback_for_uncommited_txn(const memtable::ObMemtableSet *memtable_set);
@@ -590,6 +596,8 @@ private:
   // Used to indicate whether mvcc row is updated or not.
   // When a statement is update or select for update, the value can be set ture;
   bool has_row_updated_;
+  // The row with the delta nodes of the txn
+  ObMvccRow *delta_row_;
   // For deaklock detection
   // The trans id of the holder of the conflict row lock
   // TODO(Handora), for non-local execution, if no-occupy-thread wait is implemented,
@@ -0,0 +1,556 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_memtable_delta.h"
+#include "storage/memtable/mvcc/ob_mvcc_row.h"
+#include "storage/memtable/mvcc/ob_row_data.h"
+#include "storage/memtable/ob_memtable_data.h"
+#include "storage/memtable/ob_nop_bitmap.h"
+#include "storage/access/ob_table_read_info.h"
+#include "storage/tx_table/ob_tx_table.h"
+#include "storage/blocksstable/ob_row_reader.h"
+#include "storage/blocksstable/ob_row_writer.h"
+#include "storage/ob_i_store.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace storage;
+using namespace blocksstable;
+using namespace transaction;
+namespace memtable
+{
+
+struct ObMemtableRowDelta::ObDeltaColumns
+{
+  ObDeltaColumns() : cnt_(0), rowkey_cnt_(0), column_cnt_(0) {}
+  int64_t cnt_;
+  int64_t rowkey_cnt_;
+  int64_t column_cnt_;
+  // column index and delta value of the delta node
+  int64_t idx_[MAX_DELTA_COLUMN_CNT];
+  int64_t delta_[MAX_DELTA_COLUMN_CNT];
+  // the latest value of the column on the row
+  int64_t base_[MAX_DELTA_COLUMN_CNT];
+  bool has_base_[MAX_DELTA_COLUMN_CNT];
+  bool is_null_[MAX_DELTA_COLUMN_CNT];
+  // whether the column has a value visible to the writer
+  bool has_visible_[MAX_DELTA_COLUMN_CNT];
+  // the sum of the increments and decrements of the pending delta nodes
+  int64_t pending_inc_[MAX_DELTA_COLUMN_CNT];
+  int64_t pending_dec_[MAX_DELTA_COLUMN_CNT];
+};
+
+int ObMemtableRowDelta::build_delta_row(const int64_t rowkey_cnt,
+                                        const ObStoreRow &old_row,
+                                        const ObStoreRow &new_row,
+                                        const ObIArray<int64_t> &update_idx,
+                                        ObIArray<ObObj> &delta_cells,
+                                        ObStoreRow &delta_row,
+                                        bool &is_delta)
+{
+  int ret = OB_SUCCESS;
+  const int64_t column_cnt = new_row.row_val_.count_;
+  int64_t delta_cnt = 0;
+  is_delta = old_row.row_val_.count_ == column_cnt && !new_row.flag_.is_delete();
+  delta_cells.reset();
+  for (int64_t i = 0; OB_SUCC(ret) && is_delta && i < column_cnt; ++i) {
+    if (OB_FAIL(delta_cells.push_back(new_row.row_val_.cells_[i]))) {
+      TRANS_LOG(WARN, "push back delta cell failed", K(ret), K(i));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && is_delta && i < update_idx.count(); ++i) {
+    const int64_t idx = update_idx.at(i);
+    int64_t delta = 0;
+    if (idx < rowkey_cnt) {
+      // the rowkey is always kept
+    } else if (idx >= column_cnt || ++delta_cnt > MAX_DELTA_COLUMN_CNT) {
+      is_delta = false;
+    } else {
+      const ObObj &old_cell = old_row.row_val_.cells_[idx];
+      const ObObj &new_cell = new_row.row_val_.cells_[idx];
+      if (ObIntType != old_cell.get_type() || ObIntType != new_cell.get_type()) {
+        is_delta = false;
+      } else if (__builtin_sub_overflow(new_cell.get_int(), old_cell.get_int(), &delta)) {
+        is_delta = false;
+      } else {
+        delta_cells.at(idx).set_int(delta);
+      }
+    }
+  }
+  if (OB_SUCC(ret) && is_delta) {
+    is_delta = delta_cnt > 0;
+    delta_row = new_row;
+    delta_row.row_val_.cells_ = &delta_cells.at(0);
+  }
+  return ret;
+}
+
+int ObMemtableRowDelta::read_delta_columns_(const ObMvccTransNode &node,
+                                            ObDeltaColumns &cols)
+{
+  int ret = OB_SUCCESS;
+  ObRowReader reader;
+  ObStorageDatum datum;
+  const ObRowHeader *row_header = nullptr;
+  const ObMemtableDataHeader *mtd = reinterpret_cast<const ObMemtableDataHeader *>(node.buf_);
+  if (OB_FAIL(reader.read_row_header(mtd->buf_, mtd->buf_len_, row_header))) {
+    TRANS_LOG(WARN, "read row header failed", K(ret), K(node));
+  } else {
+    cols.cnt_ = 0;
+    cols.rowkey_cnt_ = row_header->get_rowkey_count();
+    cols.column_cnt_ = row_header->get_column_count();
+  }
+  for (int64_t i = cols.rowkey_cnt_; OB_SUCC(ret) && i < cols.column_cnt_; ++i) {
+    if (OB_FAIL(reader.read_column(mtd->buf_, mtd->buf_len_, i, datum))) {
+      TRANS_LOG(WARN, "read delta column failed", K(ret), K(i), K(node));
+    } else if (datum.is_nop()) {
+    } else if (OB_UNLIKELY(datum.is_null() || cols.cnt_ >= MAX_DELTA_COLUMN_CNT)) {
+      ret = OB_ERR_UNEXPECTED;
+      TRANS_LOG(ERROR, "unexpected delta column", K(ret), K(i), K(datum), K(node));
+    } else {
+      const int64_t k = cols.cnt_++;
+      cols.idx_[k] = i;
+      cols.delta_[k] = datum.get_int();
+      cols.base_[k] = 0;
+      cols.has_base_[k] = false;
+      cols.is_null_[k] = false;
+      cols.has_visible_[k] = false;
+      cols.pending_inc_[k] = 0;
+      cols.pending_dec_[k] = 0;
+    }
+  }
+  return ret;
+}
+
+// Walk from start down to the base values of the delta columns. The delta nodes
+// on the way are accumulated into the pending sums for the write, while they
+// must be the delta nodes of other txns for the conversion.
+int ObMemtableRowDelta::read_base_columns_(ObTxTableGuard &tx_table_guard,
+                                           ObMvccRow &row,
+                                           ObMvccTransNode *start,
+                                           const ObTransID &tx_id,
+                                           const SCN snapshot_version,
+                                           const bool for_convert,
+                                           ObDeltaColumns &cols)
+{
+  int ret = OB_SUCCESS;
+  ObRowReader reader;
+  ObStorageDatum datum;
+  int64_t missing_cnt = cols.cnt_;
+  int64_t invisible_cnt = for_convert ? 0 : cols.cnt_;
+  bool stop = false;
+  ObMvccTransNode *iter = start;
+  while (OB_SUCC(ret) && NULL != iter && !stop && (missing_cnt > 0 || invisible_cnt > 0)) {
+    const ObMemtableDataHeader *mtd = reinterpret_cast<const ObMemtableDataHeader *>(iter->buf_);
+    if (iter->is_delayed_cleanout()
+        && !(iter->is_committed() || iter->is_aborted())
+        && OB_FAIL(tx_table_guard.cleanout_tx_node(iter->tx_id_, row, *iter, false /*need_row_latch*/))) {
+      TRANS_LOG(WARN, "cleanout tx state failed", K(ret), K(row), KPC(iter));
+    } else if (iter->is_aborted()) {
+      // skip the aborted node
+    } else if (NDT_DELTA == iter->type_) {
+      if (for_convert) {
+        if (iter->tx_id_ == tx_id) {
+          // the older delta node of the same txn must be folded first
+          ret = OB_TX_DELTA_FOLD_BLOCKED;
+        }
+      } else {
+        ObDeltaColumns pending;
+        if (OB_FAIL(read_delta_columns_(*iter, pending))) {
+          TRANS_LOG(WARN, "read pending delta failed", K(ret), KPC(iter));
+        }
+        for (int64_t i = 0; OB_SUCC(ret) && i < pending.cnt_; ++i) {
+          for (int64_t k = 0; OB_SUCC(ret) && k < cols.cnt_; ++k) {
+            if (pending.idx_[i] != cols.idx_[k]) {
+            } else if (pending.delta_[i] > 0
+                       ? __builtin_add_overflow(cols.pending_inc_[k], pending.delta_[i], &cols.pending_inc_[k])
+                       : __builtin_add_overflow(cols.pending_dec_[k], pending.delta_[i], &cols.pending_dec_[k])) {
+              ret = OB_EAGAIN;
+            }
+          }
+        }
+      }
+    } else if (!(iter->is_committed() || iter->is_elr()) && iter->tx_id_ != tx_id) {
+      // the base is locked by another txn, whose delta node is being folded
+      ret = for_convert ? OB_TX_DELTA_FOLD_BLOCKED : OB_EAGAIN;
+    } else if (ObDmlFlag::DF_LOCK == mtd->dml_flag_) {
+      // skip the lock node
+    } else if (ObDmlFlag::DF_DELETE == mtd->dml_flag_) {
+      stop = true;
+    } else {
+      const ObRowHeader *row_header = nullptr;
+      const bool is_visible = iter->tx_id_ == tx_id
+        || (iter->is_committed() && iter->trans_version_ <= snapshot_version);
+      if (OB_FAIL(reader.read_row_header(mtd->buf_, mtd->buf_len_, row_header))) {
+        TRANS_LOG(WARN, "read row header failed", K(ret), KPC(iter));
+      }
+      for (int64_t k = 0; OB_SUCC(ret) && k < cols.cnt_; ++k) {
+        if ((cols.has_base_[k] && (cols.has_visible_[k] || !is_visible))
+            || cols.idx_[k] >= row_header->get_column_count()) {
+        } else if (OB_FAIL(reader.read_column(mtd->buf_, mtd->buf_len_, cols.idx_[k], datum))) {
+          TRANS_LOG(WARN, "read base column failed", K(ret), K(k), KPC(iter));
+        } else if (datum.is_nop()) {
+        } else {
+          if (!cols.has_base_[k]) {
+            cols.has_base_[k] = true;
+            cols.is_null_[k] = datum.is_null();
+            cols.base_[k] = datum.is_null() ? 0 : datum.get_int();
+            missing_cnt--;
+          }
+          if (is_visible && !cols.has_visible_[k]) {
+            cols.has_visible_[k] = true;
+            invisible_cnt--;
+          }
+        }
+      }
+      if (ObDmlFlag::DF_INSERT == mtd->dml_flag_ || NDT_COMPACT == iter->type_) {
+        stop = true;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      iter = iter->prev_;
+    }
+  }
+  return ret;
+}
+
+int ObMemtableRowDelta::check_delta_write(ObTxTableGuard &tx_table_guard,
+                                          ObMvccRow &row,
+                                          const ObMvccTransNode &delta_node,
+                                          const ObTransID &tx_id,
+                                          const SCN snapshot_version,
+                                          const bool need_non_neg)
+{
+  int ret = OB_SUCCESS;
+  ObDeltaColumns cols;
+  if (OB_FAIL(read_delta_columns_(delta_node, cols))) {
+    TRANS_LOG(WARN, "read delta columns failed", K(ret), K(delta_node));
+  } else if (OB_FAIL(read_base_columns_(tx_table_guard,
+                                        row,
+                                        ATOMIC_LOAD(&row.list_head_),
+                                        tx_id,
+                                        snapshot_version,
+                                        false /*for_convert*/,
+                                        cols))) {
+    if (OB_EAGAIN != ret) {
+      TRANS_LOG(WARN, "read base columns failed", K(ret), K(delta_node), K(row));
+    }
+  }
+  for (int64_t k = 0; OB_SUCC(ret) && k < cols.cnt_; ++k) {
+    int64_t upper = 0;
+    int64_t lower = 0;
+    const int64_t delta = cols.delta_[k];
+    if (!cols.has_base_[k] || cols.is_null_[k] || !cols.has_visible_[k]) {
+      // the base value is not in the memtable
+      ret = OB_EAGAIN;
+    } else if (__builtin_add_overflow(cols.base_[k], cols.pending_inc_[k], &upper)
+               || __builtin_add_overflow(upper, MAX(delta, 0), &upper)
+               || __builtin_add_overflow(cols.base_[k], cols.pending_dec_[k], &lower)
+               || __builtin_add_overflow(lower, MIN(delta, 0), &lower)) {
+      // the value may overflow after all the pending delta nodes are folded
+      ret = OB_EAGAIN;
+    } else if (need_non_neg && delta < 0 && lower < 0) {
+      ret = OB_ERR_CHECK_CONSTRAINT_VIOLATED;
+      TRANS_LOG(WARN, "delta update may break the non-negative check", K(ret), K(k),
+                "column_idx", cols.idx_[k], "base", cols.base_[k],
+                "pending_dec", cols.pending_dec_[k], K(delta));
+    }
+  }
+  return ret;
+}
+
+int ObMemtableRowDelta::convert_delta_node(ObTxTableGuard &tx_table_guard,
+                                           ObIAllocator &node_alloc,
+                                           ObIAllocator &row_alloc,
+                                           ObMvccRow &row,
+                                           ObMvccTransNode *&node,
+                                           ObRowData &old_row)
+{
+  int ret = OB_SUCCESS;
+  ObDeltaColumns cols;
+  ObMvccTransNode *delta_node = node;
+  ObMvccTransNode *base = NULL;
+  ObMvccTransNode *iter = NULL;
+  const ObMemtableDataHeader *delta_mtd = NULL;
+  ObDatumRow new_row;
+
+  if (OB_ISNULL(delta_node) || OB_UNLIKELY(NDT_DELTA != delta_node->type_)) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid delta node", K(ret), KPC(delta_node));
+  } else {
+    delta_mtd = reinterpret_cast<const ObMemtableDataHeader *>(delta_node->buf_);
+    iter = delta_node->prev_;
+  }
+  // skip the delta nodes of other txns and the aborted nodes to the base
+  while (OB_SUCC(ret) && NULL != iter && NULL == base) {
+    if (iter->is_aborted()) {
+      iter = iter->prev_;
+    } else if (NDT_DELTA == iter->type_) {
+      if (iter->tx_id_ == delta_node->tx_id_) {
+        ret = OB_TX_DELTA_FOLD_BLOCKED;
+      } else {
+        iter = iter->prev_;
+      }
+    } else {
+      base = iter;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(base)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(ERROR, "base of the delta node not found", K(ret), KPC(delta_node), K(row));
+  } else if (OB_FAIL(read_delta_columns_(*delta_node, cols))) {
+    TRANS_LOG(WARN, "read delta columns failed", K(ret), KPC(delta_node));
+  } else if (OB_FAIL(read_base_columns_(tx_table_guard,
+                                        row,
+                                        base,
+                                        delta_node->tx_id_,
+                                        SCN::max_scn(),
+                                        true /*for_convert*/,
+                                        cols))) {
+    if (OB_TX_DELTA_FOLD_BLOCKED != ret) {
+      TRANS_LOG(WARN, "read base columns failed", K(ret), KPC(delta_node), K(row));
+    }
+  } else if (OB_FAIL(new_row.init(cols.column_cnt_))) {
+    TRANS_LOG(WARN, "init datum row failed", K(ret), K(cols.column_cnt_));
+  } else {
+    ObRowReader reader;
+    new_row.count_ = cols.column_cnt_;
+    new_row.row_flag_.set_flag(delta_mtd->dml_flag_);
+    for (int64_t i = 0; OB_SUCC(ret) && i < cols.column_cnt_; ++i) {
+      if (i >= cols.rowkey_cnt_) {
+        new_row.storage_datums_[i].set_nop();
+      } else if (OB_FAIL(reader.read_column(delta_mtd->buf_,
+                                            delta_mtd->buf_len_,
+                                            i,
+                                            new_row.storage_datums_[i]))) {
+        TRANS_LOG(WARN, "read rowkey column failed", K(ret), K(i), KPC(delta_node));
+      }
+    }
+    for (int64_t k = 0; OB_SUCC(ret) && k < cols.cnt_; ++k) {
+      int64_t value = 0;
+      ObStorageDatum &datum = new_row.storage_datums_[cols.idx_[k]];
+      if (OB_UNLIKELY(!cols.has_base_[k])) {
+        ret = OB_ERR_UNEXPECTED;
+        TRANS_LOG(ERROR, "base value of the delta column not found", K(ret), K(k), KPC(delta_node), K(row));
+      } else if (cols.is_null_[k]) {
+        datum.set_null();
+      } else if (__builtin_add_overflow(cols.base_[k], cols.delta_[k], &value)) {
+        ret = OB_ERR_UNEXPECTED;
+        TRANS_LOG(ERROR, "delta column overflow", K(ret), K(k), "base", cols.base_[k],
+                  "delta", cols.delta_[k], KPC(delta_node));
+      } else {
+        datum.reuse();
+        datum.set_int(value);
+      }
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    SMART_VAR(ObRowWriter, row_writer) {
+      char *buf = nullptr;
+      int64_t len = 0;
+      ObMvccTransNode *new_node = NULL;
+      if (OB_FAIL(row_writer.write(cols.rowkey_cnt_, new_row, buf, len))) {
+        TRANS_LOG(WARN, "write converted row failed", K(ret), K(new_row));
+      } else {
+        ObMemtableData mtd(delta_mtd->dml_flag_, len, buf);
+        const int64_t node_size = (int64_t)sizeof(ObMvccTransNode) + mtd.dup_size();
+        if (OB_ISNULL(new_node = (ObMvccTransNode *)node_alloc.alloc(node_size))) {
+          ret = OB_ALLOCATE_MEMORY_FAILED;
+          TRANS_LOG(WARN, "alloc trans node failed", K(ret), K(node_size));
+        } else if (FALSE_IT(new (new_node) ObMvccTransNode())) {
+        } else if (OB_FAIL(ObMemtableDataHeader::build(reinterpret_cast<ObMemtableDataHeader *>(new_node->buf_), &mtd))) {
+          TRANS_LOG(WARN, "dup data to trans node failed", K(ret));
+        } else {
+          new_node->tx_id_ = delta_node->tx_id_;
+          new_node->seq_no_ = delta_node->seq_no_;
+          new_node->trans_version_ = delta_node->trans_version_;
+          new_node->scn_ = delta_node->scn_;
+          new_node->version_ = delta_node->version_;
+          new_node->modify_count_ = base->modify_count_ + 1;
+          new_node->type_ = NDT_NORMAL;
+
+          // Link the new node right above the base, so the delta nodes of other
+          // txns are still above it. The readers do not hold the row latch and
+          // may meet both the delta node and the new node, see
+          // ObReadRow::iterate_row_value_
+          ATOMIC_STORE(&(new_node->prev_), base);
+          ATOMIC_STORE(&(new_node->next_), base->next_);
+          ATOMIC_STORE(&(base->next_->prev_), new_node);
+          ATOMIC_STORE(&(base->next_), new_node);
+          row.total_trans_node_cnt_++;
+          if (OB_FAIL(row.unlink_trans_node(*delta_node))) {
+            TRANS_LOG(ERROR, "unlink delta node failed", K(ret), KPC(delta_node), K(row));
+          } else {
+            node = new_node;
+          }
+        }
+      }
+    }
+  }
+
+  // the old row is read by the writer before the delta nodes of other txns
+  // are folded, so it is rebuilt with the base values the delta is folded into
+  if (OB_SUCC(ret) && NULL != old_row.data_ && old_row.size_ > 0
+      && OB_FAIL(fold_old_row_(cols, row_alloc, old_row))) {
+    TRANS_LOG(WARN, "fold old row failed", K(ret), KPC(node));
+  }
+  return ret;
+}
+
+int ObMemtableRowDelta::fold_old_row_(const ObDeltaColumns &cols,
+                                      ObIAllocator &row_alloc,
+                                      ObRowData &old_row)
+{
+  int ret = OB_SUCCESS;
+  ObRowReader reader;
+  ObDatumRow datum_row;
+  const ObRowHeader *row_header = nullptr;
+  if (OB_FAIL(reader.read_row_header(old_row.data_, old_row.size_, row_header))) {
+    TRANS_LOG(WARN, "read old row header failed", K(ret), K(old_row));
+  } else if (OB_FAIL(datum_row.init(row_header->get_column_count()))) {
+    TRANS_LOG(WARN, "init datum row failed", K(ret), K(row_header->get_column_count()));
+  } else {
+    datum_row.count_ = row_header->get_column_count();
+    datum_row.row_flag_ = row_header->get_row_flag();
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < datum_row.count_; ++i) {
+    if (OB_FAIL(reader.read_column(old_row.data_, old_row.size_, i, datum_row.storage_datums_[i]))) {
+      TRANS_LOG(WARN, "read old row column failed", K(ret), K(i), K(old_row));
+    }
+  }
+  for (int64_t k = 0; OB_SUCC(ret) && k < cols.cnt_; ++k) {
+    if (cols.idx_[k] < datum_row.count_) {
+      ObStorageDatum &datum = datum_row.storage_datums_[cols.idx_[k]];
+      datum.reuse();
+      if (cols.is_null_[k]) {
+        datum.set_null();
+      } else {
+        datum.set_int(cols.base_[k]);
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    SMART_VAR(ObRowWriter, row_writer) {
+      char *buf = nullptr;
+      char *new_buf = nullptr;
+      int64_t len = 0;
+      if (OB_FAIL(row_writer.write(row_header->get_rowkey_count(), datum_row, buf, len))) {
+        TRANS_LOG(WARN, "write folded old row failed", K(ret), K(datum_row));
+      } else if (OB_ISNULL(new_buf = (char *)row_alloc.alloc(len))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        TRANS_LOG(WARN, "alloc old row failed", K(ret), K(len));
+      } else {
+        MEMCPY(new_buf, buf, len);
+        old_row.set(new_buf, (int32_t)len);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObMemtableRowDelta::get_blocked_delta_txs(const ObMvccTransNode &decided_node,
+                                              ObIArray<ObTransID> &tx_ids)
+{
+  int ret = OB_SUCCESS;
+  tx_ids.reset();
+  for (ObMvccTransNode *iter = decided_node.next_;
+       OB_SUCC(ret) && NULL != iter && tx_ids.count() < MAX_WAKEUP_TX_CNT;
+       iter = iter->next_) {
+    if (NDT_DELTA != iter->type_
+        || iter->is_aborted()
+        || iter->tx_id_ == decided_node.tx_id_
+        || has_exist_in_array(tx_ids, iter->tx_id_)) {
+      // skip
+    } else if (OB_FAIL(tx_ids.push_back(iter->tx_id_))) {
+      TRANS_LOG(WARN, "push back tx id failed", K(ret), KPC(iter));
+    }
+  }
+  return ret;
+}
+
+int ObMemtableRowDelta::read_delta_node(const ObITableReadInfo &read_info,
+                                        const ObMvccTransNode &node,
+                                        ObNopBitMap &bitmap,
+                                        ObIAllocator &allocator,
+                                        int64_t *&deltas)
+{
+  int ret = OB_SUCCESS;
+  ObRowReader reader;
+  ObStorageDatum datum;
+  const ObRowHeader *row_header = nullptr;
+  const ObMemtableDataHeader *mtd = reinterpret_cast<const ObMemtableDataHeader *>(node.buf_);
+  const ObColumnIndexArray &cols_index = read_info.get_memtable_columns_index();
+  const int64_t request_cnt = read_info.get_request_count();
+  if (OB_FAIL(reader.read_row_header(mtd->buf_, mtd->buf_len_, row_header))) {
+    TRANS_LOG(WARN, "read row header failed", K(ret), K(node));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < request_cnt; ++i) {
+    const int64_t store_idx = cols_index.at(i);
+    if (!bitmap.test(i)
+        || store_idx < row_header->get_rowkey_count()
+        || store_idx >= row_header->get_column_count()) {
+      // the column is read from the newer node or not a delta column
+    } else if (OB_FAIL(reader.read_column(mtd->buf_, mtd->buf_len_, store_idx, datum))) {
+      TRANS_LOG(WARN, "read delta column failed", K(ret), K(i), K(node));
+    } else if (datum.is_nop()) {
+    } else {
+      if (NULL == deltas) {
+        if (OB_ISNULL(deltas = static_cast<int64_t *>(allocator.alloc(sizeof(int64_t) * request_cnt)))) {
+          ret = OB_ALLOCATE_MEMORY_FAILED;
+          TRANS_LOG(WARN, "alloc deltas failed", K(ret), K(request_cnt));
+        } else {
+          MEMSET(deltas, 0, sizeof(int64_t) * request_cnt);
+        }
+      }
+      if (OB_SUCC(ret) && __builtin_add_overflow(deltas[i], datum.get_int(), &deltas[i])) {
+        ret = OB_DATA_OUT_OF_RANGE;
+        TRANS_LOG(WARN, "delta column overflow", K(ret), K(i), K(node));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObMemtableRowDelta::apply_deltas(const ObITableReadInfo &read_info,
+                                     const int64_t *deltas,
+                                     ObNopBitMap &bitmap,
+                                     ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && NULL != deltas && i < read_info.get_request_count(); ++i) {
+    ObStorageDatum &datum = row.storage_datums_[i];
+    int64_t value = 0;
+    if (0 == deltas[i]) {
+    } else if (OB_UNLIKELY(bitmap.test(i))) {
+      // the delta node is always written above its base in the memtable
+      ret = OB_ERR_UNEXPECTED;
+      TRANS_LOG(ERROR, "base of the delta column not found", K(ret), K(i), K(row));
+    } else if (datum.is_null()) {
+      // NULL plus the delta is still NULL
+    } else if (__builtin_add_overflow(datum.get_int(), deltas[i], &value)) {
+      ret = OB_DATA_OUT_OF_RANGE;
+      TRANS_LOG(WARN, "delta column overflow", K(ret), K(i), K(datum), "delta", deltas[i]);
+    } else {
+      datum.reuse();
+      datum.set_int(value);
+    }
+  }
+  return ret;
+}
+
+} // namespace memtable
+} // namespace oceanbase
@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_MEMTABLE_OB_MEMTABLE_DELTA_
+#define OCEANBASE_MEMTABLE_OB_MEMTABLE_DELTA_
+
+#include "share/ob_define.h"
+#include "share/scn.h"
+#include "lib/container/ob_iarray.h"
+#include "common/object/ob_object.h"
+
+namespace oceanbase
+{
+namespace common
+{
+class ObIAllocator;
+}
+namespace blocksstable
+{
+struct ObDatumRow;
+}
+namespace storage
+{
+class ObTxTableGuard;
+class ObITableReadInfo;
+struct ObStoreRow;
+}
+namespace transaction
+{
+class ObTransID;
+}
+
+namespace memtable
+{
+
+struct ObMvccRow;
+struct ObMvccTransNode;
+struct ObRowData;
+class ObNopBitMap;
+
+// Commutative delta update of the counter columns on the hot row.
+//
+// The update like `c = c + k` on bigint columns may be written as a delta
+// node(NDT_DELTA) which only records k instead of the new value of c. The delta
+// nodes of different txns commute, so the delta writer neither waits for nor
+// locks out the other delta writers, it only appends its node on the top of the
+// row. The delta nodes always lie above the base node(the latest node holding
+// the value of the counter columns), and the normal writer will wait for the
+// undecided delta nodes of other txns as usual.
+//
+// The delta node is private to the leader. It is folded into a normal node with
+// the new value of the counter columns when its redo is filled, so the redo
+// log, the follower, the row compaction and the mini merge only meet normal
+// nodes. Before that, the reader of the writer txn folds its visible delta
+// nodes into the base value.
+class ObMemtableRowDelta
+{
+public:
+  static const int64_t MAX_DELTA_COLUMN_CNT = 16;
+  static const int64_t MAX_WAKEUP_TX_CNT = 16;
+public:
+  // build_delta_row turns the new row of the update into the delta row, which
+  // keeps the rowkey and new - old of the updated columns. is_delta is false
+  // if any updated column is not a non-null bigint or the delta overflows
+  static int build_delta_row(const int64_t rowkey_cnt,
+                             const storage::ObStoreRow &old_row,
+                             const storage::ObStoreRow &new_row,
+                             const common::ObIArray<int64_t> &update_idx,
+                             common::ObIArray<common::ObObj> &delta_cells,
+                             storage::ObStoreRow &delta_row,
+                             bool &is_delta);
+  // check_delta_write checks whether the delta node can be appended on the row
+  // under the row latch. Every delta column needs a non-null base value in the
+  // memtable which is visible to the writer, otherwise OB_EAGAIN is returned
+  // and the writer falls back to the normal update. If need_non_neg is true,
+  // the base value with all the pending decrements must not be negative,
+  // otherwise OB_ERR_CHECK_CONSTRAINT_VIOLATED is returned
+  static int check_delta_write(storage::ObTxTableGuard &tx_table_guard,
+                               ObMvccRow &row,
+                               const ObMvccTransNode &delta_node,
+                               const transaction::ObTransID &tx_id,
+                               const share::SCN snapshot_version,
+                               const bool need_non_neg);
+  // convert_delta_node folds the delta node into a normal node, which is linked
+  // right above the base node and takes the place of the delta node. The old
+  // row(if any) is rebuilt with the folded base values into row_alloc. It
+  // returns OB_TX_DELTA_FOLD_BLOCKED if the base node is undecided and written
+  // by another txn or an older delta node of the same txn has not been folded,
+  // and the redo submitter will retry later. The row latch must be held
+  static int convert_delta_node(storage::ObTxTableGuard &tx_table_guard,
+                                common::ObIAllocator &node_alloc,
+                                common::ObIAllocator &row_alloc,
+                                ObMvccRow &row,
+                                ObMvccTransNode *&node,
+                                ObRowData &old_row);
+  // get_blocked_delta_txs collects the other txns whose delta nodes lie above
+  // the decided node and may be blocked on folding, so they are woken up to
+  // resubmit their redo instead of waiting for the next submit. Only the nearest
+  // MAX_WAKEUP_TX_CNT txns are collected, the farther ones are woken when the
+  // nodes folded below them are decided. The row latch must be held
+  static int get_blocked_delta_txs(const ObMvccTransNode &decided_node,
+                                   common::ObIArray<transaction::ObTransID> &tx_ids);
+  // read_delta_node accumulates the visible delta node into deltas(indexed by
+  // the output column) for the columns which is not read yet
+  static int read_delta_node(const storage::ObITableReadInfo &read_info,
+                             const ObMvccTransNode &node,
+                             ObNopBitMap &bitmap,
+                             common::ObIAllocator &allocator,
+                             int64_t *&deltas);
+  // apply_deltas adds the accumulated deltas to the base value of the row
+  static int apply_deltas(const storage::ObITableReadInfo &read_info,
+                          const int64_t *deltas,
+                          ObNopBitMap &bitmap,
+                          blocksstable::ObDatumRow &row);
+private:
+  struct ObDeltaColumns;
+  static int read_delta_columns_(const ObMvccTransNode &node,
+                                 ObDeltaColumns &cols);
+  static int read_base_columns_(storage::ObTxTableGuard &tx_table_guard,
+                                ObMvccRow &row,
+                                ObMvccTransNode *start,
+                                const transaction::ObTransID &tx_id,
+                                const share::SCN snapshot_version,
+                                const bool for_convert,
+                                ObDeltaColumns &cols);
+  static int fold_old_row_(const ObDeltaColumns &cols,
+                           common::ObIAllocator &row_alloc,
+                           ObRowData &old_row);
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObMemtableRowDelta);
+};
+
+} // namespace memtable
+} // namespace oceanbase
+
+#endif // OCEANBASE_MEMTABLE_OB_MEMTABLE_DELTA_
@@ -22,6 +22,7 @@
 #include "storage/memtable/mvcc/ob_mvcc_engine.h"
 #include "storage/memtable/mvcc/ob_mvcc_row.h"
 #include "storage/memtable/ob_row_conflict_handler.h"
+#include "storage/memtable/ob_memtable_delta.h"
 #include "storage/tx/ob_trans_define.h"
 #include "ob_memtable_context.h"
 #include "ob_memtable.h"
@@ -1407,6 +1408,9 @@ OB_INLINE int ObReadRow::iterate_row_value_(
   const ObMemtableDataHeader *mtd = NULL;
   bool read_finished = false;
   ObRowReader reader;
+  // the sums of the visible delta nodes of the reader txn, see ObMemtableRowDelta
+  int64_t *deltas = NULL;
+  ObTxSEQ min_delta_seq_no;
   row_scn = 0;
   row.row_flag_.set_flag(ObDmlFlag::DF_NOT_EXIST);
   row.snapshot_version_ = 0;
@@ -1417,6 +1421,11 @@ OB_INLINE int ObReadRow::iterate_row_value_(
     } else if (OB_ISNULL(mtd = reinterpret_cast<const ObMemtableDataHeader *>(reinterpret_cast<const ObMvccTransNode *>(tnode)->buf_))) {
       ret = OB_ERR_UNEXPECTED;
       TRANS_LOG(WARN, "transa node value is null", K(ret), KP(tnode), KP(mtd));
+    } else if (min_delta_seq_no.is_valid()
+               && NDT_DELTA != reinterpret_cast<const ObMvccTransNode *>(tnode)->type_
+               && reinterpret_cast<const ObMvccTransNode *>(tnode)->get_tx_id() == value_iter.get_reader_tx_id()
+               && reinterpret_cast<const ObMvccTransNode *>(tnode)->get_seq_no() >= min_delta_seq_no) {
+      // the delta node read before has been folded into this node concurrently
     } else {
       const bool is_committed = reinterpret_cast<const ObMvccTransNode *>(tnode)->is_committed();
       const int64_t trans_version = is_committed ? reinterpret_cast<const ObMvccTransNode *>(tnode)->trans_version_.get_val_for_tx() : INT64_MAX;
@@ -1433,8 +1442,17 @@ OB_INLINE int ObReadRow::iterate_row_value_(
       }
       TRANS_LOG(DEBUG, "row snapshot version", K(row.snapshot_version_));
 
-      if (OB_FAIL(reader.read_memtable_row(mtd->buf_, mtd->buf_len_, read_info, row, bitmap, read_finished))) {
+      if (NDT_DELTA == reinterpret_cast<const ObMvccTransNode *>(tnode)->type_) {
+        const ObMvccTransNode *delta_node = reinterpret_cast<const ObMvccTransNode *>(tnode);
+        if (OB_FAIL(ObMemtableRowDelta::read_delta_node(read_info, *delta_node, bitmap, allocator, deltas))) {
+          TRANS_LOG(WARN, "Failed to read delta node", K(ret), KPC(delta_node));
+        } else if (!min_delta_seq_no.is_valid() || delta_node->get_seq_no() < min_delta_seq_no) {
+          min_delta_seq_no = delta_node->get_seq_no();
+        }
+      } else if (OB_FAIL(reader.read_memtable_row(mtd->buf_, mtd->buf_len_, read_info, row, bitmap, read_finished))) {
         TRANS_LOG(WARN, "Failed to read memtable row", K(ret));
+      }
+      if (OB_FAIL(ret)) {
       } else if (0 == row_scn) {
         const ObMvccTransNode *tx_node = reinterpret_cast<const ObMvccTransNode *>(tnode);
         const ObTransID snapshot_tx_id = value_iter.get_snapshot_tx_id();
@@ -1457,6 +1475,10 @@ OB_INLINE int ObReadRow::iterate_row_value_(
   } // while
 
   ret = (OB_ITER_END == ret) ? OB_SUCCESS : ret;
+  if (OB_SUCC(ret) && NULL != deltas
+      && OB_FAIL(ObMemtableRowDelta::apply_deltas(read_info, deltas, bitmap, row))) {
+    TRANS_LOG(WARN, "Failed to apply deltas", K(ret), K(row));
+  }
   return ret;
 }
 
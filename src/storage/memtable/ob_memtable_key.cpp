@@ -14,6 +14,7 @@
 #include "lib/ob_errno.h"
 #include "rowkey/ob_rowkey.h"
 #include "share/rc/ob_tenant_base.h"
+#include "share/ob_order_perserving_encoder.h"
 #include "storage/ob_i_store.h"
 
 namespace oceanbase
@@ -116,5 +117,60 @@ ObMemtableKeyGenerator::~ObMemtableKeyGenerator()
   reset();
 }
 
+bool ObStoreRowkeyWrapper::can_encode_fingerprint(const common::ObObj &obj)
+{
+  // float and double are not included because -0.0 equals to 0.0 but encodes differently
+  const ObObjTypeClass tc = obj.get_type_class();
+  return (ObIntTC == tc || ObUIntTC == tc || ObDateTimeTC == tc || ObDateTC == tc
+          || ObTimeTC == tc || ObYearTC == tc || ObStringTC == tc)
+      && share::ObOrderPerservingEncoder::can_encode_sortkey(obj.get_type(), obj.get_collation_type());
+}
+
+uint64_t ObStoreRowkeyWrapper::get_fingerprint() const
+{
+  uint64_t fingerprint = 0;
+  if (OB_NOT_NULL(rowkey_) && OB_NOT_NULL(rowkey_->get_obj_ptr())) {
+    const ObObj *objs = rowkey_->get_obj_ptr();
+    const int64_t obj_cnt = rowkey_->get_obj_cnt();
+    unsigned char buf[FINGERPRINT_BUF_SIZE];
+    const int64_t fingerprint_len = sizeof(fingerprint);
+    int64_t len = 0;
+    unsigned char pad = 0x00;
+    bool can_encode = true;
+    for (int64_t i = 0; can_encode && i < obj_cnt && len < fingerprint_len; ++i) {
+      ObObj obj = objs[i];
+      if (obj.is_min_value()) {
+        break;
+      } else if (obj.is_max_value()) {
+        // max value is greater than any key with the same prefix
+        pad = 0xFF;
+        break;
+      } else if (obj.is_null()) {
+        // null is the smallest in mysql mode but the largest in oracle mode,
+        // stop here and only keep the fingerprint of the encoded prefix
+        can_encode = false;
+      } else if (!can_encode_fingerprint(obj)) {
+        can_encode = false;
+      } else if (obj.is_string_type()
+                 && len + 1 + 7 * obj.get_string_len() + 20 > FINGERPRINT_BUF_SIZE) {
+        // too long to encode, see ObOrderPerservingEncoder::encode_from_string_varlen
+        can_encode = false;
+      } else {
+        buf[len++] = FINGERPRINT_VALUE_FLAG;
+        if (OB_SUCCESS != share::ObOrderPerservingEncoder::make_order_perserving_encode_from_object(
+            obj, buf + len, FINGERPRINT_BUF_SIZE, len)) {
+          can_encode = false;
+        }
+      }
+    }
+    if (can_encode || len >= fingerprint_len) {
+      for (int64_t i = 0; i < fingerprint_len; ++i) {
+        fingerprint = (fingerprint << 8) | (i < len ? buf[i] : pad);
+      }
+    }
+  }
+  return fingerprint;
+}
+
 }
 }
\ No newline at end of file
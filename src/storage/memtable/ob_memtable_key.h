@@ -288,6 +288,13 @@ private:
 
 class ObStoreRowkeyWrapper
 {
+public:
+  // The fingerprint is the first 8 bytes of the order perserving encoding of
+  // the rowkey, 0 means no fingerprint. If both keys have fingerprints and they
+  // are different, they decide the order of the keys. The encoding stops at the
+  // first null, so the key has no fingerprint if the null is in the first 8 bytes.
+  static const int64_t FINGERPRINT_BUF_SIZE = 1024;
+  static const unsigned char FINGERPRINT_VALUE_FLAG = 0x02;
 public:
   ObStoreRowkeyWrapper() : rowkey_(nullptr) {}
   ObStoreRowkeyWrapper(const common::ObStoreRowkey *rowkey) : rowkey_(rowkey) {}
@@ -304,6 +311,9 @@ public:
   int64_t to_string(char *buf, const int64_t buf_len) const { return rowkey_->to_string(buf, buf_len); }
   const ObObj *get_ptr() const { return rowkey_->get_obj_ptr(); }
   const char *repr() const { return rowkey_->repr(); }
+  uint64_t get_fingerprint() const;
+private:
+  static bool can_encode_fingerprint(const common::ObObj &obj);
 public:
   const common::ObStoreRowkey *rowkey_;
 };
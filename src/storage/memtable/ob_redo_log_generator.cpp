@@ -70,7 +70,8 @@ int ObRedoLogGenerator::set(ObTransCallbackMgr *mgr, ObMemtableCtx *mem_ctx)
 // - OB_SUCCESS: success, all callbacks were filled
 // - OB_BUF_NOT_ENOUGH: buffer can not hold this callback
 // - OB_BLOCK_FROZEN: the callback's memtable logging is blocked
-//                    on waiting the previous frozen siblings logged
+//                    on waiting the previous frozen siblings logged,
+//                    or its delta node can not be folded yet
 // - OB_ITER_END: reach end of *ctx.epoch_to_*
 // - OB_XXX: other error
 class ObFillRedoLogFunctor final : public ObITxFillRedoFunctor
@@ -163,7 +164,20 @@ private:
 
     if (fake_fill) {
     } else if (OB_FAIL(riter->get_redo(redo)) && OB_ENTRY_NOT_EXIST != ret) {
-      TRANS_LOG(ERROR, "get_redo", K(ret));
+      if (OB_TX_DELTA_FOLD_BLOCKED == ret) {
+        // the delta node can not be folded until its base is decided. Stop
+        // filling this callback-list here like a logging blocked memtable, the
+        // callbacks before it are still submitted, and the fill is retried by
+        // the next round of submit(after write, freeze or commit), the
+        // committing txn is woken up to retry when the base node is decided
+        ctx_.delta_fold_blocked_cnt_++;
+        if (TC_REACH_TIME_INTERVAL(5_s)) {
+          TRANS_LOG(INFO, "redo fill blocked by unfolded delta node", K(ret), KPC(riter), K(ctx_));
+        }
+        ret = OB_BLOCK_FROZEN;
+      } else {
+        TRANS_LOG(ERROR, "get_redo", K(ret));
+      }
     } else if (OB_ENTRY_NOT_EXIST == ret) {
       ret = OB_SUCCESS;
     } else {
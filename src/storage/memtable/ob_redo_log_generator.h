@@ -96,6 +96,7 @@ struct ObTxFillRedoCtx
     buf_pos_(-1),
     helper_(NULL),
     last_log_blocked_memtable_(NULL),
+    delta_fold_blocked_cnt_(0),
     fill_count_(0),
     is_all_filled_(false),
     fill_time_(0)
@@ -120,6 +121,7 @@ struct ObTxFillRedoCtx
   int64_t buf_pos_;
   ObRedoLogSubmitHelper *helper_;
   ObMemtable *last_log_blocked_memtable_;
+  int delta_fold_blocked_cnt_; // number of fills stopped by unfolded delta node
   int fill_count_;         // number of callbacks was filled
   int fill_round_;         // iter of `choice-list -> fill -> fill others` loop count
   bool is_all_filled_;     // no remains, all callbacks was filled
@@ -143,6 +145,7 @@ public:
                K_(list_idx),
                K_(list_log_epoch_arr),
                KP_(last_log_blocked_memtable),
+               K_(delta_fold_blocked_cnt),
                K_(buf_len),
                K_(buf_pos));
 };
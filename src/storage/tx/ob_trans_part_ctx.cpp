@@ -4964,6 +4964,28 @@ int ObPartTransCtx::try_submit_next_log()
   return try_submit_next_log_(true);
 }
 
+// The commit submits the remaining redo first, which stops at the delta node
+// whose base is not decided. Retry it once the base is decided like the timeout
+// task does, the redo of the txn not committing is submitted by its own writes
+int ObPartTransCtx::retry_commit_for_delta_fold()
+{
+  int ret = OB_SUCCESS;
+  CtxLockGuard guard(lock_);
+  if (is_follower_() || is_exiting_ || !is_committing_()) {
+    // do nothing
+  } else if (is_local_tx_()) {
+    ret = try_submit_next_log_(false);
+  } else if (ObTxState::PREPARE > get_upstream_state()) {
+    ObTxState next_state = (is_sub2pc() || exec_info_.is_dup_tx_) ?
+                              ObTxState::REDO_COMPLETE :
+                              ObTxState::PREPARE;
+    if (OB_FAIL(drive_self_2pc_phase(next_state))) {
+      TRANS_LOG(WARN, "drive to next phase failed", K(ret), K(next_state), KPC(this));
+    }
+  }
+  return ret;
+}
+
 bool ObPartTransCtx::is_2pc_logging() const { return is_2pc_logging_(); }
 
 // uint64_t ObPartTransCtx::get_participant_id()
@@ -377,6 +377,8 @@ public:
 
   virtual int submit_log(const ObTwoPhaseCommitLogType &log_type) override;
   int try_submit_next_log();
+  // retry the commit blocked by an unfolded delta node whose base is decided
+  int retry_commit_for_delta_fold();
   // for instant logging and freezing
   int submit_redo_after_write(const bool force, const ObTxSEQ &write_seq_no);
   int submit_redo_log_for_freeze(const uint32_t freeze_clock);
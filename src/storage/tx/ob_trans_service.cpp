@@ -561,6 +561,14 @@ void ObTransService::handle(void *task)
         mtl_free(standby_cleanup_task);
         standby_cleanup_task = nullptr;
       }
+    } else if (ObTransRetryTaskType::DELTA_FOLD_WAKEUP_TASK == trans_task->get_task_type()) {
+      ObTxDeltaFoldWakeupTask *wakeup_task = static_cast<ObTxDeltaFoldWakeupTask *>(trans_task);
+      if (OB_FAIL(do_delta_fold_wakeup(*wakeup_task))) {
+        TRANS_LOG(WARN, "do delta fold wakeup failed", K(ret), KPC(wakeup_task));
+      }
+      wakeup_task->~ObTxDeltaFoldWakeupTask();
+      mtl_free(wakeup_task);
+      wakeup_task = nullptr;
     } else if(ObTransRetryTaskType::DUP_TABLE_TX_REDO_SYNC_RETRY_TASK == trans_task->get_task_type()) {
       ObTxRedoSyncRetryTask *redo_sync_task = static_cast<ObTxRedoSyncRetryTask *>(trans_task);
       redo_sync_task->clear_in_thread_pool_flag();
@@ -3818,6 +3818,51 @@ void ObTransService::register_standby_cleanup_task()
   }
 }
 
+int ObTransService::wakeup_delta_fold(const share::ObLSID &ls_id, const ObTransID &tx_id)
+{
+  int ret = OB_SUCCESS;
+  ObTxDeltaFoldWakeupTask *task = nullptr;
+
+  if (IS_NOT_INIT) {
+    TRANS_LOG(WARN, "ObTransService not inited");
+    ret = OB_NOT_INIT;
+  } else if (OB_UNLIKELY(!is_running_)) {
+    TRANS_LOG(WARN, "ObTransService is not running");
+    ret = OB_NOT_RUNNING;
+  } else if (OB_ISNULL(task = static_cast<ObTxDeltaFoldWakeupTask *>(
+    share::mtl_malloc(sizeof(ObTxDeltaFoldWakeupTask), "DeltaFoldTask")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    TRANS_LOG(WARN, "alloc ObTxDeltaFoldWakeupTask failed", K(ret));
+  } else if (OB_FALSE_IT(new (task) ObTxDeltaFoldWakeupTask(ls_id, tx_id))) {
+  } else if (OB_FAIL(push(task))) {
+    TRANS_LOG(WARN, "push ObTxDeltaFoldWakeupTask failed", K(ret), KPC(task));
+    task->~ObTxDeltaFoldWakeupTask();
+    share::mtl_free(task);
+    task = nullptr;
+  }
+  return ret;
+}
+
+int ObTransService::do_delta_fold_wakeup(const ObTxDeltaFoldWakeupTask &task)
+{
+  int ret = OB_SUCCESS;
+  ObPartTransCtx *ctx = NULL;
+  if (OB_FAIL(get_tx_ctx_(task.get_ls_id(), task.get_tx_id(), ctx))) {
+    if (OB_TRANS_CTX_NOT_EXIST == ret) {
+      // the txn has ended
+      ret = OB_SUCCESS;
+    } else {
+      TRANS_LOG(WARN, "get tx ctx failed", K(ret), K(task));
+    }
+  } else {
+    if (OB_FAIL(ctx->retry_commit_for_delta_fold())) {
+      TRANS_LOG(WARN, "retry commit for delta fold failed", K(ret), K(task));
+    }
+    revert_tx_ctx_(ctx);
+  }
+  return ret;
+}
+
 int ObTransService::do_standby_cleanup()
 {
   int ret = OB_SUCCESS;
@@ -185,6 +185,10 @@ int check_for_standby(const share::ObLSID &ls_id,
                       SCN &trans_version);
 void register_standby_cleanup_task();
 int do_standby_cleanup();
+// the delta writer blocked on folding is woken asynchronously, because the
+// waker holds the row latch which the redo fill of the delta writer needs
+int wakeup_delta_fold(const share::ObLSID &ls_id, const ObTransID &tx_id);
+int do_delta_fold_wakeup(const ObTxDeltaFoldWakeupTask &task);
 void handle_defer_abort(ObTxDesc &tx);
 
 // tx state check for 4377
@@ -412,74 +412,109 @@ private:
   ObTxData *tx_data_;
 };
 
+// ObTxDataMiniCache is the lookaside cache of the decided tx data held by each
+// tx table guard, so a scan doesn't look up the tx table again and again for
+// the rows written by the same transactions.
+//
+// The items are indexed by the tx id, so the rows written by several
+// interleaved transactions don't evict each other. Only the tx data whose state
+// is decided and which has no undo actions is cached, and it never changes
+// afterwards, so the items need no invalidation.
+//
+// The cache takes no lock. Each item is guarded by a sequence number which is
+// odd while the item is being written. A reader treats a torn read as a miss
+// instead of retrying, and a writer skips the item if another one is writing.
 class ObTxDataMiniCache
 {
 private:
-  static const int32_t TX_DATA_MINI_LRU_ITEM_CNT = 1 << 2; /* 4 */
-  static const int32_t MINI_LRU_CONCURRENCY_MOD_MASK = TX_DATA_MINI_LRU_ITEM_CNT - 1;
+  static const int32_t TX_DATA_MINI_CACHE_ITEM_CNT = 1 << 4; /* 16 */
+  static const int32_t MINI_CACHE_ITEM_IDX_MASK = TX_DATA_MINI_CACHE_ITEM_CNT - 1;
 
   struct CacheItem {
+    // 0 means the item has never been written
+    int64_t seq_;
     ObTxCommitData tx_data_;
-    bool is_valid_;
-    common::SpinRWLock lock_;
 
-    CacheItem() : tx_data_(), is_valid_(false) {}
+    CacheItem() : seq_(0), tx_data_() {}
 
     void reset()
     {
+      ATOMIC_STORE(&seq_, 0);
       tx_data_.reset();
-      is_valid_ = false;
     }
 
-    TO_STRING_KV(K_(tx_data), K_(is_valid));
+    bool is_valid() const
+    {
+      const int64_t seq = ATOMIC_LOAD(&seq_);
+      return 0 != seq && 0 == (seq & 1);
+    }
+
+    TO_STRING_KV(K_(seq), K_(tx_data));
   };
 
 public:
+  ObTxDataMiniCache() : hit_cnt_(0) {}
+
   int get(const transaction::ObTransID tx_id, ObTxCommitData &tx_commit_data)
   {
     int ret = OB_SUCCESS;
-    int64_t thread_idx = get_itid() & MINI_LRU_CONCURRENCY_MOD_MASK;
-    SpinRLockGuard guard(cache_items_[thread_idx].lock_);
-    if (cache_items_[thread_idx].is_valid_) {
-      if (tx_id == cache_items_[thread_idx].tx_data_.tx_id_) {
-        tx_commit_data = cache_items_[thread_idx].tx_data_;
-      } else {
+    CacheItem &item = cache_items_[get_item_idx_(tx_id)];
+    const int64_t seq = ATOMIC_LOAD_ACQ(&item.seq_);
+    if (0 == seq || 0 != (seq & 1)) {
+      ret = OB_TRANS_CTX_NOT_EXIST;
+    } else {
+      ObTxCommitData tx_data = item.tx_data_;
+      MEM_BARRIER();
+      if (seq != ATOMIC_LOAD(&item.seq_) || tx_id != tx_data.tx_id_) {
         ret = OB_TRANS_CTX_NOT_EXIST;
+      } else {
+        tx_commit_data = tx_data;
+        // each hit avoids a lookup of the tx data kv cache or the tx table
+        (void)ATOMIC_FAA(&hit_cnt_, 1);
       }
-    } else {
-      ret = OB_TRANS_CTX_NOT_EXIST;
     }
     return ret;
   }
 
   void set(const ObTxCommitData &tx_commit_data)
   {
-    int64_t thread_idx = get_itid() & MINI_LRU_CONCURRENCY_MOD_MASK;
-    SpinWLockGuard guard(cache_items_[thread_idx].lock_);
-    if (cache_items_[thread_idx].tx_data_.tx_id_ != tx_commit_data.tx_id_) {
-      cache_items_[thread_idx].tx_data_ = tx_commit_data;
-      cache_items_[thread_idx].is_valid_ = true;
+    CacheItem &item = cache_items_[get_item_idx_(tx_commit_data.tx_id_)];
+    const int64_t seq = ATOMIC_LOAD_ACQ(&item.seq_);
+    if (0 != (seq & 1)) {
+      // another thread is writing the item
+    } else if (0 != seq && item.tx_data_.tx_id_ == tx_commit_data.tx_id_) {
+      // the tx data has been cached, which never changes
+    } else if (!ATOMIC_BCAS(&item.seq_, seq, seq + 1)) {
+      // lose the race to another writer
+    } else {
+      item.tx_data_ = tx_commit_data;
+      ATOMIC_STORE_REL(&item.seq_, seq + 2);
     }
   }
 
+  // NB: it must not be called concurrently with get or set
   void reset() {
-    for (int i = 0; i < TX_DATA_MINI_LRU_ITEM_CNT; i++) {
+    for (int i = 0; i < TX_DATA_MINI_CACHE_ITEM_CNT; i++) {
       cache_items_[i].reset();
     }
+    hit_cnt_ = 0;
   }
 
+  int64_t get_hit_cnt() const { return ATOMIC_LOAD(&hit_cnt_); }
+
   int64_t to_string(char *buf, const int64_t buf_len) const
   {
     int64_t pos = 0;
+    databuff_printf(buf, buf_len, pos, "hit_cnt:%ld, ", get_hit_cnt());
     J_ARRAY_START();
-    for (int i = 0; i < TX_DATA_MINI_LRU_ITEM_CNT; i++) {
+    for (int i = 0; i < TX_DATA_MINI_CACHE_ITEM_CNT; i++) {
       if (i == 0) {
         databuff_printf(buf, buf_len, pos, "%d:", i);
       } else {
         databuff_printf(buf, buf_len, pos, ", %d:", i);
       }
 
-      if (OB_UNLIKELY(cache_items_[i].is_valid_)) {
+      if (OB_UNLIKELY(cache_items_[i].is_valid())) {
         databuff_print_obj(buf, buf_len, pos, cache_items_[i]);
       } else {
         databuff_printf(buf, buf_len, pos, "{}");
@@ -490,7 +525,17 @@ public:
   }
 
 private:
-  CacheItem cache_items_[TX_DATA_MINI_LRU_ITEM_CNT];
+  // the tx ids are allocated in ascending order, so the transactions written
+  // around the same time fall into different items
+  static int64_t get_item_idx_(const transaction::ObTransID tx_id)
+  {
+    return tx_id.get_id() & MINI_CACHE_ITEM_IDX_MASK;
+  }
+
+private:
+  CacheItem cache_items_[TX_DATA_MINI_CACHE_ITEM_CNT];
+  // the lookups served by the cache
+  int64_t hit_cnt_;
 };
 
 struct ObReadTxDataArg{
@@ -657,5 +657,28 @@ int LoadTxOpFunctor::operator()(const ObTxData &tx_data, ObTxCCCtx *tx_cc_ctx)
   return ret;
 }
 
+int CacheCtxTxDataFunctor::operator()(const ObTxData &tx_data, ObTxCCCtx *tx_cc_ctx)
+{
+  int ret = OB_SUCCESS;
+  // NB: the tx data in the tx ctx is read without the lock of the ctx. The
+  // commit version and the end scn are settled before the state is filled in
+  // with commit (see ObPartTransCtx::tx_end_), and the state never changes
+  // afterwards, so we read the state before the others. The abort state is not
+  // cached since the abort op is added after it.
+  const int32_t state = ATOMIC_LOAD(&tx_data.state_);
+  if (OB_FAIL(fn_(tx_data, tx_cc_ctx))) {
+    // do nothing
+  } else if (ObTxData::COMMIT == state && !tx_data.op_guard_.is_valid()) {
+    ObTxCommitData commit_data;
+    commit_data.tx_id_ = tx_id_;
+    commit_data.state_ = state;
+    commit_data.commit_version_ = tx_data.commit_version_.atomic_load();
+    commit_data.start_scn_ = tx_data.start_scn_.atomic_load();
+    commit_data.end_scn_ = tx_data.end_scn_.atomic_load();
+    mini_cache_.set(commit_data);
+  }
+  return ret;
+}
+
 } // namespace storage
 } // namespace oceanbase
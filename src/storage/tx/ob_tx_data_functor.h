@@ -250,6 +250,24 @@ public:
   ObTxData &tx_data_;
 };
 
+// Check with the tx data in the tx ctx table by the functor, and put the tx
+// data into the mini cache once the tx is committed.
+class CacheCtxTxDataFunctor : public ObITxDataCheckFunctor
+{
+public:
+  CacheCtxTxDataFunctor(const transaction::ObTransID tx_id,
+                        ObITxDataCheckFunctor &fn,
+                        ObTxDataMiniCache &mini_cache)
+    : tx_id_(tx_id), fn_(fn), mini_cache_(mini_cache) {}
+  virtual int operator()(const ObTxData &tx_data, ObTxCCCtx *tx_cc_ctx = nullptr) override;
+  virtual bool recheck() override { return fn_.recheck(); }
+  INHERIT_TO_STRING_KV("ObITxDataCheckFunctor", ObITxDataCheckFunctor, K_(tx_id), K_(fn));
+public:
+  transaction::ObTransID tx_id_;
+  ObITxDataCheckFunctor &fn_;
+  ObTxDataMiniCache &mini_cache_;
+};
+
 }  // namespace storage
 }  // namespace oceanbase
 
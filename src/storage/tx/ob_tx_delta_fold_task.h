@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_TRANSACTION_OB_TX_DELTA_FOLD_TASK_
+#define OCEANBASE_TRANSACTION_OB_TX_DELTA_FOLD_TASK_
+
+#include "ob_trans_define.h"
+
+namespace oceanbase
+{
+
+namespace transaction
+{
+// wakeup the txn whose redo submit is blocked by an unfolded delta node, the
+// base node of which has been decided
+class ObTxDeltaFoldWakeupTask : public ObTransTask
+{
+public:
+  ObTxDeltaFoldWakeupTask(const share::ObLSID &ls_id, const ObTransID &tx_id)
+    : ObTransTask(ObTransRetryTaskType::DELTA_FOLD_WAKEUP_TASK), ls_id_(ls_id), tx_id_(tx_id)
+  {}
+  ~ObTxDeltaFoldWakeupTask() { destroy(); }
+  const share::ObLSID &get_ls_id() const { return ls_id_; }
+  const ObTransID &get_tx_id() const { return tx_id_; }
+  TO_STRING_KV(K_(task_type), K_(ls_id), K_(tx_id));
+private:
+  share::ObLSID ls_id_;
+  ObTransID tx_id_;
+};
+
+} // transaction
+} // oceanbase
+
+#endif // OCEANBASE_TRANSACTION_OB_TX_DELTA_FOLD_TASK_
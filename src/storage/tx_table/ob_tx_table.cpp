@@ -755,8 +755,13 @@ int ObTxTable::check_tx_data_in_kv_cache_(ObReadTxDataArg &read_tx_data_arg, ObI
 int ObTxTable::check_tx_data_in_tables_(ObReadTxDataArg &read_tx_data_arg, ObITxDataCheckFunctor &fn)
 {
   int ret = OB_SUCCESS;
+  // the tx data of the committed tx is cached even if it is read from the tx
+  // ctx, so the rows written by the tx are not checked with the ctx one by one
+  // before the callbacks of the tx write back the commit version
+  CacheCtxTxDataFunctor cache_fn(read_tx_data_arg.tx_id_, fn, read_tx_data_arg.tx_data_mini_cache_);
+  ObITxDataCheckFunctor &ctx_fn = read_tx_data_arg.skip_cache_ ? fn : cache_fn;
 
-  if (OB_SUCC(tx_ctx_table_.check_with_tx_data(read_tx_data_arg.tx_id_, fn))) {
+  if (OB_SUCC(tx_ctx_table_.check_with_tx_data(read_tx_data_arg.tx_id_, ctx_fn))) {
     EVENT_INC(ObStatEventIds::TX_DATA_READ_TX_CTX_COUNT);
     TRANS_LOG(DEBUG, "tx ctx table check with tx data succeed", K(read_tx_data_arg), K(fn));
   } else if (OB_TRANS_CTX_NOT_EXIST == ret) {
@@ -327,6 +327,8 @@ public: // getter & setter
   int64_t get_epoch() const { return ATOMIC_LOAD(&epoch_); }
   TxTableState get_state() const { return ATOMIC_LOAD(&state_); }
   share::ObLSID get_ls_id() const { return ls_id_; }
+  void add_mini_cache_hit_cnt(const int64_t hit_cnt) { (void)ATOMIC_FAA(&mini_cache_hit_cnt_, hit_cnt); }
+  int64_t get_mini_cache_hit_cnt() const { return ATOMIC_LOAD(&mini_cache_hit_cnt_); }
 
   static int64_t get_filter_col_idx();
 
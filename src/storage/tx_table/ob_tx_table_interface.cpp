@@ -34,6 +34,14 @@ int ObTxTableGuard::init(ObTxTable *tx_table)
   return ret;
 }
 
+void ObTxTableGuard::flush_mini_cache_stat_()
+{
+  const int64_t hit_cnt = mini_cache_.get_hit_cnt();
+  if (0 < hit_cnt) {
+    tx_table_->add_mini_cache_hit_cnt(hit_cnt);
+  }
+}
+
 int ObTxTableGuard::check_with_tx_data(ObReadTxDataArg &read_tx_data_arg,
                                        ObITxDataCheckFunctor &fn)
 {
@@ -44,6 +44,7 @@ public:
   void reset()
   {
     if (OB_NOT_NULL(tx_table_)) {
+      flush_mini_cache_stat_();
       tx_table_ = nullptr;
       epoch_ = -1;
     }
@@ -105,10 +106,20 @@ public: // dalegate functions
 
   bool check_ls_offline();
 
-  void reuse() { mini_cache_.reset(); }
+  void reuse()
+  {
+    if (OB_NOT_NULL(tx_table_)) {
+      flush_mini_cache_stat_();
+    }
+    mini_cache_.reset();
+  }
 
   TO_STRING_KV(KP_(tx_table), K_(epoch), K(mini_cache_));
 
+private:
+  // count the lookups avoided by the mini cache into the tx table
+  void flush_mini_cache_stat_();
+
 private:
   ObTxTable *tx_table_;
   int64_t epoch_;
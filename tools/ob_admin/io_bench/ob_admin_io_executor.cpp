@@ -10,8 +10,10 @@
  * See the Mulan PubL v2 for more details.
  */
 
+#include <sys/stat.h>
 #include "ob_admin_io_executor.h"
 #include "share/io/ob_io_manager.h"
+#include "lib/random/ob_random.h"
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -24,7 +26,9 @@ namespace tools
 ObAdminIOExecutor::ObAdminIOExecutor()
   : conf_dir_(NULL),
     data_dir_(NULL),
-    file_size_(NULL)
+    file_size_(NULL),
+    io_engine_(NULL),
+    io_depth_(DEFAULT_IO_DEPTH)
 {
 }
 
@@ -41,6 +45,17 @@ int ObAdminIOExecutor::execute(int argc, char *argv[])
   } else if (OB_UNLIKELY(NULL == conf_dir_ || NULL == data_dir_)) {
     ret = OB_INVALID_ARGUMENT;
     COMMON_LOG(ERROR, "invalid argument", K(ret), K(data_dir_), K(conf_dir_));
+  } else if (OB_UNLIKELY(NULL != io_engine_
+      && 0 != STRCMP(io_engine_, "libaio")
+      && 0 != STRCMP(io_engine_, "io_uring")
+      && 0 != STRCMP(io_engine_, "compare"))) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(ERROR, "invalid io engine", K(ret), K(io_engine_));
+    print_usage();
+  } else if (OB_UNLIKELY(io_depth_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(ERROR, "invalid io depth", K(ret), K(io_depth_));
+    print_usage();
   } else {
     file_size_ = NULL == file_size_ ? "100G" : file_size_;
     ObArenaAllocator arena;
@@ -75,6 +90,263 @@ int ObAdminIOExecutor::execute(int argc, char *argv[])
         }
       }
     }
+    if (OB_SUCC(ret) && NULL != io_engine_ && OB_FAIL(run_device_bench_())) {
+      COMMON_LOG(WARN, "fail to bench local device", K(ret), K(io_engine_), K(io_depth_));
+    }
+  }
+  return ret;
+}
+
+int ObAdminIOExecutor::run_device_bench_()
+{
+  int ret = OB_SUCCESS;
+  char store_dir[OB_MAX_FILE_NAME_LENGTH] = {0};
+  char sstable_dir[OB_MAX_FILE_NAME_LENGTH] = {0};
+  char result_path[OB_MAX_FILE_NAME_LENGTH] = {0};
+  FILE *result_file = NULL;
+  // the device creates its block file in store_dir/sstable, keep it away from an existing block file
+  if (OB_FAIL(databuff_printf(store_dir, sizeof(store_dir), "%s/ob_io_bench_device", data_dir_))
+      || OB_FAIL(databuff_printf(sstable_dir, sizeof(sstable_dir), "%s/sstable", store_dir))
+      || OB_FAIL(databuff_printf(result_path, sizeof(result_path), "%s/io_engine_bench.log", conf_dir_))) {
+    COMMON_LOG(WARN, "path is too long", K(ret), K(data_dir_), K(conf_dir_));
+  } else if (0 != ::mkdir(store_dir, S_IRWXU) && EEXIST != errno) {
+    ret = OB_IO_ERROR;
+    COMMON_LOG(WARN, "fail to create bench dir", K(ret), K(store_dir), K(errno));
+  } else if (0 != ::mkdir(sstable_dir, S_IRWXU) && EEXIST != errno) {
+    ret = OB_IO_ERROR;
+    COMMON_LOG(WARN, "fail to create bench dir", K(ret), K(sstable_dir), K(errno));
+  } else if (OB_ISNULL(result_file = fopen(result_path, "w"))) {
+    ret = OB_IO_ERROR;
+    COMMON_LOG(WARN, "fail to open result file", K(ret), K(result_path), K(errno));
+  } else {
+    fprintf(result_file, "%-10s %-15s %-10s %-10s %-15s %-10s\n",
+        "io_type", "io_size_byte", "io_engine", "io_depth", "io_ps", "io_rt_us");
+    const bool bench_libaio = 0 != STRCMP(io_engine_, "io_uring");
+    const bool bench_io_uring = 0 != STRCMP(io_engine_, "libaio");
+    if (bench_libaio && OB_FAIL(bench_device_(false /*enable_io_uring*/, store_dir, result_file))) {
+      COMMON_LOG(WARN, "fail to bench libaio", K(ret));
+    } else if (bench_io_uring && !share::ObLocalIOUring::is_supported()) {
+      fprintf(stderr, "io_uring is not supported, skip it\n");
+    } else if (bench_io_uring && OB_FAIL(bench_device_(true /*enable_io_uring*/, store_dir, result_file))) {
+      COMMON_LOG(WARN, "fail to bench io_uring", K(ret));
+    }
+    fclose(result_file);
+    fprintf(stdout, "io engine bench result: %s\n", result_path);
+  }
+  if (0 != store_dir[0]) {
+    char file_path[OB_MAX_FILE_NAME_LENGTH] = {0};
+    if (OB_SUCCESS == databuff_printf(file_path, sizeof(file_path), "%s/block_file", sstable_dir)) {
+      ::unlink(file_path);
+    }
+    ::rmdir(sstable_dir);
+    ::rmdir(store_dir);
+  }
+  return ret;
+}
+
+int ObAdminIOExecutor::bench_device_(const bool enable_io_uring, const char *store_dir, FILE *result_file)
+{
+  int ret = OB_SUCCESS;
+  const char *engine_name = enable_io_uring ? "io_uring" : "libaio";
+  const int64_t io_size_array[] = {4096, 16384, 65536, 262144};
+  share::ObLocalDevice device;
+  ObIODOpt iod_opt_array[6];
+  ObIODOpts iod_opts;
+  ObIODOpt start_opt;
+  ObIODOpts start_opts;
+  ObIOContext *io_context = NULL;
+  ObIOEvents *io_events = NULL;
+  char sstable_dir[OB_MAX_FILE_NAME_LENGTH] = {0};
+  iod_opts.opts_ = iod_opt_array;
+  iod_opts.opt_cnt_ = ARRAYSIZEOF(iod_opt_array);
+  start_opts.opts_ = &start_opt;
+  start_opts.opt_cnt_ = 1;
+  if (OB_FAIL(databuff_printf(sstable_dir, sizeof(sstable_dir), "%s/sstable", store_dir))) {
+    COMMON_LOG(WARN, "path is too long", K(ret), K(store_dir));
+  } else {
+    iod_opt_array[0].set("data_dir", store_dir);
+    iod_opt_array[1].set("sstable_dir", sstable_dir);
+    iod_opt_array[2].set("block_size", DEVICE_BENCH_BLOCK_SIZE);
+    iod_opt_array[3].set("datafile_disk_percentage", 0L);
+    iod_opt_array[4].set("datafile_size", DEVICE_BENCH_FILE_SIZE);
+    iod_opt_array[5].set("enable_io_uring", enable_io_uring);
+    start_opt.set("reserved size", 0L);
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(device.init(iod_opts))) {
+    COMMON_LOG(WARN, "fail to init local device", K(ret), K(store_dir));
+  } else if (OB_FAIL(device.start(start_opts))) {
+    COMMON_LOG(WARN, "fail to start local device", K(ret), K(store_dir));
+  } else if (start_opt.value_.value_bool && OB_FAIL(fill_device_(device))) {
+    // a new block file is filled up, otherwise the reads of unwritten extents never reach the disk
+    COMMON_LOG(WARN, "fail to fill block file", K(ret));
+  } else if (OB_FAIL(device.io_setup(io_depth_, io_context))) {
+    COMMON_LOG(WARN, "fail to setup io context", K(ret), K(io_depth_));
+  } else if (OB_ISNULL(io_events = device.alloc_io_events(io_depth_))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    COMMON_LOG(WARN, "fail to alloc io events", K(ret), K(io_depth_));
+  } else {
+    for (int64_t is_write = 1; OB_SUCC(ret) && is_write >= 0; --is_write) {
+      for (int64_t i = 0; OB_SUCC(ret) && i < ARRAYSIZEOF(io_size_array); ++i) {
+        double iops = 0;
+        double rt_us = 0;
+        fprintf(stdout, "bench local device: io_engine=%s, io_depth=%ld, is_write=%ld, io_size=%ld\n",
+            engine_name, io_depth_, is_write, io_size_array[i]);
+        if (OB_FAIL(bench_device_io_(device, io_context, io_events, 1 == is_write, io_size_array[i], iops, rt_us))) {
+          COMMON_LOG(WARN, "fail to bench device io", K(ret), K(is_write), K(io_size_array[i]));
+        } else {
+          fprintf(stdout, "\e[1;32mio_engine=%s, is_write=%ld, io_size=%ld, iops=%.2lf, rt=%.2lf\e[0m\n\n",
+              engine_name, is_write, io_size_array[i], iops, rt_us);
+          fprintf(result_file, "%-10ld %-15ld %-10s %-10ld %-15.2lf %-10.2lf\n",
+              is_write, io_size_array[i], engine_name, io_depth_, iops, rt_us);
+        }
+      }
+    }
+  }
+  if (NULL != io_events) {
+    device.free_io_events(io_events);
+  }
+  if (NULL != io_context) {
+    device.io_destroy(io_context);
+  }
+  device.destroy();
+  return ret;
+}
+
+int ObAdminIOExecutor::fill_device_(share::ObLocalDevice &device)
+{
+  int ret = OB_SUCCESS;
+  const int64_t block_cnt = DEVICE_BENCH_FILE_SIZE / DEVICE_BENCH_BLOCK_SIZE;
+  char *buf = NULL;
+  if (OB_ISNULL(buf = static_cast<char *>(ob_malloc_align(DIO_ALIGN_SIZE, DEVICE_BENCH_BLOCK_SIZE, ObMemAttr(OB_SERVER_TENANT_ID, "IOBench"))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    COMMON_LOG(WARN, "fail to alloc memory", K(ret));
+  } else {
+    MEMSET(buf, 'a', DEVICE_BENCH_BLOCK_SIZE);
+    fprintf(stdout, "fill bench block file, size=%ld\n", DEVICE_BENCH_FILE_SIZE);
+    for (int64_t i = share::ObLocalDevice::RESERVED_BLOCK_INDEX; OB_SUCC(ret) && i < block_cnt; ++i) {
+      const ObIOFd fd(&device, 0, i);
+      int64_t write_size = 0;
+      if (OB_FAIL(device.pwrite(fd, 0, DEVICE_BENCH_BLOCK_SIZE, buf, write_size))) {
+        COMMON_LOG(WARN, "fail to write block", K(ret), K(fd));
+      }
+    }
+    ob_free_align(buf);
+  }
+  return ret;
+}
+
+int ObAdminIOExecutor::bench_device_io_(
+    share::ObLocalDevice &device,
+    ObIOContext *io_context,
+    ObIOEvents *io_events,
+    const bool is_write,
+    const int64_t io_size,
+    double &iops,
+    double &rt_us)
+{
+  int ret = OB_SUCCESS;
+  const int64_t block_cnt = DEVICE_BENCH_FILE_SIZE / DEVICE_BENCH_BLOCK_SIZE;
+  const int64_t io_cnt_per_block = DEVICE_BENCH_BLOCK_SIZE / io_size;
+  ObArenaAllocator arena;
+  char *buf = NULL;
+  ObIOCB **iocbs = NULL;
+  int64_t *submit_ts = NULL;
+  int64_t *free_slots = NULL;
+  int64_t free_cnt = 0;
+  iops = 0;
+  rt_us = 0;
+  if (OB_ISNULL(buf = static_cast<char *>(ob_malloc_align(DIO_ALIGN_SIZE, io_size * io_depth_, ObMemAttr(OB_SERVER_TENANT_ID, "IOBench"))))
+      || OB_ISNULL(iocbs = static_cast<ObIOCB **>(arena.alloc(sizeof(ObIOCB *) * io_depth_)))
+      || OB_ISNULL(submit_ts = static_cast<int64_t *>(arena.alloc(sizeof(int64_t) * io_depth_)))
+      || OB_ISNULL(free_slots = static_cast<int64_t *>(arena.alloc(sizeof(int64_t) * io_depth_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    COMMON_LOG(WARN, "fail to alloc memory", K(ret), K(io_size), K(io_depth_));
+  } else {
+    MEMSET(buf, 'a', io_size * io_depth_);
+    MEMSET(iocbs, 0, sizeof(ObIOCB *) * io_depth_);
+    for (int64_t i = 0; OB_SUCC(ret) && i < io_depth_; ++i) {
+      free_slots[free_cnt++] = i;
+      if (OB_ISNULL(iocbs[i] = device.alloc_iocb())) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        COMMON_LOG(WARN, "fail to alloc iocb", K(ret), K(i));
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    int64_t now = start_ts;
+    int64_t inflight_cnt = 0;
+    int64_t complete_cnt = 0;
+    int64_t total_rt = 0;
+    while (OB_SUCC(ret) && (now - start_ts < DEVICE_BENCH_TIME_US || inflight_cnt > 0)) {
+      // keep io_depth_ requests in flight until the bench time is up
+      while (OB_SUCC(ret) && free_cnt > 0 && now - start_ts < DEVICE_BENCH_TIME_US) {
+        const int64_t slot = free_slots[free_cnt - 1];
+        const int64_t block_idx = ObRandom::rand(share::ObLocalDevice::RESERVED_BLOCK_INDEX, block_cnt - 1);
+        const int64_t offset = ObRandom::rand(0, io_cnt_per_block - 1) * io_size;
+        const ObIOFd fd(&device, 0, block_idx);
+        char *io_buf = buf + slot * io_size;
+        void *callback = reinterpret_cast<void *>(slot);
+        if (is_write && OB_FAIL(device.io_prepare_pwrite(fd, io_buf, io_size, offset, iocbs[slot], callback))) {
+          COMMON_LOG(WARN, "fail to prepare pwrite", K(ret), K(fd), K(offset));
+        } else if (!is_write && OB_FAIL(device.io_prepare_pread(fd, io_buf, io_size, offset, iocbs[slot], callback))) {
+          COMMON_LOG(WARN, "fail to prepare pread", K(ret), K(fd), K(offset));
+        } else if (OB_FAIL(device.io_submit(io_context, iocbs[slot]))) {
+          COMMON_LOG(WARN, "fail to submit io", K(ret), K(fd), K(offset));
+        } else {
+          submit_ts[slot] = ObTimeUtility::current_time();
+          --free_cnt;
+          ++inflight_cnt;
+        }
+      }
+      if (OB_SUCC(ret) && inflight_cnt > 0) {
+        struct timespec timeout = {1, 0};
+        if (OB_FAIL(device.io_getevents(io_context, 1, io_events, &timeout))) {
+          COMMON_LOG(WARN, "fail to get io events", K(ret));
+        } else {
+          now = ObTimeUtility::current_time();
+          for (int64_t i = 0; i < io_events->get_complete_cnt(); ++i) {
+            const int64_t slot = reinterpret_cast<int64_t>(io_events->get_ith_data(i));
+            --inflight_cnt;
+            if (OB_FAIL(ret)) {
+            } else if (OB_UNLIKELY(0 != io_events->get_ith_ret_code(i) || io_size != io_events->get_ith_ret_bytes(i))) {
+              ret = OB_IO_ERROR;
+              COMMON_LOG(WARN, "io failed", K(ret), K(slot), "ret_code", io_events->get_ith_ret_code(i),
+                  "ret_bytes", io_events->get_ith_ret_bytes(i));
+            } else {
+              total_rt += now - submit_ts[slot];
+              free_slots[free_cnt++] = slot;
+              ++complete_cnt;
+            }
+          }
+        }
+      } else {
+        now = ObTimeUtility::current_time();
+      }
+    }
+    // drain the requests in flight on failure before their buffers are freed
+    int tmp_ret = OB_SUCCESS;
+    while (OB_FAIL(ret) && OB_SUCCESS == tmp_ret && inflight_cnt > 0) {
+      struct timespec timeout = {1, 0};
+      if (OB_SUCCESS != (tmp_ret = device.io_getevents(io_context, 1, io_events, &timeout))) {
+        COMMON_LOG(WARN, "fail to get io events", K(tmp_ret), K(inflight_cnt));
+      } else {
+        inflight_cnt -= io_events->get_complete_cnt();
+      }
+    }
+    if (OB_SUCC(ret) && complete_cnt > 0) {
+      iops = static_cast<double>(complete_cnt) * 1000000 / static_cast<double>(now - start_ts);
+      rt_us = static_cast<double>(total_rt) / static_cast<double>(complete_cnt);
+    }
+  }
+  for (int64_t i = 0; NULL != iocbs && i < io_depth_; ++i) {
+    if (NULL != iocbs[i]) {
+      device.free_iocb(iocbs[i]);
+    }
+  }
+  if (NULL != buf) {
+    ob_free_align(buf);
   }
   return ret;
 }
@@ -83,12 +355,14 @@ int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
 {
   int ret = OB_SUCCESS;
   int opt = 0;
-  const char* opt_string = "hc:d:f:";
+  const char* opt_string = "hc:d:f:e:q:";
   struct option longopts[] =
     {{"help", 0, NULL, 'h' },
      {"conf_dir", 1, NULL, 'c'},
      {"data_dir", 1, NULL, 'd'},
-     {"file_size", 1, NULL, 'f'}};
+     {"file_size", 1, NULL, 'f'},
+     {"io_engine", 1, NULL, 'e'},
+     {"io_depth", 1, NULL, 'q'}};
 
   while ((opt = getopt_long(argc, argv, opt_string, longopts, NULL)) != -1) {
     switch (opt) {
@@ -108,6 +382,14 @@ int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
         file_size_ = optarg;
         break;
       }
+      case 'e': {
+        io_engine_ = optarg;
+        break;
+      }
+      case 'q': {
+        io_depth_ = atol(optarg);
+        break;
+      }
       default: {
         print_usage();
         ret = OB_INVALID_ARGUMENT;
@@ -119,7 +401,11 @@ int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
 
 void ObAdminIOExecutor::print_usage()
 {
-  fprintf(stderr, "\nUsage: ob_tool io_bench -c conf_dir -d data_dir\n");
+  fprintf(stderr, "\nUsage: ob_tool io_bench -c conf_dir -d data_dir [-f file_size] "
+                  "[-e libaio|io_uring|compare] [-q io_depth]\n"
+                  "  -e: after io_resource.conf is generated, bench the async io of the local device "
+                  "on the given engine, or on both engines with compare, and write io_engine_bench.log\n"
+                  "  -q: the number of requests in flight for -e, 64 by default\n");
 }
 
 void ObAdminIOExecutor::reset()
@@ -127,6 +413,8 @@ void ObAdminIOExecutor::reset()
   conf_dir_ = NULL;
   data_dir_ = NULL;
   file_size_ = NULL;
+  io_engine_ = NULL;
+  io_depth_ = DEFAULT_IO_DEPTH;
 }
 
 }
@@ -13,6 +13,7 @@
 #ifndef OB_ADMIN_IO_EXECUTOR_H_
 #define OB_ADMIN_IO_EXECUTOR_H_
 #include "../ob_admin_executor.h"
+#include "share/ob_local_device.h"
 
 namespace oceanbase
 {
@@ -28,11 +29,29 @@ public:
   void reset();
 private:
   static const int64_t DEFAULT_BENCH_FILE_SIZE = 1024L * 1024L * 1024L * 100L;
+  static const int64_t DEFAULT_IO_DEPTH = 64;
+  static const int64_t DEVICE_BENCH_FILE_SIZE = 1024L * 1024L * 1024L * 4L;
+  static const int64_t DEVICE_BENCH_BLOCK_SIZE = 2L * 1024L * 1024L;
+  static const int64_t DEVICE_BENCH_TIME_US = 10L * 1000L * 1000L;
   int parse_cmd(int argc, char *argv[]);
   void print_usage();
+  // benches ObLocalDevice async io with io_depth_ requests in flight, on the engines given by -e
+  int run_device_bench_();
+  int bench_device_(const bool enable_io_uring, const char *store_dir, FILE *result_file);
+  int fill_device_(share::ObLocalDevice &device);
+  int bench_device_io_(
+      share::ObLocalDevice &device,
+      common::ObIOContext *io_context,
+      common::ObIOEvents *io_events,
+      const bool is_write,
+      const int64_t io_size,
+      double &iops,
+      double &rt_us);
   const char *conf_dir_;
   const char *data_dir_;
   const char *file_size_;
+  const char *io_engine_;
+  int64_t io_depth_;
 };
 
 }
@@ -231,6 +231,165 @@ TEST_F(TestLogCache, test_flashback)
   buf = NULL;
 }
 
+TEST_F(TestLogCache, test_read_ahead_tracker)
+{
+  PALF_LOG(INFO, "begin read ahead tracker");
+  LogReadAheadTracker tracker;
+  const int64_t read_size = 16 * 1024;
+  const LSN limit_lsn(PALF_BLOCK_SIZE);
+  int64_t cur_ts = 1;
+  LSN read_ahead_lsn;
+  int64_t read_ahead_size = 0;
+  // the first read of a reader doesn't trigger read-ahead
+  LSN lsn(0);
+  tracker.record_read(lsn, lsn + read_size, true, limit_lsn, cur_ts, read_ahead_lsn, read_ahead_size);
+  EXPECT_EQ(0, read_ahead_size);
+  // the sequential read triggers read-ahead from the cache line of the read end
+  lsn = lsn + read_size;
+  tracker.record_read(lsn, lsn + read_size, true, limit_lsn, cur_ts, read_ahead_lsn, read_ahead_size);
+  EXPECT_EQ(LSN(0), read_ahead_lsn);
+  EXPECT_EQ(LogReadAheadTracker::MIN_READ_AHEAD_SIZE, read_ahead_size);
+  const LSN read_ahead_end_lsn = read_ahead_lsn + read_ahead_size;
+  // no need to read ahead until half of the window is consumed, and then the window doubles
+  do {
+    lsn = lsn + read_size;
+    tracker.record_read(lsn, lsn + read_size, false, limit_lsn, cur_ts, read_ahead_lsn, read_ahead_size);
+  } while (0 == read_ahead_size && lsn < read_ahead_end_lsn);
+  EXPECT_GE(LogReadAheadTracker::MIN_READ_AHEAD_SIZE / 2, read_ahead_end_lsn - (lsn + read_size));
+  EXPECT_EQ(read_ahead_end_lsn, read_ahead_lsn);
+  EXPECT_EQ(LogCacheUtils::lower_align_with_start(lsn + read_size + 2 * LogReadAheadTracker::MIN_READ_AHEAD_SIZE,
+                                                  CACHE_LINE_SIZE),
+            read_ahead_lsn + read_ahead_size);
+  // the logs read ahead are evicted, the window is halved
+  lsn = lsn + read_size;
+  tracker.record_read(lsn, lsn + read_size, true, limit_lsn, cur_ts, read_ahead_lsn, read_ahead_size);
+  EXPECT_EQ(LogCacheUtils::lower_align_with_start(lsn + read_size, CACHE_LINE_SIZE), read_ahead_lsn);
+  EXPECT_EQ(LogReadAheadTracker::MIN_READ_AHEAD_SIZE, read_ahead_size);
+  // the logs can't be read ahead beyond limit_lsn
+  lsn = LSN(PALF_BLOCK_SIZE - 2 * CACHE_LINE_SIZE);
+  tracker.record_read(lsn, lsn + read_size, true, limit_lsn, cur_ts, read_ahead_lsn, read_ahead_size);
+  tracker.record_read(lsn + read_size, lsn + 2 * read_size, true, limit_lsn, cur_ts, read_ahead_lsn, read_ahead_size);
+  EXPECT_EQ(limit_lsn, read_ahead_lsn + read_ahead_size);
+  // the streams expire, and the readers share the total read-ahead size
+  cur_ts += LogReadAheadTracker::STREAM_EXPIRE_TIME_US;
+  for (int64_t i = 0; i < LogReadAheadTracker::MAX_STREAM_CNT; i++) {
+    lsn = LSN(i * 100 * CACHE_LINE_SIZE);
+    tracker.record_read(lsn, lsn + read_size, true, limit_lsn, cur_ts, read_ahead_lsn, read_ahead_size);
+  }
+  for (int64_t round = 0; round < 10; round++) {
+    for (int64_t i = 0; i < LogReadAheadTracker::MAX_STREAM_CNT; i++) {
+      lsn = LSN(i * 100 * CACHE_LINE_SIZE + (round + 1) * read_size);
+      tracker.record_read(lsn, lsn + read_size, false, limit_lsn, cur_ts, read_ahead_lsn, read_ahead_size);
+    }
+  }
+  for (int64_t i = 0; i < LogReadAheadTracker::MAX_STREAM_CNT; i++) {
+    EXPECT_TRUE(tracker.streams_[i].is_active(cur_ts));
+    EXPECT_GE(LogReadAheadTracker::MAX_TOTAL_READ_AHEAD_SIZE / LogReadAheadTracker::MAX_STREAM_CNT,
+              tracker.streams_[i].window_size_);
+  }
+}
+
+TEST_F(TestLogCache, test_read_ahead_hit_accounting)
+{
+  PALF_LOG(INFO, "begin read ahead hit accounting");
+  log_storage.is_inited_ = true;
+  log_storage.logical_block_size_ = PALF_BLOCK_SIZE;
+  const int64_t flashback_version = 0;
+  // another palf, the cache lines filled by other cases are not hit
+  const int64_t palf_id = 2;
+  LogColdCache cold_cache;
+  cold_cache.init(palf_id, palf_env_impl, &log_storage);
+  const int64_t read_size = 16 * 1024;
+  const LSN limit_lsn(PALF_BLOCK_SIZE);
+  char *buf = reinterpret_cast<char *>(ob_malloc(MAX_LOG_BUFFER_SIZE, "LOG_KV_CACHE"));
+  LogIteratorInfo iterator_info;
+  LSN read_ahead_lsn;
+  int64_t read_ahead_size = 0;
+  LSN lsn(0);
+  int64_t miss_cnt = 0;
+  // the first two sequential reads miss the cache and trigger read-ahead
+  for (int64_t i = 0; i < LogReadAheadTracker::MIN_SEQ_READ_CNT; i++) {
+    int64_t out_read_size = 0;
+    EXPECT_EQ(OB_ENTRY_NOT_EXIST, cold_cache.get_cache_lines_(lsn, flashback_version, read_size, buf,
+                                                              out_read_size, &iterator_info));
+    EXPECT_EQ(0, out_read_size);
+    LSN miss_lsn = lsn;
+    int64_t in_read_size = read_size;
+    EXPECT_EQ(OB_SUCCESS, cold_cache.deal_with_miss_(false, 0, MAX_LOG_BUFFER_SIZE, miss_lsn, in_read_size,
+                                                     out_read_size, &iterator_info));
+    miss_cnt++;
+    cold_cache.read_ahead_tracker_.record_read(lsn, lsn + read_size, true, limit_lsn, 1,
+                                               read_ahead_lsn, read_ahead_size);
+    lsn = lsn + read_size;
+  }
+  EXPECT_EQ(0, cold_cache.log_cache_stat_.hit_cnt_);
+  EXPECT_EQ(miss_cnt, cold_cache.log_cache_stat_.miss_cnt_);
+  EXPECT_EQ(miss_cnt, iterator_info.cold_cache_stat_.miss_cnt_);
+  EXPECT_EQ(LSN(0), read_ahead_lsn);
+  EXPECT_EQ(LogReadAheadTracker::MIN_READ_AHEAD_SIZE, read_ahead_size);
+
+  // the logs read ahead are filled into the cache, which is neither a hit nor a miss
+  EXPECT_EQ(OB_SUCCESS, cold_cache.fill_cache_lines_(flashback_version, read_ahead_lsn, read_ahead_size, buf));
+  EXPECT_EQ(0, cold_cache.log_cache_stat_.hit_cnt_);
+  EXPECT_EQ(miss_cnt, cold_cache.log_cache_stat_.miss_cnt_);
+  EXPECT_EQ(0, cold_cache.log_cache_stat_.cache_read_size_);
+
+  // the following reads hit the logs read ahead
+  const LSN read_ahead_end_lsn = read_ahead_lsn + read_ahead_size;
+  int64_t hit_cnt = 0;
+  for (; lsn + read_size <= read_ahead_end_lsn; lsn = lsn + read_size) {
+    int64_t out_read_size = 0;
+    EXPECT_EQ(OB_SUCCESS, cold_cache.get_cache_lines_(lsn, flashback_version, read_size, buf,
+                                                      out_read_size, &iterator_info));
+    EXPECT_EQ(read_size, out_read_size);
+    hit_cnt++;
+  }
+  EXPECT_LT(0, hit_cnt);
+  EXPECT_EQ(hit_cnt, cold_cache.log_cache_stat_.hit_cnt_);
+  EXPECT_EQ(hit_cnt * read_size, cold_cache.log_cache_stat_.cache_read_size_);
+  EXPECT_EQ(miss_cnt, cold_cache.log_cache_stat_.miss_cnt_);
+  EXPECT_EQ(hit_cnt, iterator_info.cold_cache_stat_.hit_cnt_);
+  EXPECT_EQ(hit_cnt * read_size, iterator_info.cold_cache_stat_.cache_read_size_);
+  EXPECT_EQ(miss_cnt, iterator_info.cold_cache_stat_.miss_cnt_);
+
+  // the read after the logs read ahead misses again
+  {
+    int64_t out_read_size = 0;
+    EXPECT_EQ(OB_ENTRY_NOT_EXIST, cold_cache.get_cache_lines_(lsn, flashback_version, read_size, buf,
+                                                              out_read_size, &iterator_info));
+    LSN miss_lsn = lsn;
+    int64_t in_read_size = read_size;
+    EXPECT_EQ(OB_SUCCESS, cold_cache.deal_with_miss_(false, 0, MAX_LOG_BUFFER_SIZE, miss_lsn, in_read_size,
+                                                     out_read_size, &iterator_info));
+    miss_cnt++;
+    EXPECT_EQ(hit_cnt, cold_cache.log_cache_stat_.hit_cnt_);
+    EXPECT_EQ(miss_cnt, cold_cache.log_cache_stat_.miss_cnt_);
+  }
+
+  ob_free(buf);
+  buf = NULL;
+}
+
+TEST_F(TestLogCache, test_read_ahead_task_limit)
+{
+  PALF_LOG(INFO, "begin read ahead task limit");
+  log_storage.is_inited_ = true;
+  log_storage.logical_block_size_ = PALF_BLOCK_SIZE;
+  const int64_t flashback_version = 0;
+  const int64_t palf_id = 3;
+  LogColdCache cold_cache;
+  cold_cache.init(palf_id, palf_env_impl, &log_storage);
+  const LSN read_ahead_lsn(0);
+  const int64_t read_ahead_size = LogReadAheadTracker::MIN_READ_AHEAD_SIZE;
+  // the task isn't submitted when too many tasks are in flight
+  cold_cache.read_ahead_task_cnt_ = LogColdCache::MAX_READ_AHEAD_TASK_CNT;
+  EXPECT_EQ(OB_EAGAIN, cold_cache.submit_read_ahead_task_(flashback_version, read_ahead_lsn, read_ahead_size));
+  EXPECT_EQ(LogColdCache::MAX_READ_AHEAD_TASK_CNT, cold_cache.read_ahead_task_cnt_);
+  // the task in flight is finished even if it fails
+  EXPECT_EQ(OB_INVALID_ARGUMENT, cold_cache.read_ahead(flashback_version, read_ahead_lsn, 0));
+  EXPECT_EQ(LogColdCache::MAX_READ_AHEAD_TASK_CNT - 1, cold_cache.read_ahead_task_cnt_);
+}
+
 } // end namespace unittest
 } // end namespace oceanbase
 
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "logservice/ob_log_compression.h"
+#undef private
+#include "logservice/ob_log_base_header.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "lib/random/ob_random.h"
+#include "share/allocator/ob_tenant_mutil_allocator.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace logservice;
+
+static const int64_t LOG_BUF_LEN = 16 * 1024;
+
+class TestLogCompression : public ::testing::Test
+{
+public:
+  TestLogCompression() : allocator_(1001) {}
+  virtual void SetUp() override
+  {
+    ASSERT_EQ(OB_SUCCESS, wrapper_.init(1, &allocator_));
+    // do not refresh from the tenant config
+    wrapper_.last_refresh_ts_ = INT64_MAX / 2;
+  }
+  virtual void TearDown() override
+  {
+    wrapper_.reset();
+  }
+protected:
+  void enable(const ObCompressorType type)
+  {
+    ObCompressor *compressor = NULL;
+    ASSERT_EQ(OB_SUCCESS, ObCompressorPool::get_instance().get_compressor(type, compressor));
+    wrapper_.compressor_ = compressor;
+    wrapper_.is_enabled_ = true;
+  }
+  // ObLogBaseHeader followed by payload_len bytes of payload
+  int64_t fill_log(const ObReplayBarrierType barrier, const int64_t payload_len, const bool random)
+  {
+    ObLogBaseHeader header(TRANS_SERVICE_LOG_BASE_TYPE, barrier);
+    int64_t pos = 0;
+    EXPECT_EQ(OB_SUCCESS, header.serialize(log_buf_, LOG_BUF_LEN, pos));
+    for (int64_t i = 0; i < payload_len; ++i) {
+      log_buf_[pos + i] = random ? static_cast<char>(ObRandom::rand(0, 255)) : "abcdefgh"[i % 7];
+    }
+    return pos + payload_len;
+  }
+  void check_passthrough(const int64_t nbytes)
+  {
+    void *compression_buf = NULL;
+    bool log_compressed = true;
+    const void *final_buf = NULL;
+    int64_t final_nbytes = 0;
+    ASSERT_EQ(OB_SUCCESS, wrapper_.compress_payload(log_buf_, nbytes, compression_buf,
+                                                    log_compressed, final_buf, final_nbytes));
+    ASSERT_FALSE(log_compressed);
+    ASSERT_EQ(NULL, compression_buf);
+    ASSERT_EQ(log_buf_, final_buf);
+    ASSERT_EQ(nbytes, final_nbytes);
+  }
+  void check_round_trip(const int64_t nbytes)
+  {
+    void *compression_buf = NULL;
+    bool log_compressed = false;
+    const void *final_buf = NULL;
+    int64_t final_nbytes = 0;
+    ObLogBaseHeader header;
+    int64_t header_len = 0;
+    int64_t decompressed_len = 0;
+    ASSERT_EQ(OB_SUCCESS, wrapper_.compress_payload(log_buf_, nbytes, compression_buf,
+                                                    log_compressed, final_buf, final_nbytes));
+    ASSERT_TRUE(log_compressed);
+    ASSERT_EQ(compression_buf, final_buf);
+    ASSERT_LT(final_nbytes, nbytes);
+    // the base header is kept readable, only the payload is compressed
+    const char *buf = static_cast<const char *>(final_buf);
+    ASSERT_EQ(OB_SUCCESS, header.deserialize(buf, final_nbytes, header_len));
+    ASSERT_TRUE(header.is_compressed());
+    ASSERT_EQ(TRANS_SERVICE_LOG_BASE_TYPE, header.get_log_type());
+    ASSERT_EQ(OB_SUCCESS, decompress(buf + header_len, final_nbytes - header_len, out_buf_,
+                                     LOG_BUF_LEN, decompressed_len));
+    ASSERT_EQ(nbytes - header_len, decompressed_len);
+    ASSERT_EQ(0, MEMCMP(log_buf_ + header_len, out_buf_, decompressed_len));
+    // the output buffer must hold the original payload
+    ASSERT_EQ(OB_BUF_NOT_ENOUGH, decompress(buf + header_len, final_nbytes - header_len, out_buf_,
+                                            decompressed_len - 1, decompressed_len));
+    wrapper_.free_compression_buf(compression_buf);
+    ASSERT_EQ(NULL, compression_buf);
+  }
+protected:
+  ObTenantMutilAllocator allocator_;
+  ObLogCompressorWrapper wrapper_;
+  char log_buf_[LOG_BUF_LEN];
+  char out_buf_[LOG_BUF_LEN];
+};
+
+TEST_F(TestLogCompression, round_trip)
+{
+  const ObCompressorType types[] = {LZ4_COMPRESSOR, ZSTD_COMPRESSOR, ZSTD_1_3_8_COMPRESSOR};
+  for (int64_t i = 0; i < ARRAYSIZEOF(types); ++i) {
+    enable(types[i]);
+    check_round_trip(fill_log(NO_NEED_BARRIER, 4096, false));
+    check_round_trip(fill_log(STRICT_BARRIER, LOG_BUF_LEN / 2, false));
+    check_round_trip(fill_log(NO_NEED_BARRIER, ObLogCompressorWrapper::MIN_COMPRESS_PAYLOAD_LEN + 1, false));
+  }
+}
+
+TEST_F(TestLogCompression, passthrough)
+{
+  // not enabled
+  check_passthrough(fill_log(NO_NEED_BARRIER, 4096, false));
+  enable(LZ4_COMPRESSOR);
+  // too short to compress
+  check_passthrough(fill_log(NO_NEED_BARRIER, ObLogCompressorWrapper::MIN_COMPRESS_PAYLOAD_LEN, false));
+  // replay reads the barrier log before decompression
+  check_passthrough(fill_log(PRE_BARRIER, 4096, false));
+  // not shorter after compression
+  check_passthrough(fill_log(NO_NEED_BARRIER, 4096, true));
+
+  // already compressed
+  void *compression_buf = NULL;
+  bool log_compressed = false;
+  const void *final_buf = NULL;
+  int64_t final_nbytes = 0;
+  const int64_t nbytes = fill_log(NO_NEED_BARRIER, 4096, false);
+  ASSERT_EQ(OB_SUCCESS, wrapper_.compress_payload(log_buf_, nbytes, compression_buf,
+                                                  log_compressed, final_buf, final_nbytes));
+  ASSERT_TRUE(log_compressed);
+  MEMCPY(log_buf_, final_buf, final_nbytes);
+  wrapper_.free_compression_buf(compression_buf);
+  check_passthrough(final_nbytes);
+
+  // not inited
+  wrapper_.reset();
+  check_passthrough(fill_log(NO_NEED_BARRIER, 4096, false));
+}
+
+TEST_F(TestLogCompression, decompress_invalid)
+{
+  int64_t decompressed_len = 0;
+  int64_t header_len = 0;
+  ObLogBaseHeader header;
+  const int64_t nbytes = fill_log(NO_NEED_BARRIER, 4096, false);
+  ASSERT_EQ(OB_SUCCESS, header.deserialize(log_buf_, nbytes, header_len));
+  // the payload without LogCompressedPayloadHeader
+  ASSERT_EQ(OB_INVALID_DATA, decompress(log_buf_ + header_len, nbytes - header_len, out_buf_,
+                                        LOG_BUF_LEN, decompressed_len));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, decompress(NULL, nbytes, out_buf_, LOG_BUF_LEN, decompressed_len));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, decompress(log_buf_, nbytes, NULL, LOG_BUF_LEN, decompressed_len));
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_log_compression.log*");
+  OB_LOGGER.set_file_name("test_log_compression.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
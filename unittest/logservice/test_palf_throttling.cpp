@@ -215,6 +215,7 @@ TEST_F(TestPalfThrottling, test_log_write_throttle)
   ASSERT_EQ(1, throttle.stat_.total_throttling_task_cnt_);
   ASSERT_EQ(0, throttle.stat_.total_skipped_task_cnt_);
   ASSERT_EQ(0, throttle.stat_.total_skipped_size_);
+  ASSERT_EQ(true, OB_INVALID_TIMESTAMP != throttle.next_throttling_ts_);
   throttle.after_append_log(1024);
   ASSERT_EQ(1024, throttle.appended_log_size_cur_round_);
 
@@ -259,7 +260,9 @@ TEST_F(TestPalfThrottling, test_log_write_throttle)
 
   PALF_LOG(INFO, "case 7: need throttling after all flush meta task handled", K(throttle));
   g_need_purging_throttling = false;
+  const int64_t prev_next_throttling_ts = throttle.next_throttling_ts_;
   throttle.throttling(1024, g_need_purging_throttling_func, &palf_env_impl);
+  ASSERT_EQ(true, throttle.next_throttling_ts_ > prev_next_throttling_ts);
   ASSERT_EQ(throttle_options, throttle.throttling_options_);
   ASSERT_EQ(true, throttle.decay_factor_ > 0.0);
   ASSERT_EQ(true, throttle.need_throttling_not_guarded_by_lock_(g_need_purging_throttling_func));
@@ -284,6 +287,7 @@ TEST_F(TestPalfThrottling, test_log_write_throttle)
   ASSERT_EQ(3, throttle.stat_.total_skipped_task_cnt_);
   ASSERT_EQ(3072, throttle.stat_.total_skipped_size_);
   ASSERT_EQ(true, OB_INVALID_TIMESTAMP != throttle.stat_.stop_ts_);
+  ASSERT_EQ(OB_INVALID_TIMESTAMP, throttle.next_throttling_ts_);
   throttle.after_append_log(1024);
   ASSERT_EQ(1024, throttle.appended_log_size_cur_round_);
   ASSERT_EQ(0, throttle.decay_factor_);
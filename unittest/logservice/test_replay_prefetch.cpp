@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "logservice/replayservice/ob_replay_status.h"
+#undef private
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace logservice;
+using namespace palf;
+
+static const int64_t PREFETCH_SIZE = 8 * (1LL << 20);
+
+class TestReplayPrefetch : public ::testing::Test
+{
+public:
+  virtual void SetUp() override
+  {
+    // do not refresh from the tenant config
+    task_.last_refresh_ts_ = INT64_MAX / 2;
+    task_.prefetch_size_ = PREFETCH_SIZE;
+  }
+protected:
+  // the prefetch round has read the logs before lsn
+  void set_prefetched(const int64_t lsn)
+  {
+    task_.prefetch_end_lsn_ = LSN(lsn);
+  }
+  void check_range(const int64_t next_to_submit_lsn,
+                   const int64_t end_lsn,
+                   const int64_t expected_begin,
+                   const int64_t expected_end)
+  {
+    LSN prefetch_lsn = task_.prefetch_end_lsn_;
+    LSN prefetch_end_lsn;
+    task_.get_prefetch_range_(LSN(next_to_submit_lsn), LSN(end_lsn), PREFETCH_SIZE,
+                              prefetch_lsn, prefetch_end_lsn);
+    ASSERT_EQ(LSN(expected_begin), prefetch_lsn);
+    ASSERT_EQ(LSN(expected_end), prefetch_end_lsn);
+  }
+protected:
+  ObReplayServicePrefetchTask task_;
+};
+
+TEST_F(TestReplayPrefetch, need_prefetch)
+{
+  const int64_t base = 100 * PREFETCH_SIZE;
+  ASSERT_FALSE(task_.need_prefetch(LSN()));
+  // nothing is prefetched
+  ASSERT_TRUE(task_.need_prefetch(LSN(base)));
+  ASSERT_EQ(LSN(base), task_.next_to_submit_lsn_);
+
+  // the window is full
+  set_prefetched(base + PREFETCH_SIZE);
+  ASSERT_FALSE(task_.need_prefetch(LSN(base)));
+  // the iterator consumes less than half of the window
+  ASSERT_FALSE(task_.need_prefetch(LSN(base + PREFETCH_SIZE / 2)));
+  // less than half of the window is left
+  ASSERT_TRUE(task_.need_prefetch(LSN(base + PREFETCH_SIZE / 2 + 1)));
+  // the iterator passes the prefetched logs
+  ASSERT_TRUE(task_.need_prefetch(LSN(base + 2 * PREFETCH_SIZE)));
+
+  // prefetch is turned off
+  task_.prefetch_size_ = 0;
+  set_prefetched(0);
+  ASSERT_FALSE(task_.need_prefetch(LSN(base)));
+}
+
+TEST_F(TestReplayPrefetch, prefetch_range)
+{
+  const int64_t base = 100 * PREFETCH_SIZE;
+  const int64_t end = base + 4 * PREFETCH_SIZE;
+  // the first round starts from the next log to submit
+  check_range(base, end, base, base + PREFETCH_SIZE);
+  // continue from the last prefetched log
+  set_prefetched(base + PREFETCH_SIZE / 2);
+  check_range(base + 1024, end, base + PREFETCH_SIZE / 2, base + 1024 + PREFETCH_SIZE);
+  // the window is limited by the committed end
+  check_range(base, base + PREFETCH_SIZE / 4 * 3, base + PREFETCH_SIZE / 2, base + PREFETCH_SIZE / 4 * 3);
+  // the iterator passes the prefetched logs
+  check_range(base + PREFETCH_SIZE, end, base + PREFETCH_SIZE, base + 2 * PREFETCH_SIZE);
+  // the iterator is reset backward, the cached logs in the window are kept
+  set_prefetched(base + PREFETCH_SIZE);
+  check_range(base + 1024, end, base + PREFETCH_SIZE, base + 1024 + PREFETCH_SIZE);
+  // the iterator is reset far backward, the window restarts
+  check_range(base - PREFETCH_SIZE, end, base - PREFETCH_SIZE, base);
+}
+
+TEST_F(TestReplayPrefetch, invalidate_on_truncate_and_flashback)
+{
+  const int64_t base = 100 * PREFETCH_SIZE;
+  set_prefetched(base + PREFETCH_SIZE);
+  // the logs after end lsn are truncated, the prefetched lsn is beyond it
+  check_range(base, base + PREFETCH_SIZE / 2, base, base + PREFETCH_SIZE / 2);
+  // the prefetched logs are not beyond the end lsn, the window is kept
+  check_range(base, base + PREFETCH_SIZE, base + PREFETCH_SIZE, base + PREFETCH_SIZE);
+
+  // the replay is disabled before flashback, which drops the window
+  set_prefetched(base + PREFETCH_SIZE);
+  ASSERT_FALSE(task_.need_prefetch(LSN(base)));
+  task_.reset();
+  ASSERT_FALSE(task_.prefetch_end_lsn_.is_valid());
+  ASSERT_FALSE(task_.next_to_submit_lsn_.is_valid());
+  ASSERT_EQ(NULL, task_.read_buf_);
+  ASSERT_TRUE(task_.need_prefetch(LSN(base)));
+  check_range(base, base + 4 * PREFETCH_SIZE, base, base + PREFETCH_SIZE);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_replay_prefetch.log*");
+  OB_LOGGER.set_file_name("test_replay_prefetch.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -686,6 +686,211 @@ TEST_F(TestKVCache, test_hold_size)
   ASSERT_TRUE(cache.store_size(tenant_id_) >= hold_size);
 }
 
+TEST(ObKVCacheFrequencySketch, normal)
+{
+  ObKVCacheFrequencySketch sketch;
+  ObMemAttr attr(OB_SERVER_TENANT_ID, "CACHE_ADMIT");
+  ASSERT_EQ(OB_INVALID_ARGUMENT, sketch.init(0, attr));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, sketch.init(1000, attr));
+  ASSERT_EQ(0, sketch.estimate(1));
+  ASSERT_EQ(OB_SUCCESS, sketch.init(16, attr));
+  ASSERT_EQ(OB_INIT_TWICE, sketch.init(16, attr));
+
+  const uint64_t hot_hash = 0x9ae16a3b2f90404fUL;
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_FALSE(sketch.increment(hot_hash));
+  }
+  ASSERT_GE(sketch.estimate(hot_hash), 3);
+  // counters saturate at 15
+  for (int64_t i = 0; i < 20; ++i) {
+    sketch.increment(hot_hash);
+  }
+  ASSERT_EQ(15, sketch.estimate(hot_hash));
+
+  // all counters are halved once sample_size increments are done
+  bool halved = false;
+  for (int64_t i = sketch.add_cnt_; !halved && i < sketch.sample_size_; ++i) {
+    halved = sketch.increment(i);
+  }
+  ASSERT_TRUE(halved);
+  ASSERT_LE(sketch.estimate(hot_hash), 7);
+  sketch.destroy();
+  ASSERT_EQ(0, sketch.estimate(hot_hash));
+}
+
+TEST(ObKVCacheTinyLFUAdmission, window_period)
+{
+  static const int64_t KV_SIZE = 1L << 20;
+  static const uint64_t HASH_BASE = 0x9e3779b97f4a7c15UL;
+  ObKVCacheTinyLFUAdmission admission;
+  ObMemAttr attr(OB_SERVER_TENANT_ID, "CACHE_ADMIT");
+  ASSERT_TRUE(admission.admit(HASH_BASE, KV_SIZE, 0));
+  ASSERT_EQ(OB_SUCCESS, admission.init(attr));
+
+  // the window of an empty cache instance is 2MB, the third new key is rejected
+  ASSERT_TRUE(admission.admit(1 * HASH_BASE, KV_SIZE, 0));
+  ASSERT_TRUE(admission.admit(2 * HASH_BASE, KV_SIZE, 0));
+  ASSERT_FALSE(admission.admit(3 * HASH_BASE, KV_SIZE, 0));
+  // the rejected key is admitted on its second put, without using the window
+  ASSERT_TRUE(admission.admit(3 * HASH_BASE, KV_SIZE, 0));
+  ASSERT_EQ(2 * KV_SIZE, admission.window_used_size_);
+
+  // the window is refilled once the puts add up to 200MB, i.e. 100 windows
+  const int64_t period_cnt = 100 * 2 - 4;
+  for (int64_t i = 1; i <= period_cnt; ++i) {
+    if (i < period_cnt) {
+      ASSERT_FALSE(admission.admit((100 + i) * HASH_BASE, KV_SIZE, 0));
+    } else {
+      ASSERT_TRUE(admission.admit((100 + i) * HASH_BASE, KV_SIZE, 0));
+    }
+  }
+  ASSERT_EQ(0, admission.period_put_size_);
+  ASSERT_EQ(KV_SIZE, admission.window_used_size_);
+
+  // the window and the period grow with the store size of the cache instance
+  const int64_t store_size = 1L << 30;
+  for (int64_t i = 1; i < 10; ++i) {
+    ASSERT_TRUE(admission.admit((1000 + i) * HASH_BASE, KV_SIZE, store_size));
+  }
+  admission.destroy();
+  ASSERT_TRUE(admission.admit(3 * HASH_BASE, KV_SIZE, 0));
+}
+
+class TestWashCallback : public ObIKVCacheWashCallback
+{
+public:
+  TestWashCallback() : wash_cnt_(0) {}
+  virtual void on_wash(const ObIKVCacheKey &key, const ObIKVCacheValue &value) override
+  {
+    UNUSEDx(key, value);
+    ++wash_cnt_;
+  }
+  int64_t wash_cnt_;
+};
+
+TEST(ObKVStoreMemBlock, on_wash)
+{
+  typedef TestKVCacheKey<16> TestKey;
+  typedef TestKVCacheValue<16> TestValue;
+  static const int64_t BUF_SIZE = 4096;
+  char buf[BUF_SIZE];
+  MEMSET(buf, 0xff, BUF_SIZE);
+  ObKVStoreMemBlock mem_block(buf, BUF_SIZE);
+  TestKey key;
+  TestValue value;
+  const int64_t align_kv_size = ObKVStoreMemBlock::get_align_size(key, value);
+  ObKVCachePair *kvpairs[3] = {NULL, NULL, NULL};
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(OB_SUCCESS, mem_block.alloc(key.size(), value.size(), align_kv_size, kvpairs[i]));
+    ASSERT_EQ(ObKVCachePair::ALLOCATED, kvpairs[i]->status_);
+  }
+  // the first kvpair is never constructed, the second one is not put into the map
+  for (int64_t i = 1; i < 3; ++i) {
+    ASSERT_EQ(OB_SUCCESS, key.deep_copy(reinterpret_cast<char *>(kvpairs[i]->key_), key.size(), kvpairs[i]->key_));
+    ASSERT_EQ(OB_SUCCESS, value.deep_copy(reinterpret_cast<char *>(kvpairs[i]->value_), value.size(), kvpairs[i]->value_));
+  }
+  kvpairs[1]->status_ = ObKVCachePair::STORED;
+  kvpairs[2]->status_ = ObKVCachePair::MAPPED;
+  TestWashCallback callback;
+  mem_block.on_wash(callback);
+  ASSERT_EQ(1, callback.wash_cnt_);
+}
+
+TEST(ObKVCacheAdmissionFactory, create_destroy)
+{
+  ObIKVCacheAdmission *admission = NULL;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObKVCacheAdmissionFactory::create(MAX_ADMISSION_POLICY, OB_SERVER_TENANT_ID, admission));
+  ASSERT_EQ(OB_SUCCESS, ObKVCacheAdmissionFactory::create(ADMIT_ALL, OB_SERVER_TENANT_ID, admission));
+  ASSERT_TRUE(NULL == admission);
+  ObKVCacheAdmissionFactory::destroy(admission);
+  ASSERT_EQ(OB_SUCCESS, ObKVCacheAdmissionFactory::create(TINY_LFU, OB_SERVER_TENANT_ID, admission));
+  ASSERT_TRUE(NULL != admission);
+  ASSERT_EQ(TINY_LFU, admission->get_policy());
+  ObKVCacheAdmissionFactory::destroy(admission);
+}
+
+TEST_F(TestKVCache, test_admission)
+{
+  static const int64_t K_SIZE = 16;
+  static const int64_t V_SIZE = 64 * 1024;
+  typedef TestKVCacheKey<K_SIZE> TestKey;
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+
+  ObKVCache<TestKey, TestValue> cache;
+  TestKey key;
+  TestValue value;
+  const TestValue *pvalue = NULL;
+  ObKVCacheHandle handle;
+  ASSERT_EQ(OB_NOT_INIT, cache.set_admission_policy(TINY_LFU));
+  ASSERT_EQ(OB_SUCCESS, cache.init("test"));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache.set_admission_policy(MAX_ADMISSION_POLICY));
+  ASSERT_EQ(OB_SUCCESS, cache.set_admission_policy(TINY_LFU));
+
+  // keys seen only once are admitted until the window segment is used up
+  static const int64_t KEY_CNT = 100;
+  key.tenant_id_ = tenant_id_;
+  for (int64_t i = 0; i < KEY_CNT; ++i) {
+    key.v_ = i;
+    ASSERT_EQ(OB_SUCCESS, cache.put(key, value));
+  }
+  ObKVCacheInstKey inst_key(cache.cache_id_, tenant_id_);
+  ObKVCacheInstHandle inst_handle;
+  ASSERT_EQ(OB_SUCCESS, ObKVGlobalCache::get_instance().insts_.get_cache_inst(inst_key, inst_handle));
+  ObKVCacheStatus &status = inst_handle.get_inst()->status_;
+  const int64_t admit_cnt = status.total_admit_cnt_.value();
+  ASSERT_LT(0, admit_cnt);
+  ASSERT_GT(KEY_CNT, admit_cnt);
+  ASSERT_EQ(KEY_CNT, admit_cnt + status.total_reject_cnt_.value());
+  key.v_ = 0;
+  ASSERT_EQ(OB_SUCCESS, cache.get(key, pvalue, handle));
+  key.v_ = KEY_CNT - 1;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(key, pvalue, handle));
+
+  // put_and_fetch still returns the rejected value
+  key.v_ = KEY_CNT;
+  value.v_ = 4321;
+  ASSERT_EQ(OB_SUCCESS, cache.put_and_fetch(key, value, pvalue, handle));
+  ASSERT_EQ(4321, pvalue->v_);
+  handle.reset();
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache.get(key, pvalue, handle));
+
+  // a rejected key is admitted once it is put again
+  key.v_ = KEY_CNT - 1;
+  ASSERT_EQ(OB_SUCCESS, cache.put(key, value));
+  ASSERT_EQ(OB_SUCCESS, cache.get(key, pvalue, handle));
+  handle.reset();
+
+  // admission is checked before alloc, so a rejected key takes no memory of the cache
+  key.v_ = 3 * KEY_CNT;
+  const int64_t store_size = cache.store_size(tenant_id_);
+  ASSERT_FALSE(cache.admit(tenant_id_, key, V_SIZE));
+  ASSERT_EQ(store_size, cache.store_size(tenant_id_));
+  // put_kvpair maps the kvpair allocated by the caller without checking admission again
+  ObKVCachePair *kvpair = NULL;
+  ObKVCacheInstHandle pair_inst_handle;
+  ASSERT_EQ(OB_SUCCESS, cache.alloc(tenant_id_, K_SIZE, V_SIZE, kvpair, handle, pair_inst_handle));
+  kvpair->key_ = new (kvpair->key_) TestKey;
+  kvpair->value_ = new (kvpair->value_) TestValue;
+  key.deep_copy(reinterpret_cast<char *>(kvpair->key_), key.size(), kvpair->key_);
+  value.deep_copy(reinterpret_cast<char *>(kvpair->value_), value.size(), kvpair->value_);
+  const int64_t admit_reject_cnt = status.total_admit_cnt_.value() + status.total_reject_cnt_.value();
+  ASSERT_EQ(OB_SUCCESS, cache.put_kvpair(pair_inst_handle, kvpair, handle));
+  ASSERT_EQ(admit_reject_cnt, status.total_admit_cnt_.value() + status.total_reject_cnt_.value());
+  handle.reset();
+  ASSERT_EQ(OB_SUCCESS, cache.get(key, pvalue, handle));
+  handle.reset();
+
+  // nothing is rejected after admission is turned off
+  const int64_t reject_cnt = status.total_reject_cnt_.value();
+  ASSERT_EQ(OB_SUCCESS, cache.set_admission_policy(ADMIT_ALL));
+  for (int64_t i = KEY_CNT + 1; i < 2 * KEY_CNT; ++i) {
+    key.v_ = i;
+    ASSERT_EQ(OB_SUCCESS, cache.put(key, value));
+  }
+  ASSERT_EQ(reject_cnt, status.total_reject_cnt_.value());
+  ASSERT_EQ(OB_SUCCESS, cache.get(key, pvalue, handle));
+}
+
 // TEST_F(TestKVCache, sync_wash_mbs)
 // {
 //   CHUNK_MGR.set_limit(512 * 1024 * 1024);
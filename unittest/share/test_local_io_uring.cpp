@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#define private public
+#include "share/ob_local_io_uring.h"
+#undef private
+#include "lib/utility/ob_test_util.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+static const char *FILE_NAME = "test_local_io_uring.data";
+static const int64_t IO_CNT = 16;
+static const int64_t IO_SIZE = 4096;
+
+class TestLocalIOUring : public ::testing::Test
+{
+public:
+  TestLocalIOUring() : fd_(-1) {}
+  virtual ~TestLocalIOUring() {}
+  virtual void SetUp()
+  {
+    fd_ = ::open(FILE_NAME, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd_, 0);
+  }
+  virtual void TearDown()
+  {
+    ::close(fd_);
+    ::unlink(FILE_NAME);
+  }
+  void write_and_read(ObLocalIOUring &ring, const bool use_fixed_file);
+protected:
+  int fd_;
+};
+
+void TestLocalIOUring::write_and_read(ObLocalIOUring &ring, const bool use_fixed_file)
+{
+  char write_buf[IO_CNT][IO_SIZE];
+  char read_buf[IO_CNT][IO_SIZE];
+  struct io_event events[IO_CNT];
+  struct timespec timeout = {1, 0};
+  struct iocb cb;
+  if (use_fixed_file) {
+    ASSERT_EQ(OB_SUCCESS, ring.register_file(fd_));
+    ASSERT_EQ(OB_SUCCESS, ring.register_file(fd_));
+  }
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    MEMSET(write_buf[i], 'a' + i, IO_SIZE);
+    ::io_prep_pwrite(&cb, fd_, write_buf[i], IO_SIZE, i * IO_SIZE);
+    cb.data = write_buf[i];
+    ASSERT_EQ(OB_SUCCESS, ring.submit(cb));
+  }
+  int64_t total_cnt = 0;
+  while (total_cnt < IO_CNT) {
+    int64_t complete_cnt = 0;
+    ASSERT_EQ(OB_SUCCESS, ring.reap(1, IO_CNT - total_cnt, events + total_cnt, &timeout, complete_cnt));
+    total_cnt += complete_cnt;
+  }
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    ASSERT_EQ(IO_SIZE, static_cast<int64_t>(events[i].res));
+  }
+
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    MEMSET(read_buf[i], 0, IO_SIZE);
+    ::io_prep_pread(&cb, fd_, read_buf[i], IO_SIZE, i * IO_SIZE);
+    cb.data = reinterpret_cast<void *>(i);
+    ASSERT_EQ(OB_SUCCESS, ring.submit(cb));
+  }
+  total_cnt = 0;
+  while (total_cnt < IO_CNT) {
+    int64_t complete_cnt = 0;
+    ASSERT_EQ(OB_SUCCESS, ring.reap(1, IO_CNT - total_cnt, events + total_cnt, &timeout, complete_cnt));
+    total_cnt += complete_cnt;
+  }
+  for (int64_t i = 0; i < IO_CNT; ++i) {
+    const int64_t idx = reinterpret_cast<int64_t>(events[i].data);
+    ASSERT_EQ(IO_SIZE, static_cast<int64_t>(events[i].res));
+    ASSERT_EQ(0, MEMCMP(write_buf[idx], read_buf[idx], IO_SIZE));
+  }
+}
+
+TEST_F(TestLocalIOUring, basic)
+{
+  if (!ObLocalIOUring::is_supported()) {
+    STORAGE_LOG(INFO, "io_uring is not supported, skip");
+  } else {
+    ObLocalIOUring ring;
+    ASSERT_EQ(OB_INVALID_ARGUMENT, ring.init(0, false));
+    ASSERT_EQ(OB_SUCCESS, ring.init(IO_CNT, false));
+    ASSERT_EQ(OB_INIT_TWICE, ring.init(IO_CNT, false));
+    write_and_read(ring, false);
+    ASSERT_EQ(IO_CNT * 2, ring.submit_cnt_);
+  }
+}
+
+TEST_F(TestLocalIOUring, fixed_file_and_sqpoll)
+{
+  if (!ObLocalIOUring::is_supported()) {
+    STORAGE_LOG(INFO, "io_uring is not supported, skip");
+  } else {
+    // falls back to the interrupt driven mode without privilege
+    ObLocalIOUring ring;
+    ASSERT_EQ(OB_SUCCESS, ring.init(IO_CNT, true));
+    write_and_read(ring, true);
+  }
+}
+
+TEST_F(TestLocalIOUring, register_file_fail_once)
+{
+  if (!ObLocalIOUring::is_supported()) {
+    STORAGE_LOG(INFO, "io_uring is not supported, skip");
+  } else {
+    ObLocalIOUring ring;
+    const int other_fd = ::dup(fd_);
+    ASSERT_GE(other_fd, 0);
+    ASSERT_EQ(OB_SUCCESS, ring.init(IO_CNT, false));
+    ASSERT_EQ(OB_SUCCESS, ring.register_file(fd_));
+    // the failure is only reported once, the device calls it on every submit
+    ASSERT_EQ(OB_ENTRY_EXIST, ring.register_file(other_fd));
+    ASSERT_TRUE(ring.register_failed_);
+    ASSERT_EQ(OB_SUCCESS, ring.register_file(other_fd));
+    ASSERT_EQ(fd_, ring.registered_fd_);
+    ::close(other_fd);
+  }
+}
+
+TEST_F(TestLocalIOUring, batch_flush)
+{
+  if (!ObLocalIOUring::is_supported()) {
+    STORAGE_LOG(INFO, "io_uring is not supported, skip");
+  } else {
+    ObLocalIOUring ring;
+    char read_buf[IO_CNT][IO_SIZE];
+    struct io_event events[IO_CNT];
+    struct timespec timeout = {1, 0};
+    struct iocb cb;
+    char write_buf[IO_SIZE * IO_CNT];
+    MEMSET(write_buf, 'x', sizeof(write_buf));
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(write_buf)), ::pwrite(fd_, write_buf, sizeof(write_buf), 0));
+    ASSERT_EQ(OB_SUCCESS, ring.init(IO_CNT, false));
+    // another thread is in the kernel, the sqes are only published
+    ring.flushing_ = true;
+    for (int64_t i = 0; i < IO_CNT; ++i) {
+      ::io_prep_pread(&cb, fd_, read_buf[i], IO_SIZE, i * IO_SIZE);
+      cb.data = reinterpret_cast<void *>(i);
+      ASSERT_EQ(OB_SUCCESS, ring.submit(cb));
+    }
+    ASSERT_EQ(0, ring.enter_cnt_);
+    ASSERT_EQ(IO_CNT, *ring.sq_tail_ - *ring.sq_head_);
+    // the ring is full
+    ASSERT_EQ(OB_EAGAIN, ring.submit(cb));
+    // all published sqes are submitted by one enter
+    ring.flushing_ = false;
+    ring.flush_();
+    ASSERT_EQ(1, ring.enter_cnt_);
+    ASSERT_EQ(*ring.sq_tail_, *ring.sq_head_);
+    int64_t total_cnt = 0;
+    while (total_cnt < IO_CNT) {
+      int64_t complete_cnt = 0;
+      ASSERT_EQ(OB_SUCCESS, ring.reap(1, IO_CNT - total_cnt, events + total_cnt, &timeout, complete_cnt));
+      total_cnt += complete_cnt;
+    }
+    for (int64_t i = 0; i < IO_CNT; ++i) {
+      ASSERT_EQ(IO_SIZE, static_cast<int64_t>(events[i].res));
+    }
+  }
+}
+
+TEST_F(TestLocalIOUring, reap_flushes_pending)
+{
+  if (!ObLocalIOUring::is_supported()) {
+    STORAGE_LOG(INFO, "io_uring is not supported, skip");
+  } else {
+    ObLocalIOUring ring;
+    char buf[IO_SIZE];
+    struct io_event events[1];
+    struct timespec timeout = {1, 0};
+    struct iocb cb;
+    int64_t complete_cnt = 0;
+    MEMSET(buf, 'y', IO_SIZE);
+    ASSERT_EQ(OB_SUCCESS, ring.init(IO_CNT, false));
+    // the sqe is left in the ring, as if the flush failed
+    ring.flushing_ = true;
+    ::io_prep_pwrite(&cb, fd_, buf, IO_SIZE, 0);
+    ASSERT_EQ(OB_SUCCESS, ring.submit(cb));
+    ring.flushing_ = false;
+    while (0 == complete_cnt) {
+      ASSERT_EQ(OB_SUCCESS, ring.reap(1, 1, events, &timeout, complete_cnt));
+    }
+    ASSERT_EQ(IO_SIZE, static_cast<int64_t>(events[0].res));
+  }
+}
+
+TEST_F(TestLocalIOUring, reap_timeout)
+{
+  if (!ObLocalIOUring::is_supported()) {
+    STORAGE_LOG(INFO, "io_uring is not supported, skip");
+  } else {
+    ObLocalIOUring ring;
+    struct io_event events[1];
+    struct timespec timeout = {0, 10 * 1000 * 1000};
+    int64_t complete_cnt = 0;
+    ASSERT_EQ(OB_SUCCESS, ring.init(IO_CNT, false));
+    ASSERT_EQ(OB_SUCCESS, ring.reap(1, 1, events, &timeout, complete_cnt));
+    ASSERT_EQ(0, complete_cnt);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_local_io_uring.log*");
+  OB_LOGGER.set_file_name("test_local_io_uring.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
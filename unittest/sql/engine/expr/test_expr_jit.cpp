@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/expr/ob_expr_jit.h"
+#undef private
+#include "sql/engine/expr/ob_expr_add.h"
+#include "sql/engine/expr/ob_expr_minus.h"
+#include "sql/engine/expr/ob_expr_case.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static const int64_t MAX_EXPR_CNT = 256;
+
+class TestExprJit : public ::testing::Test
+{
+public:
+  TestExprJit() : expr_cnt_(0) {}
+  virtual void SetUp() override { expr_cnt_ = 0; }
+protected:
+  ObExpr *leaf()
+  {
+    ObExpr *expr = &exprs_[expr_cnt_++];
+    expr->reset();
+    expr->type_ = T_REF_COLUMN;
+    expr->datum_meta_.type_ = ObIntType;
+    expr->vec_value_tc_ = VEC_TC_INTEGER;
+    return expr;
+  }
+  ObExpr *node(const ObItemType type, ObExpr *left, ObExpr *right)
+  {
+    ObExpr *expr = &exprs_[expr_cnt_++];
+    expr->reset();
+    expr->type_ = type;
+    expr->datum_meta_.type_ = ObIntType;
+    expr->vec_value_tc_ = VEC_TC_INTEGER;
+    expr->arg_cnt_ = 2;
+    expr->args_ = &args_[(expr_cnt_ - 1) * 3];
+    expr->args_[0] = left;
+    expr->args_[1] = right;
+    if (T_OP_MINUS == type) {
+      expr->eval_vector_func_ = ObExprMinus::minus_int_int_vector;
+    } else {
+      // the comparisons are fused by type, the other types are not fused
+      expr->eval_vector_func_ = ObExprAdd::add_int_int_vector;
+    }
+    return expr;
+  }
+  ObExpr *case_when(ObExpr *when, ObExpr *then, ObExpr *els)
+  {
+    ObExpr *expr = node(T_OP_CASE, when, then);
+    expr->arg_cnt_ = 3;
+    expr->args_[2] = els;
+    expr->eval_vector_func_ = ObExprCase::eval_case_vector;
+    return expr;
+  }
+  bool is_fusable(ObExpr *root, int64_t &node_cnt, int64_t &leaf_cnt)
+  {
+    ObSEArray<ObExpr *, 16> nodes;
+    ObSEArray<ObExpr *, 16> leaves;
+    bool fusable = true;
+    EXPECT_EQ(OB_SUCCESS, ObExprJit::collect_tree(*root, nodes, leaves, fusable));
+    node_cnt = nodes.count();
+    leaf_cnt = leaves.count();
+    return fusable;
+  }
+protected:
+  ObExpr exprs_[MAX_EXPR_CNT];
+  ObExpr *args_[MAX_EXPR_CNT * 3];
+  int64_t expr_cnt_;
+};
+
+TEST_F(TestExprJit, collect_tree)
+{
+  int64_t node_cnt = 0;
+  int64_t leaf_cnt = 0;
+  ObExpr *c1 = leaf();
+  ObExpr *c2 = leaf();
+  // (c1 + c2) - c1 > c2
+  ObExpr *add = node(T_OP_ADD, c1, c2);
+  ObExpr *root = node(T_OP_GT, node(T_OP_MINUS, add, c1), c2);
+  ASSERT_TRUE(is_fusable(root, node_cnt, leaf_cnt));
+  ASSERT_EQ(3, node_cnt);
+  ASSERT_EQ(2, leaf_cnt);
+  // shared sub expression: case when c1 + c2 > 0 then c1 + c2 else c2 end
+  ObExpr *c0 = leaf();
+  root = case_when(node(T_OP_GT, add, c0), add, c2);
+  ASSERT_TRUE(is_fusable(root, node_cnt, leaf_cnt));
+  ASSERT_EQ(3, node_cnt);
+  ASSERT_EQ(3, leaf_cnt);
+}
+
+TEST_F(TestExprJit, collect_mixed_tree)
+{
+  int64_t node_cnt = 0;
+  int64_t leaf_cnt = 0;
+  ObExpr *c1 = leaf();
+  ObExpr *c2 = leaf();
+  // c1 * c2 is neither a fusable node nor a leaf
+  ObExpr *mul = node(T_OP_MUL, c1, c2);
+  ASSERT_FALSE(ObExprJit::is_fusable_node(*mul));
+  ASSERT_FALSE(is_fusable(node(T_OP_ADD, c1, mul), node_cnt, leaf_cnt));
+  ASSERT_FALSE(is_fusable(node(T_OP_LT, node(T_OP_ADD, c1, c2), mul), node_cnt, leaf_cnt));
+  ASSERT_FALSE(is_fusable(case_when(node(T_OP_EQ, c1, c2), mul, c2), node_cnt, leaf_cnt));
+  // the leaf which is evaluated
+  ObExpr *func = leaf();
+  func->eval_func_ = reinterpret_cast<ObExpr::EvalFunc>(0x1);
+  ASSERT_FALSE(is_fusable(node(T_OP_ADD, c1, func), node_cnt, leaf_cnt));
+  // the add of the other types is evaluated by another function
+  ObExpr *add = node(T_OP_ADD, c1, c2);
+  add->eval_vector_func_ = ObExprMinus::minus_int_int_vector;
+  ASSERT_FALSE(is_fusable(node(T_OP_MINUS, add, c1), node_cnt, leaf_cnt));
+  // the comparison of non integer columns
+  ObExpr *str = leaf();
+  str->datum_meta_.type_ = ObVarcharType;
+  str->vec_value_tc_ = VEC_TC_STRING;
+  ASSERT_FALSE(is_fusable(node(T_OP_EQ, c1, str), node_cnt, leaf_cnt));
+}
+
+TEST_F(TestExprJit, collect_too_large_tree)
+{
+  int64_t node_cnt = 0;
+  int64_t leaf_cnt = 0;
+  // c0 + c1 + ... + c16
+  ObExpr *root = leaf();
+  for (int64_t i = 0; i < ObExprJit::MAX_LEAF_CNT; ++i) {
+    root = node(T_OP_ADD, root, leaf());
+  }
+  ASSERT_FALSE(is_fusable(root, node_cnt, leaf_cnt));
+  // c0 + c1 + c0 + c1 + ...
+  ObExpr *c0 = leaf();
+  ObExpr *c1 = leaf();
+  root = c0;
+  for (int64_t i = 0; i < ObExprJit::MAX_NODE_CNT; ++i) {
+    root = node(T_OP_ADD, root, 0 == i % 2 ? c1 : c0);
+  }
+  ASSERT_TRUE(is_fusable(root, node_cnt, leaf_cnt));
+  ASSERT_EQ(ObExprJit::MAX_NODE_CNT, node_cnt);
+  root = node(T_OP_ADD, root, c1);
+  ASSERT_FALSE(is_fusable(root, node_cnt, leaf_cnt));
+}
+
+TEST_F(TestExprJit, overflow)
+{
+  ObExpr *c1 = leaf();
+  ObExpr *c2 = leaf();
+  ObExpr *c3 = leaf();
+  // case when c1 - c2 < c3 then c1 + c3 else c2 end
+  ObExpr *root = case_when(node(T_OP_LT, node(T_OP_MINUS, c1, c2), c3), node(T_OP_ADD, c1, c3), c2);
+  ObSEArray<ObExpr *, 16> nodes;
+  ObSEArray<ObExpr *, 16> leaves;
+  bool fusable = true;
+  ASSERT_EQ(OB_SUCCESS, ObExprJit::collect_tree(*root, nodes, leaves, fusable));
+  ASSERT_TRUE(fusable);
+  ASSERT_EQ(c1, leaves.at(0));
+  ASSERT_EQ(c2, leaves.at(1));
+  ASSERT_EQ(c3, leaves.at(2));
+
+  ObExprJitCtx jit_ctx(OB_SYS_TENANT_ID);
+  ASSERT_EQ(OB_SUCCESS, jit_ctx.init());
+  ASSERT_EQ(OB_SUCCESS, ObExprJit::generate_function(jit_ctx.helper_, ObString("expr_jit_0"),
+                                                     *root, leaves));
+  ASSERT_EQ(OB_SUCCESS, jit_ctx.helper_.verify_module());
+  ASSERT_EQ(OB_SUCCESS, jit_ctx.helper_.compile_module(static_cast<jit::ObPLOptLevel>(2)));
+  ObExprJitFunc func = reinterpret_cast<ObExprJitFunc>(
+    jit_ctx.helper_.get_function_address(ObString("expr_jit_0")));
+  ASSERT_TRUE(NULL != func);
+
+  const int64_t row_cnt = 4;
+  int64_t v1[row_cnt] = {1, 10, -5, INT64_MAX};
+  int64_t v2[row_cnt] = {2, 3, 7, 0};
+  int64_t v3 = 5;
+  int64_t res[row_cnt] = {0};
+  const int64_t *inputs[] = {v1, v2, &v3};
+  // c3 is a constant
+  int64_t masks[] = {-1, -1, 0};
+  ASSERT_EQ(0, func(0, row_cnt - 1, inputs, masks, res));
+  ASSERT_EQ(6, res[0]);
+  ASSERT_EQ(3, res[1]);
+  ASSERT_EQ(0, res[2]);
+  // c1 + c3 overflows, the batch is computed by the interpreter
+  ASSERT_NE(0, func(0, row_cnt, inputs, masks, res));
+  ASSERT_NE(0, func(row_cnt - 1, row_cnt, inputs, masks, res));
+  // c1 - c2 overflows although c2 is picked by the case
+  v1[0] = INT64_MIN;
+  v2[0] = 1;
+  v3 = 0;
+  ASSERT_NE(0, func(0, 1, inputs, masks, res));
+  ASSERT_EQ(0, func(1, row_cnt - 1, inputs, masks, res));
+  ASSERT_EQ(3, res[1]);
+  ASSERT_EQ(-5, res[2]);
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_expr_jit.log*");
+  OB_LOGGER.set_file_name("test_expr_jit.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  oceanbase::jit::ObLLVMHelper::initialize();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
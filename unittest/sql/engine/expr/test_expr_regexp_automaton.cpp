@@ -0,0 +1,474 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <random>
+#include <string>
+#include <vector>
+#include <icu/i18n/unicode/uregex.h>
+#define private public
+#include "sql/engine/expr/ob_expr_regexp_automaton.h"
+#undef private
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+typedef std::vector<uint32_t> CodePoints;
+
+// Decodes %str into code points, every byte of the ill-formed sequences becomes '?' as the
+// charset conversion before ICU does.
+static void decode_utf8(const std::string &str, CodePoints &cps)
+{
+  const unsigned char *s = reinterpret_cast<const unsigned char *>(str.data());
+  const int64_t len = str.length();
+  int64_t pos = 0;
+  cps.clear();
+  while (pos < len) {
+    const uint32_t c = s[pos];
+    int64_t n = 0;
+    uint32_t cp = '?';
+    uint32_t min = 0;
+    if (c < 0x80) {
+      n = 1;
+      cp = c;
+    } else if (c >= 0xC2 && c < 0xE0) {
+      n = 2;
+      cp = c & 0x1F;
+      min = 0x80;
+    } else if (c >= 0xE0 && c < 0xF0) {
+      n = 3;
+      cp = c & 0x0F;
+      min = 0x800;
+    } else if (c >= 0xF0 && c <= 0xF4) {
+      n = 4;
+      cp = c & 0x07;
+      min = 0x10000;
+    }
+    for (int64_t i = 1; n > 0 && i < n; ++i) {
+      if (pos + i >= len || 0x80 != (s[pos + i] & 0xC0)) {
+        n = 0;
+      } else {
+        cp = (cp << 6) | (s[pos + i] & 0x3F);
+      }
+    }
+    if (0 == n || cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+      cps.push_back('?');
+      pos += 1;
+    } else {
+      cps.push_back(cp);
+      pos += n;
+    }
+  }
+}
+
+// Encodes %cps in utf8, or in utf16 big endian as the utf16 collations do. The surrogates are
+// encoded as they are, which makes the ill-formed texts.
+static void encode(const CodePoints &cps, const bool is_utf16, std::string &out)
+{
+  out.clear();
+  for (int64_t i = 0; i < static_cast<int64_t>(cps.size()); ++i) {
+    const uint32_t cp = cps[i];
+    if (is_utf16) {
+      if (cp < 0x10000) {
+        out.push_back(static_cast<char>(cp >> 8));
+        out.push_back(static_cast<char>(cp & 0xFF));
+      } else {
+        const uint32_t high = 0xD800 + ((cp - 0x10000) >> 10);
+        const uint32_t low = 0xDC00 + ((cp - 0x10000) & 0x3FF);
+        out.push_back(static_cast<char>(high >> 8));
+        out.push_back(static_cast<char>(high & 0xFF));
+        out.push_back(static_cast<char>(low >> 8));
+        out.push_back(static_cast<char>(low & 0xFF));
+      }
+    } else if (cp < 0x80) {
+      out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+      out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+      out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+      out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+      out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+  }
+}
+
+static std::string to_hex(const std::string &str)
+{
+  static const char *digits = "0123456789abcdef";
+  std::string res;
+  for (int64_t i = 0; i < static_cast<int64_t>(str.length()); ++i) {
+    const unsigned char c = static_cast<unsigned char>(str[i]);
+    res.push_back(digits[c >> 4]);
+    res.push_back(digits[c & 0xF]);
+  }
+  return res;
+}
+
+// Matches the texts by the automaton and by ICU as REGEXP_LIKE does. The result of the
+// automaton must be the same as ICU whenever it is done, and the prefilter must not reject any
+// text matched by ICU.
+class TestExprRegexpAutomaton : public ::testing::Test
+{
+public:
+  TestExprRegexpAutomaton() : flags_(0), done_cnt_(0), not_done_cnt_(0), last_done_(false) {}
+  virtual void SetUp() override
+  {
+    done_cnt_ = 0;
+    not_done_cnt_ = 0;
+  }
+  virtual void TearDown() override { automaton_.destroy(); }
+protected:
+  bool init(const char *pattern, const uint32_t flags)
+  {
+    bool is_supported = false;
+    CodePoints cps;
+    decode_utf8(pattern, cps);
+    encode(cps, true, pattern16_);
+    flags_ = flags;
+    desc_ = std::string("pattern: ") + pattern + ", flags: " + std::to_string(flags);
+    automaton_.destroy();
+    EXPECT_EQ(OB_SUCCESS, automaton_.init(ObString(pattern16_.length(), pattern16_.data()),
+                                          flags, is_supported)) << desc_;
+    return is_supported;
+  }
+  // the same as ObExprRegexContext::get_valid_unicode_string, with a terminating 0
+  static void to_uchars(const std::string &str16, std::vector<UChar> &u_str)
+  {
+    u_str.assign(str16.length() / sizeof(UChar) + 1, 0);
+    MEMCPY(u_str.data(), str16.data(), str16.length());
+    for (int64_t i = 0; i < static_cast<int64_t>(str16.length() / sizeof(UChar)); ++i) {
+      u_str[i] = htons(static_cast<uint16_t>(u_str[i]));
+    }
+  }
+  bool icu_match(const std::string &text16)
+  {
+    bool result = false;
+    std::vector<UChar> u_pattern;
+    std::vector<UChar> u_text;
+    UParseError parse_error;
+    UErrorCode code = U_ZERO_ERROR;
+    to_uchars(pattern16_, u_pattern);
+    to_uchars(text16, u_text);
+    URegularExpression *regex = uregex_open(u_pattern.data(),
+                                            static_cast<int32_t>(u_pattern.size() - 1),
+                                            flags_, &parse_error, &code);
+    EXPECT_TRUE(U_SUCCESS(code)) << desc_ << ", error: " << u_errorName(code);
+    if (U_SUCCESS(code)) {
+      uregex_setText(regex, u_text.data(), static_cast<int32_t>(u_text.size() - 1), &code);
+      result = uregex_find(regex, 0, &code);
+      EXPECT_TRUE(U_SUCCESS(code)) << desc_ << ", error: " << u_errorName(code);
+    }
+    if (NULL != regex) {
+      uregex_close(regex);
+    }
+    return result;
+  }
+  void check_match(const std::string &text, const ObCollationType cs_type, const bool expected)
+  {
+    bool result = false;
+    const ObString str(text.length(), text.data());
+    last_done_ = false;
+    ASSERT_EQ(OB_SUCCESS, automaton_.match(str, cs_type, result, last_done_)) << desc_;
+    if (last_done_) {
+      ++done_cnt_;
+      ASSERT_EQ(expected, result) << desc_ << ", text: " << to_hex(text) << ", cs_type: " << cs_type;
+    } else {
+      ++not_done_cnt_;
+    }
+    if (expected) {
+      ASSERT_TRUE(automaton_.may_match(str, cs_type))
+          << desc_ << ", text: " << to_hex(text) << ", cs_type: " << cs_type;
+    }
+  }
+  // %text16 is what ICU sees for both %text8 and %text16
+  void check(const std::string &text8, const std::string &text16)
+  {
+    const bool expected = icu_match(text16);
+    check_match(text8, CS_TYPE_UTF8MB4_BIN, expected);
+    check_match(text16, CS_TYPE_UTF16_BIN, expected);
+  }
+  void check(const CodePoints &cps)
+  {
+    std::string text8;
+    std::string text16;
+    encode(cps, false, text8);
+    encode(cps, true, text16);
+    check(text8, text16);
+  }
+  void check(const char *text)
+  {
+    CodePoints cps;
+    decode_utf8(text, cps);
+    check(cps);
+  }
+protected:
+  ObExprRegexAutomaton automaton_;
+  std::string pattern16_;
+  uint32_t flags_;
+  std::string desc_;
+  int64_t done_cnt_;
+  int64_t not_done_cnt_;
+  bool last_done_;
+};
+
+TEST_F(TestExprRegexpAutomaton, anchors_and_line_terminators)
+{
+  const char *patterns[] = {"^ab", "ab$", "^ab$", "^a.*b$", "a.$", "\\r$", "a\\r$", "b\\n$",
+                            "^$", "^", "$", "^a*", "a.b", "a[^x]b"};
+  const char *texts[] = {"", "ab", "xab", "abx", "ab\n", "ab\r", "ab\r\n", "ab\n\n", "ab\n\r",
+                         "a\r\n", "a\r", "ab\xc2\x85", "ab\xe2\x80\xa8", "ab\xe2\x80\xa9", "\n",
+                         "\r\n", "a\nb", "a\rb", "a\xe2\x80\xa8" "b", "a\xc2\x85" "b", "b\n",
+                         "xa\nb\n", "ab\x0b", "ab\x0c"};
+  const uint32_t flags[] = {0, UREGEX_DOTALL, UREGEX_UNIX_LINES, UREGEX_DOTALL | UREGEX_UNIX_LINES};
+  for (int64_t i = 0; i < ARRAYSIZEOF(patterns); ++i) {
+    for (int64_t j = 0; j < ARRAYSIZEOF(flags); ++j) {
+      ASSERT_TRUE(init(patterns[i], flags[j])) << desc_;
+      for (int64_t k = 0; k < ARRAYSIZEOF(texts); ++k) {
+        check(texts[k]);
+      }
+    }
+  }
+  // the valid texts are always matched by the automaton
+  ASSERT_EQ(0, not_done_cnt_);
+  // '^' and '$' match at the line terminators in the multiline mode, which is left to ICU
+  ASSERT_FALSE(init("^ab", UREGEX_MULTILINE));
+  ASSERT_FALSE(init("ab$", UREGEX_MULTILINE));
+  ASSERT_FALSE(init("a$b", 0));
+  ASSERT_FALSE(init("^ab|cd", 0));
+  ASSERT_TRUE(init("a.b", UREGEX_MULTILINE));
+  check("a\nb");
+  check("axb");
+}
+
+TEST_F(TestExprRegexpAutomaton, case_folding)
+{
+  const char *patterns[] = {"abc", "[a-c]x", "a\\d", "A.c", "\\w+z", "12", "(?:ab|CD)+e", "^k$",
+                            "s{2}"};
+  const char *texts[] = {"ABC", "aBc", "xAbCx", "a1", "A1", "bX", "CX", "azZ", "abCDe", "12",
+                         "k", "K", "ss", "sS"};
+  const char *non_ascii_texts[] = {"\xc3\x80" "BC", "abc\xc5\xbf", "\xe2\x84\xaa", "\xc3\x9f"};
+  const uint32_t flags[] = {0, UREGEX_CASE_INSENSITIVE};
+  for (int64_t i = 0; i < ARRAYSIZEOF(patterns); ++i) {
+    for (int64_t j = 0; j < ARRAYSIZEOF(flags); ++j) {
+      ASSERT_TRUE(init(patterns[i], flags[j])) << desc_;
+      for (int64_t k = 0; k < ARRAYSIZEOF(texts); ++k) {
+        check(texts[k]);
+      }
+      for (int64_t k = 0; k < ARRAYSIZEOF(non_ascii_texts); ++k) {
+        check(non_ascii_texts[k]);
+      }
+    }
+  }
+  // the kelvin sign matches 'k' and the sharp s matches 'ss' by the full case folding of ICU
+  ASSERT_TRUE(init("^k$", UREGEX_CASE_INSENSITIVE));
+  check("\xe2\x84\xaa");
+  ASSERT_FALSE(last_done_);
+  ASSERT_TRUE(init("s{2}", UREGEX_CASE_INSENSITIVE));
+  check("\xc3\x9f");
+  ASSERT_FALSE(last_done_);
+  // the non-ascii pattern and the negated class are not folded by the automaton
+  ASSERT_FALSE(init("\xc3\xa9", UREGEX_CASE_INSENSITIVE));
+  ASSERT_FALSE(init("[^a]", UREGEX_CASE_INSENSITIVE));
+}
+
+TEST_F(TestExprRegexpAutomaton, utf16_odd_offset)
+{
+  // the bytes of 'ab' in utf16 are at the offset 1 of U+4100 U+6100 U+6241
+  ASSERT_TRUE(init("ab", 0));
+  CodePoints cps = {0x4100, 0x6100, 0x6241};
+  std::string text16;
+  encode(cps, true, text16);
+  ASSERT_FALSE(automaton_.may_match(ObString(text16.length(), text16.data()), CS_TYPE_UTF16_BIN));
+  check(cps);
+  ASSERT_TRUE(last_done_);
+  cps.push_back('a');
+  cps.push_back('b');
+  check(cps);
+  ASSERT_TRUE(last_done_);
+  // the same for a supplementary character, 'x' U+1D11E is 0078 D834 DD1E in utf16, which is at
+  // the offset 1 of U+4100 U+78D8 U+34DD U+1E00
+  ASSERT_TRUE(init("x\xf0\x9d\x84\x9e", 0));
+  cps = {0x0078, 0x1D11E};
+  check(cps);
+  ASSERT_TRUE(last_done_);
+  cps = {0x4100, 0x78D8, 0x34DD, 0x1E00};
+  encode(cps, true, text16);
+  ASSERT_FALSE(automaton_.may_match(ObString(text16.length(), text16.data()), CS_TYPE_UTF16_BIN));
+  check(cps);
+  cps = {0x0078, 0x1D11E, 0x4100, 0x78D8, 0x34DD, 0x1E00};
+  check(cps);
+  cps = {0x4100, 0x78D8, 0x34DD, 0x1E00, 0x0078, 0x1D11E};
+  check(cps);
+  ASSERT_TRUE(last_done_);
+  ASSERT_EQ(0, not_done_cnt_);
+}
+
+TEST_F(TestExprRegexpAutomaton, ill_formed)
+{
+  const char *patterns[] = {"ab", "a.b", "x\\?", "^a", "b$", "a[^b]", "a.*"};
+  // truncated, overlong, surrogate and out of range sequences
+  const char *texts8[] = {"ab\xff", "\xff" "ab", "a\xff" "b", "a\xc0\x80" "b", "a\xed\xa0\x80" "b",
+                          "a\xf4\x90\x80\x80" "b", "a\xe2\x82", "x\xff", "\x80", "b\xc3"};
+  // lone surrogates, which ICU matches as code points
+  const CodePoints texts16[] = {{'a', 0xD800, 'b'}, {'a', 0xDC00, 'b'}, {'a', 'b', 0xD800},
+                                {0xDBFF, 'a', 'b'}, {'x', 0xDFFF}, {'a', 0xDBFF, 0xDBFF, 'b'}};
+  for (int64_t i = 0; i < ARRAYSIZEOF(patterns); ++i) {
+    ASSERT_TRUE(init(patterns[i], 0)) << desc_;
+    for (int64_t k = 0; k < ARRAYSIZEOF(texts8); ++k) {
+      CodePoints cps;
+      std::string text16;
+      decode_utf8(texts8[k], cps);
+      encode(cps, true, text16);
+      check(texts8[k], text16);
+    }
+    for (int64_t k = 0; k < ARRAYSIZEOF(texts16); ++k) {
+      check(texts16[k]);
+    }
+  }
+  ASSERT_GT(not_done_cnt_, 0);
+  // the ill-formed character is left to ICU unless the result is known before it
+  ASSERT_TRUE(init("a.b", 0));
+  check(CodePoints({'a', 0xD800, 'b'}));
+  ASSERT_FALSE(last_done_);
+  ASSERT_TRUE(init("ab", 0));
+  check("ab\xff");
+  ASSERT_TRUE(last_done_);
+  // '?' may come from the conversion of the ill-formed characters, so it is never prefiltered
+  ASSERT_TRUE(init("x\\?", 0));
+  ASSERT_TRUE(automaton_.literal_utf8_.empty());
+  ASSERT_TRUE(automaton_.may_match(ObString("x\xff"), CS_TYPE_UTF8MB4_BIN));
+}
+
+TEST_F(TestExprRegexpAutomaton, dfa_cache_reset)
+{
+  // the DFA remembers the positions of 'a' in the last 10 characters, which needs up to 1024
+  // states, so the cache is dropped many times on a random text.
+  std::mt19937 rng(1);
+  const int64_t TEXT_LEN = 8192;
+  ASSERT_TRUE(init("a[ab]{9}c", 0));
+  std::string text;
+  for (int64_t i = 0; i < TEXT_LEN; ++i) {
+    text.push_back(0 == rng() % 2 ? 'a' : 'b');
+  }
+  check(text.c_str());
+  ASSERT_TRUE(last_done_);
+  text.push_back('c');
+  check(text.c_str());
+  ASSERT_TRUE(last_done_);
+  ASSERT_LE(automaton_.dfa_state_cnt_, ObExprRegexAutomaton::MAX_DFA_STATE_CNT);
+  ASSERT_LE(automaton_.dfa_pool_size_, automaton_.dfa_pool_cap_);
+  // the automaton is still right after the cache is dropped
+  const char *texts[] = {"aababababbc", "abababababc", "bbbbbbbbbbc", "aaaaaaaaaac", "aaaaaaaaac"};
+  for (int64_t i = 0; i < ARRAYSIZEOF(texts); ++i) {
+    check(texts[i]);
+  }
+  ASSERT_EQ(0, not_done_cnt_);
+}
+
+TEST_F(TestExprRegexpAutomaton, random)
+{
+  std::mt19937 rng(1);
+  const char *atoms[] = {"a", "b", "c", ".", "[ab]", "[^a]", "[a-c]", "\\n", "\\r", "\\d", "\\s",
+                         "\xc3\xa9", "\xf0\x9d\x84\x9e", "(a|bc)", "(?:ab|\\n)"};
+  const char *quantifiers[] = {"", "", "", "*", "+", "?", "{2}", "{1,3}", "*?", "{0,2}"};
+  const char *chars[] = {"a", "b", "c", "A", "1", " ", "\n", "\r", "\xc3\xa9", "\xc2\x85",
+                         "\xe2\x80\xa8", "\xf0\x9d\x84\x9e"};
+  const uint32_t flags[] = {0, UREGEX_CASE_INSENSITIVE, UREGEX_DOTALL, UREGEX_UNIX_LINES,
+                            UREGEX_MULTILINE, UREGEX_CASE_INSENSITIVE | UREGEX_DOTALL};
+  const int64_t PATTERN_CNT = 1000;
+  const int64_t TEXT_CNT = 30;
+  int64_t supported_cnt = 0;
+  for (int64_t i = 0; i < PATTERN_CNT; ++i) {
+    std::string pattern;
+    if (0 == rng() % 4) {
+      pattern.append("^");
+    }
+    const int64_t piece_cnt = 1 + rng() % 4;
+    for (int64_t j = 0; j < piece_cnt; ++j) {
+      pattern.append(atoms[rng() % ARRAYSIZEOF(atoms)]);
+      pattern.append(quantifiers[rng() % ARRAYSIZEOF(quantifiers)]);
+    }
+    if (0 == rng() % 4) {
+      pattern.append("$");
+    }
+    if (init(pattern.c_str(), flags[rng() % ARRAYSIZEOF(flags)])) {
+      ++supported_cnt;
+      for (int64_t j = 0; j < TEXT_CNT; ++j) {
+        std::string text;
+        const int64_t len = rng() % 12;
+        for (int64_t k = 0; k < len; ++k) {
+          text.append(chars[rng() % ARRAYSIZEOF(chars)]);
+        }
+        check(text.c_str());
+      }
+    }
+  }
+  ASSERT_GT(supported_cnt, PATTERN_CNT / 2);
+  ASSERT_GT(done_cnt_, supported_cnt);
+}
+
+TEST_F(TestExprRegexpAutomaton, find_literal)
+{
+#if OB_USE_MULTITARGET_CODE
+  if (!is_arch_supported(ObTargetArch::AVX2)) {
+    LOG_INFO("avx2 is not supported, skip");
+  } else {
+    std::mt19937 rng(1);
+    for (int64_t round = 0; round < 100000; ++round) {
+      // the small alphabet makes the first and the last bytes of the literal match often
+      const int64_t text_len = rng() % 256;
+      const int64_t literal_len = 1 + rng() % 40;
+      const int64_t alphabet = 2 + rng() % 2;
+      std::vector<char> text(text_len + 1);
+      std::vector<char> literal(literal_len);
+      for (int64_t i = 0; i < text_len; ++i) {
+        text[i] = static_cast<char>('a' + rng() % alphabet);
+      }
+      for (int64_t i = 0; i < literal_len; ++i) {
+        literal[i] = static_cast<char>('a' + rng() % alphabet);
+      }
+      if (text_len >= literal_len && 0 == rng() % 2) {
+        MEMCPY(text.data() + rng() % (text_len - literal_len + 1), literal.data(), literal_len);
+      }
+      const char *expected = specific::normal::find_literal(text.data(), text_len,
+                                                            literal.data(), literal_len);
+      const char *actual = specific::avx2::find_literal(text.data(), text_len,
+                                                        literal.data(), literal_len);
+      ASSERT_EQ(expected, actual) << "text: " << std::string(text.data(), text_len)
+                                  << ", literal: " << std::string(literal.data(), literal_len);
+    }
+  }
+#endif
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_expr_regexp_automaton.log*");
+  OB_LOGGER.set_file_name("test_expr_regexp_automaton.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
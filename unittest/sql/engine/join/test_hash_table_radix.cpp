@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENGINE
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+#include <algorithm>
+#define private public
+#define protected public
+#include "sql/engine/join/hash_join/hash_table.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/random/ob_random.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static const int64_t NBUCKETS = 1 << 12;
+static const int64_t RADIX_SHIFT = 40;
+
+class TestHashTableRadix : public ::testing::Test
+{
+public:
+  TestHashTableRadix() : allocator_("HtRadixTest") {}
+  virtual void SetUp() override {}
+  virtual void TearDown() override { allocator_.reset(); }
+
+protected:
+  // stored row with only extra info (hash value/next pointer) as payload
+  GenericItem *new_row()
+  {
+    const int64_t size = sizeof(ObHJStoredRow) + sizeof(ObHJStoredRow::ExtraInfo);
+    void *buf = allocator_.alloc(size);
+    EXPECT_TRUE(NULL != buf);
+    MEMSET(buf, 0, size);
+    return static_cast<GenericItem *>(buf);
+  }
+  void check_probe(const int64_t radix_bits, const int64_t distinct_cnt, const bool skewed);
+
+protected:
+  ObArenaAllocator allocator_;
+  JoinTableCtx ctx_;
+};
+
+void TestHashTableRadix::check_probe(const int64_t radix_bits, const int64_t distinct_cnt, const bool skewed)
+{
+  GenericTable table;
+  ASSERT_EQ(OB_SUCCESS, table.init(allocator_, 256));
+  ASSERT_EQ(OB_SUCCESS, table.build_prepare(distinct_cnt, NBUCKETS, RADIX_SHIFT, radix_bits));
+  // hash value -> rows with that hash value
+  std::map<uint64_t, std::vector<GenericItem *>> expected;
+  int64_t used_buckets = 0;
+  int64_t collisions = 0;
+  for (int64_t i = 0; i < distinct_cnt; ++i) {
+    uint64_t hash_val = ObRandom::rand(0, INT64_MAX) & ObHJStoredRow::HASH_VAL_MASK;
+    if (skewed) {
+      // all rows fall into partition 0, so linear probing runs over the following slices
+      hash_val &= ~(((1UL << radix_bits) - 1) << RADIX_SHIFT);
+    }
+    const int64_t dup_cnt = 1 + i % 3;
+    for (int64_t j = 0; j < dup_cnt; ++j) {
+      GenericItem *item = new_row();
+      table.set(ctx_, hash_val, item, used_buckets, collisions);
+      expected[hash_val].push_back(item);
+    }
+  }
+  ASSERT_EQ(static_cast<int64_t>(expected.size()), used_buckets);
+
+  for (auto &it : expected) {
+    GenericItem *item = table.get(it.first);
+    int64_t cnt = 0;
+    while (reinterpret_cast<GenericItem *>(END_ITEM) != item && NULL != item) {
+      ASSERT_TRUE(std::find(it.second.begin(), it.second.end(), item) != it.second.end());
+      ++cnt;
+      item = item->get_next(ctx_.build_row_meta_);
+    }
+    ASSERT_EQ(static_cast<int64_t>(it.second.size()), cnt);
+    GenericBucket *bkt = NULL;
+    table.get(it.first, bkt);
+    ASSERT_TRUE(NULL != bkt);
+    ASSERT_EQ(it.first, bkt->hash_value());
+  }
+
+  // not exist hash values
+  for (int64_t i = 0; i < 1000; ++i) {
+    const uint64_t hash_val = ObRandom::rand(0, INT64_MAX) & ObHJStoredRow::HASH_VAL_MASK;
+    if (expected.count(hash_val) == 0) {
+      ASSERT_EQ(reinterpret_cast<GenericItem *>(END_ITEM), table.get(hash_val));
+    }
+  }
+}
+
+TEST_F(TestHashTableRadix, bucket_pos)
+{
+  for (int64_t radix_bits = 0; radix_bits <= 8; ++radix_bits) {
+    GenericTable table;
+    ASSERT_EQ(OB_SUCCESS, table.init(allocator_, 256));
+    ASSERT_EQ(OB_SUCCESS, table.build_prepare(NBUCKETS / 2, NBUCKETS, RADIX_SHIFT, radix_bits));
+    const int64_t bucket_bits = __builtin_ctzll(NBUCKETS);
+    ASSERT_EQ(radix_bits > 0 ? bucket_bits - radix_bits : 0, table.slice_bits_);
+    for (int64_t i = 0; i < 10000; ++i) {
+      const uint64_t hash_val = ObRandom::rand(0, INT64_MAX) & ObHJStoredRow::HASH_VAL_MASK;
+      const uint64_t pos = table.get_bucket_pos(hash_val);
+      ASSERT_LT(pos, static_cast<uint64_t>(NBUCKETS));
+      if (0 == radix_bits) {
+        ASSERT_EQ(hash_val & (NBUCKETS - 1), pos);
+      } else {
+        const uint64_t part = (hash_val >> RADIX_SHIFT) & ((1UL << radix_bits) - 1);
+        const uint64_t slice_size = NBUCKETS >> radix_bits;
+        // partition owns the slice [part * slice_size, (part + 1) * slice_size)
+        ASSERT_EQ(part, pos / slice_size);
+        ASSERT_EQ(hash_val & (slice_size - 1), pos % slice_size);
+      }
+    }
+  }
+}
+
+TEST_F(TestHashTableRadix, fallback)
+{
+  GenericTable table;
+  ASSERT_EQ(OB_SUCCESS, table.init(allocator_, 256));
+  const uint64_t hash_val = 0x5a5a5a5a5a5aUL;
+  // radix bits not less than bucket bits
+  ASSERT_EQ(OB_SUCCESS, table.build_prepare(16, 16, RADIX_SHIFT, 4));
+  ASSERT_EQ(0UL, table.radix_mask_);
+  ASSERT_EQ(hash_val & 15, table.get_bucket_pos(hash_val));
+  // partition bits exceed the 63 bits stored in bucket
+  ASSERT_EQ(OB_SUCCESS, table.build_prepare(16, NBUCKETS, 60, 4));
+  ASSERT_EQ(0UL, table.radix_mask_);
+  ASSERT_EQ(hash_val & (NBUCKETS - 1), table.get_bucket_pos(hash_val));
+  // radix layout is reset by the next build
+  ASSERT_EQ(OB_SUCCESS, table.build_prepare(16, NBUCKETS, RADIX_SHIFT, 4));
+  ASSERT_EQ(15UL, table.radix_mask_);
+  ASSERT_EQ(OB_SUCCESS, table.build_prepare(16, NBUCKETS, RADIX_SHIFT, 0));
+  ASSERT_EQ(0UL, table.radix_mask_);
+  ASSERT_EQ(hash_val & (NBUCKETS - 1), table.get_bucket_pos(hash_val));
+}
+
+TEST_F(TestHashTableRadix, probe)
+{
+  for (int64_t radix_bits = 0; radix_bits <= 6; ++radix_bits) {
+    check_probe(radix_bits, NBUCKETS / 4, false);
+    // almost full table
+    check_probe(radix_bits, NBUCKETS - 16, false);
+  }
+}
+
+TEST_F(TestHashTableRadix, probe_skewed)
+{
+  for (int64_t radix_bits = 1; radix_bits <= 6; ++radix_bits) {
+    // partition 0 overflows its slice, probing must continue into the next slices
+    check_probe(radix_bits, (NBUCKETS >> radix_bits) * 2 - 1, true);
+  }
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_hash_table_radix.log*");
+  OB_LOGGER.set_file_name("test_hash_table_radix.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+#include <gtest/gtest.h>
+#include "../test_op_engine.h"
+#include "../ob_test_config.h"
+#include "share/ob_cluster_version.h"
+#include <string>
+
+using namespace ::oceanbase::sql;
+
+namespace test
+{
+// The queries of all join types are run by PHY_NESTED_LOOP_JOIN and PHY_VEC_NESTED_LOOP_JOIN,
+// and the outputs of the two operators are compared.
+class TestNestedLoopJoinVec : public TestOpEngine
+{
+public:
+  TestNestedLoopJoinVec();
+  virtual ~TestNestedLoopJoinVec();
+  virtual void SetUp();
+  virtual void TearDown();
+
+protected:
+  void set_nlj_batching_enabled(const bool enabled);
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestNestedLoopJoinVec);
+};
+
+TestNestedLoopJoinVec::TestNestedLoopJoinVec()
+{
+  std::string schema_filename = ObTestOpConfig::get_instance().test_filename_prefix_ + ".schema";
+  strcpy(schema_file_path_, schema_filename.c_str());
+}
+
+TestNestedLoopJoinVec::~TestNestedLoopJoinVec()
+{}
+
+void TestNestedLoopJoinVec::SetUp()
+{
+  TestOpEngine::SetUp();
+  // PHY_VEC_NESTED_LOOP_JOIN is generated since 4.3.3.0
+  oceanbase::common::ObClusterVersion::get_instance().update_cluster_version(CLUSTER_VERSION_4_3_3_0);
+}
+
+void TestNestedLoopJoinVec::TearDown()
+{
+  destroy();
+}
+
+void TestNestedLoopJoinVec::set_nlj_batching_enabled(const bool enabled)
+{
+  ASSERT_EQ(OB_SUCCESS, session_info_.update_sys_variable(oceanbase::share::SYS_VAR__NLJ_BATCHING_ENABLED,
+                                                          enabled ? 1 : 0));
+}
+
+TEST_F(TestNestedLoopJoinVec, basic_test)
+{
+  set_nlj_batching_enabled(false);
+  std::string test_file_path = ObTestOpConfig::get_instance().test_filename_prefix_ + ".test";
+  int ret = basic_random_test(test_file_path);
+  EXPECT_EQ(ret, 0);
+}
+
+// the right child is rescanned by the group join buffer
+TEST_F(TestNestedLoopJoinVec, group_rescan_test)
+{
+  set_nlj_batching_enabled(true);
+  std::string test_file_path = ObTestOpConfig::get_instance().test_filename_prefix_ + ".test";
+  int ret = basic_random_test(test_file_path);
+  EXPECT_EQ(ret, 0);
+}
+} // namespace test
+
+int main(int argc, char **argv)
+{
+  ObTestOpConfig::get_instance().test_filename_prefix_ = "test_nested_loop_join_vec";
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-bg") == 0) {
+      ObTestOpConfig::get_instance().test_filename_prefix_ += "_bg";
+      ObTestOpConfig::get_instance().run_in_background_ = true;
+    }
+  }
+  ObTestOpConfig::get_instance().init();
+
+  system(("rm -f " + ObTestOpConfig::get_instance().test_filename_prefix_ + ".log").data());
+  system(("rm -f " + ObTestOpConfig::get_instance().test_filename_prefix_ + ".log.*").data());
+  oceanbase::common::ObClockGenerator::init();
+  observer::ObReqTimeGuard req_timeinfo_guard;
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name((ObTestOpConfig::get_instance().test_filename_prefix_ + ".log").data(), true);
+  init_sql_factories();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -24,11 +24,25 @@ int ObFakeTableScanVecOp::inner_open()
   ObDataGenerator::get_instance().register_op(this);
   std::string round;
   ObTestOpConfig::get_instance().get_config("round", round);
+  begin_round_ = current_round_;
   if (!round.empty()) { max_round_ = current_round_ + std::stoi(round); }
 
   return OB_SUCCESS;
 }
 
+// the rescan params are ignored, the generated rounds are replayed from the beginning
+int ObFakeTableScanVecOp::inner_rescan()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(ObOperator::inner_rescan())) {
+    LOG_WARN("failed to inner rescan", K(ret));
+  } else {
+    current_round_ = begin_round_;
+    brs_.end_ = false;
+  }
+  return ret;
+}
+
 int ObFakeTableScanVecOp::inner_get_next_batch(const int64_t max_row_cnt)
 {
   int ret = OB_SUCCESS;
@@ -35,6 +35,7 @@ public:
   ~ObFakeTableScanVecOp() = default;
 
   int inner_open() override;
+  int inner_rescan() override;
   int inner_get_next_batch(const int64_t max_row_cnt) override;
 
   int fill_random_data_into_expr_datum_frame(int expr_i, int expr_count, const ObExpr *expr, const int output_max_count,
@@ -45,6 +46,7 @@ public:
 
 public:
   int max_round_{2};
+  int begin_round_{1};
   int current_round_{1};
 
   // io
@@ -690,7 +690,11 @@ int TestOpEngine::basic_random_test(const std::string &test_file)
 
       //if output to file, compare data in file at last
       if (ObTestOpConfig::get_instance().output_result_to_file_) {
-        if (original_root->get_spec().get_type() == PHY_HASH_JOIN && original_root->get_spec().get_type() == PHY_VEC_HASH_JOIN) {
+        const ObPhyOperatorType root_type = original_root->get_spec().get_type();
+        // the join operators of vectorization 2.0 may output the rows in different order,
+        // so may the window function for the rows with the same sort keys
+        if (PHY_HASH_JOIN == root_type || PHY_MERGE_JOIN == root_type
+            || PHY_NESTED_LOOP_JOIN == root_type || PHY_WINDOW_FUNCTION == root_type) {
           system(("sort " + ObTestOpConfig::get_instance().test_filename_origin_output_file_ + " -o "
                   + ObTestOpConfig::get_instance().test_filename_origin_output_file_)
                    .c_str());
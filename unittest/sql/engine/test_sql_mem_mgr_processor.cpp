@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/ob_sql_mem_mgr_processor.h"
+#undef private
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+TEST(ObSqlMemMgrProcessor, compressed)
+{
+  ObMonitorNode op_monitor_info;
+  ObSqlWorkAreaProfile profile(ObSqlWorkAreaType::HASH_WORK_AREA);
+  ObSqlMemMgrProcessor processor(profile, op_monitor_info);
+  ObTenantSqlMemoryCallback tenant_callback;
+  processor.mem_callback_ = &tenant_callback;
+
+  processor.compressed(1000, 250);
+  processor.compressed(1000, 1000);
+  ASSERT_EQ(2000, processor.get_compress_raw_size());
+  ASSERT_EQ(1250, processor.get_compressed_size());
+  // the processor does not take any otherstat slot of the operator
+  ASSERT_EQ(0, op_monitor_info.otherstat_7_id_);
+  ASSERT_EQ(0, op_monitor_info.otherstat_8_id_);
+  // tenant stat
+  ASSERT_EQ(750, tenant_callback.get_total_compress_saved_size());
+  ASSERT_EQ(62, tenant_callback.get_compress_ratio());
+
+  // the stores of hash join only report the compression
+  ObSqlMemCompressCallback compress_callback(processor);
+  const int64_t dumped_size = processor.get_dumped_size();
+  compress_callback.alloc(1024);
+  compress_callback.dumped(1024);
+  compress_callback.compressed(1000, 500);
+  ASSERT_EQ(dumped_size, processor.get_dumped_size());
+  ASSERT_EQ(0, processor.get_delta_size());
+  ASSERT_EQ(3000, processor.get_compress_raw_size());
+  ASSERT_EQ(1750, processor.get_compressed_size());
+  ASSERT_EQ(1250, tenant_callback.get_total_compress_saved_size());
+}
+
+TEST(ObSqlMemMgrProcessor, set_compress_stat)
+{
+  ObMonitorNode info;
+  // nothing is dumped
+  ObSqlMemMgrProcessor::set_compress_stat(0, 0, info.otherstat_4_id_, info.otherstat_4_value_,
+                                          info.otherstat_5_id_, info.otherstat_5_value_);
+  ASSERT_EQ(0, info.otherstat_4_id_);
+  ASSERT_EQ(0, info.otherstat_5_id_);
+  ObSqlMemMgrProcessor::set_compress_stat(4000, 1000, info.otherstat_4_id_, info.otherstat_4_value_,
+                                          info.otherstat_5_id_, info.otherstat_5_value_);
+  ASSERT_EQ(ObSqlMonitorStatIds::SPILL_COMPRESS_SAVED_SIZE, info.otherstat_4_id_);
+  ASSERT_EQ(3000, info.otherstat_4_value_);
+  ASSERT_EQ(ObSqlMonitorStatIds::SPILL_COMPRESS_RATIO, info.otherstat_5_id_);
+  ASSERT_EQ(25, info.otherstat_5_value_);
+  // the other slots are not touched
+  ASSERT_EQ(0, info.otherstat_7_id_);
+  ASSERT_EQ(0, info.otherstat_8_id_);
+}
+
+TEST(ObTenantSqlMemoryCallback, compressed)
+{
+  ObTenantSqlMemoryCallback callback;
+  ASSERT_EQ(0, callback.get_total_compress_saved_size());
+  ASSERT_EQ(100, callback.get_compress_ratio());
+  callback.compressed(100, 40);
+  callback.compressed(300, 60);
+  ASSERT_EQ(300, callback.get_total_compress_saved_size());
+  ASSERT_EQ(25, callback.get_compress_ratio());
+  callback.reset();
+  ASSERT_EQ(0, callback.get_total_compress_saved_size());
+  ASSERT_EQ(100, callback.get_compress_ratio());
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
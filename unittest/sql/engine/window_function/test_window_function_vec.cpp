@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+#include <gtest/gtest.h>
+#include "../test_op_engine.h"
+#include "../ob_test_config.h"
+#include "share/ob_cluster_version.h"
+#include <string>
+
+using namespace ::oceanbase::sql;
+
+namespace test
+{
+// The sliding MIN/MAX frames are calculated by PHY_WINDOW_FUNCTION, which aggregates
+// the frames again, and by PHY_VEC_WINDOW_FUNCTION, which uses the segment tree for
+// the large frames, and the outputs of the two operators are compared.
+class TestWindowFunctionVec : public TestOpEngine
+{
+public:
+  TestWindowFunctionVec();
+  virtual ~TestWindowFunctionVec();
+  virtual void SetUp();
+  virtual void TearDown();
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestWindowFunctionVec);
+};
+
+TestWindowFunctionVec::TestWindowFunctionVec()
+{
+  std::string schema_filename = ObTestOpConfig::get_instance().test_filename_prefix_ + ".schema";
+  strcpy(schema_file_path_, schema_filename.c_str());
+}
+
+TestWindowFunctionVec::~TestWindowFunctionVec()
+{}
+
+void TestWindowFunctionVec::SetUp()
+{
+  TestOpEngine::SetUp();
+  // PHY_VEC_WINDOW_FUNCTION is generated since 4.3.2.0
+  oceanbase::common::ObClusterVersion::get_instance().update_cluster_version(CLUSTER_VERSION_4_3_3_0);
+}
+
+void TestWindowFunctionVec::TearDown()
+{
+  destroy();
+}
+
+TEST_F(TestWindowFunctionVec, basic_test)
+{
+  std::string test_file_path = ObTestOpConfig::get_instance().test_filename_prefix_ + ".test";
+  int ret = basic_random_test(test_file_path);
+  EXPECT_EQ(ret, 0);
+}
+} // namespace test
+
+int main(int argc, char **argv)
+{
+  ObTestOpConfig::get_instance().test_filename_prefix_ = "test_window_function_vec";
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-bg") == 0) {
+      ObTestOpConfig::get_instance().test_filename_prefix_ += "_bg";
+      ObTestOpConfig::get_instance().run_in_background_ = true;
+    }
+  }
+  ObTestOpConfig::get_instance().init();
+
+  system(("rm -f " + ObTestOpConfig::get_instance().test_filename_prefix_ + ".log").data());
+  system(("rm -f " + ObTestOpConfig::get_instance().test_filename_prefix_ + ".log.*").data());
+  oceanbase::common::ObClockGenerator::init();
+  observer::ObReqTimeGuard req_timeinfo_guard;
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name((ObTestOpConfig::get_instance().test_filename_prefix_ + ".log").data(), true);
+  init_sql_factories();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "ob_cs_encoding_test_base.h"
+#include "storage/blocksstable/ob_micro_block_hash_index.h"
+#include "storage/blocksstable/cs_encoding/ob_micro_block_cs_decoder.h"
+#include "storage/blocksstable/cs_encoding/ob_micro_block_cs_encoder.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+using namespace storage;
+using namespace share::schema;
+
+class TestCSHashIndex : public ObCSEncodingTestBase, public ::testing::Test
+{
+public:
+  TestCSHashIndex() {}
+  virtual ~TestCSHashIndex() {}
+
+  virtual void SetUp();
+  virtual void TearDown() { reuse(); }
+
+protected:
+  // rows are generated with even seeds, so that odd seeds can be used as not exist rowkeys
+  void build_block(const int64_t row_cnt, const bool with_hash_index, ObDatumRow *row_arr,
+                   ObMicroBlockCSEncoder &encoder, ObMicroBlockDesc &desc, ObMicroBlockHeader *&header,
+                   const int64_t block_size_upper_bound = 0, const bool abandon_hash_index = false);
+  void full_transform(const ObMicroBlockHeader *header, const ObMicroBlockDesc &desc,
+                      ObMicroBlockData &block_data);
+  int64_t get_rows(const ObMicroBlockData &block_data, const ObDatumRow *row_arr,
+                   const int64_t row_cnt, const int64_t round);
+
+protected:
+  static const int64_t ROWKEY_CNT = 2;
+  static const int64_t COL_CNT = 4;
+  ObMicroBlockHashIndexBuilder hash_index_builder_;
+};
+
+void TestCSHashIndex::SetUp()
+{
+  ObObjType col_types[COL_CNT] = {ObIntType, ObVarcharType, ObIntType, ObVarcharType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, ROWKEY_CNT, COL_CNT));
+}
+
+void TestCSHashIndex::build_block(
+    const int64_t row_cnt,
+    const bool with_hash_index,
+    ObDatumRow *row_arr,
+    ObMicroBlockCSEncoder &encoder,
+    ObMicroBlockDesc &desc,
+    ObMicroBlockHeader *&header,
+    const int64_t block_size_upper_bound,
+    const bool abandon_hash_index)
+{
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  // data store desc is not needed when rows are added by hash value
+  hash_index_builder_.reset();
+  hash_index_builder_.is_inited_ = true;
+  ObDatumRowkey rowkey;
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, COL_CNT));
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(2 * i, row_arr[i]));
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    uint64_t hash_value = 0;
+    ASSERT_EQ(OB_SUCCESS, rowkey.assign(row_arr[i].storage_datums_, ROWKEY_CNT));
+    ASSERT_EQ(OB_SUCCESS, rowkey.murmurhash(0, read_info_.get_datum_utils(), hash_value));
+    const int tmp_ret = hash_index_builder_.internal_add(hash_value, i);
+    if (OB_SUCCESS == tmp_ret) {
+      ++hash_index_builder_.row_index_;
+    } else {
+      ASSERT_EQ(OB_NOT_SUPPORTED, tmp_ret);
+    }
+  }
+  if (abandon_hash_index) {
+    // the space is not enough for the hash index when the last row is appended
+    hash_index_builder_.abandon();
+    ASSERT_EQ(0, hash_index_builder_.estimate_size(true));
+    ASSERT_EQ(OB_NOT_SUPPORTED, hash_index_builder_.build_block(encoder.hash_index_buffer_));
+  }
+  if (with_hash_index) {
+    const int expected_ret = (abandon_hash_index || row_cnt > ObMicroBlockHashIndex::MAX_OFFSET_SUPPORTED)
+        ? OB_NOT_SUPPORTED : OB_SUCCESS;
+    ASSERT_EQ(expected_ret, encoder.append_hash_index(hash_index_builder_));
+  }
+  if (block_size_upper_bound > 0) {
+    encoder.set_block_size_upper_bound(block_size_upper_bound);
+  }
+  ASSERT_EQ(OB_SUCCESS, build_micro_block_desc(encoder, desc, header));
+}
+
+void TestCSHashIndex::full_transform(
+    const ObMicroBlockHeader *header,
+    const ObMicroBlockDesc &desc,
+    ObMicroBlockData &block_data)
+{
+  ObMicroBlockCSDecoder decoder;
+  ASSERT_EQ(OB_SUCCESS, init_cs_decoder(header, desc, block_data, decoder));
+}
+
+int64_t TestCSHashIndex::get_rows(
+    const ObMicroBlockData &block_data,
+    const ObDatumRow *row_arr,
+    const int64_t row_cnt,
+    const int64_t round)
+{
+  ObCSEncodeBlockGetReader get_reader;
+  ObDatumRowkey rowkey;
+  ObDatumRow row;
+  EXPECT_EQ(OB_SUCCESS, row.init(allocator_, COL_CNT));
+  const int64_t start_us = ObTimeUtility::current_time();
+  for (int64_t r = 0; r < round; ++r) {
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      rowkey.assign(row_arr[i].storage_datums_, ROWKEY_CNT);
+      EXPECT_EQ(OB_SUCCESS, get_reader.get_row(block_data, rowkey, read_info_, row));
+    }
+  }
+  return ObTimeUtility::current_time() - start_us;
+}
+
+TEST_F(TestCSHashIndex, get_and_exist)
+{
+  const int64_t row_cnt = 200;
+  ObDatumRow row_arr[row_cnt];
+  ObMicroBlockCSEncoder encoder;
+  ObMicroBlockDesc desc;
+  ObMicroBlockHeader *header = nullptr;
+  build_block(row_cnt, true, row_arr, encoder, desc, header);
+  ASSERT_TRUE(header->is_contain_hash_index());
+  ASSERT_EQ(OB_SUCCESS, full_transform_check_row(header, desc, row_arr, row_cnt, true));
+  ASSERT_EQ(OB_SUCCESS, part_transform_check_row(header, desc, row_arr, row_cnt, true));
+
+  ObMicroBlockData block_data;
+  full_transform(header, desc, block_data);
+  ObCSEncodeBlockGetReader get_reader;
+  ObDatumRowkey rowkey;
+  ObDatumRow not_exist_row;
+  ASSERT_EQ(OB_SUCCESS, not_exist_row.init(allocator_, COL_CNT));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    bool exist = false;
+    bool found = false;
+    int64_t row_id = -1;
+    rowkey.assign(row_arr[i].storage_datums_, ROWKEY_CNT);
+    ASSERT_EQ(OB_SUCCESS, get_reader.exist_row(block_data, rowkey, read_info_, exist, found));
+    ASSERT_TRUE(exist);
+    ASSERT_TRUE(get_reader.hash_index_.is_inited());
+    ASSERT_EQ(OB_SUCCESS, get_reader.get_row_id(block_data, rowkey, read_info_, row_id));
+    ASSERT_EQ(i, row_id);
+
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(2 * i + 1, not_exist_row));
+    rowkey.assign(not_exist_row.storage_datums_, ROWKEY_CNT);
+    ASSERT_EQ(OB_SUCCESS, get_reader.exist_row(block_data, rowkey, read_info_, exist, found));
+    ASSERT_FALSE(exist);
+    ASSERT_EQ(OB_BEYOND_THE_RANGE, get_reader.get_row(block_data, rowkey, read_info_, not_exist_row));
+  }
+}
+
+TEST_F(TestCSHashIndex, too_many_rows)
+{
+  const int64_t row_cnt = ObMicroBlockHashIndex::MAX_OFFSET_SUPPORTED + 100;
+  ObDatumRow row_arr[row_cnt];
+  ObMicroBlockCSEncoder encoder;
+  ObMicroBlockDesc desc;
+  ObMicroBlockHeader *header = nullptr;
+  build_block(row_cnt, true, row_arr, encoder, desc, header);
+  ASSERT_FALSE(header->is_contain_hash_index());
+  ASSERT_EQ(OB_SUCCESS, full_transform_check_row(header, desc, row_arr, row_cnt, true));
+}
+
+TEST_F(TestCSHashIndex, enough_space)
+{
+  const int64_t row_cnt = 100;
+  ObDatumRow row_arr[row_cnt];
+  ObMicroBlockCSEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, COL_CNT));
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(2 * i, row_arr[i]));
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+  }
+  const int64_t hash_index_size = ObMicroBlockHashIndex::get_serialize_size(row_cnt);
+  ASSERT_TRUE(encoder.has_enough_space_for_hash_index(hash_index_size));
+  encoder.set_block_size_upper_bound(encoder.get_block_size() + hash_index_size);
+  ASSERT_TRUE(encoder.has_enough_space_for_hash_index(hash_index_size));
+  ASSERT_FALSE(encoder.has_enough_space_for_hash_index(hash_index_size + 1));
+}
+
+TEST_F(TestCSHashIndex, drop_when_exceed_upper_bound)
+{
+  const int64_t row_cnt = 100;
+  ObDatumRow row_arr[row_cnt];
+  ObMicroBlockCSEncoder encoder;
+  ObMicroBlockDesc desc;
+  ObMicroBlockHeader *header = nullptr;
+  build_block(row_cnt, false, row_arr, encoder, desc, header);
+  ASSERT_FALSE(header->is_contain_hash_index());
+  const int64_t block_size = encoder.data_buffer_.length();
+
+  // same rows encode into the same block, which has no room left for hash index
+  ObDatumRow hash_row_arr[row_cnt];
+  ObMicroBlockCSEncoder hash_encoder;
+  ObMicroBlockDesc hash_desc;
+  ObMicroBlockHeader *hash_header = nullptr;
+  build_block(row_cnt, true, hash_row_arr, hash_encoder, hash_desc, hash_header, block_size + 1);
+  ASSERT_FALSE(hash_header->is_contain_hash_index());
+  ASSERT_EQ(block_size, hash_encoder.data_buffer_.length());
+  ASSERT_EQ(OB_SUCCESS, full_transform_check_row(hash_header, hash_desc, hash_row_arr, row_cnt, true));
+}
+
+TEST_F(TestCSHashIndex, abandon_when_space_not_enough)
+{
+  const int64_t row_cnt = 100;
+  ObDatumRow row_arr[row_cnt];
+  ObMicroBlockCSEncoder encoder;
+  ObMicroBlockDesc desc;
+  ObMicroBlockHeader *header = nullptr;
+  build_block(row_cnt, true, row_arr, encoder, desc, header, 0, true);
+  ASSERT_FALSE(header->is_contain_hash_index());
+  ASSERT_EQ(OB_SUCCESS, full_transform_check_row(header, desc, row_arr, row_cnt, true));
+
+  ObMicroBlockData block_data;
+  full_transform(header, desc, block_data);
+  ObCSEncodeBlockGetReader get_reader;
+  ObDatumRowkey rowkey;
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    bool exist = false;
+    bool found = false;
+    rowkey.assign(row_arr[i].storage_datums_, ROWKEY_CNT);
+    ASSERT_EQ(OB_SUCCESS, get_reader.exist_row(block_data, rowkey, read_info_, exist, found));
+    ASSERT_TRUE(exist);
+    ASSERT_FALSE(get_reader.hash_index_.is_inited());
+  }
+  // the next micro block builds hash index again
+  hash_index_builder_.reuse();
+  ASSERT_FALSE(hash_index_builder_.is_abandoned());
+}
+
+TEST_F(TestCSHashIndex, perf_get)
+{
+  const int64_t row_cnt = 250;
+  const int64_t round = 1000;
+  ObDatumRow row_arr[row_cnt];
+  ObMicroBlockCSEncoder encoder;
+  ObMicroBlockDesc desc;
+  ObMicroBlockHeader *header = nullptr;
+  ObMicroBlockData block_data;
+  build_block(row_cnt, false, row_arr, encoder, desc, header);
+  ASSERT_FALSE(header->is_contain_hash_index());
+  full_transform(header, desc, block_data);
+  const int64_t binary_search_us = get_rows(block_data, row_arr, row_cnt, round);
+
+  ObDatumRow hash_row_arr[row_cnt];
+  ObMicroBlockCSEncoder hash_encoder;
+  ObMicroBlockDesc hash_desc;
+  ObMicroBlockHeader *hash_header = nullptr;
+  ObMicroBlockData hash_block_data;
+  build_block(row_cnt, true, hash_row_arr, hash_encoder, hash_desc, hash_header);
+  ASSERT_TRUE(hash_header->is_contain_hash_index());
+  full_transform(hash_header, hash_desc, hash_block_data);
+  const int64_t hash_index_us = get_rows(hash_block_data, hash_row_arr, row_cnt, round);
+
+  const int64_t get_cnt = row_cnt * round;
+  std::cout << "get " << get_cnt << " rows, binary search: " << binary_search_us * 1000 / get_cnt
+            << " ns/row, hash index: " << hash_index_us * 1000 / get_cnt << " ns/row, block size: "
+            << desc.buf_size_ << " -> " << hash_desc.buf_size_ << std::endl;
+  LOG_INFO("cs micro block get perf", K(get_cnt), K(binary_search_us), K(hash_index_us),
+      K(desc.buf_size_), K(hash_desc.buf_size_));
+}
+
+}  // namespace blocksstable
+}  // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_cs_hash_index.log*");
+  OB_LOGGER.set_file_name("test_cs_hash_index.log", true, false);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
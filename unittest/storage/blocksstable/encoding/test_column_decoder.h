@@ -154,6 +154,8 @@ public:
 
   void filter_pushdown_comaprison_neg_test();
 
+  void filter_pushdown_with_row_wise_test();
+
   void batch_decode_to_datum_test(bool is_condensed = false);
   void batch_decode_to_vector_test(
       const bool is_condensed,
@@ -1306,6 +1308,87 @@ void TestColumnDecoder::basic_filter_pushdown_bt_test()
   }
 }
 
+// compare the column specific pushdown with the row-wise (retro) pushdown on ranges
+// which start and end inside runs, cover single row runs, null runs and the first / last run
+void TestColumnDecoder::filter_pushdown_with_row_wise_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  const int64_t seed_a = 10001;
+  const int64_t seed_b = 10002;
+  const int64_t seed_c = 10003;
+  const int64_t seed_absent = 10004;
+  const int64_t NULL_SEED = -1;
+  //  0 --- 8 --- 11 --- 24 - 25 --- 40 --- 56 --- ROW_CNT
+  //  |  a  | null |  b  | a  | null |  b   |  c   |
+  const int64_t run_ends[] = {8, 11, 24, 25, 40, 56, ROW_CNT};
+  const int64_t run_seeds[] = {seed_a, NULL_SEED, seed_b, seed_a, NULL_SEED, seed_b, seed_c};
+  int64_t row_idx = 0;
+  for (int64_t r = 0; r < ARRAYSIZEOF(run_ends); ++r) {
+    if (NULL_SEED == run_seeds[r]) {
+      for (int64_t j = 0; j < full_column_cnt_; ++j) {
+        row.storage_datums_[j].set_null();
+      }
+    } else {
+      ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(run_seeds[r], row));
+    }
+    for (; row_idx < run_ends[r]; ++row_idx) {
+      ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << row_idx << std::endl;
+    }
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.data_buffer_.data(), encoder_.data_buffer_.length());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_)) << "buffer size: " << data.get_buf_size() << std::endl;
+
+  const int64_t ranges[][2] = {
+    {0, ROW_CNT}, {0, 1}, {0, 8}, {3, 9}, {8, 11}, {9, 10}, {10, 25}, {12, 20},
+    {24, 25}, {23, 41}, {30, 39}, {55, 57}, {56, ROW_CNT}, {ROW_CNT - 1, ROW_CNT}};
+  const sql::ObWhiteFilterOperatorType op_types[] = {
+    sql::WHITE_OP_NU, sql::WHITE_OP_NN, sql::WHITE_OP_EQ, sql::WHITE_OP_NE,
+    sql::WHITE_OP_GT, sql::WHITE_OP_LE, sql::WHITE_OP_IN};
+  const int64_t ref_seeds[] = {seed_a, seed_b, seed_c, seed_absent};
+  sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    if (i >= rowkey_cnt_ && i < read_info_.get_rowkey_count()) {
+      continue;
+    }
+    ObMalloc mallocer;
+    mallocer.set_label("ColumnDecoder");
+    for (int64_t s = 0; s < ARRAYSIZEOF(ref_seeds); ++s) {
+      ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 1);
+      objs.init(1);
+      ObObj ref_obj;
+      setup_obj(ref_obj, i, ref_seeds[s]);
+      objs.push_back(ref_obj);
+      for (int64_t o = 0; o < ARRAYSIZEOF(op_types); ++o) {
+        white_filter.op_type_ = op_types[o];
+        for (int64_t r = 0; r < ARRAYSIZEOF(ranges); ++r) {
+          const int64_t start = ranges[r][0];
+          const int64_t end = ranges[r][1];
+          ObBitmap pd_result_bitmap(allocator_);
+          ObBitmap row_wise_result_bitmap(allocator_);
+          ASSERT_EQ(OB_SUCCESS, pd_result_bitmap.init(end - start));
+          ASSERT_EQ(OB_SUCCESS, row_wise_result_bitmap.init(end - start));
+          ASSERT_EQ(OB_SUCCESS, test_filter_pushdown_with_pd_info(start, end, i, false, decoder,
+              white_filter, pd_result_bitmap, objs));
+          ASSERT_EQ(OB_SUCCESS, test_filter_pushdown_with_pd_info(start, end, i, true, decoder,
+              white_filter, row_wise_result_bitmap, objs));
+          for (int64_t k = 0; k < end - start; ++k) {
+            ASSERT_EQ(row_wise_result_bitmap.test(k), pd_result_bitmap.test(k))
+                << "column: " << i << ", op: " << op_types[o] << ", seed: " << ref_seeds[s]
+                << ", range: [" << start << ", " << end << "), row: " << start + k;
+          }
+        }
+      }
+    }
+  }
+}
+
 void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
 {
   void *row_buf = allocator_.alloc(sizeof(ObDatumRow) * ROW_CNT);
@@ -104,10 +104,16 @@ PUSHDOWN_GENERAL_TEST(TestRetroPDDecoder);
 PUSHDOWN_GENERAL_TEST(TestDictDecoder);
 PUSHDOWN_GENERAL_TEST(TestRLEDecoder);
 PUSHDOWN_GENERAL_TEST(TestIntBaseDiffDecoder);
+PUSHDOWN_GENERAL_TEST(TestHexDecoder);
 
-TEST_F(TestHexDecoder, basic_filter_pushdown_op_test_eq_ne_nu_nn)
+TEST_F(TestRLEDecoder, filter_pushdown_with_row_wise_test)
 {
-  basic_filter_pushdown_eq_ne_nu_nn_test();
+  filter_pushdown_with_row_wise_test();
+}
+
+TEST_F(TestHexDecoder, filter_pushdown_with_row_wise_test)
+{
+  filter_pushdown_with_row_wise_test();
 }
 
 TEST_F(TestDictDecoder, batch_decode_to_datum_condense_test)
@@ -0,0 +1,325 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "storage/blocksstable/ob_micro_block_secondary_cache.h"
+#undef private
+#include "storage/blocksstable/ob_micro_block_cache.h"
+#include "lib/allocator/page_arena.h"
+#include "share/io/ob_io_manager.h"
+#include "ob_data_file_prepare.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+namespace unittest
+{
+static const uint64_t TENANT_ID = 1001;
+static const int64_t BLOCK_SIZE = 64 * 1024;
+static const int64_t SEGMENT_CNT = 8;
+
+static const char *DIR = "./test_micro_block_secondary_cache_dir";
+
+static void wash(ObMicroBlockSecondaryCache &cache, char *block_buf, const uint64_t tenant_id, const int64_t idx)
+{
+  MEMSET(block_buf, 'a' + idx % 26, BLOCK_SIZE);
+  ObMicroBlockCacheKey key(tenant_id, MacroBlockId(0, idx + 1, 0), 4096, BLOCK_SIZE);
+  ObMicroBlockCacheValue value(block_buf, BLOCK_SIZE);
+  cache.on_wash(key, value);
+}
+
+static void wait_flushed(ObMicroBlockSecondaryCache &cache, const int64_t segment_seq)
+{
+  // idle buffers are sealed after two flush intervals
+  for (int64_t i = 0; i < 100 && ATOMIC_LOAD(&cache.segment_seq_) < segment_seq; ++i) {
+    ob_usleep(100 * 1000);
+  }
+  ASSERT_LE(segment_seq, ATOMIC_LOAD(&cache.segment_seq_));
+}
+
+static void corrupt(const ObMicroBlockSecondaryCache::Location &location)
+{
+  // flip a byte in the middle of the micro block data, bypassing the direct io of the cache
+  const int fd = ::open("./test_micro_block_secondary_cache_dir/micro_block_secondary_cache", O_RDWR);
+  ASSERT_LE(0, fd);
+  const int64_t offset = location.segment_id_ * ObMicroBlockSecondaryCache::SEGMENT_SIZE
+      + location.offset_ + ObMicroBlockSecondaryCache::get_entry_size(0) + location.size_ / 2;
+  char c = 0;
+  ASSERT_EQ(1, ::pread(fd, &c, 1, offset));
+  c = static_cast<char>(~c);
+  ASSERT_EQ(1, ::pwrite(fd, &c, 1, offset));
+  ::fsync(fd);
+  ::close(fd);
+}
+
+class TestMicroBlockSecondaryCache : public ::testing::Test
+{
+public:
+  TestMicroBlockSecondaryCache() {}
+  virtual ~TestMicroBlockSecondaryCache() {}
+  virtual void SetUp()
+  {
+    system("rm -rf ./test_micro_block_secondary_cache_dir && mkdir ./test_micro_block_secondary_cache_dir");
+  }
+  virtual void TearDown()
+  {
+    cache_.destroy();
+    system("rm -rf ./test_micro_block_secondary_cache_dir");
+  }
+  void wash(const uint64_t tenant_id, const int64_t idx) { unittest::wash(cache_, block_buf_, tenant_id, idx); }
+  void wait_flushed(const int64_t segment_seq) { unittest::wait_flushed(cache_, segment_seq); }
+protected:
+  char block_buf_[BLOCK_SIZE];
+  ObMicroBlockSecondaryCache cache_;
+};
+
+TEST_F(TestMicroBlockSecondaryCache, init)
+{
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.init(nullptr, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, 50));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.init(DIR, 1024, 50));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.init(DIR, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, 0));
+  ASSERT_EQ(OB_SUCCESS, cache_.init(DIR, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, 50));
+  ASSERT_EQ(OB_INIT_TWICE, cache_.init(DIR, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, 50));
+  ASSERT_EQ(SEGMENT_CNT, cache_.segment_cnt_);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.set_tenant_limit_percentage(101));
+  ASSERT_EQ(OB_SUCCESS, cache_.set_tenant_limit_percentage(100));
+}
+
+TEST_F(TestMicroBlockSecondaryCache, wash_and_get)
+{
+  ObArenaAllocator allocator;
+  const char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, cache_.init(DIR, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, 100));
+  ASSERT_EQ(OB_SUCCESS, cache_.start());
+  for (int64_t i = 0; i < 10; ++i) {
+    wash(TENANT_ID, i);
+  }
+  ObMicroBlockCacheKey key(TENANT_ID, MacroBlockId(0, 1, 0), 4096, BLOCK_SIZE);
+  // not readable until the segment buffer is written
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(key, allocator, buf, size));
+  wait_flushed(1);
+  for (int64_t i = 0; i < 10; ++i) {
+    key.set(TENANT_ID, MacroBlockId(0, i + 1, 0), 4096, BLOCK_SIZE);
+    ASSERT_EQ(OB_SUCCESS, cache_.get(key, allocator, buf, size));
+    ASSERT_EQ(BLOCK_SIZE, size);
+    ASSERT_EQ('a' + i, buf[0]);
+    ASSERT_EQ('a' + i, buf[BLOCK_SIZE - 1]);
+  }
+  key.set(TENANT_ID + 1, MacroBlockId(0, 1, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(key, allocator, buf, size));
+}
+
+TEST_F(TestMicroBlockSecondaryCache, recycle)
+{
+  ObArenaAllocator allocator;
+  const char *buf = nullptr;
+  int64_t size = 0;
+  const int64_t block_cnt_per_segment = ObMicroBlockSecondaryCache::SEGMENT_SIZE / BLOCK_SIZE - 1;
+  ASSERT_EQ(OB_SUCCESS, cache_.init(DIR, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, 100));
+  ASSERT_EQ(OB_SUCCESS, cache_.start());
+  // the ring is written more than once, so the first segment is recycled
+  for (int64_t i = 0; i < block_cnt_per_segment * (SEGMENT_CNT + 2); ++i) {
+    wash(TENANT_ID, i);
+    while (ATOMIC_LOAD(&cache_.buffers_[cache_.fill_buf_idx_].is_sealed_)) {
+      ob_usleep(1000);
+    }
+  }
+  wait_flushed(SEGMENT_CNT + 2);
+  ObMicroBlockCacheKey key(TENANT_ID, MacroBlockId(0, 1, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(key, allocator, buf, size));
+  const int64_t last_idx = block_cnt_per_segment * (SEGMENT_CNT + 2) - 1;
+  key.set(TENANT_ID, MacroBlockId(0, last_idx + 1, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_SUCCESS, cache_.get(key, allocator, buf, size));
+  ASSERT_EQ('a' + last_idx % 26, buf[0]);
+  ASSERT_GE(SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, cache_.get_tenant_used_size(TENANT_ID));
+}
+
+TEST_F(TestMicroBlockSecondaryCache, tenant_limit)
+{
+  ObArenaAllocator allocator;
+  const char *buf = nullptr;
+  int64_t size = 0;
+  const int64_t limit_pct = 25;
+  const int64_t limit_size = SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE / 100 * limit_pct;
+  const int64_t block_cnt_per_segment = ObMicroBlockSecondaryCache::SEGMENT_SIZE / BLOCK_SIZE - 1;
+  ASSERT_EQ(OB_SUCCESS, cache_.init(DIR, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, limit_pct));
+  ASSERT_EQ(OB_SUCCESS, cache_.start());
+  for (int64_t i = 0; i < 3; ++i) {
+    for (int64_t j = 0; j < block_cnt_per_segment; ++j) {
+      wash(TENANT_ID, i * block_cnt_per_segment + j);
+    }
+    wait_flushed(i + 1);
+  }
+  ASSERT_LT(limit_size, cache_.get_tenant_used_size(TENANT_ID));
+  // the tenant has used up its share, other tenants are not affected
+  wash(TENANT_ID, 1000);
+  wash(TENANT_ID + 1, 1001);
+  wait_flushed(4);
+  ObMicroBlockCacheKey key(TENANT_ID, MacroBlockId(0, 1001, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get(key, allocator, buf, size));
+  key.set(TENANT_ID + 1, MacroBlockId(0, 1002, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_SUCCESS, cache_.get(key, allocator, buf, size));
+  ASSERT_EQ(ObMicroBlockSecondaryCache::get_entry_size(BLOCK_SIZE), cache_.get_tenant_used_size(TENANT_ID + 1));
+}
+
+TEST_F(TestMicroBlockSecondaryCache, corrupted)
+{
+  ObArenaAllocator allocator;
+  const char *buf = nullptr;
+  int64_t size = 0;
+  ObMicroBlockSecondaryCache::Location location;
+  ASSERT_EQ(OB_SUCCESS, cache_.init(DIR, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, 100));
+  ASSERT_EQ(OB_SUCCESS, cache_.start());
+  wash(TENANT_ID, 0);
+  wash(TENANT_ID, 1);
+  wait_flushed(1);
+  ObMicroBlockCacheKey key(TENANT_ID, MacroBlockId(0, 1, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_SUCCESS, cache_.get(key, allocator, buf, size));
+  ASSERT_EQ(OB_SUCCESS, cache_.get_location(key, location));
+  corrupt(location);
+  ASSERT_EQ(OB_CHECKSUM_ERROR, cache_.get(key, allocator, buf, size));
+  // the neighbour entry is not affected
+  key.set(TENANT_ID, MacroBlockId(0, 2, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_SUCCESS, cache_.get(key, allocator, buf, size));
+  ASSERT_EQ('b', buf[0]);
+  // the entry read before its segment is recycled is not used
+  ASSERT_EQ(OB_SUCCESS, cache_.get_location(key, location));
+  const int64_t entry_size = ObMicroBlockSecondaryCache::get_entry_size(BLOCK_SIZE);
+  char *entry_buf = static_cast<char *>(allocator.alloc(entry_size));
+  ASSERT_NE(nullptr, entry_buf);
+  MEMSET(entry_buf, 0, entry_size);
+  ObMicroBlockSecondaryCache::Location stale = location;
+  stale.segment_seq_ = location.segment_seq_ - 1;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.check_entry(stale, entry_buf, entry_size, buf, size));
+  ASSERT_EQ(OB_CHECKSUM_ERROR, cache_.check_entry(location, entry_buf, entry_size, buf, size));
+}
+
+class TestSecondaryCacheIOCallback : public ObIOCallback
+{
+public:
+  TestSecondaryCacheIOCallback(
+      ObIAllocator &allocator,
+      ObMicroBlockSecondaryCache &cache,
+      const ObMicroBlockSecondaryCache::Location &location)
+    : allocator_(allocator), cache_(cache), location_(location), data_(nullptr), data_size_(0) {}
+  virtual ~TestSecondaryCacheIOCallback() {}
+  virtual ObIAllocator *get_allocator() override { return &allocator_; }
+  virtual const char *get_data() override { return data_; }
+  virtual int64_t size() const override { return sizeof(*this); }
+  virtual int alloc_data_buf(const char *io_data_buffer, const int64_t data_size) override
+  {
+    UNUSEDx(io_data_buffer, data_size);
+    return OB_NOT_SUPPORTED;
+  }
+  virtual int inner_process(const char *data_buffer, const int64_t size) override
+  {
+    int ret = OB_SUCCESS;
+    const char *block_buf = nullptr;
+    int64_t block_size = 0;
+    if (OB_FAIL(cache_.check_entry(location_, data_buffer, size, block_buf, block_size))) {
+      STORAGE_LOG(WARN, "fail to check entry", K(ret), K_(location));
+    } else if (OB_ISNULL(data_ = static_cast<char *>(allocator_.alloc(block_size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else {
+      MEMCPY(data_, block_buf, block_size);
+      data_size_ = block_size;
+    }
+    return ret;
+  }
+  TO_STRING_KV(K_(location), KP_(data), K_(data_size));
+private:
+  ObIAllocator &allocator_;
+  ObMicroBlockSecondaryCache &cache_;
+  ObMicroBlockSecondaryCache::Location location_;
+  char *data_;
+  int64_t data_size_;
+};
+
+static ObSimpleMemLimitGetter getter;
+
+class TestMicroBlockSecondaryCacheAsyncRead : public TestDataFilePrepare
+{
+public:
+  TestMicroBlockSecondaryCacheAsyncRead()
+    : TestDataFilePrepare(&getter, "TestMicroBlockSecondaryCacheAsyncRead") {}
+  virtual ~TestMicroBlockSecondaryCacheAsyncRead() {}
+  virtual void SetUp()
+  {
+    TestDataFilePrepare::SetUp();
+    system("rm -rf ./test_micro_block_secondary_cache_dir && mkdir ./test_micro_block_secondary_cache_dir");
+    ASSERT_EQ(OB_SUCCESS, cache_.init(DIR, SEGMENT_CNT * ObMicroBlockSecondaryCache::SEGMENT_SIZE, 100));
+    ASSERT_EQ(OB_SUCCESS, cache_.start());
+  }
+  virtual void TearDown()
+  {
+    cache_.destroy();
+    system("rm -rf ./test_micro_block_secondary_cache_dir");
+    TestDataFilePrepare::TearDown();
+  }
+  int read(const ObMicroBlockSecondaryCache::Location &location, ObIOHandle &io_handle)
+  {
+    int ret = OB_SUCCESS;
+    void *buf = nullptr;
+    TestSecondaryCacheIOCallback *callback = nullptr;
+    if (OB_ISNULL(buf = allocator_.alloc(sizeof(TestSecondaryCacheIOCallback)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else if (FALSE_IT(callback = new (buf) TestSecondaryCacheIOCallback(allocator_, cache_, location))) {
+    } else if (OB_FAIL(cache_.async_read(location, *callback, io_handle))) {
+      callback->~TestSecondaryCacheIOCallback();
+    } else {
+      ret = io_handle.wait();
+    }
+    return ret;
+  }
+protected:
+  char block_buf_[BLOCK_SIZE];
+  ObMicroBlockSecondaryCache cache_;
+};
+
+TEST_F(TestMicroBlockSecondaryCacheAsyncRead, wash_hit_and_checksum_mismatch)
+{
+  ObIOHandle io_handle;
+  ObMicroBlockSecondaryCache::Location location;
+  for (int64_t i = 0; i < 3; ++i) {
+    wash(cache_, block_buf_, TENANT_ID, i);
+  }
+  wait_flushed(cache_, 1);
+  ObMicroBlockCacheKey key(TENANT_ID, MacroBlockId(0, 2, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_SUCCESS, cache_.get_location(key, location));
+  // hit by the async read
+  ASSERT_EQ(OB_SUCCESS, read(location, io_handle));
+  ASSERT_EQ('b', io_handle.get_buffer()[0]);
+  ASSERT_EQ('b', io_handle.get_buffer()[BLOCK_SIZE - 1]);
+  io_handle.reset();
+  // the checksum mismatch fails the read, the caller falls back to the macro block
+  corrupt(location);
+  ASSERT_EQ(OB_CHECKSUM_ERROR, read(location, io_handle));
+  io_handle.reset();
+  // miss
+  key.set(TENANT_ID, MacroBlockId(0, 100, 0), 4096, BLOCK_SIZE);
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get_location(key, location));
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_micro_block_secondary_cache.log*");
+  OB_LOGGER.set_file_name("test_micro_block_secondary_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
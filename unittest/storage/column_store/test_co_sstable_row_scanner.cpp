@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2022 OceanBase
+ * OceanBase is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include <gtest/gtest.h>
+
+#define private public
+#define protected public
+
+#include "storage/access/ob_table_access_context.h"
+#include "storage/column_store/ob_co_sstable_row_scanner.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+
+namespace unittest
+{
+
+static const int64_t BATCH_SIZE = 256;
+static const int64_t MAX_GROUP_SIZE = BATCH_SIZE * ObCOSSTableRowScanner::MAX_FILTER_GROUP_SCALE;
+
+class TestCOSSTableRowScanner : public ::testing::Test
+{
+public:
+  virtual void SetUp() override
+  {
+    access_ctx_.limit_param_ = nullptr;
+    scanner_.access_ctx_ = &access_ctx_;
+    scanner_.batch_size_ = BATCH_SIZE;
+    scanner_.filter_group_size_ = BATCH_SIZE;
+  }
+  virtual void TearDown() override
+  {
+    scanner_.access_ctx_ = nullptr;
+  }
+  void adjust(const int64_t select_cnt)
+  {
+    scanner_.adjust_filter_group_size(scanner_.filter_group_size_, select_cnt);
+  }
+protected:
+  ObTableAccessContext access_ctx_;
+  ObCOSSTableRowScanner scanner_;
+};
+
+TEST_F(TestCOSSTableRowScanner, grow_until_max_group_size)
+{
+  // less than 1/16 rows selected, double the group size
+  adjust(0);
+  ASSERT_EQ(2 * BATCH_SIZE, scanner_.filter_group_size_);
+  adjust(2 * BATCH_SIZE / ObCOSSTableRowScanner::SPARSE_SELECT_RATIO - 1);
+  ASSERT_EQ(4 * BATCH_SIZE, scanner_.filter_group_size_);
+  adjust(1);
+  ASSERT_EQ(MAX_GROUP_SIZE, scanner_.filter_group_size_);
+  // capped by 8 times of the batch size
+  adjust(0);
+  ASSERT_EQ(MAX_GROUP_SIZE, scanner_.filter_group_size_);
+  adjust(0);
+  ASSERT_EQ(MAX_GROUP_SIZE, scanner_.filter_group_size_);
+}
+
+TEST_F(TestCOSSTableRowScanner, reset_on_dense_result)
+{
+  adjust(0);
+  adjust(0);
+  ASSERT_EQ(4 * BATCH_SIZE, scanner_.filter_group_size_);
+  // exactly 1/2 selected is not dense
+  adjust(2 * BATCH_SIZE);
+  ASSERT_EQ(4 * BATCH_SIZE, scanner_.filter_group_size_);
+  // more than 1/2 selected, back to the batch size
+  adjust(2 * BATCH_SIZE + 1);
+  ASSERT_EQ(BATCH_SIZE, scanner_.filter_group_size_);
+  adjust(BATCH_SIZE);
+  ASSERT_EQ(BATCH_SIZE, scanner_.filter_group_size_);
+}
+
+TEST_F(TestCOSSTableRowScanner, keep_between_thresholds)
+{
+  // exactly 1/16 selected is not sparse
+  adjust(BATCH_SIZE / ObCOSSTableRowScanner::SPARSE_SELECT_RATIO);
+  ASSERT_EQ(BATCH_SIZE, scanner_.filter_group_size_);
+  adjust(BATCH_SIZE / 4);
+  ASSERT_EQ(BATCH_SIZE, scanner_.filter_group_size_);
+  adjust(BATCH_SIZE / 2);
+  ASSERT_EQ(BATCH_SIZE, scanner_.filter_group_size_);
+  adjust(0);
+  ASSERT_EQ(2 * BATCH_SIZE, scanner_.filter_group_size_);
+  adjust(BATCH_SIZE / 2);
+  ASSERT_EQ(2 * BATCH_SIZE, scanner_.filter_group_size_);
+}
+
+TEST_F(TestCOSSTableRowScanner, keep_with_limit)
+{
+  ObLimitParam limit_param;
+  limit_param.offset_ = 0;
+  limit_param.limit_ = 10;
+  access_ctx_.limit_param_ = &limit_param;
+  adjust(0);
+  ASSERT_EQ(BATCH_SIZE, scanner_.filter_group_size_);
+  access_ctx_.limit_param_ = nullptr;
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_co_sstable_row_scanner.log");
+  OB_LOGGER.set_file_name("test_co_sstable_row_scanner.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,279 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "storage/memtable/mvcc/ob_keybtree.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/random/ob_random.h"
+#include "lib/time/ob_time_utility.h"
+#include "lib/worker.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+namespace oceanbase {
+namespace unittest {
+using namespace oceanbase::common;
+using namespace oceanbase::keybtree;
+using namespace oceanbase::memtable;
+
+// Same rowkey without fingerprint, as the baseline of the benchmark
+class NoFingerprintKey : public ObStoreRowkeyWrapper
+{
+public:
+  NoFingerprintKey() : ObStoreRowkeyWrapper() {}
+  NoFingerprintKey(const ObStoreRowkey *rowkey) : ObStoreRowkeyWrapper(rowkey) {}
+};
+
+class TestKeyBtreeFingerprint : public ::testing::Test
+{
+public:
+  static const int64_t ROWKEY_CNT = 3;
+  TestKeyBtreeFingerprint() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp() {}
+  virtual void TearDown() { allocator_.clear(); }
+protected:
+  // (varchar, varchar, int) with a long common prefix in the first column
+  ObStoreRowkey *build_rowkey(const int64_t seed)
+  {
+    ObObj *objs = static_cast<ObObj *>(allocator_.alloc(sizeof(ObObj) * ROWKEY_CNT));
+    char *buf = static_cast<char *>(allocator_.alloc(64));
+    ObStoreRowkey *rowkey = static_cast<ObStoreRowkey *>(allocator_.alloc(sizeof(ObStoreRowkey)));
+    EXPECT_TRUE(nullptr != objs && nullptr != buf && nullptr != rowkey);
+    const int64_t len1 = snprintf(buf, 32, "order_%010ld", seed / 7);
+    const int64_t len2 = snprintf(buf + 32, 32, "item_%06ld", seed % 7);
+    objs[0].set_varchar(buf, static_cast<int32_t>(len1));
+    objs[0].set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+    objs[1].set_varchar(buf + 32, static_cast<int32_t>(len2));
+    objs[1].set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    objs[2].set_int(seed);
+    new (rowkey) ObStoreRowkey();
+    EXPECT_EQ(OB_SUCCESS, rowkey->assign(objs, ROWKEY_CNT));
+    return rowkey;
+  }
+  ObStoreRowkey *build_rowkey(const ObObj *objs, const int64_t obj_cnt)
+  {
+    ObObj *dup_objs = static_cast<ObObj *>(allocator_.alloc(sizeof(ObObj) * obj_cnt));
+    ObStoreRowkey *rowkey = static_cast<ObStoreRowkey *>(allocator_.alloc(sizeof(ObStoreRowkey)));
+    EXPECT_TRUE(nullptr != dup_objs && nullptr != rowkey);
+    for (int64_t i = 0; i < obj_cnt; ++i) {
+      dup_objs[i] = objs[i];
+    }
+    new (rowkey) ObStoreRowkey();
+    EXPECT_EQ(OB_SUCCESS, rowkey->assign(dup_objs, obj_cnt));
+    return rowkey;
+  }
+  // the fingerprints must agree with the comparator whenever they decide the order
+  int64_t check_order(const std::vector<ObStoreRowkey *> &rowkeys)
+  {
+    int64_t differ_cnt = 0;
+    for (int64_t i = 0; i < rowkeys.size(); ++i) {
+      for (int64_t j = 0; j < rowkeys.size(); ++j) {
+        const ObStoreRowkeyWrapper left(rowkeys.at(i));
+        const ObStoreRowkeyWrapper right(rowkeys.at(j));
+        const uint64_t left_fp = left.get_fingerprint();
+        const uint64_t right_fp = right.get_fingerprint();
+        int cmp = 0;
+        EXPECT_EQ(OB_SUCCESS, left.compare(right, cmp));
+        if (0 != left_fp && 0 != right_fp && left_fp != right_fp) {
+          ++differ_cnt;
+          EXPECT_EQ(left_fp < right_fp, cmp < 0) << "left: " << left.repr() << " right: " << right.repr();
+        }
+      }
+    }
+    return differ_cnt;
+  }
+  template <typename BtreeKey>
+  void bench(const std::vector<ObStoreRowkey *> &rowkeys, int64_t &insert_us, int64_t &scan_us);
+protected:
+  ObArenaAllocator allocator_;
+};
+
+template <typename BtreeKey>
+void TestKeyBtreeFingerprint::bench(
+    const std::vector<ObStoreRowkey *> &rowkeys,
+    int64_t &insert_us,
+    int64_t &scan_us)
+{
+  ObArenaAllocator node_arena(ObModIds::TEST);
+  BtreeNodeAllocator<BtreeKey, ObMvccRow *> node_allocator(node_arena);
+  ObKeyBtree<BtreeKey, ObMvccRow *> btree(node_allocator);
+  ASSERT_EQ(OB_SUCCESS, btree.init());
+  int64_t start_us = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < rowkeys.size(); ++i) {
+    ObMvccRow *val = reinterpret_cast<ObMvccRow *>((i + 1) << 3);
+    ASSERT_EQ(OB_SUCCESS, btree.insert(BtreeKey(rowkeys.at(i)), val));
+  }
+  insert_us = ObTimeUtility::current_time() - start_us;
+
+  start_us = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < rowkeys.size(); ++i) {
+    ObMvccRow *val = nullptr;
+    ASSERT_EQ(OB_SUCCESS, btree.get(BtreeKey(rowkeys.at(i)), val));
+    ASSERT_EQ(reinterpret_cast<ObMvccRow *>((i + 1) << 3), val);
+  }
+  ObStoreRowkey min_key;
+  ObStoreRowkey max_key;
+  min_key.set_min();
+  max_key.set_max();
+  BtreeIterator<BtreeKey, ObMvccRow *> iter;
+  ASSERT_EQ(OB_SUCCESS, btree.set_key_range(iter, BtreeKey(&min_key), true, BtreeKey(&max_key), true));
+  BtreeKey key;
+  BtreeKey prev_key;
+  ObMvccRow *val = nullptr;
+  int64_t count = 0;
+  int cmp = 0;
+  while (OB_SUCCESS == iter.get_next(key, val)) {
+    if (count > 0) {
+      ASSERT_EQ(OB_SUCCESS, prev_key.compare(key, cmp));
+      ASSERT_LT(cmp, 0);
+    }
+    prev_key = key;
+    ++count;
+  }
+  scan_us = ObTimeUtility::current_time() - start_us;
+  ASSERT_EQ(static_cast<int64_t>(rowkeys.size()), count);
+  btree.destroy(false /*is_batch_destroy*/);
+}
+
+TEST_F(TestKeyBtreeFingerprint, fingerprint_order)
+{
+  const int64_t KEY_NUM = 500;
+  std::vector<ObStoreRowkey *> rowkeys;
+  for (int64_t i = 0; i < KEY_NUM; ++i) {
+    rowkeys.push_back(build_rowkey(ObRandom::rand(0, KEY_NUM * 10)));
+  }
+  ObStoreRowkey min_key;
+  ObStoreRowkey max_key;
+  min_key.set_min();
+  max_key.set_max();
+  rowkeys.push_back(&min_key);
+  rowkeys.push_back(&max_key);
+  ASSERT_GT(check_order(rowkeys), 0);
+  // min key has no fingerprint, max key is greater than all the fingerprints
+  ASSERT_EQ(0, ObStoreRowkeyWrapper(&min_key).get_fingerprint());
+  ASSERT_EQ(UINT64_MAX, ObStoreRowkeyWrapper(&max_key).get_fingerprint());
+}
+
+TEST_F(TestKeyBtreeFingerprint, min_max_value)
+{
+  ObObj objs[2];
+  // ('ab', min) < ('ab', 1) < ('ab', max) < ('abc', min)
+  objs[0].set_varchar("ab");
+  objs[0].set_collation_type(CS_TYPE_BINARY);
+  objs[1].set_min_value();
+  ObStoreRowkey *ab_min = build_rowkey(objs, 2);
+  objs[1].set_int(1);
+  ObStoreRowkey *ab_one = build_rowkey(objs, 2);
+  objs[1].set_max_value();
+  ObStoreRowkey *ab_max = build_rowkey(objs, 2);
+  objs[0].set_varchar("abc");
+  objs[1].set_min_value();
+  ObStoreRowkey *abc_min = build_rowkey(objs, 2);
+  const uint64_t ab_min_fp = ObStoreRowkeyWrapper(ab_min).get_fingerprint();
+  const uint64_t ab_one_fp = ObStoreRowkeyWrapper(ab_one).get_fingerprint();
+  const uint64_t ab_max_fp = ObStoreRowkeyWrapper(ab_max).get_fingerprint();
+  const uint64_t abc_min_fp = ObStoreRowkeyWrapper(abc_min).get_fingerprint();
+  ASSERT_NE(0, ab_min_fp);
+  ASSERT_LT(ab_min_fp, ab_one_fp);
+  ASSERT_LT(ab_one_fp, ab_max_fp);
+  ASSERT_LT(ab_max_fp, abc_min_fp);
+  std::vector<ObStoreRowkey *> rowkeys;
+  rowkeys.push_back(ab_min);
+  rowkeys.push_back(ab_one);
+  rowkeys.push_back(ab_max);
+  rowkeys.push_back(abc_min);
+  ASSERT_EQ(12, check_order(rowkeys));
+}
+
+TEST_F(TestKeyBtreeFingerprint, null_value)
+{
+  ObObj objs[2];
+  // null in the first 8 bytes, no fingerprint
+  objs[0].set_null();
+  objs[1].set_int(1);
+  ASSERT_EQ(0, ObStoreRowkeyWrapper(build_rowkey(objs, 2)).get_fingerprint());
+  objs[0].set_varchar("ab");
+  objs[0].set_collation_type(CS_TYPE_BINARY);
+  objs[1].set_null();
+  ASSERT_EQ(0, ObStoreRowkeyWrapper(build_rowkey(objs, 2)).get_fingerprint());
+  // null after the first 8 bytes, the prefix decides the fingerprint
+  objs[0].set_varchar("abcdefgh");
+  ObStoreRowkey *null_key = build_rowkey(objs, 2);
+  objs[1].set_int(1);
+  ObStoreRowkey *int_key = build_rowkey(objs, 2);
+  ASSERT_NE(0, ObStoreRowkeyWrapper(null_key).get_fingerprint());
+  ASSERT_EQ(ObStoreRowkeyWrapper(null_key).get_fingerprint(),
+            ObStoreRowkeyWrapper(int_key).get_fingerprint());
+  // invalid unicode has no order perserving sortkey
+  objs[0].set_varchar("\xff\xfe");
+  objs[0].set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  ASSERT_EQ(0, ObStoreRowkeyWrapper(build_rowkey(objs, 2)).get_fingerprint());
+}
+
+TEST_F(TestKeyBtreeFingerprint, oracle_mode)
+{
+  lib::CompatModeGuard mode_guard(lib::Worker::CompatMode::ORACLE);
+  // null is the largest in oracle mode, and the trailing spaces are compared
+  const char *strs[] = {"a", "a ", "a  b", "ab", "b"};
+  const int64_t str_cnt = sizeof(strs) / sizeof(strs[0]);
+  std::vector<ObStoreRowkey *> rowkeys;
+  ObObj objs[2];
+  for (int64_t i = 0; i <= str_cnt; ++i) {
+    for (int64_t j = -1; j < 3; ++j) {
+      if (i == str_cnt) {
+        objs[0].set_null();
+      } else {
+        objs[0].set_varchar(strs[i]);
+        objs[0].set_collation_type(CS_TYPE_UTF8MB4_BIN);
+      }
+      if (j < 0) {
+        objs[1].set_null();
+      } else {
+        objs[1].set_int(j);
+      }
+      rowkeys.push_back(build_rowkey(objs, 2));
+    }
+  }
+  ASSERT_GT(check_order(rowkeys), 0);
+  objs[0].set_null();
+  objs[1].set_int(1);
+  ASSERT_EQ(0, ObStoreRowkeyWrapper(build_rowkey(objs, 2)).get_fingerprint());
+}
+
+TEST_F(TestKeyBtreeFingerprint, insert_and_scan_perf)
+{
+  const int64_t KEY_NUM = 500000;
+  std::vector<ObStoreRowkey *> rowkeys;
+  for (int64_t i = 0; i < KEY_NUM; ++i) {
+    rowkeys.push_back(build_rowkey(i));
+  }
+  std::random_shuffle(rowkeys.begin(), rowkeys.end());
+  int64_t insert_us = 0;
+  int64_t scan_us = 0;
+  int64_t fp_insert_us = 0;
+  int64_t fp_scan_us = 0;
+  bench<NoFingerprintKey>(rowkeys, insert_us, scan_us);
+  bench<ObStoreRowkeyWrapper>(rowkeys, fp_insert_us, fp_scan_us);
+  LOG_INFO("keybtree fingerprint perf", K(KEY_NUM), K(insert_us), K(fp_insert_us), K(scan_us), K(fp_scan_us));
+}
+
+}  // namespace unittest
+}  // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_file_name("test_keybtree_fingerprint.log", true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -10,7 +10,9 @@
  * See the Mulan PubL v2 for more details.
  */
 
+#define private public
 #include "storage/memtable/mvcc/ob_query_engine.h"
+#undef private
 
 #include "storage/memtable/ob_memtable_key.h"
 #include "lib/atomic/ob_atomic.h"
@@ -20,6 +22,7 @@
 
 #include <gtest/gtest.h>
 #include <thread>
+#include <vector>
 
 namespace oceanbase
 {
@@ -156,6 +159,110 @@ TEST(TestObQueryEngine, smoke_test)
   test_scan(3, false,  3, false);
   test_scan(4, false,  4, false);
   test_scan(5, false,  5, false);
+
+  // the same scans on the frozen image
+  ASSERT_EQ(OB_SUCCESS, qe.build_frozen_image());
+  ASSERT_TRUE(qe.has_frozen_image());
+  test_scan(0, true,  5, true);
+  test_scan(0, false, 5, true);
+  test_scan(0, true,  5, false);
+  test_scan(0, false, 5, false);
+
+  test_scan(5, true,  0, true);
+  test_scan(5, false, 0, true);
+  test_scan(5, true,  0, false);
+  test_scan(5, false, 0, false);
+
+  test_scan(1, true,  4, true);
+  test_scan(1, false, 4, true);
+  test_scan(1, true,  4, false);
+  test_scan(1, false, 4, false);
+
+  test_scan(4, true,  1, true);
+  test_scan(4, false, 1, true);
+  test_scan(4, true,  1, false);
+  test_scan(4, false, 1, false);
+
+  test_scan(0, true,  0, true);
+  test_scan(1, true,  1, true);
+  test_scan(2, true,  2, true);
+  test_scan(3, true,  3, true);
+  test_scan(4, true,  4, true);
+  test_scan(5, true,  5, true);
+
+  test_scan(0, false,  0, false);
+  test_scan(1, false,  1, false);
+  test_scan(2, false,  2, false);
+  test_scan(3, false,  3, false);
+  test_scan(4, false,  4, false);
+  test_scan(5, false,  5, false);
+}
+
+TEST(TestObQueryEngine, concurrent_build_frozen_image)
+{
+  static const int64_t R_COUNT = 2000;
+  static const int64_t BUILD_THREAD_CNT = 4;
+  static const int64_t SCAN_THREAD_CNT = 4;
+
+  ObModAllocator allocator;
+  ObQueryEngine qe(allocator);
+  ObMemtableKey *mtk[R_COUNT];
+  ObMvccTransNode *tdn = new ObMvccTransNode[R_COUNT];
+  ObMvccRow *mtv = new ObMvccRow[R_COUNT];
+  ASSERT_EQ(OB_SUCCESS, qe.init());
+  for (int64_t i = 0; i < R_COUNT; i++) {
+    INIT_MTK(allocator, mtk[i], V("aaaa", 4), I(i));
+    mtv[i].list_head_ = &tdn[i];
+    ASSERT_EQ(OB_SUCCESS, qe.set(mtk[i], &mtv[i]));
+  }
+
+  // the scans see all the keys in order whether the image is ready or not
+  auto scan_all = [&]() {
+    ObIQueryEngineIterator *iter = nullptr;
+    EXPECT_EQ(OB_SUCCESS, qe.scan(mtk[0], false, mtk[R_COUNT - 1], false, iter));
+    for (int64_t i = 0; i < R_COUNT; i++) {
+      EXPECT_EQ(OB_SUCCESS, iter->next());
+      EXPECT_EQ(0, mtk[i]->compare(*iter->get_key()));
+      EXPECT_EQ(&mtv[i], iter->get_value());
+    }
+    EXPECT_EQ(OB_ITER_END, iter->next());
+    qe.revert_iter(iter);
+  };
+
+  bool stop = false;
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < SCAN_THREAD_CNT; i++) {
+    threads.push_back(std::thread([&]() {
+      while (!ATOMIC_LOAD(&stop)) {
+        scan_all();
+      }
+      scan_all();
+    }));
+  }
+  std::vector<std::thread> builders;
+  for (int64_t i = 0; i < BUILD_THREAD_CNT; i++) {
+    builders.push_back(std::thread([&]() {
+      EXPECT_EQ(OB_SUCCESS, qe.build_frozen_image());
+    }));
+  }
+  for (int64_t i = 0; i < BUILD_THREAD_CNT; i++) {
+    builders[i].join();
+  }
+  ATOMIC_STORE(&stop, true);
+  for (int64_t i = 0; i < SCAN_THREAD_CNT; i++) {
+    threads[i].join();
+  }
+
+  // only one thread builds the image, the keys are not pushed twice
+  ASSERT_TRUE(qe.has_frozen_image());
+  ASSERT_EQ(R_COUNT, qe.frozen_image_.count());
+  ASSERT_EQ(OB_SUCCESS, qe.build_frozen_image());
+  ASSERT_EQ(R_COUNT, qe.frozen_image_.count());
+  scan_all();
+
+  qe.destroy();
+  delete[] mtv;
+  delete[] tdn;
 }
 
 }
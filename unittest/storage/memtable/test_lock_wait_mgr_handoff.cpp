@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#define private public
+#define protected public
+#include "storage/memtable/ob_lock_wait_mgr.h"
+#include "common/rowkey/ob_store_rowkey.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace memtable;
+using namespace transaction;
+
+// the reposted requests are recorded instead of being put into the worker queue
+class MockLockWaitMgr : public ObLockWaitMgr
+{
+public:
+  virtual int repost(Node *node) override
+  {
+    reposted_.push_back(node);
+    return OB_SUCCESS;
+  }
+  std::vector<Node *> reposted_;
+};
+
+class TestLockWaitMgrHandoff : public ::testing::Test
+{
+public:
+  typedef ObLockWaitMgr::Node Node;
+  virtual void SetUp() override
+  {
+    mgr_ = new MockLockWaitMgr();
+    mgr_->is_inited_ = true;
+    mgr_->fifo_handoff_ = true;
+    // the thread pool is not started, let the waiters park
+    ATOMIC_STORE(&mgr_->stop_, false);
+    rowkey_obj_[0].set_int(1);
+    rowkey_obj_[1].set_int(2);
+  }
+  virtual void TearDown() override
+  {
+    ATOMIC_STORE(&mgr_->stop_, true);
+    delete mgr_;
+    mgr_ = NULL;
+  }
+protected:
+  uint64_t row_hash(const int64_t idx)
+  {
+    ObStoreRowkey rowkey(&rowkey_obj_[idx], 1);
+    ObMemtableKey key(&rowkey);
+    return LockHashHelper::hash_rowkey(tablet_id_, key);
+  }
+  // park the request of tx_id on the hash, and remember its conflict row
+  void park(Node &node, const uint64_t hash, const uint64_t conflict_row_hash,
+            const int64_t tx_id, const int64_t holder_tx_id, const int64_t recv_ts)
+  {
+    node.set(&node, hash, mgr_->get_seq(hash), INT64_MAX, tablet_id_.id(), 0, 0, "key",
+             1, 2, tx_id, holder_tx_id, share::ObLSID(1001));
+    node.set_row_hash(conflict_row_hash);
+    node.recv_ts_ = recv_ts;
+    ASSERT_TRUE(mgr_->wait(&node));
+  }
+  bool is_handed_off_to(const uint64_t hash, const int64_t tx_id)
+  {
+    int64_t handoff_tx_id = 0;
+    int64_t expire_ts = 0;
+    return mgr_->get_handoff_(hash, handoff_tx_id, expire_ts) && handoff_tx_id == tx_id;
+  }
+protected:
+  MockLockWaitMgr *mgr_;
+  ObTabletID tablet_id_ = ObTabletID(200001);
+  ObObj rowkey_obj_[2];
+};
+
+TEST_F(TestLockWaitMgrHandoff, fifo_wakeup_order)
+{
+  const uint64_t row = row_hash(0);
+  Node n1, n2, n3;
+  // park out of arrival order, the waiters of the row are ordered by recv_ts
+  park(n2, row, row, 12, 10, 2);
+  park(n3, row, row, 13, 10, 3);
+  park(n1, row, row, 11, 10, 1);
+  ASSERT_EQ(3, mgr_->total_wait_node_);
+
+  // each wakeup of the row hands it off to the oldest waiter only
+  mgr_->wakeup(row);
+  ASSERT_EQ(1, mgr_->reposted_.size());
+  ASSERT_EQ(&n1, mgr_->reposted_[0]);
+  ASSERT_EQ(row, n1.hold_key_);
+  ASSERT_TRUE(is_handed_off_to(row, 11));
+
+  mgr_->wakeup(row);
+  ASSERT_EQ(2, mgr_->reposted_.size());
+  ASSERT_EQ(&n2, mgr_->reposted_[1]);
+  ASSERT_TRUE(is_handed_off_to(row, 12));
+
+  mgr_->wakeup(row);
+  ASSERT_EQ(3, mgr_->reposted_.size());
+  ASSERT_EQ(&n3, mgr_->reposted_[2]);
+  ASSERT_TRUE(is_handed_off_to(row, 13));
+  ASSERT_EQ(0, mgr_->total_wait_node_);
+
+  // no waiter remains, the handoff is cleared
+  mgr_->wakeup(row);
+  ASSERT_EQ(3, mgr_->reposted_.size());
+  ASSERT_FALSE(is_handed_off_to(row, 13));
+}
+
+TEST_F(TestLockWaitMgrHandoff, txn_end_wakes_row_heads)
+{
+  const ObTransID holder(10);
+  const uint64_t tx_hash = LockHashHelper::hash_trans(holder);
+  const uint64_t row_a = row_hash(0);
+  const uint64_t row_b = row_hash(1);
+  Node a1, a2, b1, t1;
+  park(a1, tx_hash, row_a, 11, 10, 1);
+  park(a2, tx_hash, row_a, 12, 10, 2);
+  park(b1, tx_hash, row_b, 13, 10, 3);
+  // the waiter without the conflict row is reposted as before
+  park(t1, tx_hash, 0, 14, 10, 4);
+
+  mgr_->wakeup(holder);
+  ASSERT_EQ(3, mgr_->reposted_.size());
+  ASSERT_EQ(&a1, mgr_->reposted_[0]);
+  ASSERT_EQ(&b1, mgr_->reposted_[1]);
+  ASSERT_EQ(&t1, mgr_->reposted_[2]);
+  ASSERT_TRUE(is_handed_off_to(row_a, 11));
+  ASSERT_TRUE(is_handed_off_to(row_b, 13));
+  ASSERT_EQ(tx_hash, t1.hold_key_);
+
+  // the other waiter of row a is moved to wait behind the head
+  ASSERT_EQ(1, mgr_->total_wait_node_);
+  ASSERT_EQ(row_a, a2.hash());
+  ASSERT_EQ(1, a2.try_lock_times_);
+
+  // the head releases the row without locking it, the next waiter is woken up
+  mgr_->wakeup(row_a);
+  ASSERT_EQ(4, mgr_->reposted_.size());
+  ASSERT_EQ(&a2, mgr_->reposted_[3]);
+  ASSERT_TRUE(is_handed_off_to(row_a, 12));
+  ASSERT_EQ(0, mgr_->total_wait_node_);
+}
+
+TEST_F(TestLockWaitMgrHandoff, repost_when_repark_fails)
+{
+  const ObTransID holder(10);
+  const uint64_t tx_hash = LockHashHelper::hash_trans(holder);
+  const uint64_t row = row_hash(0);
+  Node n1, n2;
+  park(n1, tx_hash, row, 11, 10, 1);
+  park(n2, tx_hash, row, 12, 10, 2);
+
+  // the waiter behind the head can not be parked again, it is reposted at once
+  ATOMIC_STORE(&mgr_->stop_, true);
+  mgr_->wakeup(holder);
+  ASSERT_EQ(2, mgr_->reposted_.size());
+  ASSERT_EQ(&n1, mgr_->reposted_[0]);
+  ASSERT_EQ(&n2, mgr_->reposted_[1]);
+  ASSERT_EQ(row, n2.hash());
+  ASSERT_EQ(0, mgr_->total_wait_node_);
+  ASSERT_TRUE(is_handed_off_to(row, 11));
+}
+
+TEST_F(TestLockWaitMgrHandoff, handoff_expire)
+{
+  ObStoreRowkey rowkey(&rowkey_obj_[0], 1);
+  ObMemtableKey key(&rowkey);
+  const uint64_t row = row_hash(0);
+  ObTransID head_tx_id;
+  Node n1;
+  park(n1, row, row, 11, 10, 1);
+  mgr_->wakeup(row);
+  ASSERT_EQ(1, mgr_->reposted_.size());
+
+  // the newcomers of other txns queue behind the head, but the head itself not
+  ASSERT_TRUE(mgr_->is_handed_off(tablet_id_, key, ObTransID(12), head_tx_id));
+  ASSERT_EQ(ObTransID(11), head_tx_id);
+  ASSERT_FALSE(mgr_->is_handed_off(tablet_id_, key, ObTransID(11), head_tx_id));
+
+  // the head never retries, the row is released after the handoff expires
+  usleep(ObLockWaitMgr::HANDOFF_EXPIRE_US + 10 * 1000);
+  ASSERT_FALSE(mgr_->is_handed_off(tablet_id_, key, ObTransID(12), head_tx_id));
+
+  // the handoff is not visible if the mode is turned off
+  mgr_->wakeup(row);
+  mgr_->set_handoff_(row, 11);
+  ASSERT_TRUE(mgr_->is_handed_off(tablet_id_, key, ObTransID(12), head_tx_id));
+  mgr_->fifo_handoff_ = false;
+  ASSERT_FALSE(mgr_->is_handed_off(tablet_id_, key, ObTransID(12), head_tx_id));
+}
+
+TEST_F(TestLockWaitMgrHandoff, head_locks_row)
+{
+  ObStoreRowkey rowkey(&rowkey_obj_[0], 1);
+  ObMemtableKey key(&rowkey);
+  const uint64_t row = row_hash(0);
+  ObTransID head_tx_id;
+  Node n1;
+  park(n1, row, row, 11, 10, 1);
+  mgr_->wakeup(row);
+  ASSERT_TRUE(mgr_->is_handed_off(tablet_id_, key, ObTransID(12), head_tx_id));
+
+  // the retried head locks the row, the handoff and its hold key are dropped,
+  // so the end of the request does not wake up the next waiter
+  ObLockWaitMgr::get_thread_node() = &n1;
+  ObLockWaitMgr::get_thread_hold_key() = n1.hold_key_;
+  mgr_->on_row_locked(tablet_id_, key);
+  ASSERT_EQ(0, ObLockWaitMgr::get_thread_hold_key());
+  ASSERT_FALSE(mgr_->is_handed_off(tablet_id_, key, ObTransID(12), head_tx_id));
+  ObLockWaitMgr::get_thread_node() = NULL;
+}
+
+}  // namespace unittest
+}  // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_lock_wait_mgr_handoff.log*");
+  OB_LOGGER.set_file_name("test_lock_wait_mgr_handoff.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
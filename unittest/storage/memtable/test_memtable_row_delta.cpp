@@ -0,0 +1,562 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "storage/memtable/ob_memtable_delta.h"
+#include "storage/memtable/ob_memtable_data.h"
+#include "storage/memtable/ob_nop_bitmap.h"
+#include "storage/memtable/mvcc/ob_mvcc_row.h"
+#include "storage/memtable/mvcc/ob_row_data.h"
+#include "storage/access/ob_table_read_info.h"
+#include "storage/blocksstable/ob_row_reader.h"
+#include "storage/blocksstable/ob_row_writer.h"
+#include "storage/tx_table/ob_tx_table_interface.h"
+#include "storage/ob_i_store.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_se_array.h"
+#include "lib/time/ob_time_utility.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace oceanbase::common;
+using namespace oceanbase::storage;
+using namespace oceanbase::memtable;
+using namespace oceanbase::blocksstable;
+using namespace oceanbase::transaction;
+
+// the cell values of the tx node, NOP for the column not written
+static const int64_t NOP = INT64_MIN;
+static const int64_t NUL = INT64_MIN + 1;
+
+class TestMemtableRowDelta : public ::testing::Test
+{
+public:
+  static const int64_t ROWKEY_CNT = 1;
+  static const int64_t COL_CNT = 4;
+  TestMemtableRowDelta() : allocator_("RowDeltaTest") {}
+  virtual void TearDown() { allocator_.reset(); }
+  virtual void SetUp()
+  {
+    // (pk, cnt1, cnt2, name)
+    old_cells_[0].set_int(1);
+    old_cells_[1].set_int(100);
+    old_cells_[2].set_int(-5);
+    old_cells_[3].set_varchar("abc");
+    for (int64_t i = 0; i < COL_CNT; ++i) {
+      new_cells_[i] = old_cells_[i];
+    }
+    init_row(old_cells_, old_row_);
+    init_row(new_cells_, new_row_);
+  }
+protected:
+  void init_row(ObObj *cells, ObStoreRow &row)
+  {
+    row.flag_.set_flag(blocksstable::ObDmlFlag::DF_UPDATE);
+    row.row_val_.cells_ = cells;
+    row.row_val_.count_ = COL_CNT;
+  }
+  // (pk, cnt1, cnt2), the name column is only written by the insert node
+  void write_row(const ObDmlFlag flag, const int64_t *values, char *&buf, int64_t &len)
+  {
+    ObDatumRow row;
+    ObRowWriter row_writer;
+    char *row_buf = nullptr;
+    ASSERT_EQ(OB_SUCCESS, row.init(allocator_, COL_CNT));
+    row.count_ = COL_CNT;
+    row.row_flag_.set_flag(flag);
+    for (int64_t i = 0; i < COL_CNT - 1; ++i) {
+      if (NOP == values[i]) {
+        row.storage_datums_[i].set_nop();
+      } else if (NUL == values[i]) {
+        row.storage_datums_[i].set_null();
+      } else {
+        row.storage_datums_[i].set_int(values[i]);
+      }
+    }
+    if (ObDmlFlag::DF_INSERT == flag) {
+      row.storage_datums_[COL_CNT - 1].set_string("abc", 3);
+    } else {
+      row.storage_datums_[COL_CNT - 1].set_nop();
+    }
+    ASSERT_EQ(OB_SUCCESS, row_writer.write(ROWKEY_CNT, row, row_buf, len));
+    ASSERT_TRUE(NULL != (buf = (char *)allocator_.alloc(len)));
+    MEMCPY(buf, row_buf, len);
+  }
+  ObMvccTransNode *new_node(const int64_t tx_id,
+                            const uint8_t type,
+                            const ObDmlFlag flag,
+                            const int64_t pk,
+                            const int64_t cnt1,
+                            const int64_t cnt2,
+                            const int64_t commit_version = 0)
+  {
+    const int64_t values[COL_CNT - 1] = {pk, cnt1, cnt2};
+    char *buf = nullptr;
+    int64_t len = 0;
+    ObMvccTransNode *node = NULL;
+    write_row(flag, values, buf, len);
+    ObMemtableData mtd(flag, len, buf);
+    void *node_buf = allocator_.alloc(sizeof(ObMvccTransNode) + mtd.dup_size());
+    EXPECT_TRUE(NULL != node_buf);
+    node = new (node_buf) ObMvccTransNode();
+    EXPECT_EQ(OB_SUCCESS, ObMemtableDataHeader::build(reinterpret_cast<ObMemtableDataHeader *>(node->buf_), &mtd));
+    node->tx_id_ = ObTransID(tx_id);
+    node->type_ = type;
+    if (commit_version > 0) {
+      node->trans_version_.convert_for_tx(commit_version);
+      node->set_committed();
+    }
+    return node;
+  }
+  // link the node on the top of the row
+  void append(ObMvccRow &row, ObMvccTransNode *node)
+  {
+    node->prev_ = row.list_head_;
+    node->next_ = NULL;
+    if (NULL != row.list_head_) {
+      row.list_head_->next_ = node;
+    }
+    row.list_head_ = node;
+    row.total_trans_node_cnt_++;
+  }
+  void read_int(const char *buf, const int64_t len, const int64_t idx, int64_t &value, bool &is_null)
+  {
+    ObRowReader reader;
+    ObStorageDatum datum;
+    ASSERT_EQ(OB_SUCCESS, reader.read_column(buf, len, idx, datum));
+    is_null = datum.is_null();
+    value = is_null ? 0 : datum.get_int();
+  }
+  void check_node_value(const ObMvccTransNode &node, const int64_t cnt1, const int64_t cnt2)
+  {
+    const ObMemtableDataHeader *mtd = reinterpret_cast<const ObMemtableDataHeader *>(node.buf_);
+    const int64_t expected[COL_CNT - 1] = {0, cnt1, cnt2};
+    ObRowReader reader;
+    ObStorageDatum datum;
+    for (int64_t i = ROWKEY_CNT; i < COL_CNT - 1; ++i) {
+      ASSERT_EQ(OB_SUCCESS, reader.read_column(mtd->buf_, mtd->buf_len_, i, datum));
+      if (NOP == expected[i]) {
+        ASSERT_TRUE(datum.is_nop());
+      } else {
+        ASSERT_FALSE(datum.is_nop() || datum.is_null());
+        ASSERT_EQ(expected[i], datum.get_int());
+      }
+    }
+  }
+  share::SCN scn(const int64_t v)
+  {
+    share::SCN ret_scn;
+    ret_scn.convert_for_tx(v);
+    return ret_scn;
+  }
+protected:
+  ObArenaAllocator allocator_;
+  ObObj old_cells_[COL_CNT];
+  ObObj new_cells_[COL_CNT];
+  ObStoreRow old_row_;
+  ObStoreRow new_row_;
+};
+
+TEST_F(TestMemtableRowDelta, build_delta_row)
+{
+  ObSEArray<int64_t, 4> update_idx;
+  ObSEArray<ObObj, 4> delta_cells;
+  ObStoreRow delta_row;
+  bool is_delta = false;
+  new_cells_[1].set_int(103);
+  new_cells_[2].set_int(-15);
+  ASSERT_EQ(OB_SUCCESS, update_idx.push_back(1));
+  ASSERT_EQ(OB_SUCCESS, update_idx.push_back(2));
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::build_delta_row(ROWKEY_CNT, old_row_, new_row_, update_idx,
+                                                            delta_cells, delta_row, is_delta));
+  ASSERT_TRUE(is_delta);
+  ASSERT_EQ(COL_CNT, delta_row.row_val_.count_);
+  ASSERT_EQ(1, delta_row.row_val_.cells_[0].get_int());
+  ASSERT_EQ(3, delta_row.row_val_.cells_[1].get_int());
+  ASSERT_EQ(-10, delta_row.row_val_.cells_[2].get_int());
+  // the new row is kept
+  ASSERT_EQ(103, new_row_.row_val_.cells_[1].get_int());
+}
+
+TEST_F(TestMemtableRowDelta, not_delta)
+{
+  ObSEArray<int64_t, 4> update_idx;
+  ObSEArray<ObObj, 4> delta_cells;
+  ObStoreRow delta_row;
+  bool is_delta = true;
+  // the non bigint column
+  new_cells_[3].set_varchar("abd");
+  ASSERT_EQ(OB_SUCCESS, update_idx.push_back(3));
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::build_delta_row(ROWKEY_CNT, old_row_, new_row_, update_idx,
+                                                            delta_cells, delta_row, is_delta));
+  ASSERT_FALSE(is_delta);
+
+  // the null value
+  update_idx.reset();
+  new_cells_[3] = old_cells_[3];
+  new_cells_[1].set_null();
+  ASSERT_EQ(OB_SUCCESS, update_idx.push_back(1));
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::build_delta_row(ROWKEY_CNT, old_row_, new_row_, update_idx,
+                                                            delta_cells, delta_row, is_delta));
+  ASSERT_FALSE(is_delta);
+
+  // the delta overflows
+  new_cells_[1].set_int(INT64_MAX);
+  old_cells_[1].set_int(-1);
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::build_delta_row(ROWKEY_CNT, old_row_, new_row_, update_idx,
+                                                            delta_cells, delta_row, is_delta));
+  ASSERT_FALSE(is_delta);
+
+  // only the rowkey is updated
+  update_idx.reset();
+  old_cells_[1] = new_cells_[1];
+  new_cells_[0].set_int(2);
+  ASSERT_EQ(OB_SUCCESS, update_idx.push_back(0));
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::build_delta_row(ROWKEY_CNT, old_row_, new_row_, update_idx,
+                                                            delta_cells, delta_row, is_delta));
+  ASSERT_FALSE(is_delta);
+
+  // the delete row
+  update_idx.reset();
+  new_row_.flag_.set_flag(blocksstable::ObDmlFlag::DF_DELETE);
+  ASSERT_EQ(OB_SUCCESS, update_idx.push_back(1));
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::build_delta_row(ROWKEY_CNT, old_row_, new_row_, update_idx,
+                                                            delta_cells, delta_row, is_delta));
+  ASSERT_FALSE(is_delta);
+}
+
+TEST_F(TestMemtableRowDelta, check_delta_write)
+{
+  ObTxTableGuard tx_table_guard;
+  ObMvccRow row;
+  // the committed base and the pending decrement of tx 2
+  append(row, new_node(1, NDT_NORMAL, ObDmlFlag::DF_INSERT, 1, 100, -5, 10));
+  append(row, new_node(2, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, -60, NOP));
+
+  // the escrow check counts the pending decrement in
+  ObMvccTransNode *delta = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, -50, NOP);
+  ASSERT_EQ(OB_ERR_CHECK_CONSTRAINT_VIOLATED,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, row, *delta, ObTransID(3), scn(20), true));
+  // without the non-negative check
+  ASSERT_EQ(OB_SUCCESS,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, row, *delta, ObTransID(3), scn(20), false));
+  delta = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, -40, NOP);
+  ASSERT_EQ(OB_SUCCESS,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, row, *delta, ObTransID(3), scn(20), true));
+  // the increment is not limited by the check, even if the base is negative
+  delta = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, NOP, 1);
+  ASSERT_EQ(OB_SUCCESS,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, row, *delta, ObTransID(3), scn(20), true));
+
+  // the value may overflow after the pending increment is folded
+  append(row, new_node(4, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, INT64_MAX - 100, NOP));
+  delta = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 1, NOP);
+  ASSERT_EQ(OB_EAGAIN,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, row, *delta, ObTransID(3), scn(20), false));
+
+  // the base is not visible to the snapshot
+  ASSERT_EQ(OB_EAGAIN,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, row, *delta, ObTransID(3), scn(5), false));
+
+  // the base is locked by another txn
+  ObMvccRow locked_row;
+  append(locked_row, new_node(1, NDT_NORMAL, ObDmlFlag::DF_INSERT, 1, 100, -5, 10));
+  append(locked_row, new_node(5, NDT_NORMAL, ObDmlFlag::DF_UPDATE, 1, 90, NOP));
+  ASSERT_EQ(OB_EAGAIN,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, locked_row, *delta, ObTransID(3), scn(20), false));
+
+  // the base value is NULL or not in the memtable
+  ObMvccRow null_row;
+  append(null_row, new_node(1, NDT_NORMAL, ObDmlFlag::DF_INSERT, 1, NUL, -5, 10));
+  ASSERT_EQ(OB_EAGAIN,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, null_row, *delta, ObTransID(3), scn(20), false));
+  ObMvccRow sparse_row;
+  append(sparse_row, new_node(1, NDT_NORMAL, ObDmlFlag::DF_UPDATE, 1, NOP, -5, 10));
+  ASSERT_EQ(OB_EAGAIN,
+            ObMemtableRowDelta::check_delta_write(tx_table_guard, sparse_row, *delta, ObTransID(3), scn(20), false));
+}
+
+TEST_F(TestMemtableRowDelta, convert_delta_node)
+{
+  ObTxTableGuard tx_table_guard;
+  ObMvccRow row;
+  ObMvccTransNode *base = new_node(1, NDT_NORMAL, ObDmlFlag::DF_INSERT, 1, 100, -5, 10);
+  ObMvccTransNode *other = new_node(2, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 3, NOP);
+  ObMvccTransNode *delta = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 7, -2);
+  ObMvccTransNode *node = delta;
+  append(row, base);
+  append(row, other);
+  append(row, delta);
+  base->modify_count_ = 5;
+
+  // the stale old row read by the writer before tx 1 committed
+  const int64_t old_values[COL_CNT - 1] = {1, 90, -5};
+  char *old_buf = nullptr;
+  int64_t old_len = 0;
+  write_row(ObDmlFlag::DF_UPDATE, old_values, old_buf, old_len);
+  ObRowData old_row;
+  old_row.set(old_buf, (int32_t)old_len);
+
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::convert_delta_node(tx_table_guard, allocator_, allocator_,
+                                                               row, node, old_row));
+  ASSERT_NE(delta, node);
+  ASSERT_EQ(NDT_NORMAL, node->type_);
+  ASSERT_EQ(ObTransID(3), node->tx_id_);
+  ASSERT_EQ(6U, node->modify_count_);
+  check_node_value(*node, 107, -7);
+  // the folded node takes the place right above the base, below the delta of tx 2
+  ASSERT_EQ(base, node->prev_);
+  ASSERT_EQ(node, base->next_);
+  ASSERT_EQ(other, node->next_);
+  ASSERT_EQ(node, other->prev_);
+  ASSERT_EQ(other, row.list_head_);
+  ASSERT_EQ(3, row.total_trans_node_cnt_);
+
+  // the old row is rebuilt from the folded base
+  int64_t value = 0;
+  bool is_null = false;
+  ASSERT_NE(old_buf, old_row.data_);
+  read_int(old_row.data_, old_row.size_, 1, value, is_null);
+  ASSERT_EQ(100, value);
+  read_int(old_row.data_, old_row.size_, 2, value, is_null);
+  ASSERT_EQ(-5, value);
+  read_int(old_row.data_, old_row.size_, 0, value, is_null);
+  ASSERT_EQ(1, value);
+
+  // the delta of tx 2 is folded above the converted node of tx 3, which is
+  // undecided and blocks the fold
+  ObRowData empty_old_row;
+  node = other;
+  ASSERT_EQ(OB_TX_DELTA_FOLD_BLOCKED, ObMemtableRowDelta::convert_delta_node(tx_table_guard, allocator_, allocator_,
+                                                                             row, node, empty_old_row));
+  ASSERT_EQ(other, node);
+  ASSERT_EQ(NDT_DELTA, other->type_);
+}
+
+TEST_F(TestMemtableRowDelta, convert_blocked_by_own_delta)
+{
+  ObTxTableGuard tx_table_guard;
+  ObMvccRow row;
+  ObRowData old_row;
+  append(row, new_node(1, NDT_NORMAL, ObDmlFlag::DF_INSERT, 1, 100, -5, 10));
+  ObMvccTransNode *first = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 1, NOP);
+  ObMvccTransNode *second = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 2, NOP);
+  append(row, first);
+  append(row, second);
+
+  // the older delta node of the same txn must be folded first
+  ObMvccTransNode *node = second;
+  ASSERT_EQ(OB_TX_DELTA_FOLD_BLOCKED, ObMemtableRowDelta::convert_delta_node(tx_table_guard, allocator_, allocator_,
+                                                                             row, node, old_row));
+  node = first;
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::convert_delta_node(tx_table_guard, allocator_, allocator_,
+                                                               row, node, old_row));
+  check_node_value(*node, 101, NOP);
+  // the base of the second delta is the folded node of its own txn
+  node = second;
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::convert_delta_node(tx_table_guard, allocator_, allocator_,
+                                                               row, node, old_row));
+  check_node_value(*node, 103, NOP);
+  ASSERT_EQ(node, row.list_head_);
+  ASSERT_TRUE(NULL == old_row.data_);
+}
+
+TEST_F(TestMemtableRowDelta, read_delta_node)
+{
+  ObSEArray<ObColDesc, COL_CNT> cols_desc;
+  ObTableReadInfo read_info;
+  for (int64_t i = 0; i < COL_CNT; ++i) {
+    ObColDesc col_desc;
+    col_desc.col_id_ = OB_APP_MIN_COLUMN_ID + i;
+    col_desc.col_type_.set_type(i == COL_CNT - 1 ? ObVarcharType : ObIntType);
+    col_desc.col_type_.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    ASSERT_EQ(OB_SUCCESS, cols_desc.push_back(col_desc));
+  }
+  ASSERT_EQ(OB_SUCCESS, read_info.init(allocator_, COL_CNT, ROWKEY_CNT, false, cols_desc, nullptr));
+
+  ObNopBitMap bitmap;
+  int64_t *deltas = NULL;
+  ASSERT_EQ(OB_SUCCESS, bitmap.init(COL_CNT, ROWKEY_CNT));
+  ObMvccTransNode *d1 = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 7, -2);
+  ObMvccTransNode *d2 = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 5, NOP);
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::read_delta_node(read_info, *d1, bitmap, allocator_, deltas));
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::read_delta_node(read_info, *d2, bitmap, allocator_, deltas));
+  ASSERT_TRUE(NULL != deltas);
+  ASSERT_EQ(0, deltas[0]);
+  ASSERT_EQ(12, deltas[1]);
+  ASSERT_EQ(-2, deltas[2]);
+  ASSERT_EQ(0, deltas[3]);
+
+  // the deltas are added to the base values read from the older node
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, COL_CNT));
+  row.count_ = COL_CNT;
+  row.storage_datums_[0].set_int(1);
+  row.storage_datums_[1].set_int(100);
+  row.storage_datums_[2].set_null();
+  row.storage_datums_[3].set_string("abc", 3);
+  // the base of the delta column must be read before the deltas are applied
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ObMemtableRowDelta::apply_deltas(read_info, deltas, bitmap, row));
+  for (int64_t i = ROWKEY_CNT; i < COL_CNT; ++i) {
+    bitmap.set_false(i);
+  }
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::apply_deltas(read_info, deltas, bitmap, row));
+  ASSERT_EQ(1, row.storage_datums_[0].get_int());
+  ASSERT_EQ(112, row.storage_datums_[1].get_int());
+  // NULL plus the delta is still NULL
+  ASSERT_TRUE(row.storage_datums_[2].is_null());
+
+  // the column read from the newer node skips the older delta
+  int64_t *newer_deltas = NULL;
+  ObNopBitMap newer_bitmap;
+  ASSERT_EQ(OB_SUCCESS, newer_bitmap.init(COL_CNT, ROWKEY_CNT));
+  newer_bitmap.set_false(1);
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::read_delta_node(read_info, *d1, newer_bitmap, allocator_, newer_deltas));
+  ASSERT_EQ(0, newer_deltas[1]);
+  ASSERT_EQ(-2, newer_deltas[2]);
+
+  // the accumulated delta overflows
+  int64_t *overflow_deltas = NULL;
+  ObNopBitMap overflow_bitmap;
+  ASSERT_EQ(OB_SUCCESS, overflow_bitmap.init(COL_CNT, ROWKEY_CNT));
+  ObMvccTransNode *big = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, INT64_MAX, NOP);
+  ASSERT_EQ(OB_SUCCESS, ObMemtableRowDelta::read_delta_node(read_info, *big, overflow_bitmap, allocator_, overflow_deltas));
+  ASSERT_EQ(OB_DATA_OUT_OF_RANGE, ObMemtableRowDelta::read_delta_node(read_info, *d1, overflow_bitmap, allocator_, overflow_deltas));
+}
+
+TEST_F(TestMemtableRowDelta, undo_middle_delta_node)
+{
+  ObMvccRow row;
+  ObMvccTransNode *base = new_node(1, NDT_NORMAL, ObDmlFlag::DF_INSERT, 1, 100, -5, 10);
+  ObMvccTransNode *d2 = new_node(2, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 3, NOP);
+  ObMvccTransNode *d3 = new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 4, NOP);
+  ObMvccTransNode *d4 = new_node(4, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 5, NOP);
+  append(row, base);
+  append(row, d2);
+  append(row, d3);
+  append(row, d4);
+
+  // the delta node covered by the delta nodes of other txns is unlinked
+  row.mvcc_undo(d3);
+  ASSERT_TRUE(d3->is_aborted());
+  ASSERT_EQ(d4, row.list_head_);
+  ASSERT_EQ(d2, d4->prev_);
+  ASSERT_EQ(d4, d2->next_);
+  ASSERT_EQ(3, row.total_trans_node_cnt_);
+
+  // the undo of the lowest delta node links the base to the upper one
+  row.mvcc_undo(d2);
+  ASSERT_TRUE(d2->is_aborted());
+  ASSERT_EQ(base, d4->prev_);
+  ASSERT_EQ(d4, base->next_);
+  ASSERT_EQ(2, row.total_trans_node_cnt_);
+
+  // the head node is popped
+  row.mvcc_undo(d4);
+  ASSERT_TRUE(d4->is_aborted());
+  ASSERT_EQ(base, row.list_head_);
+  ASSERT_TRUE(NULL == base->next_);
+  ASSERT_EQ(1, row.total_trans_node_cnt_);
+  ASSERT_FALSE(base->is_aborted());
+}
+
+TEST_F(TestMemtableRowDelta, wakeup_concurrent_delta_writers)
+{
+  const int64_t WRITER_CNT = 2;
+  const int64_t MAX_WAIT_US = 10 * 1000 * 1000;
+  ObTxTableGuard tx_table_guard;
+  ObMvccRow row;
+  // the base of tx 1 is undecided, so the delta nodes of tx 2 and tx 3 are blocked
+  ObMvccTransNode *base = new_node(1, NDT_NORMAL, ObDmlFlag::DF_INSERT, 1, 100, -5);
+  ObMvccTransNode *deltas[WRITER_CNT] = {new_node(2, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 3, NOP),
+                                         new_node(3, NDT_DELTA, ObDmlFlag::DF_UPDATE, 1, 4, NOP)};
+  append(row, base);
+  append(row, deltas[0]);
+  append(row, deltas[1]);
+  bool woken[WRITER_CNT] = {false, false};
+  int64_t wakeup_cnt = 0;
+  // commit the node and wakeup the delta writers above it like the row callback
+  auto commit_and_wakeup = [&](ObMvccTransNode *node, const int64_t commit_version) {
+    ObSEArray<ObTransID, ObMemtableRowDelta::MAX_WAKEUP_TX_CNT> tx_ids;
+    ObRowLatchGuard guard(row.latch_);
+    node->trans_version_.convert_for_tx(commit_version);
+    node->set_committed();
+    EXPECT_EQ(OB_SUCCESS, ObMemtableRowDelta::get_blocked_delta_txs(*node, tx_ids));
+    for (int64_t i = 0; i < tx_ids.count(); ++i) {
+      const int64_t idx = tx_ids.at(i).get_id() - 2;
+      EXPECT_TRUE(idx >= 0 && idx < WRITER_CNT);
+      if (idx >= 0 && idx < WRITER_CNT) {
+        ATOMIC_STORE(&woken[idx], true);
+        ATOMIC_INC(&wakeup_cnt);
+      }
+    }
+  };
+  // the writer only retries the fold when it is woken up, and the node
+  // allocator is only used under the row latch
+  std::vector<std::thread> writers;
+  for (int64_t i = 0; i < WRITER_CNT; ++i) {
+    writers.push_back(std::thread([&, i]() {
+      ObMvccTransNode *node = deltas[i];
+      ObRowData old_row;
+      int ret = OB_TX_DELTA_FOLD_BLOCKED;
+      bool stalled = false;
+      const int64_t start_us = ObTimeUtility::current_time();
+      while (OB_TX_DELTA_FOLD_BLOCKED == ret && !stalled) {
+        ATOMIC_STORE(&woken[i], false);
+        {
+          ObRowLatchGuard guard(row.latch_);
+          ret = ObMemtableRowDelta::convert_delta_node(tx_table_guard, allocator_, allocator_,
+                                                       row, node, old_row);
+        }
+        while (OB_TX_DELTA_FOLD_BLOCKED == ret && !ATOMIC_LOAD(&woken[i]) && !stalled) {
+          stalled = ObTimeUtility::current_time() - start_us > MAX_WAIT_US;
+          usleep(100);
+        }
+      }
+      EXPECT_FALSE(stalled) << "delta writer " << i << " is not woken up";
+      EXPECT_EQ(OB_SUCCESS, ret);
+      if (OB_SUCCESS == ret) {
+        commit_and_wakeup(node, 20 + i);
+      }
+    }));
+  }
+  usleep(10 * 1000);
+  commit_and_wakeup(base, 10);
+  for (int64_t i = 0; i < WRITER_CNT; ++i) {
+    writers.at(i).join();
+  }
+  ASSERT_GE(wakeup_cnt, WRITER_CNT);
+  // both delta nodes are folded on top of the base
+  int64_t value = 0;
+  bool is_null = false;
+  ASSERT_EQ(3, row.total_trans_node_cnt_);
+  for (ObMvccTransNode *iter = row.list_head_; NULL != iter; iter = iter->prev_) {
+    ASSERT_EQ(NDT_NORMAL, iter->type_);
+    ASSERT_TRUE(iter->is_committed());
+  }
+  const ObMemtableDataHeader *mtd = reinterpret_cast<const ObMemtableDataHeader *>(row.list_head_->buf_);
+  read_int(mtd->buf_, mtd->buf_len_, 1, value, is_null);
+  ASSERT_EQ(107, value);
+}
+
+}  // namespace unittest
+}  // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
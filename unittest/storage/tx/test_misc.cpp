@@ -113,6 +113,38 @@ TEST_F(TestObTxMisc, multiple_checksum_collapse_for_commit_log)
   }
 }
 
+TEST_F(TestObTxMisc, tx_data_mini_cache)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  storage::ObTxDataMiniCache mini_cache;
+  storage::ObTxCommitData tx_data;
+  // the tx data of the interleaved transactions are cached together
+  const int64_t TX_CNT = 16;
+  for (int64_t i = 1; i <= TX_CNT; i++) {
+    tx_data.reset();
+    tx_data.tx_id_ = ObTransID(i);
+    tx_data.state_ = storage::ObTxCommitData::COMMIT;
+    tx_data.commit_version_.convert_for_tx(100 + i);
+    mini_cache.set(tx_data);
+  }
+  for (int64_t i = 1; i <= TX_CNT; i++) {
+    EXPECT_EQ(OB_SUCCESS, mini_cache.get(ObTransID(i), tx_data));
+    EXPECT_EQ(ObTransID(i), tx_data.tx_id_);
+    EXPECT_EQ(100 + i, tx_data.commit_version_.get_val_for_tx());
+  }
+  // the tx data which is not cached or evicted can't be found
+  EXPECT_EQ(OB_TRANS_CTX_NOT_EXIST, mini_cache.get(ObTransID(TX_CNT + 100), tx_data));
+  tx_data.reset();
+  tx_data.tx_id_ = ObTransID(TX_CNT + 1);
+  tx_data.state_ = storage::ObTxCommitData::ABORT;
+  mini_cache.set(tx_data);
+  EXPECT_EQ(OB_SUCCESS, mini_cache.get(ObTransID(TX_CNT + 1), tx_data));
+  EXPECT_EQ(storage::ObTxCommitData::ABORT, tx_data.state_);
+  EXPECT_EQ(OB_TRANS_CTX_NOT_EXIST, mini_cache.get(ObTransID(1), tx_data));
+  mini_cache.reset();
+  EXPECT_EQ(OB_TRANS_CTX_NOT_EXIST, mini_cache.get(ObTransID(2), tx_data));
+}
+
 }//end of unittest
 }//end of oceanbase
 
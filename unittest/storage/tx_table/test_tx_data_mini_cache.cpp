@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#define protected public
+#define private public
+#define UNITTEST
+#include "storage/tx/ob_tx_data_define.h"
+#include "storage/tx/ob_tx_data_functor.h"
+#include "storage/tx_table/ob_tx_table.h"
+
+namespace oceanbase
+{
+using namespace ::testing;
+using namespace transaction;
+using namespace storage;
+using namespace share;
+
+static const int64_t TX_CNT = 5;
+// the tx data in the tx ctx of the tx i is ctx_tx_data[i]
+static ObTxData ctx_tx_data[TX_CNT + 1];
+static int64_t ctx_read_cnt = 0;
+
+namespace storage {
+int ObTxCtxTable::check_with_tx_data(const transaction::ObTransID tx_id, ObITxDataCheckFunctor &fn)
+{
+  int ret = OB_SUCCESS;
+  const int64_t idx = tx_id.get_id();
+  ctx_read_cnt++;
+  if (idx <= 0 || idx > TX_CNT) {
+    ret = OB_TRANS_CTX_NOT_EXIST;
+  } else {
+    ret = fn(ctx_tx_data[idx], NULL);
+  }
+  return ret;
+}
+}
+
+namespace unittest
+{
+
+class TestTxDataMiniCache : public ::testing::Test
+{
+public:
+  TestTxDataMiniCache() {}
+  virtual void SetUp() override
+  {
+    ctx_read_cnt = 0;
+    for (int64_t i = 0; i <= TX_CNT; i++) {
+      ctx_tx_data[i].reset();
+      ctx_tx_data[i].tx_id_ = ObTransID(i);
+    }
+    tx_table_.is_inited_ = true;
+    tx_table_.state_ = ObTxTable::ONLINE;
+  }
+  virtual void TearDown() override
+  {
+    tx_table_.is_inited_ = false;
+    tx_table_.state_ = ObTxTable::OFFLINE;
+  }
+  void commit(const int64_t idx)
+  {
+    ctx_tx_data[idx].commit_version_.convert_for_tx(100 + idx);
+    ctx_tx_data[idx].end_scn_.convert_for_tx(90);
+    ctx_tx_data[idx].state_ = ObTxData::COMMIT;
+  }
+protected:
+  ObTxTable tx_table_;
+};
+
+TEST_F(TestTxDataMiniCache, interleaved_scan)
+{
+  ObTxTableGuard guard;
+  ASSERT_EQ(OB_SUCCESS, tx_table_.get_tx_table_guard(guard));
+  // the rows are written by the tx 1~4 which have committed, and the tx 5 which is running
+  for (int64_t i = 1; i < TX_CNT; i++) {
+    commit(i);
+  }
+  const int64_t ROW_CNT = 100 * TX_CNT;
+  SCN scn;
+  scn.convert_for_tx(1000);
+  for (int64_t row = 0; row < ROW_CNT; row++) {
+    const int64_t idx = row % TX_CNT + 1;
+    int64_t state = ObTxData::MAX_STATE_CNT;
+    SCN trans_version;
+    ASSERT_EQ(OB_SUCCESS, guard.get_tx_state_with_scn(ObTransID(idx), scn, state, trans_version));
+    if (TX_CNT == idx) {
+      EXPECT_EQ(ObTxData::RUNNING, state);
+    } else {
+      EXPECT_EQ(ObTxData::COMMIT, state);
+      EXPECT_EQ(100 + idx, trans_version.get_val_for_tx());
+    }
+  }
+  // the committed tx is read from the ctx only once, and the running tx is read every time
+  const int64_t running_read_cnt = ROW_CNT / TX_CNT;
+  EXPECT_EQ(TX_CNT - 1 + running_read_cnt, ctx_read_cnt);
+  EXPECT_EQ(ROW_CNT - ctx_read_cnt, guard.get_mini_cache().get_hit_cnt());
+
+  // the tx 5 is cached once it commits
+  commit(TX_CNT);
+  ctx_read_cnt = 0;
+  for (int64_t row = 0; row < ROW_CNT; row++) {
+    const int64_t idx = row % TX_CNT + 1;
+    int64_t state = ObTxData::MAX_STATE_CNT;
+    SCN trans_version;
+    ASSERT_EQ(OB_SUCCESS, guard.get_tx_state_with_scn(ObTransID(idx), scn, state, trans_version));
+    EXPECT_EQ(ObTxData::COMMIT, state);
+    EXPECT_EQ(100 + idx, trans_version.get_val_for_tx());
+  }
+  EXPECT_EQ(1, ctx_read_cnt);
+  const int64_t hit_cnt = guard.get_mini_cache().get_hit_cnt();
+  EXPECT_EQ(2 * ROW_CNT - TX_CNT - running_read_cnt, hit_cnt);
+
+  // the lookups avoided by the guard are counted into the tx table
+  guard.reset();
+  EXPECT_EQ(hit_cnt, tx_table_.get_mini_cache_hit_cnt());
+  EXPECT_EQ(0, guard.get_mini_cache().get_hit_cnt());
+}
+
+TEST_F(TestTxDataMiniCache, skip_undecided_and_rollbacked)
+{
+  ObTxTableGuard guard;
+  ASSERT_EQ(OB_SUCCESS, tx_table_.get_tx_table_guard(guard));
+  SCN scn;
+  scn.convert_for_tx(1000);
+  int64_t state = ObTxData::MAX_STATE_CNT;
+  SCN trans_version;
+  // neither the elr committed tx nor the aborted tx is cached from the ctx
+  commit(1);
+  ctx_tx_data[1].state_ = ObTxData::ELR_COMMIT;
+  ctx_tx_data[2].end_scn_.convert_for_tx(90);
+  ctx_tx_data[2].state_ = ObTxData::ABORT;
+  for (int64_t i = 0; i < 3; i++) {
+    ASSERT_EQ(OB_SUCCESS, guard.get_tx_state_with_scn(ObTransID(1), scn, state, trans_version));
+    EXPECT_EQ(ObTxData::RUNNING, state);
+    ASSERT_EQ(OB_SUCCESS, guard.get_tx_state_with_scn(ObTransID(2), scn, state, trans_version));
+    EXPECT_EQ(ObTxData::ABORT, state);
+  }
+  EXPECT_EQ(6, ctx_read_cnt);
+  EXPECT_EQ(0, guard.get_mini_cache().get_hit_cnt());
+
+  // the tx data isn't cached when it is loaded with skipping the cache
+  commit(3);
+  ObTxData tx_data;
+  ASSERT_EQ(OB_SUCCESS, guard.load_tx_op(ObTransID(3), tx_data));
+  ObTxCommitData commit_data;
+  EXPECT_EQ(OB_TRANS_CTX_NOT_EXIST, guard.get_mini_cache().get(ObTransID(3), commit_data));
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_tx_data_mini_cache.log*");
+  OB_LOGGER.set_file_name("test_tx_data_mini_cache.log");
+  OB_LOGGER.set_log_level("INFO");
+  STORAGE_LOG(INFO, "begin unittest: test tx data mini cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}